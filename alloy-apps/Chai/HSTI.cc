@@ -119,14 +119,14 @@ void run_hsti(int n, int t) {
 
     if (t == 0) {
         if (n != 0) {
-            datas[n] = (size_t*)AllocNTMem(pool_size * frame_size * sizeof(size_t));
+            datas[n] = (size_t*)AllocNTMem(pool_size * frame_size * sizeof(size_t), n);
             memcpy((void*)datas[n], datas[0], pool_size * frame_size * sizeof(size_t));
             printf("node[%d] copied frames\n", n);
         }
-        hists[n] = (volatile size_t*)AllocNTMem(hist_size * sizeof(size_t) / n_nodes);
+        hists[n] = (volatile size_t*)AllocNTMem(hist_size * sizeof(size_t) / n_nodes, n);
         memset((void*)hists[n], 0, hist_size * sizeof(size_t) / n_nodes);
         printf("node[%d] allocated hist\n", n);
-        local_hists[n] = (size_t*)AllocNTMem(n_bins * sizeof(size_t));
+        local_hists[n] = (size_t*)AllocNTMem(n_bins * sizeof(size_t), n);
         memset((void*)local_hists[n], 0, n_bins * sizeof(size_t));
         printf("node[%d] allocated local hist\n", n);
     }
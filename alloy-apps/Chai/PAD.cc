@@ -93,11 +93,11 @@ void sync_wg(int n, int t, size_t r) {
 void run_pad(int n, int t) {
 
     if (t == 0) {
-        matrix[n] = (volatile size_t*)AllocNTMem(d_per_node * sizeof(size_t));
+        matrix[n] = (volatile size_t*)AllocNTMem(d_per_node * sizeof(size_t), n);
         memset((void*)matrix[n], 0, d_per_node * sizeof(size_t));
         printf("node[%d] allocated matrix\n", n);
 
-        gdbs[n] = (volatile size_t*)AllocRELMem(sizeof(size_t));
+        gdbs[n] = (volatile size_t*)AllocRELMem(sizeof(size_t), n);
         memset((void*)gdbs[n], 0, sizeof(size_t));
         printf("node[%d] allocated global doorbells\n", n);
 
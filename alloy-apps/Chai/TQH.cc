@@ -12,6 +12,7 @@
  */
 
 #include "Utils.hh"
+#include "appl-channel.h"
 
 #ifndef NO_GEM5
 #include "appl.h"
@@ -54,6 +55,7 @@ std::string input_file;
 bool test_result = false;
 size_t pool_size     = 3200;
 size_t queue_size    = 320;
+size_t queue_batch   = 1;
 size_t m             = 288;
 size_t n             = 352;
 size_t n_bins        = 256;
@@ -66,8 +68,8 @@ std::vector<volatile size_t*> hists;
 std::vector<size_t*> local_hists;
 
 std::vector<std::vector<volatile Op*>> task_queuess;
-std::vector<std::vector<volatile size_t*>> headss;
-std::vector<std::vector<volatile size_t*>> tailss;
+std::vector<std::vector<volatile uint64_t*>> headss;
+std::vector<std::vector<volatile uint64_t*>> tailss;
 
 pthread_barrier_t global_bar;
 pthread_barrier_t finish_bar;
@@ -128,49 +130,9 @@ void no_op(void) {
     return;
 }
 
-size_t calc_avail_size(size_t head, size_t tail) {
-    if (head == tail) {
-        return queue_size - 1;
-    } else if (head > tail) {
-        return head - tail - 1;
-    } else {
-        return queue_size + head - tail - 1;
-    }
-}
-
-size_t waitPush(size_t cur_tail, volatile size_t* head) {
-    size_t cur_head, avail_size;
-    do {
-        cur_head = *head;
-        avail_size = calc_avail_size(cur_head, cur_tail);
-    } while (avail_size < 1);
-    return (cur_tail + 1) % queue_size;
-}
-
-void setTail(size_t next_tail, volatile size_t* tail) {
-    *tail = next_tail;
-}
-
-size_t waitPop(size_t cur_head, volatile size_t* tail) {
-    size_t cur_tail, used;
-    do {
-        cur_tail = *tail;
-        used = queue_size - 1 - calc_avail_size(cur_head, cur_tail);
-    } while (used < 1);
-    return (cur_head + 1) % queue_size;
-}
-
-void setHead(size_t next_head, volatile size_t* head) {
-    *head = next_head;
-}
-
-void insertQueue(size_t cur_tail, volatile Op* task_queue) {
-    size_t DUMMY = 1;
-    task_queue[cur_tail].code = DUMMY;
-}
-
-Op removeQueue(size_t cur_head, volatile Op* task_queue) {
-    return Op{task_queue[cur_head].code};
+appl::ChannelMem<Op> queue_mem(int nid, int t) {
+    return appl::ChannelMem<Op>{task_queuess[nid][t], tailss[nid][t],
+                                headss[nid][t], queue_size};
 }
 
 void init_tqh() {
@@ -186,27 +148,41 @@ void run_tqh(int n, int t) {
             memcpy((void*)datas[n], datas[0], pool_size * frame_size * sizeof(size_t));
             printf("node[%d] copied frames\n", n);
         }
-        hists[n] = (volatile size_t*)AllocNTMem(hist_size * sizeof(size_t) / n_nodes);
+        hists[n] = (volatile size_t*)AllocNTMem(hist_size * sizeof(size_t) / n_nodes, n);
         memset((void*)hists[n], 0, hist_size * sizeof(size_t) / n_nodes);
         printf("node[%d] allocated hist\n", n);
-        local_hists[n] = (size_t*)AllocNTMem(n_bins * sizeof(size_t));
+        local_hists[n] = (size_t*)AllocNTMem(n_bins * sizeof(size_t), n);
         memset((void*)local_hists[n], 0, n_bins * sizeof(size_t));
         printf("node[%d] allocated local hist\n", n);
     }
 
     if (n == 0) {
         for (int nid = 1; nid < n_nodes; ++nid) {
-            headss[nid][t] = (volatile size_t*)AllocRELMem(sizeof(size_t));
+            headss[nid][t] = (volatile uint64_t*)AllocRELMem(sizeof(uint64_t), n);
             *headss[nid][t] = 0;
         }
     } else {
-        task_queuess[n][t] = (volatile Op*)AllocNTMem(queue_size * sizeof(Op));
-        tailss[n][t] = (volatile size_t*)AllocRELMem(sizeof(size_t));
+        task_queuess[n][t] = (volatile Op*)AllocNTMem(queue_size * sizeof(Op), n);
+        tailss[n][t] = (volatile uint64_t*)AllocRELMem(sizeof(uint64_t), n);
         memset((void*)task_queuess[n][t], 0, queue_size * sizeof(Op));
         *tailss[n][t] = 0;
     }
         
     pthread_barrier_wait(&global_bar);
+
+    // node 0 feeds one queue per (node, thread); the queues live on the
+    // consuming node
+    std::vector<appl::SPSCProducer<Op>> producers;
+    appl::SPSCConsumer<Op> consumer;
+    if (n == 0) {
+        producers.resize(n_nodes);
+        for (int nid = 1; nid < n_nodes; ++nid) {
+            producers[nid] = appl::SPSCProducer<Op>(queue_mem(nid, t), queue_batch);
+        }
+    } else {
+        consumer = appl::SPSCConsumer<Op>(queue_mem(n, t), queue_batch);
+    }
+
 #ifndef NO_GEM5
     if (warmup_rounds + n_rounds == 0) {
         if (n == (n_nodes - 1) && t == 0) {
@@ -216,11 +192,13 @@ void run_tqh(int n, int t) {
 #endif
 
     size_t hist_per_node = hist_size / n_nodes;
-    size_t next_head = 0;
-    size_t next_tail = 0;
     for (int r = 0; r < warmup_rounds + n_rounds; ++r) {
 
         if (r == warmup_rounds) {
+            for (auto &producer : producers) {
+                producer.flush();
+            }
+            consumer.flush();
             pthread_barrier_wait(&global_bar);
 #ifndef NO_GEM5
             if (n == (n_nodes - 1) && t == 0) {
@@ -230,17 +208,13 @@ void run_tqh(int n, int t) {
         }
 
         if (n == 0) {
+            const size_t DUMMY = 1;
             for (int nid = 1; nid < n_nodes; ++nid) {
-                size_t cur_tail = next_tail;
-                next_tail = waitPush(cur_tail, headss[nid][t]);
-                insertQueue(cur_tail, task_queuess[nid][t]);
-                setTail(next_tail, tailss[nid][t]);
+                producers[nid].push(Op{DUMMY});
             }
         } else {
-            size_t cur_head = next_head;
-            next_head = waitPop(cur_head, tailss[n][t]);
-            Op op = removeQueue(cur_head, task_queuess[n][t]);
-            setHead(next_head, headss[n][t]);
+            Op op{0};
+            consumer.pop(op);
 
 #ifdef SIM_COALEASE
             const int stride = 8;
@@ -261,6 +235,10 @@ void run_tqh(int n, int t) {
         }
     }
 
+    for (auto &producer : producers) {
+        producer.flush();
+    }
+    consumer.flush();
     pthread_barrier_wait(&global_bar);
 #ifndef NO_GEM5
     if (n == (n_nodes - 1) && t == 0) {
@@ -274,7 +252,7 @@ void run_tqh(int n, int t) {
 int main(int argc, char* argv[]) {
 
     int opt;
-    while ((opt = getopt(argc, argv, "n:c:t:v:r:w:p:b:f:")) != -1) {
+    while ((opt = getopt(argc, argv, "n:c:t:v:r:w:p:b:f:q:")) != -1) {
         switch (opt) {
             case 'n':
                 n_nodes = std::stoi(optarg);
@@ -300,6 +278,9 @@ int main(int argc, char* argv[]) {
             case 'b':
                 n_bins = std::stoi(optarg);
                 break;
+            case 'q':
+                queue_batch = std::stoi(optarg);
+                break;
             case 'f':
                 if (optarg != nullptr) {
                     input_file = std::string(optarg);
@@ -321,6 +302,7 @@ int main(int argc, char* argv[]) {
 
     assert(n_threads <= n_cores);
     assert((hist_size % n_nodes) == 0);
+    assert(queue_batch >= 1 && queue_batch <= queue_size);
 
     datas.resize(n_nodes);
     hists.resize(n_nodes);
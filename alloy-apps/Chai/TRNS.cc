@@ -85,11 +85,11 @@ void init_trns() {
 void run_trns(int n, int t) {
 
     if (t == 0) {
-        matrix[n] = (volatile element_t*)AllocNTMem(d_per_node * sizeof(element_t));
+        matrix[n] = (volatile element_t*)AllocNTMem(d_per_node * sizeof(element_t), n);
         memset((void*)matrix[n], 0, d_per_node * sizeof(element_t));
         printf("node[%d] allocated matrix\n", n);
 
-        flag[n] = (volatile flag_t*)AllocRELMem(d_per_node * sizeof(flag_t));
+        flag[n] = (volatile flag_t*)AllocRELMem(d_per_node * sizeof(flag_t), n);
         memset((void*)matrix[n], 0, d_per_node * sizeof(flag_t));
         printf("node[%d] allocated flag\n", n);
     }
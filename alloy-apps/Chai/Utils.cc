@@ -31,28 +31,26 @@ void* AllocREGMem(size_t count) {
     return ret;
 }
 
-void* AllocNTMem(size_t count) {
-    void* ret = mmap(NULL, count, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
-    if (ret == MAP_FAILED) {
-        std::cerr << "Error: mmap" << std::endl;
-        return nullptr;
-    }
+void* AllocNTMem(size_t count, int node) {
 #ifndef NO_GEM5
-    appl::register_stnt((uint64_t)ret, (uint64_t)ret + count);
-#endif
+    void* ret = appl::alloc_nt(count, node);
+    if (!ret)
+        std::cerr << "Error: mmap" << std::endl;
     return ret;
+#else
+    return AllocREGMem(count);
+#endif
 }
 
-void* AllocRELMem(size_t count) {
-    void* ret = mmap(NULL, count, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
-    if (ret == MAP_FAILED) {
-        std::cerr << "Error: mmap" << std::endl;
-        return nullptr;
-    }
+void* AllocRELMem(size_t count, int node) {
 #ifndef NO_GEM5
-    appl::register_strel((uint64_t)ret, (uint64_t)ret + count);
-#endif
+    void* ret = appl::alloc_rel(count, node);
+    if (!ret)
+        std::cerr << "Error: mmap" << std::endl;
     return ret;
+#else
+    return AllocREGMem(count);
+#endif
 }
 
 void BuildCSR(const std::string filename,
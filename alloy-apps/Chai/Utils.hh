@@ -29,5 +29,7 @@ void BuildCSR(const std::string filename,
               size_t* col_idx);
 
 void* AllocREGMem(size_t count);
-void* AllocNTMem(size_t count);
-void* AllocRELMem(size_t count);
\ No newline at end of file
+// node is the node of the calling thread; with node >= 0 small regions
+// share one registered DO range per node, see appl::alloc_nt
+void* AllocNTMem(size_t count, int node = -1);
+void* AllocRELMem(size_t count, int node = -1);
\ No newline at end of file
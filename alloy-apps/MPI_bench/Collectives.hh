@@ -22,6 +22,10 @@
 #include <iostream>
 #include <chrono>
 
+#ifndef NO_GEM5
+#include "appl.h"
+#endif
+
 using wordT = uint64_t;
 const size_t CACHE_LINE_SIZE = 64;
 volatile char* SEND_DUMMY = (volatile char*)(-1);
@@ -37,12 +41,11 @@ void Add(volatile T* A, volatile T* B, size_t count) {
     }
 }
 
-inline void Send(volatile char* send_buf,
-                 volatile char* recv_buf,
-                 volatile wordT* doorbell,
-                 size_t count,
-                 wordT doorbellVal,
-                 int stride_in_word) {
+// Send without the doorbell, for messages gathered from several blocks.
+inline void Put(volatile char* send_buf,
+                volatile char* recv_buf,
+                size_t count,
+                int stride_in_word) {
     assert(count % sizeof(wordT) == 0);
     count /= sizeof(wordT);
     volatile wordT* recv_buf_word = (volatile wordT*)recv_buf;
@@ -56,6 +59,15 @@ inline void Send(volatile char* send_buf,
             recv_buf_word[i] = ((wordT*)send_buf)[i];
         }
     }
+}
+
+inline void Send(volatile char* send_buf,
+                 volatile char* recv_buf,
+                 volatile wordT* doorbell,
+                 size_t count,
+                 wordT doorbellVal,
+                 int stride_in_word) {
+    Put(send_buf, recv_buf, count, stride_in_word);
     *doorbell = doorbellVal;
 }
 
@@ -64,7 +76,11 @@ inline bool WaitDoorbellNb(volatile wordT* doorbell, wordT doorbellVal) {
 }
 
 inline void WaitDoorbell(volatile wordT* doorbell, wordT doorbellVal) {
+#ifdef NO_GEM5
     while (*doorbell != doorbellVal);
+#else
+    appl::wait_until_eq(doorbell, doorbellVal);
+#endif
 }
 
 inline void SetDoorbell(volatile wordT* doorbell, wordT doorbellVal) {
@@ -320,4 +336,488 @@ bool ReduceBinaryTree(std::vector<volatile char*> &input_bufs,
     }
 
     return true;
-}
\ No newline at end of file
+}
+//------------------------------------------------------------------------
+// Log-step collectives
+//------------------------------------------------------------------------
+// Node n owns CollSlots(num_nodes) receive slots. Slot s is the NT buffer
+// recv_bufss[n][s] (count bytes), the REL doorbell doorbellss[n][s] that
+// the sender rings with the round, and the REL flag emptyss[n][s] that n
+// sets to the round once the slot may be written. A node only frees the
+// slots it receives on in that call, and every slot has a single sender
+// per call. Slots [0, L) carry the reduction steps, [L, 2L) the allgather
+// steps, and the last two the fold/unfold of the nodes beyond the largest
+// power of two (or the broadcast).
+
+inline int CollCeilLog2(int n) {
+    int l = 0;
+    while ((1 << l) < n) {
+        ++l;
+    }
+    return l;
+}
+
+inline int CollSlots(int num_nodes) {
+    return 2 * CollCeilLog2(num_nodes) + 2;
+}
+
+inline int CollFoldSlot(int num_nodes) {
+    return 2 * CollCeilLog2(num_nodes);
+}
+
+inline int CollUnfoldSlot(int num_nodes) {
+    return 2 * CollCeilLog2(num_nodes) + 1;
+}
+
+inline void WaitDoorbellAtLeast(volatile wordT* doorbell, wordT doorbellVal) {
+    while (*doorbell < doorbellVal);
+}
+
+// Sends into slot `slot` of node `to` once `to` has freed it. dst is the
+// slot's buffer, or the final location of the data when it can be written
+// in place.
+inline void SendSlot(volatile char* send_buf,
+                     volatile char* dst,
+                     std::vector<std::vector<volatile wordT*>> &doorbellss,
+                     std::vector<std::vector<volatile wordT*>> &emptyss,
+                     int to, int slot, size_t count,
+                     int round, int stride_in_word) {
+    WaitDoorbell(emptyss[to][slot], round);
+    Send(send_buf, dst, doorbellss[to][slot], count, round, stride_in_word);
+}
+
+// Nodes [0, 2 * rem) pair up so that a power of two of them is left: the
+// even one hands its vector to the odd one and sits out (returns -1).
+// Otherwise returns the node's rank among the remaining ones.
+template <typename T>
+int CollFold(std::vector<volatile char*> &input_bufs,
+             std::vector<std::vector<volatile char*>> &recv_bufss,
+             std::vector<std::vector<volatile wordT*>> &doorbellss,
+             std::vector<std::vector<volatile wordT*>> &emptyss,
+             size_t count, int nid, int num_nodes, int p2,
+             bool apply_op, int stride_in_word, int round) {
+    int rem = num_nodes - p2;
+    int slot = CollFoldSlot(num_nodes);
+    if (nid >= 2 * rem) {
+        return nid - rem;
+    }
+    if (nid % 2 == 0) {
+        SetDoorbell(emptyss[nid][CollUnfoldSlot(num_nodes)], round);
+        SendSlot(apply_op ? input_bufs[nid] : SEND_DUMMY,
+                 recv_bufss[nid + 1][slot], doorbellss, emptyss,
+                 nid + 1, slot, count, round, stride_in_word);
+        return -1;
+    }
+    SetDoorbell(emptyss[nid][slot], round);
+    WaitDoorbell(doorbellss[nid][slot], round);
+    if (apply_op) {
+        Add<T>(reinterpret_cast<volatile T*>(recv_bufss[nid][slot]),
+               reinterpret_cast<volatile T*>(input_bufs[nid]), count);
+    }
+    return nid / 2;
+}
+
+// Hands the result back to the nodes that sat out in CollFold.
+inline void CollUnfold(std::vector<volatile char*> &input_bufs,
+                       std::vector<std::vector<volatile char*>> &recv_bufss,
+                       std::vector<std::vector<volatile wordT*>> &doorbellss,
+                       std::vector<std::vector<volatile wordT*>> &emptyss,
+                       size_t count, int nid, int num_nodes, int p2,
+                       bool apply_op, int stride_in_word, int round) {
+    int rem = num_nodes - p2;
+    int slot = CollUnfoldSlot(num_nodes);
+    if (nid >= 2 * rem) {
+        return;
+    }
+    if (nid % 2 == 0) {
+        WaitDoorbell(doorbellss[nid][slot], round);
+    } else {
+        SendSlot(apply_op ? input_bufs[nid] : SEND_DUMMY,
+                 apply_op ? input_bufs[nid - 1] : recv_bufss[nid - 1][slot],
+                 doorbellss, emptyss, nid - 1, slot, count,
+                 round, stride_in_word);
+    }
+}
+
+inline int CollRealRank(int newrank, int rem) {
+    return newrank < rem ? newrank * 2 + 1 : newrank + rem;
+}
+
+inline int CollPow2Floor(int n) {
+    int p2 = 1;
+    while (p2 * 2 <= n) {
+        p2 *= 2;
+    }
+    return p2;
+}
+
+// log2(N) steps, each exchanging the whole vector with the node whose
+// rank differs in one bit. Best while latency dominates.
+template <typename T>
+bool AllReduceRecursiveDoubling(std::vector<volatile char*> &input_bufs,
+                   std::vector<std::vector<volatile char*>> &recv_bufss,
+                   std::vector<std::vector<volatile wordT*>> &doorbellss,
+                   std::vector<std::vector<volatile wordT*>> &emptyss,
+                   size_t count, int nid, int num_nodes,
+                   bool apply_op, int stride_in_word, int round) {
+    int p2 = CollPow2Floor(num_nodes);
+    int rem = num_nodes - p2;
+
+    int newrank = CollFold<T>(input_bufs, recv_bufss, doorbellss, emptyss,
+                              count, nid, num_nodes, p2,
+                              apply_op, stride_in_word, round);
+    if (newrank >= 0) {
+        int k = 0;
+        for (int mask = 1; mask < p2; mask <<= 1, ++k) {
+            SetDoorbell(emptyss[nid][k], round);
+        }
+        k = 0;
+        for (int mask = 1; mask < p2; mask <<= 1, ++k) {
+            int partner = CollRealRank(newrank ^ mask, rem);
+            SendSlot(apply_op ? input_bufs[nid] : SEND_DUMMY,
+                     recv_bufss[partner][k], doorbellss, emptyss,
+                     partner, k, count, round, stride_in_word);
+            WaitDoorbell(doorbellss[nid][k], round);
+            if (apply_op) {
+                Add<T>(reinterpret_cast<volatile T*>(recv_bufss[nid][k]),
+                       reinterpret_cast<volatile T*>(input_bufs[nid]), count);
+            }
+        }
+    }
+
+    CollUnfold(input_bufs, recv_bufss, doorbellss, emptyss, count,
+               nid, num_nodes, p2, apply_op, stride_in_word, round);
+    return true;
+}
+
+// Rabenseifner: reduce-scatter by recursive halving, then allgather by
+// recursive doubling. 2 log2(N) steps but only about twice the vector on
+// the wire, so it takes over from recursive doubling for larger vectors.
+template <typename T>
+bool AllReduceRabenseifner(std::vector<volatile char*> &input_bufs,
+                   std::vector<std::vector<volatile char*>> &recv_bufss,
+                   std::vector<std::vector<volatile wordT*>> &doorbellss,
+                   std::vector<std::vector<volatile wordT*>> &emptyss,
+                   size_t count, int nid, int num_nodes,
+                   bool apply_op, int stride_in_word, int round) {
+    int p2 = CollPow2Floor(num_nodes);
+    int rem = num_nodes - p2;
+    int log_p2 = CollCeilLog2(p2);
+    assert(count % (sizeof(wordT) * p2) == 0);
+
+    int newrank = CollFold<T>(input_bufs, recv_bufss, doorbellss, emptyss,
+                              count, nid, num_nodes, p2,
+                              apply_op, stride_in_word, round);
+    if (newrank >= 0) {
+        for (int k = 0; k < 2 * log_p2; ++k) {
+            SetDoorbell(emptyss[nid][k], round);
+        }
+
+        volatile char* input_buf = input_bufs[nid];
+        size_t lo = 0, len = count;
+        int k = 0;
+        for (int mask = 1; mask < p2; mask <<= 1, ++k) {
+            int partner_new = newrank ^ mask;
+            int partner = CollRealRank(partner_new, rem);
+            size_t half = len / 2;
+            size_t send_off = newrank < partner_new ? lo + half : lo;
+            size_t keep_off = newrank < partner_new ? lo : lo + half;
+
+            SendSlot(apply_op ? (input_buf + send_off) : SEND_DUMMY,
+                     recv_bufss[partner][k], doorbellss, emptyss,
+                     partner, k, half, round, stride_in_word);
+            WaitDoorbell(doorbellss[nid][k], round);
+            if (apply_op) {
+                Add<T>(reinterpret_cast<volatile T*>(recv_bufss[nid][k]),
+                       reinterpret_cast<volatile T*>(input_buf + keep_off),
+                       half);
+            }
+            lo = keep_off;
+            len = half;
+        }
+
+        // the partner of each step gave this node's block away in the
+        // mirrored halving step, so blocks are written in place
+        for (int mask = p2 >> 1; mask > 0; mask >>= 1) {
+            --k;
+            int partner_new = newrank ^ mask;
+            int partner = CollRealRank(partner_new, rem);
+            int slot = log_p2 + k;
+
+            SendSlot(apply_op ? (input_buf + lo) : SEND_DUMMY,
+                     apply_op ? (input_bufs[partner] + lo)
+                              : recv_bufss[partner][slot],
+                     doorbellss, emptyss, partner, slot, len,
+                     round, stride_in_word);
+            WaitDoorbell(doorbellss[nid][slot], round);
+            if (newrank > partner_new) {
+                lo -= len;
+            }
+            len *= 2;
+        }
+    }
+
+    CollUnfold(input_bufs, recv_bufss, doorbellss, emptyss, count,
+               nid, num_nodes, p2, apply_op, stride_in_word, round);
+    return true;
+}
+
+// Binomial tree rooted at root: at step k a node whose relative rank has
+// bit k set sends its partial result to rank - 2^k and is done.
+template <typename T>
+bool ReduceBinomialTree(std::vector<volatile char*> &input_bufs,
+                   std::vector<std::vector<volatile char*>> &recv_bufss,
+                   std::vector<std::vector<volatile wordT*>> &doorbellss,
+                   std::vector<std::vector<volatile wordT*>> &emptyss,
+                   size_t count, int root, int nid, int num_nodes,
+                   bool apply_op, int stride_in_word, int round) {
+    int rel = (nid - root + num_nodes) % num_nodes;
+
+    int k = 0;
+    for (int mask = 1; mask < num_nodes && !(rel & mask); mask <<= 1, ++k) {
+        if (rel + mask < num_nodes) {
+            SetDoorbell(emptyss[nid][k], round);
+        }
+    }
+
+    k = 0;
+    for (int mask = 1; mask < num_nodes; mask <<= 1, ++k) {
+        if (rel & mask) {
+            int parent = (rel - mask + root) % num_nodes;
+            SendSlot(apply_op ? input_bufs[nid] : SEND_DUMMY,
+                     recv_bufss[parent][k], doorbellss, emptyss,
+                     parent, k, count, round, stride_in_word);
+            break;
+        }
+        if (rel + mask < num_nodes) {
+            WaitDoorbell(doorbellss[nid][k], round);
+            if (apply_op) {
+                Add<T>(reinterpret_cast<volatile T*>(recv_bufss[nid][k]),
+                       reinterpret_cast<volatile T*>(input_bufs[nid]), count);
+            }
+        }
+    }
+    return true;
+}
+
+// Binomial tree broadcast of root's vector, written in place into every
+// node's input buffer.
+inline bool BroadcastBinomialTree(std::vector<volatile char*> &input_bufs,
+                   std::vector<std::vector<volatile char*>> &recv_bufss,
+                   std::vector<std::vector<volatile wordT*>> &doorbellss,
+                   std::vector<std::vector<volatile wordT*>> &emptyss,
+                   size_t count, int root, int nid, int num_nodes,
+                   bool apply_op, int stride_in_word, int round) {
+    int rel = (nid - root + num_nodes) % num_nodes;
+    int slot = CollUnfoldSlot(num_nodes);
+
+    int mask = 1;
+    while (mask < num_nodes && !(rel & mask)) {
+        mask <<= 1;
+    }
+    if (rel != 0) {
+        SetDoorbell(emptyss[nid][slot], round);
+        WaitDoorbell(doorbellss[nid][slot], round);
+    }
+
+    for (mask >>= 1; mask > 0; mask >>= 1) {
+        if (rel + mask < num_nodes) {
+            int child = (rel + mask + root) % num_nodes;
+            SendSlot(apply_op ? input_bufs[nid] : SEND_DUMMY,
+                     apply_op ? input_bufs[child] : recv_bufss[child][slot],
+                     doorbellss, emptyss, child, slot, count,
+                     round, stride_in_word);
+        }
+    }
+    return true;
+}
+
+template <typename T>
+bool AllReduceBinomialTree(std::vector<volatile char*> &input_bufs,
+                   std::vector<std::vector<volatile char*>> &recv_bufss,
+                   std::vector<std::vector<volatile wordT*>> &doorbellss,
+                   std::vector<std::vector<volatile wordT*>> &emptyss,
+                   size_t count, int nid, int num_nodes,
+                   bool apply_op, int stride_in_word, int round) {
+    ReduceBinomialTree<T>(input_bufs, recv_bufss, doorbellss, emptyss,
+                          count, 0, nid, num_nodes,
+                          apply_op, stride_in_word, round);
+    return BroadcastBinomialTree(input_bufs, recv_bufss, doorbellss, emptyss,
+                                 count, 0, nid, num_nodes,
+                                 apply_op, stride_in_word, round);
+}
+
+// Below this many bytes the allreduce is latency-bound and recursive
+// doubling's log2(N) steps win; above it Rabenseifner's smaller volume
+// does. AllReduceRing stays the choice for very large vectors, but it
+// uses its own buffers, so it is picked by the caller.
+const size_t ALLREDUCE_SHORT_MSG = 2048;
+
+template <typename T>
+bool AllReduce(std::vector<volatile char*> &input_bufs,
+               std::vector<std::vector<volatile char*>> &recv_bufss,
+               std::vector<std::vector<volatile wordT*>> &doorbellss,
+               std::vector<std::vector<volatile wordT*>> &emptyss,
+               size_t count, int nid, int num_nodes,
+               bool apply_op, int stride_in_word, int round) {
+    int p2 = CollPow2Floor(num_nodes);
+    if (count < ALLREDUCE_SHORT_MSG ||
+        count % (sizeof(wordT) * p2) != 0) {
+        return AllReduceRecursiveDoubling<T>(input_bufs, recv_bufss,
+                                             doorbellss, emptyss, count,
+                                             nid, num_nodes, apply_op,
+                                             stride_in_word, round);
+    }
+    return AllReduceRabenseifner<T>(input_bufs, recv_bufss, doorbellss,
+                                    emptyss, count, nid, num_nodes,
+                                    apply_op, stride_in_word, round);
+}
+
+// Dissemination barrier: at step k signal node + 2^k and wait for
+// node - 2^k. Only the doorbells are used; a node may already be signalled
+// for the next round, hence the >= wait.
+inline void DisseminationBarrier(
+        std::vector<std::vector<volatile wordT*>> &doorbellss,
+        int nid, int num_nodes, int round) {
+    int k = 0;
+    for (int dist = 1; dist < num_nodes; dist <<= 1, ++k) {
+        SetDoorbell(doorbellss[(nid + dist) % num_nodes][k], round);
+        WaitDoorbellAtLeast(doorbellss[nid][k], round);
+    }
+}
+
+// The alltoalls below move one `count` byte block from every node to every
+// other: block j of input_bufs[nid] goes to node j and block i of
+// output_bufs[nid] comes from node i. Messages land in two receive slots
+// per node, recv_bufss[nid][step & 1], so a sender can fill the next slot
+// while the previous one is still being unpacked. Doorbells and empty
+// flags are per step (AllToAllSteps of them per node) because the peer
+// changes every step.
+
+inline int AllToAllSteps(int num_nodes) {
+    return num_nodes > 1 ? num_nodes - 1 : 1;
+}
+
+// Bytes per receive slot: Bruck sends up to ceil(N/2) blocks per step.
+inline size_t AllToAllSlotSize(size_t count, int num_nodes) {
+    return count * ((num_nodes + 1) / 2);
+}
+
+inline void CopyWords(volatile char* src, volatile char* dst, size_t count) {
+    assert(count % sizeof(wordT) == 0);
+    count /= sizeof(wordT);
+    for (size_t i = 0; i < count; ++i) {
+        ((volatile wordT*)dst)[i] = ((volatile wordT*)src)[i];
+    }
+}
+
+inline void SwapWords(volatile char* a, volatile char* b, size_t count) {
+    assert(count % sizeof(wordT) == 0);
+    count /= sizeof(wordT);
+    for (size_t i = 0; i < count; ++i) {
+        wordT tmp = ((volatile wordT*)a)[i];
+        ((volatile wordT*)a)[i] = ((volatile wordT*)b)[i];
+        ((volatile wordT*)b)[i] = tmp;
+    }
+}
+
+// Bruck: rotate so that block k is the one for node nid + k, then in step
+// k forward every block whose index has bit k set to node nid + 2^k. After
+// ceil(log2(N)) steps block k holds the data from node nid - k. Each block
+// crosses the network up to log2(N) times, so this is for small blocks.
+template <typename T>
+bool AllToAllBruck(std::vector<volatile char*> &input_bufs,
+                   std::vector<volatile char*> &output_bufs,
+                   std::vector<std::vector<volatile char*>> &recv_bufss,
+                   std::vector<std::vector<volatile wordT*>> &doorbellss,
+                   std::vector<std::vector<volatile wordT*>> &emptyss,
+                   size_t count, int nid, int num_nodes,
+                   bool apply_op, int stride_in_word, int round) {
+    volatile char* in = input_bufs[nid];
+    volatile char* out = output_bufs[nid];
+
+    if (apply_op) {
+        for (int k = 0; k < num_nodes; ++k) {
+            CopyWords(in + count * ((nid + k) % num_nodes), out + count * k, count);
+        }
+    }
+
+    int k = 0;
+    for (int dist = 1; dist < num_nodes; dist <<= 1, ++k) {
+        int to = (nid + dist) % num_nodes;
+        int slot = k & 1;
+        SetDoorbell(emptyss[nid][k], round);
+
+        WaitDoorbell(emptyss[to][k], round);
+        volatile char* dst = recv_bufss[to][slot];
+        for (int b = dist; b < num_nodes; ++b) {
+            if (b & dist) {
+                Put(apply_op ? (out + count * b) : SEND_DUMMY, dst, count, stride_in_word);
+                dst += count;
+            }
+        }
+        SetDoorbell(doorbellss[to][k], round);
+
+        WaitDoorbell(doorbellss[nid][k], round);
+        if (apply_op) {
+            volatile char* src = recv_bufss[nid][slot];
+            for (int b = dist; b < num_nodes; ++b) {
+                if (b & dist) {
+                    CopyWords(src, out + count * b, count);
+                    src += count;
+                }
+            }
+        }
+    }
+
+    // block k goes to position nid - k; the map is its own inverse
+    if (apply_op) {
+        for (int k = 0; k < num_nodes; ++k) {
+            int pos = (nid - k + num_nodes) % num_nodes;
+            if (k < pos) {
+                SwapWords(out + count * k, out + count * pos, count);
+            }
+        }
+    }
+    return true;
+}
+
+// Pairwise exchange: N-1 steps, each node sending one block to and
+// receiving one block from a single peer. With a power-of-two N the peer
+// is nid ^ step, so every step is a perfect matching; otherwise step s
+// sends to nid + s and receives from nid - s. Each block crosses the
+// network once, so this is for large blocks.
+template <typename T>
+bool AllToAllPairwise(std::vector<volatile char*> &input_bufs,
+                      std::vector<volatile char*> &output_bufs,
+                      std::vector<std::vector<volatile char*>> &recv_bufss,
+                      std::vector<std::vector<volatile wordT*>> &doorbellss,
+                      std::vector<std::vector<volatile wordT*>> &emptyss,
+                      size_t count, int nid, int num_nodes,
+                      bool apply_op, int stride_in_word, int round) {
+    volatile char* in = input_bufs[nid];
+    volatile char* out = output_bufs[nid];
+    bool pow2 = (num_nodes & (num_nodes - 1)) == 0;
+
+    if (apply_op) {
+        CopyWords(in + count * nid, out + count * nid, count);
+    }
+
+    for (int step = 1; step < num_nodes; ++step) {
+        int k = step - 1;
+        int slot = k & 1;
+        int to = pow2 ? (nid ^ step) : (nid + step) % num_nodes;
+        int from = pow2 ? (nid ^ step) : (nid - step + num_nodes) % num_nodes;
+        SetDoorbell(emptyss[nid][k], round);
+
+        SendSlot(apply_op ? (in + count * to) : SEND_DUMMY,
+                 recv_bufss[to][slot], doorbellss, emptyss,
+                 to, k, count, round, stride_in_word);
+
+        WaitDoorbell(doorbellss[nid][k], round);
+        if (apply_op) {
+            CopyWords(recv_bufss[nid][slot], out + count * from, count);
+        }
+    }
+    return true;
+}
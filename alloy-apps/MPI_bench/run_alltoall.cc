@@ -18,6 +18,7 @@
 #endif
 
 #include <thread>
+#include <string>
 #include <cstring>
 #include <pthread.h>
 #include <cassert>
@@ -34,11 +35,18 @@ int stride_in_word = 1;
 bool test_result = false;
 int root_nid = 0;
 bool inter_round_bar = true;
+// linear (AllToAllLinear, every node sends the same block to all others),
+// bruck (AllToAllBruck) or pairwise (AllToAllPairwise)
+std::string algorithm = "linear";
 
 std::vector<std::vector<volatile char*>> datass;
 std::vector<std::vector<std::vector<volatile char*>>> recv_bufsss;
 std::vector<std::vector<std::vector<volatile wordT*>>> doorbellsss;
 std::vector<std::vector<std::vector<volatile wordT*>>> donesss;
+std::vector<std::vector<volatile char*>> outss;
+std::vector<std::vector<std::vector<volatile char*>>> a2a_bufsss;
+std::vector<std::vector<std::vector<volatile wordT*>>> a2a_doorbellsss;
+std::vector<std::vector<std::vector<volatile wordT*>>> a2a_emptysss;
 
 pthread_barrier_t global_bar;
 pthread_barrier_t finish_bar;
@@ -48,27 +56,102 @@ void no_op(void) {
     return;
 }
 
+// buffers of AllToAllBruck and AllToAllPairwise: N blocks in and out, two
+// receive slots and a doorbell and empty flag per step
+void alloc_a2a_bufs(int n, size_t data_buf_size) {
+    size_t slot_size = AllToAllSlotSize(data_buf_size, n_nodes);
+    size_t flag_size = CACHE_LINE_SIZE;
+    int n_steps = AllToAllSteps(n_nodes);
+
+    outss[0][n] = (char*)mmap(NULL, data_buf_size * n_nodes * n_threads, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+    if (outss[0][n] == MAP_FAILED) {
+        std::cerr << "Error: mmap failed for out buf nid:" << n << std::endl;
+        return;
+    }
+    memset((void*)outss[0][n], 0, data_buf_size * n_nodes * n_threads);
+
+    volatile char* bufs = (char*)mmap(NULL, slot_size * 2 * n_threads, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+    if (bufs == MAP_FAILED) {
+        std::cerr << "Error: mmap failed for recv buf nid:" << n << std::endl;
+        return;
+    }
+#ifndef NO_GEM5
+    appl::register_stnt((uint64_t)bufs, ((uint64_t)bufs) + slot_size * 2 * n_threads);
+#endif
+    memset((void*)bufs, 0, slot_size * 2 * n_threads);
+
+    volatile wordT* doorbells = (wordT*)mmap(NULL, flag_size * n_steps * n_threads, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+    if (doorbells == MAP_FAILED) {
+        std::cerr << "Error: mmap failed for doorbell nid:" << n << std::endl;
+        return;
+    }
+#ifndef NO_GEM5
+    appl::register_strel((uint64_t)doorbells, ((uint64_t)doorbells) + flag_size * n_steps * n_threads);
+#endif
+    memset((void*)doorbells, 0, flag_size * n_steps * n_threads);
+
+    volatile wordT* emptys = (wordT*)mmap(NULL, flag_size * n_steps * n_threads, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+    if (emptys == MAP_FAILED) {
+        std::cerr << "Error: mmap failed for empty nid:" << n << std::endl;
+        return;
+    }
+#ifndef NO_GEM5
+    appl::register_strel((uint64_t)emptys, ((uint64_t)emptys) + flag_size * n_steps * n_threads);
+#endif
+    memset((void*)emptys, 0, flag_size * n_steps * n_threads);
+
+    for (int tid = 0; tid < n_threads; ++tid) {
+        outss[tid][n] = outss[0][n] + data_buf_size * n_nodes * tid;
+        a2a_bufsss[tid][n].resize(2);
+        a2a_bufsss[tid][n][0] = bufs + slot_size * tid * 2;
+        a2a_bufsss[tid][n][1] = bufs + slot_size * (tid * 2 + 1);
+        a2a_doorbellsss[tid][n].resize(n_steps);
+        a2a_emptysss[tid][n].resize(n_steps);
+        for (int k = 0; k < n_steps; ++k) {
+            a2a_doorbellsss[tid][n][k] = doorbells + flag_size * (tid * n_steps + k) / sizeof(wordT);
+            a2a_emptysss[tid][n][k] = emptys + flag_size * (tid * n_steps + k) / sizeof(wordT);
+        }
+    }
+}
+
 void run_alltoall(int n, int t) {
     if (t == 0) {
         size_t data_buf_size = n_size * sizeof(float);
         size_t recv_buf_size = data_buf_size;
         size_t flag_size = CACHE_LINE_SIZE;
 
-        datass[t][n] = (char*)mmap(NULL, data_buf_size * n_threads, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+        // the linear alltoall sends the same block to every node
+        size_t n_blocks = (algorithm == "linear") ? 1 : n_nodes;
+
+        datass[t][n] = (char*)mmap(NULL, data_buf_size * n_blocks * n_threads, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
         if (datass[t][n] == MAP_FAILED) {
             std::cerr << "Error: mmap failed for data buf nid:" << n << std::endl;
             return;
         }
-        memset((void*)datass[t][n], 0, data_buf_size * n_threads);
+        memset((void*)datass[t][n], 0, data_buf_size * n_blocks * n_threads);
         
         if (test_result) {
             volatile float* data_flt = reinterpret_cast<volatile float*>(datass[t][n]);
-            for (int j = 0; j < n_size * n_threads; ++j) {
-                data_flt[j] = 1.0 * (float)(j + 1);
+            if (algorithm == "linear") {
+                for (int j = 0; j < n_size * n_threads; ++j) {
+                    data_flt[j] = 1.0 * (float)(j + 1);
+                }
+            } else {
+                // block for node j holds n * n_nodes + j + 1
+                for (int j = 0; j < n_size * n_nodes * n_threads; ++j) {
+                    data_flt[j] = 1.0 * (float)(n * n_nodes + (j / n_size) % n_nodes + 1);
+                }
+            }
+        }
+
+        if (algorithm != "linear") {
+            alloc_a2a_bufs(n, data_buf_size);
+            for (int tid = 1; tid < n_threads; ++tid) {
+                datass[tid][n] = datass[0][n] + data_buf_size * n_nodes * tid;
             }
         }
 
-        for (int nid = 0; nid < n_nodes; ++nid) {
+        for (int nid = 0; nid < n_nodes && algorithm == "linear"; ++nid) {
             if (nid == n)
                 continue;
 
@@ -113,24 +196,36 @@ void run_alltoall(int n, int t) {
 
     int r;
     for (r = 0; r < warmup_rounds + n_rounds; ++r) {
-#ifndef NO_GEM5
         pthread_barrier_wait(&global_bar);
+#ifndef NO_GEM5
         if (r == warmup_rounds) {
             if (n == (n_nodes - 1) && t == 0) {
                 appl::start_stats();
             }
         }
 #endif
-        AllToAllLinear<float>(datass[t],
-                            recv_bufsss[t],
-                            doorbellsss[t],
-                            donesss[t],
-                            n_size * sizeof(float),
-                            n,
-                            n_nodes,
-                            test_result,
-                            stride_in_word,
-                            r + 1);
+        if (algorithm == "linear") {
+            AllToAllLinear<float>(datass[t],
+                                recv_bufsss[t],
+                                doorbellsss[t],
+                                donesss[t],
+                                n_size * sizeof(float),
+                                n,
+                                n_nodes,
+                                test_result,
+                                stride_in_word,
+                                r + 1);
+        } else if (algorithm == "bruck") {
+            AllToAllBruck<float>(datass[t], outss[t], a2a_bufsss[t],
+                                a2a_doorbellsss[t], a2a_emptysss[t],
+                                n_size * sizeof(float), n, n_nodes,
+                                test_result, stride_in_word, r + 1);
+        } else {
+            AllToAllPairwise<float>(datass[t], outss[t], a2a_bufsss[t],
+                                a2a_doorbellsss[t], a2a_emptysss[t],
+                                n_size * sizeof(float), n, n_nodes,
+                                test_result, stride_in_word, r + 1);
+        }
         
         if (inter_round_bar) {
             pthread_barrier_wait(&global_bar);
@@ -150,7 +245,7 @@ void run_alltoall(int n, int t) {
 int main(int argc, char* argv[]) {
 
     int opt;
-    while ((opt = getopt(argc, argv, "n:c:t:f:v:r:w:s:b:")) != -1) {
+    while ((opt = getopt(argc, argv, "n:c:t:f:v:r:w:s:b:a:")) != -1) {
         switch (opt) {
             case 'n':
                 n_nodes = std::stoi(optarg);
@@ -180,6 +275,9 @@ int main(int argc, char* argv[]) {
             case 'b':
                 inter_round_bar = std::stoi(optarg);
                 break;
+            case 'a':
+                algorithm = std::string(optarg);
+                break;
             default:
                 std::cerr << "Usage: " << argv[0] << "..." << std::endl;
                 return 1;
@@ -187,6 +285,7 @@ int main(int argc, char* argv[]) {
     }
 
     assert(n_threads <= n_cores);
+    assert(algorithm == "linear" || algorithm == "bruck" || algorithm == "pairwise");
     assert((n_size * sizeof(float)) % (n_threads * CACHE_LINE_SIZE) == 0);
     n_size /= n_threads;
 
@@ -194,11 +293,19 @@ int main(int argc, char* argv[]) {
     recv_bufsss.resize(n_threads);
     doorbellsss.resize(n_threads);
     donesss.resize(n_threads);
+    outss.resize(n_threads);
+    a2a_bufsss.resize(n_threads);
+    a2a_doorbellsss.resize(n_threads);
+    a2a_emptysss.resize(n_threads);
     for (int t = 0; t < n_threads; ++t) {
         datass[t].resize(n_nodes);
         recv_bufsss[t].resize(n_nodes);
         doorbellsss[t].resize(n_nodes);
         donesss[t].resize(n_nodes);
+        outss[t].resize(n_nodes);
+        a2a_bufsss[t].resize(n_nodes);
+        a2a_doorbellsss[t].resize(n_nodes);
+        a2a_emptysss[t].resize(n_nodes);
         for (int n = 0; n < n_nodes; ++n) {
             recv_bufsss[t][n].resize(n_nodes);
             doorbellsss[t][n].resize(n_nodes);
@@ -227,15 +334,27 @@ int main(int argc, char* argv[]) {
     }
 
     if (test_result) {
-        for (int t = 0; t < n_threads; ++t) {
-            for (int sender = 0; sender < n_nodes; ++sender) {
+        if (algorithm == "linear") {
+            for (int t = 0; t < n_threads; ++t) {
+                for (int sender = 0; sender < n_nodes; ++sender) {
+                    for (int recver = 0; recver < n_nodes; ++recver) {
+                        if (sender == recver)
+                            continue;
+                        volatile float* recvd = reinterpret_cast<volatile float*>(recv_bufsss[t][sender][recver]);
+                        volatile float* sent = reinterpret_cast<volatile float*>(datass[t][sender]);
+                        for (int i = 0; i < n_size; ++i) {
+                            assert(floatsEqual(sent[i], recvd[i]));
+                        }
+                    }
+                }
+            }
+        } else {
+            for (int t = 0; t < n_threads; ++t) {
                 for (int recver = 0; recver < n_nodes; ++recver) {
-                    if (sender == recver)
-                        continue;
-                    volatile float* recvd = reinterpret_cast<volatile float*>(recv_bufsss[t][sender][recver]);
-                    volatile float* sent = reinterpret_cast<volatile float*>(datass[t][sender]);
-                    for (int i = 0; i < n_size; ++i) {
-                        assert(floatsEqual(sent[i], recvd[i]));
+                    volatile float* out = reinterpret_cast<volatile float*>(outss[t][recver]);
+                    for (int i = 0; i < n_size * n_nodes; ++i) {
+                        int sender = i / n_size;
+                        assert(floatsEqual(out[i], (float)(sender * n_nodes + recver + 1)));
                     }
                 }
             }
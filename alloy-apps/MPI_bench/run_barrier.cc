@@ -27,12 +27,16 @@
 #include <sys/mman.h>
 #include <iostream>
 #include <algorithm>
+#include <string>
 
 int n_nodes = 4;
 int n_cores = 1;
 int n_threads = 1;
 int n_rounds = 1;
 int warmup_rounds = 0;
+// central (gather at node 0, then release) or dissem (dissemination
+// among the node leaders, ceil(log2(n_nodes)) rounds and no hot spot)
+std::string algorithm = "central";
 
 const size_t CACHELINE_SIZE = 64;
 
@@ -45,6 +49,7 @@ static_assert(sizeof(NodeLock) == CACHELINE_SIZE, "NodeLock size must be equal t
 volatile NodeLock* global_doorbells;
 std::vector<volatile size_t*> global_rdoorbells;
 std::vector<volatile size_t*> local_doorbells;
+std::vector<volatile NodeLock*> dissem_doorbells;
 
 pthread_barrier_t global_bar;
 pthread_barrier_t finish_bar;
@@ -88,13 +93,35 @@ void no_op(void) {
 }
 
 inline void WaitDoorbell(volatile size_t* doorbell, size_t doorbellVal) {
+#ifdef NO_GEM5
     while (*doorbell != doorbellVal);
+#else
+    appl::wait_until_eq(doorbell, doorbellVal);
+#endif
 }
 
 inline void SetDoorbell(volatile size_t* doorbell, size_t doorbellVal) {
     *doorbell = doorbellVal;
 }
 
+int num_dissem_steps() {
+    int steps = 0;
+    for (int dist = 1; dist < n_nodes; dist <<= 1)
+        ++steps;
+    return steps;
+}
+
+// In step k node n signals node (n + 2^k) % n_nodes and waits for node
+// (n - 2^k) % n_nodes. A fast neighbour may already have moved on to the
+// next round, so the wait accepts any value >= r.
+void dissem_barrier(int n, size_t r) {
+    int k = 0;
+    for (int dist = 1; dist < n_nodes; dist <<= 1, ++k) {
+        SetDoorbell(&(dissem_doorbells[(n + dist) % n_nodes][k].locked), r);
+        while (dissem_doorbells[n][k].locked < r);
+    }
+}
+
 void barrier(int n, int t, size_t r) {
     if (t == 0) {
         for (int tid = 0; tid < n_threads; ++tid) {
@@ -103,7 +130,9 @@ void barrier(int n, int t, size_t r) {
             }
         }
         
-        if (n == 0) {
+        if (algorithm == "dissem") {
+            dissem_barrier(n, r);
+        } else if (n == 0) {
             for (int nid = 0; nid < n_nodes; ++nid) {
                 if (nid != n) {
                     WaitDoorbell(&(global_doorbells[nid].locked), r);
@@ -138,7 +167,12 @@ void run_barrier(int n, int t) {
         memset((void*)local_doorbells[n], 0, n_threads * sizeof(size_t));
         printf("node[%d] allocated local doorbells\n", n);
 
-        if (n == 0) {
+        if (algorithm == "dissem") {
+            int steps = std::max(num_dissem_steps(), 1);
+            dissem_doorbells[n] = (volatile NodeLock*)AllocRELMem(steps * sizeof(NodeLock));
+            memset((void*)dissem_doorbells[n], 0, steps * sizeof(NodeLock));
+            printf("node[%d] allocated dissemination doorbells\n", n);
+        } else if (n == 0) {
             global_doorbells = (volatile NodeLock*)AllocRELMem(n_nodes * sizeof(NodeLock));
             memset((void*)global_doorbells, 0, n_nodes * sizeof(NodeLock));
             printf("node[%d] allocated global doorbells\n", n);
@@ -176,7 +210,7 @@ void run_barrier(int n, int t) {
 int main(int argc, char* argv[]) {
 
     int opt;
-    while ((opt = getopt(argc, argv, "n:c:t:r:w:")) != -1) {
+    while ((opt = getopt(argc, argv, "n:c:t:r:w:a:")) != -1) {
         switch (opt) {
             case 'n':
                 n_nodes = std::stoi(optarg);
@@ -193,6 +227,9 @@ int main(int argc, char* argv[]) {
             case 'w':
                 warmup_rounds = std::stoi(optarg);
                 break;
+            case 'a':
+                algorithm = std::string(optarg);
+                break;
             default:
                 std::cerr << "Usage: " << argv[0] << "..." << std::endl;
                 return 1;
@@ -200,9 +237,11 @@ int main(int argc, char* argv[]) {
     }
 
     assert(n_threads <= n_cores);
+    assert(algorithm == "central" || algorithm == "dissem");
 
     local_doorbells.resize(n_nodes);
     global_rdoorbells.resize(n_nodes);
+    dissem_doorbells.resize(n_nodes);
 
     pthread_barrier_init(&global_bar, nullptr, n_nodes * n_threads);
     pthread_barrier_init(&finish_bar, nullptr, n_nodes * n_cores);
@@ -18,6 +18,7 @@
 #endif
 
 #include <thread>
+#include <string>
 #include <cstring>
 #include <pthread.h>
 #include <cassert>
@@ -33,12 +34,17 @@ int warmup_rounds = 0;
 int stride_in_word = 1;
 bool test_result = false;
 bool do_red_op = false;
+// tree (ReduceBinaryTree) or binomial (ReduceBinomialTree)
+std::string algorithm = "tree";
 
 std::vector<std::vector<volatile char*>> datass;
 std::vector<std::vector<volatile char*>> correct_datass;
 std::vector<std::vector<volatile char*[2]>> recv_bufss;
 std::vector<std::vector<volatile wordT*[2]>> doorbellss;
 std::vector<std::vector<volatile wordT*>> emptys;
+std::vector<std::vector<std::vector<volatile char*>>> slot_bufsss;
+std::vector<std::vector<std::vector<volatile wordT*>>> slot_doorbellsss;
+std::vector<std::vector<std::vector<volatile wordT*>>> slot_emptysss;
 
 #ifdef NO_GEM5
 pthread_barrier_t global_bar;
@@ -50,6 +56,63 @@ void no_op(void) {
     return;
 }
 
+// NT / REL memory of node n. Under gem5 it is carved out of the node's
+// appl arena, so the collectives use the same allocation path as the apps.
+void* AllocNTMem(size_t count, int node) {
+#ifndef NO_GEM5
+    void* ret = appl::alloc_nt(count, node);
+#else
+    void* ret = mmap(NULL, count, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+    if (ret == MAP_FAILED)
+        ret = nullptr;
+#endif
+    if (!ret)
+        std::cerr << "Error: mmap" << std::endl;
+    return ret;
+}
+
+void* AllocRELMem(size_t count, int node) {
+#ifndef NO_GEM5
+    void* ret = appl::alloc_rel(count, node);
+#else
+    void* ret = mmap(NULL, count, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+    if (ret == MAP_FAILED)
+        ret = nullptr;
+#endif
+    if (!ret)
+        std::cerr << "Error: mmap" << std::endl;
+    return ret;
+}
+
+// buffers of the log-step collectives, see CollSlots in Collectives.hh
+void alloc_slot_bufs(int n, size_t slot_buf_size) {
+    int n_slots = CollSlots(n_nodes);
+    size_t flag_size = CACHE_LINE_SIZE;
+
+    volatile char* bufs = (char*)AllocNTMem(slot_buf_size * n_slots * n_threads, n);
+    volatile wordT* doorbells = (wordT*)AllocRELMem(flag_size * n_slots * n_threads, n);
+    volatile wordT* emptys = (wordT*)AllocRELMem(flag_size * n_slots * n_threads, n);
+    if (!bufs || !doorbells || !emptys) {
+        std::cerr << "Error: slot buffer allocation failed nid:" << n << std::endl;
+        return;
+    }
+    memset((void*)bufs, 0, slot_buf_size * n_slots * n_threads);
+    memset((void*)doorbells, 0, flag_size * n_slots * n_threads);
+    memset((void*)emptys, 0, flag_size * n_slots * n_threads);
+
+    for (int tid = 0; tid < n_threads; ++tid) {
+        slot_bufsss[tid][n].resize(n_slots);
+        slot_doorbellsss[tid][n].resize(n_slots);
+        slot_emptysss[tid][n].resize(n_slots);
+        for (int s = 0; s < n_slots; ++s) {
+            size_t idx = tid * n_slots + s;
+            slot_bufsss[tid][n][s] = bufs + slot_buf_size * idx;
+            slot_doorbellsss[tid][n][s] = doorbells + flag_size * idx / sizeof(wordT);
+            slot_emptysss[tid][n][s] = emptys + flag_size * idx / sizeof(wordT);
+        }
+    }
+}
+
 void run_reduce(int n, int t) {
 
     if (t == 0) {
@@ -76,45 +139,50 @@ void run_reduce(int n, int t) {
             }
         }
 
-        recv_bufss[t][n][0] = (char*)mmap(NULL, recv_buf_size * 2 * n_threads, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
-        if (recv_bufss[t][n][0] == MAP_FAILED) {
-            std::cerr << "Error: mmap failed for recv buf nid:" << n << std::endl;
-            return;
-        }
-        recv_bufss[t][n][1] = recv_bufss[t][n][0] + recv_buf_size;
-    #ifndef NO_GEM5
-        appl::register_stnt((uint64_t)(recv_bufss[t][n][0]), ((uint64_t)(recv_bufss[t][n][0])) + recv_buf_size * 2 * n_threads);
-    #endif
-        memset((void*)recv_bufss[t][n][0], 0, recv_buf_size * 2 * n_threads);
+        if (algorithm != "tree") {
+            alloc_slot_bufs(n, data_buf_size);
+        } else {
+            recv_bufss[t][n][0] = (char*)mmap(NULL, recv_buf_size * 2 * n_threads, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+            if (recv_bufss[t][n][0] == MAP_FAILED) {
+                std::cerr << "Error: mmap failed for recv buf nid:" << n << std::endl;
+                return;
+            }
+            recv_bufss[t][n][1] = recv_bufss[t][n][0] + recv_buf_size;
+        #ifndef NO_GEM5
+            appl::register_stnt((uint64_t)(recv_bufss[t][n][0]), ((uint64_t)(recv_bufss[t][n][0])) + recv_buf_size * 2 * n_threads);
+        #endif
+            memset((void*)recv_bufss[t][n][0], 0, recv_buf_size * 2 * n_threads);
 
 
-        doorbellss[t][n][0] = (wordT*)mmap(NULL, flag_size * 2 * n_threads, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
-        if (doorbellss[t][n][0] == MAP_FAILED) {
-            std::cerr << "Error: mmap failed for doorbell nid:" << n << std::endl;
-            return;
-        }
-        doorbellss[t][n][1] = doorbellss[t][n][0] + flag_size / sizeof(wordT);
-    #ifndef NO_GEM5
-        appl::register_strel((uint64_t)(doorbellss[t][n][0]), ((uint64_t)(doorbellss[t][n][0])) + flag_size * 2 * n_threads);
-    #endif
-        memset((void*)doorbellss[t][n][0], 0, flag_size * 2 * n_threads);
+            doorbellss[t][n][0] = (wordT*)mmap(NULL, flag_size * 2 * n_threads, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+            if (doorbellss[t][n][0] == MAP_FAILED) {
+                std::cerr << "Error: mmap failed for doorbell nid:" << n << std::endl;
+                return;
+            }
+            doorbellss[t][n][1] = doorbellss[t][n][0] + flag_size / sizeof(wordT);
+        #ifndef NO_GEM5
+            appl::register_strel((uint64_t)(doorbellss[t][n][0]), ((uint64_t)(doorbellss[t][n][0])) + flag_size * 2 * n_threads);
+        #endif
+            memset((void*)doorbellss[t][n][0], 0, flag_size * 2 * n_threads);
 
 
-        emptys[t][n] = (wordT*)mmap(NULL, flag_size * n_threads, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
-        if (emptys[t][n] == MAP_FAILED) {
-            std::cerr << "Error: mmap failed for empty nid:" << n << std::endl;
-            return;
+            emptys[t][n] = (wordT*)mmap(NULL, flag_size * n_threads, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+            if (emptys[t][n] == MAP_FAILED) {
+                std::cerr << "Error: mmap failed for empty nid:" << n << std::endl;
+                return;
+            }
+        #ifndef NO_GEM5
+            appl::register_strel((uint64_t)(emptys[t][n]), ((uint64_t)(emptys[t][n])) + flag_size * n_threads);
+        #endif
+            memset((void*)emptys[t][n], 0, flag_size * n_threads);
         }
-    #ifndef NO_GEM5
-        appl::register_strel((uint64_t)(emptys[t][n]), ((uint64_t)(emptys[t][n])) + flag_size * n_threads);
-    #endif
-        memset((void*)emptys[t][n], 0, flag_size * n_threads);
-
 
         for (int tid = 1; tid < n_threads; ++tid) {
             datass[tid][n] = datass[t][n] + data_buf_size * tid;
             if (test_result)
                 correct_datass[tid][n] = correct_datass[t][n] + data_buf_size * tid;
+            if (algorithm != "tree")
+                continue;
             recv_bufss[tid][n][0] = recv_bufss[t][n][0] + recv_buf_size * tid * 2;
             recv_bufss[tid][n][1] = recv_bufss[t][n][0] + recv_buf_size * (tid * 2 + 1);
             doorbellss[tid][n][0] = doorbellss[t][n][0] + flag_size * tid * 2 / sizeof(wordT);
@@ -135,17 +203,24 @@ void run_reduce(int n, int t) {
             }
         }
 #endif
-        ReduceBinaryTree<float>(datass[t],
-                            recv_bufss[t],
-                            doorbellss[t],
-                            emptys[t],
-                            n_size * sizeof(float),
-                            0,
-                            n,
-                            n_nodes,
-                            do_red_op,
-                            stride_in_word,
-                            r + 1);
+        if (algorithm == "tree") {
+            ReduceBinaryTree<float>(datass[t],
+                                recv_bufss[t],
+                                doorbellss[t],
+                                emptys[t],
+                                n_size * sizeof(float),
+                                0,
+                                n,
+                                n_nodes,
+                                do_red_op,
+                                stride_in_word,
+                                r + 1);
+        } else {
+            ReduceBinomialTree<float>(datass[t], slot_bufsss[t],
+                                slot_doorbellsss[t], slot_emptysss[t],
+                                n_size * sizeof(float), 0, n, n_nodes,
+                                do_red_op, stride_in_word, r + 1);
+        }
     }
 
 #ifdef NO_GEM5
@@ -163,7 +238,7 @@ void run_reduce(int n, int t) {
 int main(int argc, char* argv[]) {
 
     int opt;
-    while ((opt = getopt(argc, argv, "n:c:t:f:v:r:w:s:")) != -1) {
+    while ((opt = getopt(argc, argv, "n:c:t:f:v:r:w:s:a:")) != -1) {
         switch (opt) {
             case 'n':
                 n_nodes = std::stoi(optarg);
@@ -190,6 +265,9 @@ int main(int argc, char* argv[]) {
             case 's':
                 stride_in_word = std::stoi(optarg);
                 break;
+            case 'a':
+                algorithm = std::string(optarg);
+                break;
             default:
                 std::cerr << "Usage: " << argv[0] << "..." << std::endl;
                 return 1;
@@ -197,6 +275,7 @@ int main(int argc, char* argv[]) {
     }
 
     assert(n_threads <= n_cores);
+    assert(algorithm == "tree" || algorithm == "binomial");
     assert((n_size * sizeof(float)) % (n_threads * CACHE_LINE_SIZE) == 0);
     n_size /= n_threads;
 
@@ -206,6 +285,9 @@ int main(int argc, char* argv[]) {
     recv_bufss.resize(n_threads);
     doorbellss.resize(n_threads);
     emptys.resize(n_threads);
+    slot_bufsss.resize(n_threads);
+    slot_doorbellsss.resize(n_threads);
+    slot_emptysss.resize(n_threads);
     for (int t = 0; t < n_threads; ++t) {
         datass[t] = std::vector<volatile char*>(n_nodes);
         if (test_result)
@@ -213,6 +295,9 @@ int main(int argc, char* argv[]) {
         recv_bufss[t] = std::vector<volatile char*[2]>(n_nodes);
         doorbellss[t] = std::vector<volatile wordT*[2]>(n_nodes);
         emptys[t] = std::vector<volatile wordT*>(n_nodes);
+        slot_bufsss[t] = std::vector<std::vector<volatile char*>>(n_nodes);
+        slot_doorbellsss[t] = std::vector<std::vector<volatile wordT*>>(n_nodes);
+        slot_emptysss[t] = std::vector<std::vector<volatile wordT*>>(n_nodes);
     }
 
 #ifdef NO_GEM5
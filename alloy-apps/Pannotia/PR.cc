@@ -18,6 +18,7 @@
 #endif
 
 #include <thread>
+#include <string>
 #include <cstring>
 #include <atomic>
 #include <pthread.h>
@@ -47,6 +48,8 @@ int warmup_rounds = 0;
 size_t v_per_lock = 128;
 size_t update_thres = (1 << 31);
 std::string csr_file;
+// central (node 0 gathers and releases every node) or hier (HierBarrier)
+std::string sync_kind = "central";
 bool test_result = false;
 size_t num_v;
 size_t num_e;
@@ -71,7 +74,11 @@ void no_op(void) {
 }
 
 inline void WaitDoorbell(volatile size_t* doorbell, size_t doorbellVal) {
+#ifdef NO_GEM5
     while (*doorbell != doorbellVal);
+#else
+    appl::wait_until_eq(doorbell, doorbellVal);
+#endif
 }
 
 inline void SetDoorbell(volatile size_t* doorbell, size_t doorbellVal) {
@@ -87,6 +94,11 @@ void init_pagerank() {
 }
 
 void sync_phase(int n, int t, size_t r) {
+    if (sync_kind == "hier") {
+        HierBarrier(n, t, r);
+        return;
+    }
+
     if (t == 0) {
         for (int tid = 0; tid < n_threads; ++tid) {
             if (tid != t) {
@@ -135,7 +147,7 @@ void run_pagerank(int n, int t) {
         }
         
         v_per_node = (num_v + n_nodes - 1) / n_nodes;
-        prs[n] = (volatile NodeWeight*)AllocNTMem(v_per_node * sizeof(NodeWeight));
+        prs[n] = (volatile NodeWeight*)AllocNTMem(v_per_node * sizeof(NodeWeight), n);
         memset((void*)(prs[n]), 0, v_per_node * sizeof(NodeWeight));
         printf("node[%d] allocated prs\n", n);
         
@@ -143,12 +155,15 @@ void run_pagerank(int n, int t) {
         memset((void*)local_doorbells[n], 0, n_threads * sizeof(size_t));
         printf("node[%d] allocated local doorbells\n", n);
 
-        if (n == 0) {
-            global_doorbells = (volatile NodeLock*)AllocRELMem(n_nodes * sizeof(NodeLock));
+        if (sync_kind == "hier") {
+            AllocHierBarrier(n);
+            printf("node[%d] allocated barrier\n", n);
+        } else if (n == 0) {
+            global_doorbells = (volatile NodeLock*)AllocRELMem(n_nodes * sizeof(NodeLock), n);
             memset((void*)global_doorbells, 0, n_nodes * sizeof(NodeLock));
             printf("node[%d] allocated global doorbells\n", n);
         } else {
-            global_rdoorbells[n] = (volatile NodeLock*)AllocRELMem(sizeof(NodeLock));
+            global_rdoorbells[n] = (volatile NodeLock*)AllocRELMem(sizeof(NodeLock), n);
             memset((void*)global_rdoorbells[n], 0, sizeof(NodeLock));
             printf("node[%d] allocated reverse global doorbells\n", n);            
         }
@@ -221,7 +236,7 @@ void run_pagerank(int n, int t) {
 int main(int argc, char* argv[]) {
 
     int opt;
-    while ((opt = getopt(argc, argv, "n:c:t:u:v:r:w:l:f:")) != -1) {
+    while ((opt = getopt(argc, argv, "n:c:t:u:v:r:w:l:g:f:")) != -1) {
         switch (opt) {
             case 'n':
                 n_nodes = std::stoi(optarg);
@@ -247,6 +262,9 @@ int main(int argc, char* argv[]) {
             case 'l':
                 v_per_lock = std::stoi(optarg);
                 break;
+            case 'g':
+                sync_kind = std::string(optarg);
+                break;
             case 'f':
                 if (optarg != nullptr) {
                     csr_file = std::string(optarg);
@@ -262,6 +280,9 @@ int main(int argc, char* argv[]) {
     }
 
     assert(n_threads <= n_cores);
+    assert(sync_kind == "central" || sync_kind == "hier");
+    if (sync_kind == "hier")
+        InitHierBarrier(n_nodes, n_threads);
 
     row_ptrs.resize(n_nodes);
     col_idxs.resize(n_nodes);
@@ -18,6 +18,7 @@
 #endif
 
 #include <thread>
+#include <string>
 #include <cstring>
 #include <pthread.h>
 #include <cassert>
@@ -47,6 +48,8 @@ size_t v_per_lock = 128;
 size_t update_thres = 4096;
 size_t batch_size = 32;
 std::string csr_file;
+// central (pthread barrier per round) or hier (HierBarrier)
+std::string sync_kind = "central";
 bool test_result = false;
 size_t num_v;
 size_t num_e;
@@ -69,7 +72,11 @@ void no_op(void) {
 }
 
 inline void WaitDoorbell(volatile size_t* doorbell, size_t doorbellVal) {
+#ifdef NO_GEM5
     while (*doorbell != doorbellVal);
+#else
+    appl::wait_until_eq(doorbell, doorbellVal);
+#endif
 }
 
 inline void SetDoorbell(volatile size_t* doorbell, size_t doorbellVal) {
@@ -98,14 +105,19 @@ void run_sssp(int n, int t) {
         }
         
         v_per_node = (num_v + n_nodes - 1) / n_nodes;
-        dists[n] = (volatile NodeDist*)AllocNTMem(v_per_node * sizeof(NodeDist));
+        dists[n] = (volatile NodeDist*)AllocNTMem(v_per_node * sizeof(NodeDist), n);
         memset((void*)(dists[n]), 0, v_per_node * sizeof(NodeDist));
         printf("node[%d] allocated dists\n", n);
 
         l_per_node = (v_per_node + v_per_lock - 1) / v_per_lock;
-        locks[n] = (volatile NodeLock*)AllocRELMem(l_per_node * sizeof(NodeLock));
+        locks[n] = (volatile NodeLock*)AllocRELMem(l_per_node * sizeof(NodeLock), n);
         memset((void*)locks[n], 0, l_per_node * sizeof(NodeLock));
         printf("node[%d] allocated locks\n", n);
+
+        if (sync_kind == "hier") {
+            AllocHierBarrier(n);
+            printf("node[%d] allocated barrier\n", n);
+        }
     }
 
 #ifdef NO_GEM5
@@ -129,7 +141,11 @@ void run_sssp(int n, int t) {
 
     for (int r = 0; r < warmup_rounds + n_rounds; ++r) {
 
-        pthread_barrier_wait(&global_bar);
+        if (sync_kind == "hier") {
+            HierBarrier(n, t, r + 1);
+        } else {
+            pthread_barrier_wait(&global_bar);
+        }
 
 #ifndef NO_GEM5
         if (r == warmup_rounds) {
@@ -211,7 +227,7 @@ void run_sssp(int n, int t) {
 int main(int argc, char* argv[]) {
 
     int opt;
-    while ((opt = getopt(argc, argv, "n:c:t:u:v:r:w:l:b:f:")) != -1) {
+    while ((opt = getopt(argc, argv, "n:c:t:u:v:r:w:l:b:g:f:")) != -1) {
         switch (opt) {
             case 'n':
                 n_nodes = std::stoi(optarg);
@@ -240,6 +256,9 @@ int main(int argc, char* argv[]) {
             case 'b':
                 batch_size = std::stoi(optarg);
                 break;
+            case 'g':
+                sync_kind = std::string(optarg);
+                break;
             case 'f':
                 if (optarg != nullptr) {
                     csr_file = std::string(optarg);
@@ -255,6 +274,9 @@ int main(int argc, char* argv[]) {
     }
 
     assert(n_threads <= n_cores);
+    assert(sync_kind == "central" || sync_kind == "hier");
+    if (sync_kind == "hier")
+        InitHierBarrier(n_nodes, n_threads);
 
     row_ptrs.resize(n_nodes);
     col_idxs.resize(n_nodes);
@@ -19,8 +19,54 @@
 #include <iostream>
 #include <fstream>
 #include <sstream>
+#include <vector>
 #include <cassert>
+#include <cstring>
+#include <fcntl.h>
 #include <sys/mman.h>
+#include <unistd.h>
+
+// binary CSR header, see datasets/gen_csr.py
+struct CSRBinHeader {
+    uint64_t magic;
+    uint64_t num_v;
+    uint64_t num_e;
+    uint64_t flags;
+    uint64_t row_ptr_off;
+    uint64_t col_idx_off;
+    uint64_t weight_off;
+    uint64_t reserved;
+};
+
+const uint64_t CSR_BIN_MAGIC = 0x3152534341504c41; // "ALPACSR1"
+const uint64_t CSR_BIN_WEIGHTED = 0x1;
+
+static bool ReadAt(int fd, uint64_t offset, void* buf, size_t count) {
+    if (lseek(fd, offset, SEEK_SET) != (off_t)offset)
+        return false;
+    char* ptr = (char*)buf;
+    while (count > 0) {
+        ssize_t ret = read(fd, ptr, count);
+        if (ret <= 0)
+            return false;
+        ptr += ret;
+        count -= ret;
+    }
+    return true;
+}
+
+// Returns an fd positioned anywhere if filename is a binary CSR file,
+// -1 if it is not (or cannot be opened) and the text loader should run.
+static int OpenBinaryCSR(const std::string& filename, CSRBinHeader* hdr) {
+    int fd = open(filename.c_str(), O_RDONLY);
+    if (fd < 0)
+        return -1;
+    if (!ReadAt(fd, 0, hdr, sizeof(*hdr)) || hdr->magic != CSR_BIN_MAGIC) {
+        close(fd);
+        return -1;
+    }
+    return fd;
+}
 
 void* AllocREGMem(size_t count) {
     void* ret = mmap(NULL, count, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
@@ -31,33 +77,126 @@ void* AllocREGMem(size_t count) {
     return ret;
 }
 
-void* AllocNTMem(size_t count) {
-    void* ret = mmap(NULL, count, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
-    if (ret == MAP_FAILED) {
-        std::cerr << "Error: mmap" << std::endl;
-        return nullptr;
-    }
+void* AllocNTMem(size_t count, int node) {
 #ifndef NO_GEM5
-    appl::register_stnt((uint64_t)ret, (uint64_t)ret + count);
-#endif
+    void* ret = appl::alloc_nt(count, node);
+    if (!ret)
+        std::cerr << "Error: mmap" << std::endl;
     return ret;
+#else
+    return AllocREGMem(count);
+#endif
 }
 
-void* AllocRELMem(size_t count) {
-    void* ret = mmap(NULL, count, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
-    if (ret == MAP_FAILED) {
-        std::cerr << "Error: mmap" << std::endl;
-        return nullptr;
-    }
+void* AllocRELMem(size_t count, int node) {
 #ifndef NO_GEM5
-    appl::register_strel((uint64_t)ret, (uint64_t)ret + count);
-#endif
+    void* ret = appl::alloc_rel(count, node);
+    if (!ret)
+        std::cerr << "Error: mmap" << std::endl;
     return ret;
+#else
+    return AllocREGMem(count);
+#endif
+}
+
+struct alignas(CACHELINE_SIZE) BarrierFlag {
+    volatile size_t val;
+    char pad[CACHELINE_SIZE - sizeof(size_t)];
+};
+static_assert(sizeof(BarrierFlag) == CACHELINE_SIZE, "BarrierFlag size must be equal to CACHELINE_SIZE");
+
+inline void WaitFlag(BarrierFlag* flag, size_t r) {
+#ifdef NO_GEM5
+    while (flag->val != r);
+#else
+    appl::wait_until_eq(&flag->val, r);
+#endif
+}
+
+static int hb_nodes;
+static int hb_threads;
+static int hb_steps;
+static std::vector<BarrierFlag*> hb_arrives;  // per thread, node-local
+static std::vector<BarrierFlag*> hb_releases; // one per node, node-local
+static std::vector<BarrierFlag*> hb_dissems;  // per step, REL on the node
+
+void InitHierBarrier(int num_nodes, int num_threads) {
+    hb_nodes = num_nodes;
+    hb_threads = num_threads;
+    hb_steps = 0;
+    for (int dist = 1; dist < num_nodes; dist <<= 1)
+        ++hb_steps;
+    hb_arrives.assign(num_nodes, nullptr);
+    hb_releases.assign(num_nodes, nullptr);
+    hb_dissems.assign(num_nodes, nullptr);
+}
+
+void AllocHierBarrier(int n) {
+    hb_arrives[n] = (BarrierFlag*)AllocREGMem((hb_threads + 1) * sizeof(BarrierFlag));
+    memset((void*)hb_arrives[n], 0, (hb_threads + 1) * sizeof(BarrierFlag));
+    hb_releases[n] = hb_arrives[n] + hb_threads;
+
+    if (hb_steps > 0) {
+        hb_dissems[n] = (BarrierFlag*)AllocRELMem(hb_steps * sizeof(BarrierFlag), n);
+        memset((void*)hb_dissems[n], 0, hb_steps * sizeof(BarrierFlag));
+    }
+}
+
+void HierBarrier(int n, int t, size_t r) {
+    BarrierFlag* arrives = hb_arrives[n];
+    for (int c = 2 * t + 1; c <= 2 * t + 2 && c < hb_threads; ++c) {
+        WaitFlag(&arrives[c], r);
+    }
+    if (t != 0) {
+        arrives[t].val = r;
+        WaitFlag(hb_releases[n], r);
+        return;
+    }
+
+    // a neighbour may already be signalling the next barrier, hence >=
+    int k = 0;
+    for (int dist = 1; dist < hb_nodes; dist <<= 1, ++k) {
+        hb_dissems[(n + dist) % hb_nodes][k].val = r;
+        while (hb_dissems[n][k].val < r);
+    }
+    hb_releases[n]->val = r;
 }
 
 void BuildCSR(const std::string filename,
               size_t* row_ptr,
-              size_t* col_idx) {
+              size_t* col_idx,
+              double* weight) {
+    static_assert(sizeof(size_t) == sizeof(uint64_t),
+                  "binary CSR arrays are uint64");
+
+    CSRBinHeader hdr;
+    int fd = OpenBinaryCSR(filename, &hdr);
+    if (fd >= 0) {
+        bool ok = ReadAt(fd, hdr.row_ptr_off, row_ptr,
+                         (hdr.num_v + 1) * sizeof(size_t)) &&
+                  ReadAt(fd, hdr.col_idx_off, col_idx,
+                         hdr.num_e * sizeof(size_t));
+        if (ok && weight) {
+            if (hdr.flags & CSR_BIN_WEIGHTED) {
+                ok = ReadAt(fd, hdr.weight_off, weight,
+                            hdr.num_e * sizeof(double));
+            } else {
+                for (size_t i = 0; i < hdr.num_e; ++i)
+                    weight[i] = 1.0;
+            }
+        }
+        close(fd);
+        if (!ok)
+            std::cerr << "Error reading file: " << filename << std::endl;
+        return;
+    }
+
+    if (weight) {
+        std::cerr << "Error: text CSR has no weights: " << filename
+                  << std::endl;
+        return;
+    }
+
     std::ifstream file(filename);
     if (!file.is_open()) {
         std::cerr << "Error opening file: " << filename << std::endl;
@@ -77,16 +216,12 @@ void BuildCSR(const std::string filename,
             int i = 0;
             while (iss >> value) {
                 row_ptr[i++] = value;
-                if (i % 1000 == 0)
-                    std::cout << "load row_ptrs:" << i << std::endl;
             }
         } else if (l_idx == 3) {
             size_t value;
             int i = 0;
             while (iss >> value) {
                 col_idx[i++] = value;
-                if (i % 1000 == 0)
-                    std::cout << "load col_idxs:" << i << std::endl;
             }
         } else {
             assert(0);
@@ -99,7 +234,26 @@ void BuildCSR(const std::string filename,
 
 void GetGraphStat(const std::string filename,
               size_t* num_v,
-              size_t* num_e) {
+              size_t* num_e,
+              bool* weighted) {
+    CSRBinHeader hdr;
+    int fd = OpenBinaryCSR(filename, &hdr);
+    if (fd >= 0) {
+        close(fd);
+        if (num_v)
+            *num_v = hdr.num_v;
+        if (num_e)
+            *num_e = hdr.num_e;
+        if (weighted)
+            *weighted = hdr.flags & CSR_BIN_WEIGHTED;
+        std::cout << "get num_v:" << hdr.num_v << " num_e:" << hdr.num_e
+                  << " (binary)" << std::endl;
+        return;
+    }
+
+    if (weighted)
+        *weighted = false;
+
     std::ifstream file(filename);
     if (!file.is_open()) {
         std::cerr << "Error opening file: " << filename << std::endl;
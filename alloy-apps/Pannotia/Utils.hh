@@ -20,14 +20,33 @@
 
 const size_t CACHELINE_SIZE = 64;
 
+// Graph files are either the text CSR format or the binary one written by
+// datasets/gen_csr.py --binary, told apart by the magic at the start of the
+// file. A binary file loads with a few read()s straight into the arrays;
+// edge weights only exist in the binary format.
 void GetGraphStat(const std::string filename,
               size_t* num_v,
-              size_t* num_e);
+              size_t* num_e,
+              bool* weighted = nullptr);
 
 void BuildCSR(const std::string filename,
               size_t* row_ptr,
-              size_t* col_idx);
+              size_t* col_idx,
+              double* weight = nullptr);
 
 void* AllocREGMem(size_t count);
-void* AllocNTMem(size_t count);
-void* AllocRELMem(size_t count);
\ No newline at end of file
+// node is the node of the calling thread; with node >= 0 small regions
+// share one registered DO range per node, see appl::alloc_nt
+void* AllocNTMem(size_t count, int node = -1);
+void* AllocRELMem(size_t count, int node = -1);
+
+// Two-level barrier for num_nodes x num_threads workers: the threads of a
+// node combine up a binary tree to thread 0, the node leaders run a
+// dissemination barrier over REL doorbells (ceil(log2(num_nodes)) steps,
+// no node polls more than one line per step), then thread 0 releases its
+// node. InitHierBarrier runs before the workers start, thread 0 of every
+// node calls AllocHierBarrier and the barrier is usable once all of them
+// have. r must start above 0 and grow with every call.
+void InitHierBarrier(int num_nodes, int num_threads);
+void AllocHierBarrier(int n);
+void HierBarrier(int n, int t, size_t r);
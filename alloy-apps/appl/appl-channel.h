@@ -0,0 +1,243 @@
+//========================================================================
+// appl-channel.h
+//========================================================================
+// Lock-free producer/consumer rings over DO memory. The payload slots
+// and the tail index live on the consumer's node in NT and REL memory
+// respectively, so a push is a run of ST_NT stores ended by one ST_REL;
+// the head index lives on the producer's node in REL memory and is
+// written by the consumer. Every index is only ever read where it lives.
+//
+// Indices count up forever and a slot is index % capacity, so all
+// capacity slots are usable. Each endpoint caches the other side's index
+// and rereads it only when the ring looks full (or empty), and publishes
+// its own index once every `batch` entries. Unpublished entries are
+// flushed before an endpoint blocks, and must be flushed with flush()
+// before a thread waits on anything else (e.g. a barrier).
+//
+// The header does not allocate: slots need capacity * sizeof(T) bytes of
+// NT memory and each index its own cache line of REL memory. Blocking
+// uses appl::wait_until_ne; native runs (NO_GEM5) spin instead, so there
+// the header has no dependency on the rest of appl.
+
+#ifndef APPL_CHANNEL_H
+#define APPL_CHANNEL_H
+
+#include <cstddef>
+#include <cstdint>
+#include <type_traits>
+#include <vector>
+
+#ifndef NO_GEM5
+#include "appl-gem5-utils.h"
+#endif
+
+namespace appl {
+
+template <typename T>
+struct ChannelMem
+{
+  volatile T* slots;        // NT, on the consumer's node
+  volatile uint64_t* tail;  // REL, on the consumer's node
+  volatile uint64_t* head;  // REL, on the producer's node
+  size_t capacity;
+};
+
+namespace detail {
+
+template <typename T>
+inline void channel_copy(volatile T* dst, const volatile T* src)
+{
+  static_assert(std::is_trivially_copyable<T>::value,
+                "channel payloads are copied word by word");
+  if (sizeof(T) % sizeof(uint64_t) == 0) {
+    volatile uint64_t* d = (volatile uint64_t*)dst;
+    const volatile uint64_t* s = (const volatile uint64_t*)src;
+    for (size_t i = 0; i < sizeof(T) / sizeof(uint64_t); ++i)
+      d[i] = s[i];
+  } else {
+    volatile char* d = (volatile char*)dst;
+    const volatile char* s = (const volatile char*)src;
+    for (size_t i = 0; i < sizeof(T); ++i)
+      d[i] = s[i];
+  }
+}
+
+// blocks until the other side moves the index it last read as val
+inline void channel_wait_ne(volatile uint64_t* index, uint64_t val)
+{
+#ifndef NO_GEM5
+  wait_until_ne(index, val);
+#else
+  while (*index == val);
+#endif
+}
+
+} // namespace detail
+
+//------------------------------------------------------------------------
+// SPSCProducer / SPSCConsumer
+//------------------------------------------------------------------------
+// The two ends of one ring. Both start from index 0, so the index words
+// must be zero before either end is used.
+
+template <typename T>
+class SPSCProducer
+{
+ public:
+  SPSCProducer() : m_mem{nullptr, nullptr, nullptr, 0} {}
+
+  SPSCProducer(const ChannelMem<T>& mem, size_t batch = 1)
+    : m_mem(mem), m_batch(batch ? batch : 1)
+  {}
+
+  bool try_push(const T& val)
+  {
+    if (m_tail - m_head_cache == m_mem.capacity) {
+      m_head_cache = *m_mem.head;
+      if (m_tail - m_head_cache == m_mem.capacity)
+        return false;
+    }
+    detail::channel_copy(&m_mem.slots[m_tail % m_mem.capacity],
+                         (const volatile T*)&val);
+    ++m_tail;
+    if (m_tail - m_published >= m_batch)
+      flush();
+    return true;
+  }
+
+  void push(const T& val)
+  {
+    if (try_push(val))
+      return;
+    // the consumer may be waiting for what we have not published yet
+    flush();
+    while (!try_push(val))
+      detail::channel_wait_ne(m_mem.head, m_head_cache);
+  }
+
+  void flush()
+  {
+    if (m_published != m_tail) {
+      *m_mem.tail = m_tail;
+      m_published = m_tail;
+    }
+  }
+
+  uint64_t pushed() const { return m_tail; }
+
+ private:
+  ChannelMem<T> m_mem;
+  size_t m_batch = 1;
+  uint64_t m_tail = 0;
+  uint64_t m_published = 0;
+  uint64_t m_head_cache = 0;
+};
+
+template <typename T>
+class SPSCConsumer
+{
+ public:
+  SPSCConsumer() : m_mem{nullptr, nullptr, nullptr, 0} {}
+
+  SPSCConsumer(const ChannelMem<T>& mem, size_t batch = 1)
+    : m_mem(mem), m_batch(batch ? batch : 1)
+  {}
+
+  bool try_pop(T& val)
+  {
+    if (m_head == m_tail_cache) {
+      m_tail_cache = *m_mem.tail;
+      if (m_head == m_tail_cache)
+        return false;
+    }
+    detail::channel_copy((volatile T*)&val,
+                         &m_mem.slots[m_head % m_mem.capacity]);
+    ++m_head;
+    if (m_head - m_released >= m_batch)
+      flush();
+    return true;
+  }
+
+  void pop(T& val)
+  {
+    if (try_pop(val))
+      return;
+    // the producer may be waiting for slots we have not released yet
+    flush();
+    while (!try_pop(val))
+      detail::channel_wait_ne(m_mem.tail, m_tail_cache);
+  }
+
+  void flush()
+  {
+    if (m_released != m_head) {
+      *m_mem.head = m_head;
+      m_released = m_head;
+    }
+  }
+
+  uint64_t popped() const { return m_head; }
+
+ private:
+  ChannelMem<T> m_mem;
+  size_t m_batch = 1;
+  uint64_t m_head = 0;
+  uint64_t m_released = 0;
+  uint64_t m_tail_cache = 0;
+};
+
+//------------------------------------------------------------------------
+// MPSCConsumer
+//------------------------------------------------------------------------
+// Many producers, one consumer. Producers on different nodes would need
+// an atomic on a shared tail to claim slots in one ring, so instead each
+// producer owns an SPSC lane into the consumer's node and the consumer
+// drains the lanes round robin. A producer is a plain SPSCProducer on its
+// lane; entries of one producer stay in order.
+
+template <typename T>
+class MPSCConsumer
+{
+ public:
+  MPSCConsumer() = default;
+
+  MPSCConsumer(const std::vector<ChannelMem<T>>& lanes, size_t batch = 1)
+  {
+    for (const auto& lane : lanes)
+      m_lanes.emplace_back(lane, batch);
+  }
+
+  bool try_pop(T& val)
+  {
+    for (size_t i = 0; i < m_lanes.size(); ++i) {
+      size_t lane = m_next;
+      m_next = (m_next + 1) % m_lanes.size();
+      if (m_lanes[lane].try_pop(val))
+        return true;
+    }
+    return false;
+  }
+
+  void pop(T& val)
+  {
+    if (try_pop(val))
+      return;
+    flush();
+    // a wait covers one index, so the lanes are polled
+    while (!try_pop(val));
+  }
+
+  void flush()
+  {
+    for (auto& lane : m_lanes)
+      lane.flush();
+  }
+
+ private:
+  std::vector<SPSCConsumer<T>> m_lanes;
+  size_t m_next = 0;
+};
+
+} // namespace appl
+
+#endif
@@ -7,6 +7,7 @@
 #ifndef APPL_GEM5_UTILS_H
 #define APPL_GEM5_UTILS_H
 
+#include <cstddef>
 #include <cstdint>
 
 namespace appl {
@@ -24,6 +25,26 @@ void register_strel(uint64_t begin, uint64_t end);
 
 void gem5_barrier_init(uint64_t n_waiters);
 void gem5_barrier_wait(uint64_t bar_id);
+
+// Wait until *addr == val. Under gem5 with --wait-on-address the hart
+// sleeps between checks until its L1 loses the line of addr (or, for
+// NT/REL memory, is woken by the line's home L2), or for at most
+// APPL_WAIT_TIMEOUT cycles; everywhere else this is a plain spin.
+template <typename T, typename V>
+void wait_until_eq(volatile T* addr, V val);
+
+// Same for *addr != val, e.g. for an index to move on
+template <typename T, typename V>
+void wait_until_ne(volatile T* addr, V val);
+
+// Cache-line-aligned ST_NT / ST_REL memory. Allocations for the
+// same node are carved out of one region per kind that is mapped and
+// registered once (APPL_DO_ARENA_BYTES), so gem5 keeps a short list of DO
+// ranges. gem5 places pages on the node of the thread that maps them, so
+// pass the node of the calling thread. Allocations that do not fit, or
+// with node < 0, get a region of their own as before.
+void* alloc_nt(size_t bytes, int node = -1);
+void* alloc_rel(size_t bytes, int node = -1);
 }
 
 #include "appl-gem5-utils.inl"
@@ -4,6 +4,8 @@
 
 #include "appl-config.h"
 
+#include <sys/mman.h>
+
 namespace appl {
 
 inline void toggle_stats(bool on)
@@ -83,6 +85,8 @@ inline void gem5_barrier_wait(uint64_t bar_id)
                     :
                     : "r" (bar_id)
                     :);
+  // gem5 suspends the hart in the write above until the barrier opens, so
+  // the first poll succeeds
   int ready = 0;
   do {
     __asm__ volatile ("csrr %0, %1;"
@@ -94,4 +98,131 @@ inline void gem5_barrier_wait(uint64_t bar_id)
 #endif
 }
 
+#ifndef APPL_WAIT_TIMEOUT
+#define APPL_WAIT_TIMEOUT 1024
+#endif
+
+namespace detail {
+
+template <typename T, typename Done>
+inline void wait_until(volatile T* addr, Done done)
+{
+#ifdef APPL_ARCH_RISCV
+  // the first check also maps the page before the monitor is armed. On
+  // NT/REL memory the wakeup is a WAKE from the line's home L2, which
+  // only DO_MESI sends; elsewhere gem5 does not arm and this spins
+  while (!done(*addr)) {
+    __asm__ volatile ("csrw 0x798, %0;"
+                      :
+                      : "r" (addr)
+                      : "memory");
+    // an update after the arm makes the wait below return at once
+    if (done(*addr))
+      break;
+    __asm__ volatile ("csrw 0x799, %0;"
+                      :
+                      : "r" ((uint64_t)APPL_WAIT_TIMEOUT)
+                      : "memory");
+  }
+#else
+  while (!done(*addr));
+#endif
+}
+
+} // namespace detail
+
+template <typename T, typename V>
+inline void wait_until_eq(volatile T* addr, V val)
+{
+  detail::wait_until(addr, [val](T cur) { return cur == static_cast<T>(val); });
+}
+
+template <typename T, typename V>
+inline void wait_until_ne(volatile T* addr, V val)
+{
+  detail::wait_until(addr, [val](T cur) { return cur != static_cast<T>(val); });
+}
+
+#ifndef APPL_DO_ARENA_BYTES
+#define APPL_DO_ARENA_BYTES (1 << 20)
+#endif
+
+#ifndef APPL_DO_ARENA_MAX_NODES
+#define APPL_DO_ARENA_MAX_NODES 64
+#endif
+
+namespace detail {
+
+// base is 0 while unmapped and 1 while one thread maps it
+struct DOArena
+{
+  uint64_t base;
+  uint64_t used;
+};
+
+inline DOArena* do_arenas(bool rel)
+{
+  static DOArena arenas[2][APPL_DO_ARENA_MAX_NODES];
+  return arenas[rel];
+}
+
+inline void* do_map(bool rel, size_t bytes)
+{
+  void* ret = mmap(NULL, bytes, PROT_READ | PROT_WRITE,
+                   MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+  if (ret == MAP_FAILED)
+    return nullptr;
+  if (rel)
+    register_strel((uint64_t)ret, (uint64_t)ret + bytes);
+  else
+    register_stnt((uint64_t)ret, (uint64_t)ret + bytes);
+  return ret;
+}
+
+inline void* do_alloc(bool rel, size_t bytes, int node)
+{
+  const size_t line = 64;
+  bytes = (bytes + line - 1) & ~(line - 1);
+  if (node < 0 || node >= APPL_DO_ARENA_MAX_NODES ||
+      bytes > APPL_DO_ARENA_BYTES)
+    return do_map(rel, bytes);
+
+  DOArena& arena = do_arenas(rel)[node];
+  uint64_t base = __atomic_load_n(&arena.base, __ATOMIC_ACQUIRE);
+  if (base <= 1) {
+    uint64_t unmapped = 0;
+    if (__atomic_compare_exchange_n(&arena.base, &unmapped, 1, false,
+                                    __ATOMIC_ACQ_REL, __ATOMIC_ACQUIRE)) {
+      // registered before it is published, so no thread can store to it
+      // as plain memory
+      void* region = do_map(rel, APPL_DO_ARENA_BYTES);
+      if (!region) {
+        __atomic_store_n(&arena.base, 0, __ATOMIC_RELEASE);
+        return nullptr;
+      }
+      __atomic_store_n(&arena.base, (uint64_t)region, __ATOMIC_RELEASE);
+    }
+    while ((base = __atomic_load_n(&arena.base, __ATOMIC_ACQUIRE)) == 1);
+    if (base == 0)
+      return do_map(rel, bytes);
+  }
+
+  uint64_t offset = __atomic_fetch_add(&arena.used, bytes, __ATOMIC_RELAXED);
+  if (offset + bytes > APPL_DO_ARENA_BYTES)
+    return do_map(rel, bytes);
+  return (void*)(base + offset);
+}
+
+} // namespace detail
+
+inline void* alloc_nt(size_t bytes, int node)
+{
+  return detail::do_alloc(false, bytes, node);
+}
+
+inline void* alloc_rel(size_t bytes, int node)
+{
+  return detail::do_alloc(true, bytes, node);
+}
+
 } // namespace appl
\ No newline at end of file
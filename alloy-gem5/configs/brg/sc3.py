@@ -25,7 +25,7 @@ import math
 import m5
 from m5.defines import buildEnv
 from m5.objects import *
-from m5.util import addToPath, fatal, warn
+from m5.util import addToPath, convert, fatal, warn
 
 addToPath('../')
 
@@ -187,6 +187,98 @@ def makeActiveMsgNetworkTopology(adapters, network, IntLink, ExtLink, Router,
 
     network.int_links = int_links
 
+#------------------------------------------------------------------------------
+# partition the system by node
+#------------------------------------------------------------------------------
+# Every node (its cores, L1s, L2, directory, memory and routers) gets a
+# partition. Routers of different partitions only talk over the links
+# between them, which hand flits over once per sim quantum, so each
+# partition can run on its own event queue (host thread). The quantum is
+# the shortest of those links, i.e. the CG link latency.
+#
+# With serial=True all partitions stay on event queue 0 but still use the
+# quantum hand-over, which gives the reference a parallel run must match.
+
+def partitionNodes(system, root, options, serial):
+  num_nodes = options.num_l2caches
+  network = system.ruby.network
+
+  # controller -> partition, spreading each controller type evenly
+  cntrl_types = ['L1Cache_Controller', 'L2Cache_Controller',
+                 'Directory_Controller']
+  cntrl_count = {}
+  for link in network.ext_links:
+    cntrl_count[link.ext_node.type] = \
+        cntrl_count.get(link.ext_node.type, 0) + 1
+
+  def cntrl_partition(cntrl):
+    if cntrl.type not in cntrl_types:
+      return 0
+    return cntrl.version * num_nodes // cntrl_count[cntrl.type]
+
+  # routers take the partition of their controllers (switches without
+  # controllers go to partition 0)
+  router_partition = [ None ] * len(network.routers)
+  for link in network.ext_links:
+    p = cntrl_partition(link.ext_node)
+    r = link.int_node.router_id
+    if router_partition[r] is not None and router_partition[r] != p:
+      fatal("router %d serves controllers of partitions %d and %d" % \
+                                            (r, router_partition[r], p))
+    router_partition[r] = p
+  router_partition = [ p if p is not None else 0 for p in router_partition ]
+
+  quantum_cycles = None
+  for link in network.int_links:
+    if router_partition[link.src_node.router_id] != \
+       router_partition[link.dst_node.router_id]:
+      latency = int(link.latency)
+      if quantum_cycles is None or latency < quantum_cycles:
+        quantum_cycles = latency
+
+  if quantum_cycles is None:
+    warn("single node, not partitioning\n")
+    return
+
+  ruby_period = int(round(1e12 / convert.toFrequency(options.ruby_clock)))
+  root.sim_quantum = quantum_cycles * ruby_period
+  system.ruby.router_partitions = router_partition
+
+  print("Partitioned into %d nodes, quantum %d cycles%s" % \
+            (num_nodes, quantum_cycles, " (serial)" if serial else ""))
+
+  if serial:
+    return
+
+  for (i, router) in enumerate(network.routers):
+    router.eventq_index = router_partition[i]
+
+  # NIs and ext links run with their router; the controllers carry their
+  # sequencers, caches and message buffers along
+  for (i, link) in enumerate(network.ext_links):
+    p = router_partition[link.int_node.router_id]
+    link.eventq_index = p
+    link.ext_node.eventq_index = p
+    network.netifs[i].eventq_index = p
+
+  # a link runs on the side that sends into it
+  for link in network.int_links:
+    link.network_link.eventq_index = \
+        router_partition[link.src_node.router_id]
+    link.credit_link.eventq_index = \
+        router_partition[link.dst_node.router_id]
+
+  cpus_per_node = options.num_cpus // num_nodes
+  for cpu_list in [ warmup_cpu_list, main_cpu_list, cooldown_cpu_list ]:
+    if cpu_list is None:
+      continue
+    for (i, cpu) in enumerate(cpu_list):
+      cpu.eventq_index = i // cpus_per_node
+
+  mem_ctrls = getattr(system, 'mem_ctrls', [])
+  for (i, mem_ctrl) in enumerate(mem_ctrls):
+    mem_ctrl.eventq_index = i * num_nodes // len(mem_ctrls)
+
 #------------------------------------------------------------------------------
 # Adding options
 #------------------------------------------------------------------------------
@@ -321,6 +413,10 @@ for cpu in system.cpu:
 system.brg_fast_forward = options.brg_fast_forward
 system.num_nodes = options.num_l2caches
 system.num_cores = options.num_cpus
+system.wait_on_address = options.wait_on_address
+# only the DO_MESI L2s wake harts waiting on NT/REL lines
+system.wake_do_watchers = options.wait_on_address and \
+                          buildEnv['PROTOCOL'] == 'DO_MESI'
 
 #------------------------------------------------------------------------------
 # Create memory system
@@ -423,6 +519,13 @@ if options.active_message_network and np >= 2:
 
 root = Root(full_system = False, system = system)
 
+if options.partition_nodes or options.partition_serial:
+  if not options.ruby or options.network != 'garnet2.0':
+    fatal("--partition-nodes needs --ruby --network=garnet2.0")
+  if options.active_message_network and np >= 2:
+    fatal("--partition-nodes does not support the active message network")
+  partitionNodes(system, root, options, options.partition_serial)
+
 #------------------------------------------------------------------------------
 # Set up for fast-forward mode
 #------------------------------------------------------------------------------
@@ -444,7 +547,19 @@ if options.brg_fast_forward:
 # Instantiate all m5 objects
 #------------------------------------------------------------------------------
 
-checkpoint_dir = None
+# ROI checkpoints are taken when the warmup CPUs hit STATS_EN, so Ruby is
+# still cold and only the memory image, the processes and the DO ranges
+# are saved. Everything else is rebuilt from the command line on restore.
+if (options.roi_checkpoint or options.restore_roi_checkpoint) and \
+   not options.brg_fast_forward:
+  fatal("--roi-checkpoint and --restore-roi-checkpoint need "
+        "--brg-fast-forward")
+if options.roi_checkpoint and options.restore_roi_checkpoint:
+  fatal("--roi-checkpoint and --restore-roi-checkpoint cannot be combined: "
+        "a restored run starts at the ROI and never reaches the point "
+        "where the checkpoint is taken")
+
+checkpoint_dir = options.restore_roi_checkpoint
 m5.instantiate(checkpoint_dir)
 
 maxtick = m5.MaxTick
@@ -465,11 +580,23 @@ def checkExitEvent(exit_event):
     sys.exit(exit_event.getCode())
 
 if options.brg_fast_forward:
-  print("\n\n----- Entering warmup simulation -----\n")
-  exit_event = m5.simulate(maxtick)
-  print("\n\n----- Exiting warmup simulation @ tick %i because %s -----\n\n" %\
+  if options.restore_roi_checkpoint:
+    print("\n\n----- Restored ROI checkpoint %s @ tick %i -----\n" % \
+                                (options.restore_roi_checkpoint, m5.curTick()))
+  else:
+    print("\n\n----- Entering warmup simulation -----\n")
+    exit_event = m5.simulate(maxtick)
+    print("\n\n----- Exiting warmup simulation @ tick %i because %s -----\n\n" %\
                                 (m5.curTick(), exit_event.getCause()))
-  checkExitEvent(exit_event)
+    checkExitEvent(exit_event)
+
+  if options.roi_checkpoint:
+    if exit_event.getCause() != "switchcpu":
+      fatal("warmup ended before the ROI started, no checkpoint taken")
+    m5.checkpoint(options.roi_checkpoint)
+    print("\n\n----- Took ROI checkpoint %s @ tick %i -----\n" % \
+                                (options.roi_checkpoint, m5.curTick()))
+    sys.exit(0)
 
   print("\n\n----- Switching to main CPUs ----\n")
   exit_event = m5.switchCpus(system, switch_warmup_cpu_pairs)
@@ -421,6 +421,17 @@ def addBRGOptions(parser):
                       help="Skip cooldown phase (valid only if \
                             brg-fast-forward is set)")
 
+    # Checkpoint at the start of the ROI (appl::start_stats()), so that
+    # sweeps over network parameters only simulate the ROI
+    parser.add_option('--roi-checkpoint', default=None, type="string",
+                      help="take a checkpoint in this directory when the \
+                            ROI starts and exit (needs brg-fast-forward)")
+    parser.add_option('--restore-roi-checkpoint', default=None,
+                      type="string",
+                      help="start from a --roi-checkpoint directory; \
+                            network latencies and message sizes may differ \
+                            from the run that took it")
+
     # Enable CPU activity trace
     parser.add_option("--activity-trace", action="store_true",
                       help="Turn on activity trace")
@@ -494,4 +505,43 @@ def addBRGSC3Options(parser):
     parser.add_option("--tiny_l1i_assoc", type="int", default=2)
 
 def addDOOptions(parser):
-    parser.add_option('--CG_link_latency', type="int", default="600")    
\ No newline at end of file
+    parser.add_option('--CG_link_latency', type="int", default="600")
+    parser.add_option('--CG_link_bandwidth', type="int", default=0,
+                      help="""bytes/cycle of the inter-PU link (e.g. 32 for
+                            a CXL x16 link at 2GHz); flits wider than this
+                            are serialized over several cycles. 0 keeps one
+                            flit per cycle""")
+    parser.add_option('--CG_link_sample_cycles', type="int", default=0,
+                      help="""sample per-vnet flits and VC occupancy of the
+                            CG links every N cycles into
+                            <network>.cg_link_samples.csv (0: off)""")
+    parser.add_option('--CG_link_sample_windows', type="int", default=4096,
+                      help="""CG link samples kept between stats dumps""")
+    # CXLSwitchTree fabric (UPIFullyConnected only uses --CG_link_latency)
+    parser.add_option('--CG_switch_radix', type="int", default=4,
+                      help="L2 routers per CXL leaf switch")
+    parser.add_option('--CG_num_spines', type="int", default=1,
+                      help="spine switches above the CXL leaf switches")
+    parser.add_option('--CG_spine_link_latency', type="int", default=None,
+                      help="""leaf-to-spine link latency (default:
+                            --CG_link_latency)""")
+    parser.add_option('--CG_switch_latency', type="int", default=None,
+                      help="""CXL switch router latency (default:
+                            --router-latency)""")
+    parser.add_option('--wait-on-address', action="store_true",
+                      default=False,
+                      help="""suspend harts on the wait-on-address CSRs
+                            until their L1 loses the watched line (the
+                            L1s send evictions to the CPUs); with DO_MESI
+                            the L2s also wake the readers of NT/REL
+                            lines""")
+    # Partitioned simulation (see partitionNodes in brg/sc3.py)
+    parser.add_option('--partition-nodes', action="store_true",
+                      default=False,
+                      help="""simulate every node on its own host thread,
+                            synchronized every CG link latency""")
+    parser.add_option('--partition-serial', action="store_true",
+                      default=False,
+                      help="""partition like --partition-nodes but run all
+                            nodes on one thread (reference for the
+                            parallel run)""")    
\ No newline at end of file
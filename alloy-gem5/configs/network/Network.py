@@ -94,9 +94,26 @@ def define_options(parser):
                       default=0,
                       help="""maximal buffer size in the network
                               (0 means infinite)""")
+    parser.add_option("--msg-size", action="append", type="string",
+                      default=[],
+                      help="""payload bytes of a MessageSizeType as
+                            TYPE:bytes, e.g. PUT_NT:256 (a control header
+                            is added). May be given more than once.""")
+    parser.add_option("--put-nt-size-from-mask", action="store_true",
+                      default=False,
+                      help="""size each PUT_NT by the bytes set in its
+                            write mask instead of by its MessageSizeType""")
 
 def create_network(options, ruby):
 
+    ruby.msg_size_overrides = options.msg_size
+    ruby.put_nt_size_from_mask = options.put_nt_size_from_mask
+    # only scripts that add the DO options model a CG link
+    ruby.cg_link_bandwidth = getattr(options, 'CG_link_bandwidth', 0)
+    ruby.cg_link_sample_cycles = getattr(options, 'CG_link_sample_cycles', 0)
+    ruby.cg_link_sample_windows = \
+        getattr(options, 'CG_link_sample_windows', 4096)
+
     # Set the network classes based on the command line options
     if options.network == "garnet2.0":
         NetworkClass = GarnetNetwork
@@ -53,7 +53,10 @@ class L1Cache(RubyCache): pass
 class L2Cache(RubyCache): pass
 
 def define_options(parser):
-    return
+    parser.add_option("--do-consistency-model", type="choice",
+                      default="RC", choices=["RC", "TSO", "TSO_WB"],
+                      help="how sequencers issue accesses to ST_NT/ST_REL "
+                           "regions: RC, TSO or TSO_WB")
 
 def create_system(options, full_system, system, dma_ports, bootmem,
                   ruby_system):
@@ -109,7 +112,10 @@ def create_system(options, full_system, system, dma_ports, bootmem,
         l1_cntrl = L1Cache_Controller(version = i, L1Icache = l1i_cache,
                                       L1Dcache = l1d_cache,
                                       l2_select_num_bits = l2_bits,
-                                      send_evictions = send_evicts(options),
+                                      send_evictions = \
+                                          send_evicts(options) or \
+                                          getattr(options, 'wait_on_address',
+                                                  False),
                                       prefetcher = prefetcher,
                                       ruby_system = ruby_system,
                                       clk_domain = clk_domain,
@@ -119,6 +125,8 @@ def create_system(options, full_system, system, dma_ports, bootmem,
 
         cpu_seq = DOSequencer(version = i, icache = l1i_cache,
                                 dcache = l1d_cache, clk_domain = clk_domain,
+                                consistency_model = \
+                                    options.do_consistency_model,
                                 ruby_system = ruby_system)
 
 
@@ -53,7 +53,21 @@ class L1Cache(RubyCache): pass
 class L2Cache(RubyCache): pass
 
 def define_options(parser):
-    return
+    parser.add_option("--do-consistency-model", type="choice",
+                      default="RC", choices=["RC", "TSO", "TSO_WB"],
+                      help="how sequencers issue accesses to ST_NT/ST_REL "
+                           "regions: RC, TSO or TSO_WB")
+    parser.add_option("--do-l2-depth", type="int", default=16,
+                      help="epoch slots per requestor in the L2 DO table")
+    parser.add_option("--do-wc-entries", type="int", default=0,
+                      help="ST_NT write-combining entries per sequencer "
+                           "(0 disables combining)")
+    parser.add_option("--do-wc-timeout", type="int", default=64,
+                      help="cycles before a write-combining entry is "
+                           "flushed (0 disables the timeout)")
+    parser.add_option("--do-wc-flush-all", action="store_true",
+                      help="flush the whole write-combining buffer, not "
+                           "only the oldest entry, when it is full")
 
 def create_system(options, full_system, system, dma_ports, bootmem,
                   ruby_system):
@@ -108,8 +122,12 @@ def create_system(options, full_system, system, dma_ports, bootmem,
 
         l1_cntrl = L1Cache_Controller(version = i, L1Icache = l1i_cache,
                                       L1Dcache = l1d_cache,
+                                      DOTable = RubyDOCPUTable(),
                                       l2_select_num_bits = l2_bits,
-                                      send_evictions = send_evicts(options),
+                                      send_evictions = \
+                                          send_evicts(options) or \
+                                          getattr(options, 'wait_on_address',
+                                                  False),
                                       prefetcher = prefetcher,
                                       ruby_system = ruby_system,
                                       clk_domain = clk_domain,
@@ -119,6 +137,11 @@ def create_system(options, full_system, system, dma_ports, bootmem,
 
         cpu_seq = DOSequencer(version = i, icache = l1i_cache,
                                 dcache = l1d_cache, clk_domain = clk_domain,
+                                consistency_model = \
+                                    options.do_consistency_model,
+                                wc_entries = options.do_wc_entries,
+                                wc_timeout = options.do_wc_timeout,
+                                wc_flush_all = options.do_wc_flush_all,
                                 ruby_system = ruby_system)
 
 
@@ -169,6 +192,8 @@ def create_system(options, full_system, system, dma_ports, bootmem,
 
         l2_cntrl = L2Cache_Controller(version = i,
                                       L2cache = l2_cache,
+                                      DOTable = RubyDOL2Table(
+                                          depth = options.do_l2_depth),
                                       transitions_per_cycle = options.ports,
                                       ruby_system = ruby_system)
 
@@ -0,0 +1,188 @@
+ # SPDX-FileCopyrightText: Copyright (c) 2024 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ # SPDX-License-Identifier: LicenseRef-NvidiaProprietary
+ #
+ # NVIDIA CORPORATION, its affiliates and licensors retain all intellectual
+ # property and proprietary rights in and to this material, related
+ # documentation and any modifications thereto. Any use, reproduction,
+ # disclosure or distribution of this material and related documentation
+ # without an express license agreement from NVIDIA CORPORATION or
+ # its affiliates is strictly prohibited.
+
+
+# Copyright (c) 2010 Advanced Micro Devices, Inc.
+# All rights reserved.
+#
+# Redistribution and use in source and binary forms, with or without
+# modification, are permitted provided that the following conditions are
+# met: redistributions of source code must retain the above copyright
+# notice, this list of conditions and the following disclaimer;
+# redistributions in binary form must reproduce the above copyright
+# notice, this list of conditions and the following disclaimer in the
+# documentation and/or other materials provided with the distribution;
+# neither the name of the copyright holders nor the names of its
+# contributors may be used to endorse or promote products derived from
+# this software without specific prior written permission.
+#
+# THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+# "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+# LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+# A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+# OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+# SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+# LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+# DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+# THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+# (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+# OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+#
+# Authors: Brad Beckmann
+
+from m5.params import *
+from m5.objects import *
+
+from BaseTopology import SimpleTopology
+
+# Two-level CXL switch fabric. Each PU is a star of L1 routers around its
+# L2/directory router, as in TwoMeshXY. The L2 routers hang off leaf
+# switches, --CG_switch_radix per leaf (link latency --CG_link_latency),
+# and each leaf connects to every one of --CG_num_spines spine switches
+# (latency --CG_spine_link_latency). With a single leaf there is no spine
+# tier and this is the TwoMeshXY star.
+#
+# Routing stays deterministic under the table-based router: a leaf's
+# uplink to spine (leaf % num_spines) has weight 1 and its other uplinks
+# weight 2, so traffic from each leaf has exactly one minimal path, and
+# the leaves' home spines spread the load across the spine tier.
+
+class CXLSwitchTree(SimpleTopology):
+    description='CXLSwitchTree'
+
+    def __init__(self, controllers):
+        self.nodes = controllers
+
+    def makeTopology(self, options, network, IntLink, ExtLink, Router):
+        nodes = self.nodes
+        num_cpus = options.num_cpus
+
+        # default values for link latency and router latency.
+        # Can be over-ridden on a per link/router basis
+        link_latency = options.link_latency # used by simple and garnet
+        leaf_link_latency = options.CG_link_latency
+        spine_link_latency = options.CG_spine_link_latency
+        if spine_link_latency is None:
+            spine_link_latency = leaf_link_latency
+        router_latency = options.router_latency # only used by garnet
+        switch_latency = options.CG_switch_latency
+        if switch_latency is None:
+            switch_latency = router_latency
+
+        # First determine which nodes are cache cntrls vs. dirs vs. dma
+        cache_nodes = []
+        l2cache_nodes = []
+        dir_nodes = []
+        dma_nodes = []
+        for node in nodes:
+            if node.type == 'L1Cache_Controller' or \
+               node.type == 'SC3_Controller' or \
+               node.type == 'DeNovo_Controller':
+                cache_nodes.append(node)
+            elif node.type == 'L2Cache_Controller':
+                l2cache_nodes.append(node)
+            elif node.type == 'Directory_Controller':
+                dir_nodes.append(node)
+            elif node.type == 'DMA_Controller':
+                dma_nodes.append(node)
+
+        assert(len(cache_nodes) == num_cpus)
+        assert(len(l2cache_nodes) == len(dir_nodes))
+        assert(num_cpus % len(l2cache_nodes) == 0)
+        assert(options.CG_switch_radix > 0 and options.CG_num_spines > 0)
+        num_l2caches = len(l2cache_nodes)
+        num_cpus_per_l2cache = num_cpus // num_l2caches
+        radix = options.CG_switch_radix
+        num_leaves = (num_l2caches + radix - 1) // radix
+        num_spines = options.CG_num_spines if num_leaves > 1 else 0
+
+        # routers: L1s, then L2s, then leaf switches, then spine switches
+        first_leaf = num_cpus + num_l2caches
+        first_spine = first_leaf + num_leaves
+        num_routers = first_spine + num_spines
+
+        routers = [Router(router_id=i,
+                          latency = router_latency if i < first_leaf \
+                                    else switch_latency) \
+            for i in range(num_routers)]
+        network.routers = routers
+
+        # link counter to set unique link ids
+        link_count = 0
+
+        # Connect each L1 cache controller to the appropriate router
+        ext_links = []
+        for (i, n) in enumerate(cache_nodes):
+            router_id = i
+            ext_links.append(ExtLink(link_id=link_count, ext_node=n,
+                                    int_node=routers[router_id],
+                                    latency = link_latency))
+            link_count += 1
+
+        for (i, n) in enumerate(l2cache_nodes):
+            router_id = num_cpus + i
+            ext_links.append(
+                ExtLink(link_id=link_count, ext_node=n,
+                        int_node=routers[router_id],
+                        latency = link_latency)
+            )
+            link_count += 1
+
+        for (i, n) in enumerate(dir_nodes):
+            router_id = num_cpus + i
+            ext_links.append(
+                ExtLink(link_id=link_count, ext_node=n,
+                        int_node=routers[router_id],
+                        latency = link_latency)
+            )
+            link_count += 1
+
+        # Connect the dma nodes to router 0.  These should only be DMA nodes.
+        for (i, node) in enumerate(dma_nodes):
+            assert(node.type == 'DMA_Controller')
+            ext_links.append(ExtLink(link_id=link_count, ext_node=node,
+                                     int_node=routers[0],
+                                     latency = link_latency))
+            link_count += 1
+
+        network.ext_links = ext_links
+
+        int_links = []
+
+        def connect(src, dst, latency, weight):
+            int_links.append(IntLink(link_id=link_count + len(int_links),
+                                     src_node=routers[src],
+                                     dst_node=routers[dst],
+                                     latency = latency,
+                                     weight = weight))
+
+        # On-PU star: each L1 router to its PU's L2 router
+        for router_id in range(num_cpus):
+            root_router_id = num_cpus + (router_id // num_cpus_per_l2cache)
+            connect(router_id, root_router_id, link_latency, 1)
+            connect(root_router_id, router_id, link_latency, 1)
+
+        # Leaf tier: each L2 router to its leaf switch
+        for i in range(num_l2caches):
+            l2_router_id = num_cpus + i
+            leaf_router_id = first_leaf + (i // radix)
+            connect(l2_router_id, leaf_router_id, leaf_link_latency, 1)
+            connect(leaf_router_id, l2_router_id, leaf_link_latency, 1)
+
+        # Spine tier: every leaf to every spine, preferring its home spine
+        for leaf in range(num_leaves):
+            for spine in range(num_spines):
+                up_weight = 1 if spine == leaf % num_spines else 2
+                connect(first_leaf + leaf, first_spine + spine,
+                        spine_link_latency, up_weight)
+                connect(first_spine + spine, first_leaf + leaf,
+                        spine_link_latency, 1)
+
+        network.int_links = int_links
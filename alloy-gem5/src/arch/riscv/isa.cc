@@ -58,7 +58,9 @@
 #include "debug/DOMEM.hh"
 #include "params/RiscvISA.hh"
 #include "sim/core.hh"
+#include "sim/process.hh"
 #include "sim/pseudo_inst.hh"
+#include "sim/system.hh"
 
 namespace RiscvISA
 {
@@ -185,7 +187,7 @@ ISA::readMiscReg(int misc_reg, ThreadContext *tc)
       }
       case MISCREG_BARRIER_POLL:
         // DPRINTF(DOMEM, "cpu[%d] poll barrier\n", tc->getCpuPtr()->cpuId());
-        return tc->getProcessPtr()->barrierReady(tc->getCpuPtr()->cpuId());
+        return tc->getProcessPtr()->barrierReady(tc);
       default:
         // Try reading HPM counters
         // As a placeholder, all HPM counters are just cycle counters
@@ -247,6 +249,23 @@ ISA::setMiscReg(int misc_reg, RegVal val, ThreadContext *tc)
             return tc->getCpuPtr()->getInterruptController(tc->threadId())
                                   ->setIE(val);
           }
+          case MISCREG_WAIT_ADDR:
+          case MISCREG_WAIT: {
+            setMiscRegNoEffect(misc_reg, val);
+            // only the timing CPU models waiting; elsewhere both CSRs are
+            // no-ops and the caller's poll loop simply spins
+            auto cpu = dynamic_cast<TimingSimpleCPU*>(tc->getCpuPtr());
+            if (!cpu || !tc->getSystemPtr()->wait_on_address)
+                return;
+            if (misc_reg == MISCREG_WAIT_ADDR) {
+                Addr paddr;
+                if (tc->getProcessPtr()->pTable->translate(val, paddr))
+                    cpu->armWait(tc->threadId(), paddr);
+            } else {
+                cpu->waitOnAddr(tc->threadId(), Cycles(val));
+            }
+            return;
+          }
           default: {
             setMiscRegNoEffect(misc_reg, val);
           }
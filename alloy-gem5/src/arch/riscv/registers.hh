@@ -299,6 +299,12 @@ enum MiscRegIndex {
     MISCREG_BARRIER_WAIT,
     MISCREG_BARRIER_POLL,
 
+    // wait-on-address: WAIT_ADDR arms a monitor on the line of a virtual
+    // address, WAIT suspends the hart until that line is invalidated in
+    // its L1 or the written number of cycles pass (0: no timeout)
+    MISCREG_WAIT_ADDR,
+    MISCREG_WAIT,
+
     // control communication from an external manager to a processor. This
     // is read- and write-enabled.
     MISCREG_PROC2MNGR,
@@ -567,6 +573,8 @@ enum CSRIndex {
     CSR_BARRIER_INIT  = 0x7F0,
     CSR_BARRIER_WAIT  = 0x7F8,
     CSR_BARRIER_POLL  = 0x790,
+    CSR_WAIT_ADDR  = 0x798,
+    CSR_WAIT  = 0x799,
 
     CSR_PROC2MNGR = 0x7C0,
     CSR_MNGR2PROC = 0xFC0,
@@ -818,6 +826,8 @@ const std::map<int, CSRMetadata> CSRData = {
     {CSR_BARRIER_INIT , { "barrier_init"  , MISCREG_BARRIER_INIT   }},
     {CSR_BARRIER_WAIT , { "barrier_wait"  , MISCREG_BARRIER_WAIT   }},
     {CSR_BARRIER_POLL , { "barrier_poll"  , MISCREG_BARRIER_POLL   }},
+    {CSR_WAIT_ADDR , { "wait_addr"  , MISCREG_WAIT_ADDR   }},
+    {CSR_WAIT , { "wait"  , MISCREG_WAIT   }},
     {CSR_PROC2MNGR, { "proc2mngr" , MISCREG_PROC2MNGR  }},
     {CSR_MNGR2PROC, { "mngr2proc" , MISCREG_MNGR2PROC  }},
     {CSR_NUMCORES , { "numcores"  , MISCREG_NUMCORES   }},
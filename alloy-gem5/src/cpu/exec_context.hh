@@ -263,7 +263,7 @@ class ExecContext {
                 DPRINTF(DOMEM, "cpu[%d] init barrier\n", tcBase()->getCpuPtr()->cpuId());
                 break;
             case TheISA::MISCREG_BARRIER_WAIT:
-                tcBase()->getProcessPtr()->barrierWait(val);
+                tcBase()->getProcessPtr()->barrierWait(val, tcBase());
                 DPRINTF(DOMEM, "cpu[%d] wait barrier\n", tcBase()->getCpuPtr()->cpuId());
                 break;
             case TheISA::MISCREG_STATS_EN:
@@ -283,6 +283,7 @@ class ExecContext {
                     // schedule a stat event to reset all stats but not dump
                     // them (dump = false, reset = true)
                     Stats::schedStatEvent(false, true);
+                    tcBase()->getSystemPtr()->inROI = true;
 
                     // entering a timing region, we need to switch from
                     // a CPU model used to warm up to a detailed timing model.
@@ -311,6 +312,7 @@ class ExecContext {
                     // schedule a stat event to dump all stats but not reset
                     // them (dump = true, reset = false)
                     Stats::schedStatEvent(true, false);
+                    tcBase()->getSystemPtr()->inROI = false;
 
                     // @tuan: a hacky way to exit for simulation purpose
                     // uncomment this line to abort the simulation
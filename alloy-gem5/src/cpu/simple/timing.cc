@@ -72,6 +72,7 @@
 #include "params/TimingSimpleCPU.hh"
 #include "sim/faults.hh"
 #include "sim/full_system.hh"
+#include "sim/process.hh"
 #include "sim/system.hh"
 
 using namespace std;
@@ -111,6 +112,13 @@ TimingSimpleCPU::TimingSimpleCPU(TimingSimpleCPUParams *p)
     active_message_ack_latency  = 0;
     num_active_message_nack     = 0;
     active_message_nack_latency = 0;
+
+    waitMonitors.resize(numThreads);
+    for (ThreadID tid = 0; tid < numThreads; tid++) {
+        waitMonitors[tid].timeoutEvent.reset(new EventFunctionWrapper(
+            [this, tid]{ ++num_wait_timeouts; endWait(tid); },
+            name() + ".waitTimeout"));
+    }
 #endif
 }
 
@@ -129,6 +137,15 @@ TimingSimpleCPU::drain()
     if (switchedOut())
         return DrainState::Drained;
 
+#if THE_ISA == RISCV_ISA
+    // end any wait so that no thread is left suspended on a monitor that
+    // the next CPU does not have
+    for (ThreadID tid = 0; tid < numThreads; tid++) {
+        if (waitMonitors[tid].waiting)
+            endWait(tid);
+    }
+#endif
+
     if (_status == Idle ||
         (_status == BaseSimpleCPU::Running && isDrained())) {
         DPRINTF(Drain, "No need to drain.\n");
@@ -724,6 +741,9 @@ TimingSimpleCPU::threadSnoop(PacketPtr pkt, ThreadID sender)
                     dcachePort.cacheBlockMask);
         }
     }
+#if THE_ISA == RISCV_ISA
+    wakeWaiters(pkt->getAddr() & dcachePort.cacheBlockMask);
+#endif
 }
 
 void
@@ -1109,6 +1129,9 @@ TimingSimpleCPU::DcachePort::recvTimingSnoopReq(PacketPtr pkt)
         for (auto &t_info : cpu->threadInfo) {
             TheISA::handleLockedSnoop(t_info->thread, pkt, cacheBlockMask);
         }
+#if THE_ISA == RISCV_ISA
+        cpu->wakeWaiters(pkt->getAddr() & cacheBlockMask);
+#endif
     }
 }
 
@@ -1544,12 +1567,101 @@ TimingSimpleCPU::toggleCSR(int misc_reg, RegVal reg_val)
     }
 }
 
+void
+TimingSimpleCPU::armWait(ThreadID tid, Addr paddr)
+{
+    WaitMonitor &mon = waitMonitors[tid];
+    assert(!mon.waiting);
+
+    // LD_NT/LD_ACQ do not make this L1 a sharer of an NT or REL line, so
+    // a remote ST_NT/ST_REL never evicts it here. Only L2s that send a
+    // WAKE to the readers of such a line wake the thread; without them
+    // the word is left to the caller's poll loop.
+    Process *process = threadInfo[tid]->thread->getProcessPtr();
+    if (!system->wake_do_watchers && process &&
+        process->getDOAddrClass(paddr) != DORangeIndex::DO_NONE) {
+        mon.armed = false;
+        DPRINTF(Mwait, "[tid:%d] not arming DO line %#x\n", tid,
+                paddr & dcachePort.cacheBlockMask);
+        return;
+    }
+
+    mon.armed = true;
+    mon.lost = false;
+    mon.line = paddr & dcachePort.cacheBlockMask;
+    DPRINTF(Mwait, "[tid:%d] arm wait on line %#x\n", tid, mon.line);
+}
+
+void
+TimingSimpleCPU::waitOnAddr(ThreadID tid, Cycles timeout)
+{
+    WaitMonitor &mon = waitMonitors[tid];
+
+    // nothing armed, the line is already gone, or the CPU is draining
+    if (!mon.armed || mon.lost || drainState() != DrainState::Running) {
+        mon.armed = false;
+        return;
+    }
+
+    DPRINTF(Mwait, "[tid:%d] wait on line %#x for %d cycles\n", tid,
+            mon.line, timeout);
+    ++num_waits;
+    mon.waiting = true;
+    mon.start = curCycle();
+    if (timeout > 0)
+        schedule(*mon.timeoutEvent, clockEdge(timeout));
+    threadInfo[tid]->thread->suspend();
+}
+
+void
+TimingSimpleCPU::wakeWaiters(Addr line)
+{
+    for (ThreadID tid = 0; tid < numThreads; tid++) {
+        WaitMonitor &mon = waitMonitors[tid];
+        if (!mon.armed || mon.line != line)
+            continue;
+        mon.lost = true;
+        if (mon.waiting)
+            endWait(tid);
+    }
+}
+
+void
+TimingSimpleCPU::endWait(ThreadID tid)
+{
+    WaitMonitor &mon = waitMonitors[tid];
+    assert(mon.waiting);
+    DPRINTF(Mwait, "[tid:%d] wake from line %#x\n", tid, mon.line);
+
+    mon.waiting = false;
+    mon.armed = false;
+    if (mon.timeoutEvent->scheduled())
+        deschedule(*mon.timeoutEvent);
+    wait_cycles += curCycle() - mon.start;
+    threadInfo[tid]->thread->activate();
+}
+
 void
 TimingSimpleCPU::regStats()
 {
     BaseSimpleCPU::regStats();
     using namespace Stats;
 
+    num_waits
+        .name(name() + ".num_waits")
+        .desc("number of wait-on-address suspensions")
+        ;
+
+    num_wait_timeouts
+        .name(name() + ".num_wait_timeouts")
+        .desc("number of wait-on-address suspensions ended by timeout")
+        ;
+
+    wait_cycles
+        .name(name() + ".wait_cycles")
+        .desc("cycles spent suspended in wait-on-address")
+        ;
+
     num_active_message_ack
         .name(name() + ".num_active_message_ack")
         .desc("number of active messages ACK received");
@@ -56,6 +56,9 @@
 #ifndef __CPU_SIMPLE_TIMING_HH__
 #define __CPU_SIMPLE_TIMING_HH__
 
+#include <memory>
+#include <vector>
+
 #include "arch/registers.hh"
 #include "cpu/simple/base.hh"
 #include "cpu/simple/exec_context.hh"
@@ -564,6 +567,38 @@ class TimingSimpleCPU : public BaseSimpleCPU
 
     void toggle_stats_en(bool on) override;
     void toggleCSR(int misc_reg, RegVal reg_val) override;
+
+    /**
+     * Wait-on-address (CSR_WAIT_ADDR, CSR_WAIT). armWait() starts watching
+     * the cache line of paddr, and waitOnAddr() suspends the thread until
+     * the L1 invalidates or evicts that line (the L1 controller's eviction
+     * callback, received as a snoop) or timeout cycles pass. If the line
+     * was lost in between, waitOnAddr() returns at once, so a check of the
+     * watched word between the two cannot miss an update. Lines of ST_NT
+     * and ST_REL regions are woken by a WAKE from their home L2 instead,
+     * and are not armed unless System::wake_do_watchers is set.
+     */
+    void armWait(ThreadID tid, Addr paddr);
+    void waitOnAddr(ThreadID tid, Cycles timeout);
+
+    Stats::Scalar num_waits;
+    Stats::Scalar num_wait_timeouts;
+    Stats::Scalar wait_cycles;
+
+  private:
+    struct WaitMonitor
+    {
+        bool armed = false;
+        bool lost = false;
+        bool waiting = false;
+        Addr line = 0;
+        Cycles start;
+        std::unique_ptr<EventFunctionWrapper> timeoutEvent;
+    };
+    std::vector<WaitMonitor> waitMonitors;
+
+    void wakeWaiters(Addr line);
+    void endWait(ThreadID tid);
 #endif
 };
 
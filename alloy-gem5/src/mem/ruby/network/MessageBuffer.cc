@@ -48,10 +48,10 @@
 #include "base/random.hh"
 #include "base/stl_helpers.hh"
 #include "debug/RubyQueue.hh"
-#include "debug/DOSTORAGE.hh"
 #include "mem/protocol/MessageSizeType.hh"
 #include "mem/protocol/RequestMsg.hh"
 #include "mem/protocol/ResponseMsg.hh"
+#include "mem/ruby/network/MessageSize.hh"
 #include "mem/ruby/network/Network.hh"
 #include "mem/ruby/system/RubySystem.hh"
 
@@ -60,6 +60,7 @@ using m5::stl_helpers::operator<<;
 
 Stats::Vector MessageBuffer::m_coh_msg_count;
 Stats::Vector MessageBuffer::m_coh_msg_bytes;
+std::vector<MessageBuffer *> MessageBuffer::m_all_buffers;
 
 bool MessageBuffer::m_init_static_stats = false;
 
@@ -85,6 +86,11 @@ MessageBuffer::MessageBuffer(const Params *p)
     m_stall_time = 0;
 
     m_dequeue_callback = nullptr;
+
+    m_local_coh_msg_count.resize(CoherenceRequestType_NUM +
+                                 CoherenceResponseType_NUM, 0);
+    m_local_coh_msg_bytes.resize(CoherenceRequestType_NUM +
+                                 CoherenceResponseType_NUM, 0);
 }
 
 unsigned int
@@ -304,22 +310,23 @@ MessageBuffer::dequeue(Tick current_time, bool decrement_messages)
         RequestMsg* req_msg_ptr = dynamic_cast<RequestMsg*>(message.get());
         if (req_msg_ptr) {
           unsigned int i = req_msg_ptr->getType();
-          m_coh_msg_count[i]++;
-          m_coh_msg_bytes[i] +=
-               Network::MessageSizeType_to_int(req_msg_ptr->getMessageSize());
+          m_local_coh_msg_count[i]++;
+          m_local_coh_msg_bytes[i] += messageSizeBytes(req_msg_ptr);
         }
 
         // try cast the message to ResponseMsg
         ResponseMsg* resp_msg_ptr = dynamic_cast<ResponseMsg*>(message.get());
         if (resp_msg_ptr) {
           unsigned int i = CoherenceRequestType_NUM + resp_msg_ptr->getType();
-          m_coh_msg_count[i]++;
-          m_coh_msg_bytes[i] +=
-               Network::MessageSizeType_to_int(resp_msg_ptr->getMessageSize());
+          m_local_coh_msg_count[i]++;
+          m_local_coh_msg_bytes[i] += messageSizeBytes(resp_msg_ptr);
         }
     }
 
-    recycled_st_rels.erase(message.get());
+    // only buffers holding a recycled message pay for the lookup
+    if (!m_recycled_msgs.empty()) {
+        m_recycled_msgs.erase(message.get());
+    }
 
     return delay;
 }
@@ -346,6 +353,7 @@ MessageBuffer::clear()
     m_time_last_time_pop = 0;
     m_size_at_cycle_start = 0;
     m_msgs_this_cycle = 0;
+    m_recycled_msgs.clear();
 }
 
 void
@@ -363,8 +371,12 @@ MessageBuffer::recycle(Tick current_time, Tick recycle_latency)
     push_heap(m_prio_heap.begin(), m_prio_heap.end(), greater<MsgPtr>());
     m_consumer->scheduleEventAbsolute(future_time);
 
-    recycled_st_rels.insert(node.get());
-    DPRINTF(DOSTORAGE, "recycledStRel %lu\n", recycled_st_rels.size());
+    if (m_recycled_msgs.insert(node.get()).second) {
+        m_recycled_msgs_hist.sample(m_recycled_msgs.size());
+        if (m_recycled_msgs.size() > m_max_recycled_msgs.value()) {
+            m_max_recycled_msgs = m_recycled_msgs.size();
+        }
+    }
 }
 
 void
@@ -499,6 +511,17 @@ MessageBuffer::regStats()
         .desc("Average number of cycles messages are stalled in this MB")
         .flags(Stats::nozero);
 
+    m_max_recycled_msgs
+        .name(name() + ".max_recycled_msgs")
+        .desc("Max recycled messages waiting in this buffer at once")
+        .flags(Stats::nozero);
+
+    m_recycled_msgs_hist
+        .init(16)
+        .name(name() + ".recycled_msgs")
+        .desc("Recycled messages waiting in this buffer on each new recycle")
+        .flags(Stats::nozero | Stats::pdf);
+
     if (m_max_size > 0) {
         m_occupancy = m_buf_msgs / m_max_size;
     } else {
@@ -534,8 +557,32 @@ MessageBuffer::regStats()
             m_coh_msg_bytes.subname(i, CoherenceResponseType_to_string(type));
         }
 
+        Stats::registerDumpCallback(new CohMsgStatsCallback());
         m_init_static_stats = true;
     }
+    m_all_buffers.push_back(this);
+}
+
+void
+MessageBuffer::resetStats()
+{
+    std::fill(m_local_coh_msg_count.begin(), m_local_coh_msg_count.end(), 0);
+    std::fill(m_local_coh_msg_bytes.begin(), m_local_coh_msg_bytes.end(), 0);
+}
+
+void
+MessageBuffer::collateCohMsgStats()
+{
+    for (size_t i = 0; i < m_coh_msg_count.size(); ++i) {
+        Counter count = 0;
+        Counter bytes = 0;
+        for (const MessageBuffer *buf : m_all_buffers) {
+            count += buf->m_local_coh_msg_count[i];
+            bytes += buf->m_local_coh_msg_bytes[i];
+        }
+        m_coh_msg_count[i] = count;
+        m_coh_msg_bytes[i] = bytes;
+    }
 }
 
 uint32_t
@@ -55,6 +55,7 @@
 #include <vector>
 #include <unordered_set>
 
+#include "base/callback.hh"
 #include "base/trace.hh"
 #include "debug/RubyQueue.hh"
 #include "mem/protocol/CoherenceRequestType.hh"
@@ -139,6 +140,11 @@ class MessageBuffer : public SimObject
     void setVnet(int net) { m_vnet_id = net; }
 
     void regStats();
+    void resetStats() override;
+
+    // fold the per-buffer coherence message counts into coh_msg_count and
+    // coh_msg_bytes; called before every stats dump
+    static void collateCohMsgStats();
 
     // Function for figuring out if any of the messages in the buffer need
     // to be updated with the data from the packet.
@@ -227,8 +233,25 @@ class MessageBuffer : public SimObject
     static bool m_init_static_stats;
     static Stats::Vector m_coh_msg_count;
     static Stats::Vector m_coh_msg_bytes;
+    // Buffers of different partitions dequeue on different host threads,
+    // so each buffer counts on its own and the totals are summed up at
+    // dump time.
+    static std::vector<MessageBuffer *> m_all_buffers;
+    std::vector<Counter> m_local_coh_msg_count;
+    std::vector<Counter> m_local_coh_msg_bytes;
+
+    // messages that were recycled at least once and are still in this
+    // buffer; pruned on dequeue, so bounded by the buffer occupancy
+    std::unordered_set<const Message*> m_recycled_msgs;
+    Stats::Scalar m_max_recycled_msgs;
+    Stats::Histogram m_recycled_msgs_hist;
+};
 
-    std::unordered_set<Message*> recycled_st_rels;
+class CohMsgStatsCallback : public Callback
+{
+  public:
+    virtual ~CohMsgStatsCallback() {}
+    void process() { MessageBuffer::collateCohMsgStats(); }
 };
 
 Tick random_time();
@@ -0,0 +1,46 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2024 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: LicenseRef-NvidiaProprietary
+ *
+ * NVIDIA CORPORATION, its affiliates and licensors retain all intellectual
+ * property and proprietary rights in and to this material, related
+ * documentation and any modifications thereto. Any use, reproduction,
+ * disclosure or distribution of this material and related documentation
+ * without an express license agreement from NVIDIA CORPORATION or
+ * its affiliates is strictly prohibited.
+ */
+
+#ifndef __MEM_RUBY_NETWORK_MESSAGESIZE_HH__
+#define __MEM_RUBY_NETWORK_MESSAGESIZE_HH__
+
+#include <cstdint>
+
+#include "mem/protocol/MessageSizeType.hh"
+#include "mem/protocol/STNT_RequestMsg.hh"
+#include "mem/ruby/network/Network.hh"
+#include "mem/ruby/slicc_interface/Message.hh"
+#include "mem/ruby/system/RubySystem.hh"
+
+/**
+ * On-wire size of one message in bytes.
+ *
+ * Same as Network::MessageSizeType_to_int() except that, with
+ * put_nt_size_from_mask, a PUT_NT is sized by the bytes it actually
+ * writes: a control header plus one byte per set bit of its write mask.
+ */
+inline uint32_t
+messageSizeBytes(const Message *msg)
+{
+    MessageSizeType type = msg->getMessageSize();
+    if (type == MessageSizeType_PUT_NT && RubySystem::getPutNtSizeFromMask()) {
+        auto nt_msg = dynamic_cast<const STNT_RequestMsg *>(msg);
+        if (nt_msg) {
+            WriteMask mask = nt_msg->getwriteMask();
+            return Network::MessageSizeType_to_int(MessageSizeType_Control) +
+                   mask.count();
+        }
+    }
+    return Network::MessageSizeType_to_int(type);
+}
+
+#endif // __MEM_RUBY_NETWORK_MESSAGESIZE_HH__
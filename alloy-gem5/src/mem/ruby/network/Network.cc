@@ -151,6 +151,12 @@ Network::init()
 uint32_t
 Network::MessageSizeType_to_int(MessageSizeType size_type)
 {
+    // sizes given on the command line (RubySystem msg_size_overrides) are
+    // payload bytes and ride on top of a control header
+    int payload = RubySystem::getMsgSizeOverride(size_type);
+    if (payload >= 0)
+        return m_control_msg_size + payload;
+
     switch(size_type) {
       case MessageSizeType_Control:
       case MessageSizeType_Request_Control:
@@ -173,10 +179,9 @@ Network::MessageSizeType_to_int(MessageSizeType size_type)
       case MessageSizeType_ResponseLocal_Data:
       case MessageSizeType_ResponseL2hit_Data:
       case MessageSizeType_Writeback_Data:
-    //   case MessageSizeType_PUT_NT: // for MPI and TQH, make put_nt is 64B rather than 8B. the user benchmark program accordingly access a line only once i.e., enable macro SIM_STORE_BUFFER
         return m_data_msg_size;
       case MessageSizeType_SingleWordData:
-      case MessageSizeType_PUT_NT:  // for other benchmarks, make put_nt 8B!!!
+      case MessageSizeType_PUT_NT:  // one word unless --msg-size says so
       case MessageSizeType_PUT_REL:
         return m_singleword_data_msg_size;
       default:
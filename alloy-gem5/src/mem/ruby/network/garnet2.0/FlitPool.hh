@@ -0,0 +1,89 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2024 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: LicenseRef-NvidiaProprietary
+ *
+ * NVIDIA CORPORATION, its affiliates and licensors retain all intellectual
+ * property and proprietary rights in and to this material, related
+ * documentation and any modifications thereto. Any use, reproduction,
+ * disclosure or distribution of this material and related documentation
+ * without an express license agreement from NVIDIA CORPORATION or
+ * its affiliates is strictly prohibited.
+ */
+
+#ifndef __MEM_RUBY_NETWORK_GARNET2_0_FLITPOOL_HH__
+#define __MEM_RUBY_NETWORK_GARNET2_0_FLITPOOL_HH__
+
+#include <cstdint>
+#include <mutex>
+#include <new>
+#include <utility>
+#include <vector>
+
+#include "sim/parallel_lock.hh"
+
+/**
+ * Free list of flits (or credits) owned by one GarnetNetwork.
+ *
+ * Objects are placement-constructed in raw storage from ::operator new,
+ * so one that is still handed to a plain delete (e.g. a credit consumed by
+ * a router's OutputUnit) is freed correctly; it simply does not come back
+ * to the pool. With partitioned (multi-threaded) simulation a flit is
+ * often released by another thread than the one that acquired it, so the
+ * free list is locked while in parallel mode.
+ */
+template <class T>
+class FlitPool
+{
+  public:
+    FlitPool() = default;
+    FlitPool(const FlitPool &) = delete;
+    FlitPool &operator=(const FlitPool &) = delete;
+
+    ~FlitPool()
+    {
+        for (void *mem : m_free)
+            ::operator delete(mem);
+    }
+
+    template <typename... Args>
+    T *
+    acquire(Args&&... args)
+    {
+        ParallelLock<std::mutex> lock(m_mutex);
+        void *mem;
+        if (m_free.empty()) {
+            mem = ::operator new(sizeof(T));
+            ++m_allocated;
+        } else {
+            mem = m_free.back();
+            m_free.pop_back();
+            ++m_reused;
+        }
+        ++m_live;
+        return new (mem) T(std::forward<Args>(args)...);
+    }
+
+    void
+    release(T *obj)
+    {
+        obj->~T();
+        ParallelLock<std::mutex> lock(m_mutex);
+        m_free.push_back(obj);
+        --m_live;
+    }
+
+    // acquired and not yet released
+    int64_t live() const { return m_live; }
+    uint64_t pooled() const { return m_free.size(); }
+    uint64_t allocated() const { return m_allocated; }
+    uint64_t reused() const { return m_reused; }
+
+  private:
+    std::vector<void *> m_free;
+    int64_t m_live = 0;
+    uint64_t m_allocated = 0;
+    uint64_t m_reused = 0;
+    std::mutex m_mutex;
+};
+
+#endif // __MEM_RUBY_NETWORK_GARNET2_0_FLITPOOL_HH__
@@ -47,8 +47,11 @@
 #include "mem/ruby/network/garnet2.0/GarnetNetwork.hh"
 
 #include <cassert>
+#include <map>
 
 #include "base/cast.hh"
+#include "base/intmath.hh"
+#include "base/output.hh"
 #include "base/stl_helpers.hh"
 #include "mem/ruby/common/NetDest.hh"
 #include "mem/ruby/network/MessageBuffer.hh"
@@ -71,7 +74,10 @@ using m5::stl_helpers::deletePointers;
  */
 
 GarnetNetwork::GarnetNetwork(const Params *p)
-    : Network(p)
+    : Network(p), m_link_sample_cycles(0),
+      m_link_sample_event([this]{ sampleLinks(); },
+                          name() + ".linkSampleEvent"),
+      m_link_sample_out(nullptr), m_link_sample_dumps(0)
 {
     m_num_rows = p->num_rows;
     m_ni_flit_size = p->ni_flit_size;
@@ -110,6 +116,7 @@ GarnetNetwork::GarnetNetwork(const Params *p)
         m_nis.push_back(ni);
         ni->init_net_ptr(this);
     }
+    m_ni_vc_masks.resize(m_nis.size());
 }
 
 void
@@ -121,11 +128,58 @@ GarnetNetwork::init()
         m_nis[i]->addNode(m_toNetQueues[i], m_fromNetQueues[i]);
     }
 
+    // Partitioned simulation: every partition owns one event queue, and
+    // only the links between partitions may cross queues (they do so
+    // through a mailbox, see NetworkLink::drainMailbox)
+    m_router_partitions = params()->ruby_system->getRouterPartitions();
+    if (!m_router_partitions.empty()) {
+        fatal_if(m_router_partitions.size() != m_routers.size(),
+                 "%d router partitions given for %d routers\n",
+                 m_router_partitions.size(), m_routers.size());
+        std::map<int, EventQueue *> partition_queues;
+        for (int i = 0; i < m_routers.size(); i++) {
+            auto res = partition_queues.emplace(m_router_partitions[i],
+                                                m_routers[i]->eventQueue());
+            fatal_if(res.first->second != m_routers[i]->eventQueue(),
+                     "routers of partition %d are on different event "
+                     "queues\n", m_router_partitions[i]);
+        }
+    }
+    fatal_if(m_router_partitions.empty() && numMainEventQueues > 1,
+             "%s: multiple event queues need router partitions\n", name());
+
     // The topology pointer should have already been initialized in the
     // parent network constructor
     assert(m_topology_ptr != NULL);
     m_topology_ptr->createLinks(this);
 
+    // Give the CG links their own width: a flit of m_ni_flit_size bytes
+    // takes ceil(flit size / bandwidth) cycles to cross
+    uint32_t cg_link_bandwidth = params()->ruby_system->getCGLinkBandwidth();
+    if (cg_link_bandwidth > 0) {
+        Cycles cycles_per_flit(divCeil(m_ni_flit_size, cg_link_bandwidth));
+        for (auto link : m_networklinks) {
+            if (link->isCGLink())
+                link->setCyclesPerFlit(cycles_per_flit);
+        }
+    }
+
+    m_link_sample_cycles =
+        Cycles(params()->ruby_system->getCGLinkSampleCycles());
+    if (m_link_sample_cycles > 0) {
+        // the sampler reads every CG link from the network's own queue
+        fatal_if(numMainEventQueues > 1,
+                 "CG link sampling is not supported with multiple event "
+                 "queues\n");
+        vector<NetworkLink *> cg_links;
+        for (auto link : m_networklinks) {
+            if (link->isCGLink())
+                cg_links.push_back(link);
+        }
+        m_link_sampler.init(cg_links, m_virtual_networks, m_vcs_per_vnet,
+            params()->ruby_system->getCGLinkSampleWindows());
+    }
+
     // Initialize topology specific parameters
     if (getNumRows() > 0) {
         // Only for Mesh topology
@@ -157,8 +211,27 @@ GarnetNetwork::init()
     }
 }
 
+void
+GarnetNetwork::startup()
+{
+    Network::startup();
+
+    if (m_link_sample_cycles > 0)
+        schedule(m_link_sample_event, clockEdge(m_link_sample_cycles));
+}
+
+void
+GarnetNetwork::sampleLinks()
+{
+    m_link_sampler.sample(curCycle());
+    schedule(m_link_sample_event, clockEdge(m_link_sample_cycles));
+}
+
 GarnetNetwork::~GarnetNetwork()
 {
+    if (m_link_sample_out)
+        simout.close(m_link_sample_out);
+
     deletePointers(m_routers);
     deletePointers(m_nis);
     deletePointers(m_networklinks);
@@ -191,6 +264,7 @@ GarnetNetwork::makeExtInLink(NodeID src, SwitchID dest, BasicLink* link,
     PortDirection dst_inport_dirn = "Local";
     m_routers[dest]->addInPort(dst_inport_dirn, net_link, credit_link);
     m_nis[src]->addOutPort(net_link, credit_link, dest);
+    checkExtLinkQueues(m_nis[src], m_routers[dest]);
 }
 
 /*
@@ -222,6 +296,16 @@ GarnetNetwork::makeExtOutLink(SwitchID src, NodeID dest, BasicLink* link,
                                routing_table_entry,
                                link->m_weight, credit_link);
     m_nis[dest]->addInPort(net_link, credit_link);
+    checkExtLinkQueues(m_nis[dest], m_routers[src]);
+}
+
+// NIs are not partitioned on their own: they run with their router
+void
+GarnetNetwork::checkExtLinkQueues(NetworkInterface *ni, Router *router) const
+{
+    fatal_if(ni->eventQueue() != router->eventQueue(),
+             "%s and %s are on different event queues\n", ni->name(),
+             router->name());
 }
 
 /*
@@ -249,6 +333,13 @@ GarnetNetwork::makeInternalLink(SwitchID src, SwitchID dest, BasicLink* link,
     m_routers[src]->addOutPort(src_outport_dirn, net_link,
                                routing_table_entry,
                                link->m_weight, credit_link);
+
+    // flits go to dest, credits come back to src
+    if (!m_router_partitions.empty() &&
+        m_router_partitions[src] != m_router_partitions[dest]) {
+        net_link->setCrossing(m_routers[dest]->eventQueue(), simQuantum);
+        credit_link->setCrossing(m_routers[src]->eventQueue(), simQuantum);
+    }
 }
 
 // Total routers in the network
@@ -405,12 +496,68 @@ GarnetNetwork::regStats()
         .name(name() + ".CG_link_flits_bytes");
     m_total_CG_link_flits_count
         .name(name() + ".CG_link_flits_count");
+    m_CG_link_busy_cycles
+        .name(name() + ".CG_link_busy_cycles")
+        .desc("Cycles CG links spent serializing flits");
+    m_CG_link_occupancy
+        .name(name() + ".CG_link_occupancy")
+        .desc("Average fraction of cycles a CG link was busy");
+    m_CG_link_queueing_cycles
+        .name(name() + ".CG_link_queueing_cycles")
+        .desc("Cycles flits waited for a busy CG link");
+    m_CG_link_max_queueing
+        .name(name() + ".CG_link_max_queueing")
+        .desc("Longest wait of one flit for a busy CG link");
+
+    m_link_msg_flits
+        .init(NUM_LINK_CLASSES_, MessageSizeType_NUM)
+        .name(name() + ".link_msg_flits")
+        .desc("Flits crossing links, by link class and message type")
+        .flags(Stats::nozero)
+        ;
+    m_link_msg_bytes
+        .init(NUM_LINK_CLASSES_, MessageSizeType_NUM)
+        .name(name() + ".link_msg_bytes")
+        .desc("Message bytes crossing links, by link class and message type")
+        .flags(Stats::nozero)
+        ;
+    const char *link_class_names[NUM_LINK_CLASSES_] =
+        { "ext_in", "ext_out", "int", "CG" };
+    for (int lc = 0; lc < NUM_LINK_CLASSES_; lc++) {
+        m_link_msg_flits.subname(lc, link_class_names[lc]);
+        m_link_msg_bytes.subname(lc, link_class_names[lc]);
+    }
+    for (int c = 0; c < MessageSizeType_NUM; c++) {
+        string msg_class = MessageSizeType_to_string((MessageSizeType)c);
+        m_link_msg_flits.ysubname(c, msg_class);
+        m_link_msg_bytes.ysubname(c, msg_class);
+    }
 
     m_average_vc_load
         .init(m_virtual_networks * m_vcs_per_vnet)
         .name(name() + ".avg_vc_load")
         .flags(Stats::pdf | Stats::total | Stats::nozero | Stats::oneline)
         ;
+
+    // Flit/credit pools
+    m_flits_live
+        .name(name() + ".flits_live")
+        .desc("Flits taken from the pool and not returned yet");
+    m_flits_pooled
+        .name(name() + ".flits_pooled")
+        .desc("Flits waiting in the pool for reuse");
+    m_flits_allocated
+        .name(name() + ".flits_allocated")
+        .desc("Flits the pool had to allocate");
+    m_credits_pooled
+        .name(name() + ".credits_pooled")
+        .desc("Credits waiting in the pool for reuse");
+    m_credits_allocated
+        .name(name() + ".credits_allocated")
+        .desc("Credits the pool had to allocate");
+    m_credits_reused
+        .name(name() + ".credits_reused")
+        .desc("Credits constructed in recycled storage");
 }
 
 void
@@ -418,6 +565,8 @@ GarnetNetwork::collateStats()
 {
     RubySystem *rs = params()->ruby_system;
     double time_delta = double(curCycle() - rs->getStartCycle());
+    int num_CG_links = 0;
+    double CG_link_occupancy = 0;
 
     for (int i = 0; i < m_networklinks.size(); i++) {
         link_type type = m_networklinks[i]->getType();
@@ -438,17 +587,69 @@ GarnetNetwork::collateStats()
             m_average_vc_load[j] += ((double)vc_load[j] / time_delta);
         }
 
+        int link_class = m_networklinks[i]->isCGLink() ? CG_LINK_CLASS_ : type;
+        const vector<uint64_t> &msg_flits =
+            m_networklinks[i]->getMsgClassFlits();
+        const vector<uint64_t> &msg_bytes =
+            m_networklinks[i]->getMsgClassBytes();
+        for (int c = 0; c < MessageSizeType_NUM; c++) {
+            m_link_msg_flits[link_class][c] += msg_flits[c];
+            m_link_msg_bytes[link_class][c] += msg_bytes[c];
+        }
+
         if (m_networklinks[i]->isCGLink()) {
             DPRINTF(RRC, "link idx[%d] type[%d] CG_link_flits_count[%d]\n", i, type, m_networklinks[i]->getLinkFlitCount());
             m_total_CG_link_flits_bytes += m_networklinks[i]->getLinkFlitBytes();
             m_total_CG_link_flits_count += m_networklinks[i]->getLinkFlitCount();
+
+            num_CG_links++;
+            m_CG_link_busy_cycles += m_networklinks[i]->getBusyCycles();
+            CG_link_occupancy +=
+                double(m_networklinks[i]->getBusyCycles()) / time_delta;
+            m_CG_link_queueing_cycles +=
+                m_networklinks[i]->getQueueingCycles();
+            if (m_networklinks[i]->getMaxQueueing() >
+                m_CG_link_max_queueing.value())
+                m_CG_link_max_queueing = m_networklinks[i]->getMaxQueueing();
         }
     }
+    if (num_CG_links > 0)
+        m_CG_link_occupancy = CG_link_occupancy / num_CG_links;
 
     // Ask the routers to collate their statistics
     for (int i = 0; i < m_routers.size(); i++) {
         m_routers[i]->collateStats();
     }
+
+    // credits consumed by routers' OutputUnits are freed rather than
+    // returned, so only the flit pool has a meaningful live count
+    m_flits_live = m_flit_pool.live();
+    m_flits_pooled = m_flit_pool.pooled();
+    m_flits_allocated = m_flit_pool.allocated();
+    m_credits_pooled = m_credit_pool.pooled();
+    m_credits_allocated = m_credit_pool.allocated();
+    m_credits_reused = m_credit_pool.reused();
+
+    // close the current telemetry window and write out the ring
+    if (m_link_sample_cycles > 0) {
+        m_link_sampler.sample(curCycle());
+        if (!m_link_sample_out) {
+            m_link_sample_out = simout.create(name() +
+                                              ".cg_link_samples.csv");
+            m_link_sampler.printHeader(*m_link_sample_out->stream());
+        }
+        m_link_sampler.flush(*m_link_sample_out->stream(),
+                             m_link_sample_dumps++);
+    }
+}
+
+void
+GarnetNetwork::resetStats()
+{
+    Network::resetStats();
+
+    // the links' VC counters restart from zero (NetworkLink::resetStats)
+    m_link_sampler.reset();
 }
 
 void
@@ -47,15 +47,25 @@
 #ifndef __MEM_RUBY_NETWORK_GARNET2_0_GARNETNETWORK_HH__
 #define __MEM_RUBY_NETWORK_GARNET2_0_GARNETNETWORK_HH__
 
+#include <cassert>
 #include <iostream>
+#include <mutex>
 #include <vector>
 
 #include "mem/ruby/network/Network.hh"
 #include "mem/ruby/network/fault_model/FaultModel.hh"
 #include "mem/ruby/network/garnet2.0/CommonTypes.hh"
+#include "mem/ruby/network/garnet2.0/Credit.hh"
+#include "mem/ruby/network/garnet2.0/FlitPool.hh"
+#include "mem/ruby/network/garnet2.0/LinkSampler.hh"
+#include "mem/ruby/network/garnet2.0/VcMask.hh"
+#include "mem/ruby/network/garnet2.0/flit.hh"
 #include "params/GarnetNetwork.hh"
+#include "sim/eventq.hh"
+#include "sim/parallel_lock.hh"
 
 class FaultModel;
+class OutputStream;
 class NetworkInterface;
 class Router;
 class NetDest;
@@ -70,6 +80,7 @@ class GarnetNetwork : public Network
 
     ~GarnetNetwork();
     void init();
+    void startup();
 
     // Configuration (set externally)
 
@@ -118,9 +129,12 @@ class GarnetNetwork : public Network
     // Stats
     void collateStats();
     void regStats();
+    void resetStats();
     void print(std::ostream& out) const;
 
-    // increment counters
+    // increment counters; callers on different event queues must hold
+    // a ParallelLock on statsMutex()
+    std::mutex& statsMutex() { return m_stats_mutex; }
     void increment_injected_packets(int vnet) { m_packets_injected[vnet]++; }
     void increment_received_packets(int vnet) { m_packets_received[vnet]++; }
 
@@ -157,6 +171,19 @@ class GarnetNetwork : public Network
         m_total_hops += hops;
     }
 
+    // flits are made by NIs and consumed by NIs, credits are made by NIs
+    // and InputUnits; both are recycled through these per-network pools
+    FlitPool<flit>& getFlitPool() { return m_flit_pool; }
+    FlitPool<Credit>& getCreditPool() { return m_credit_pool; }
+
+    // VC bitmaps of NI ni_id, kept here on behalf of the NI
+    NiVcMasks&
+    getNiVcMasks(int ni_id)
+    {
+        assert(ni_id >= 0 && ni_id < (int)m_ni_vc_masks.size());
+        return m_ni_vc_masks[ni_id];
+    }
+
   protected:
     // Configuration
     int m_num_rows;
@@ -196,12 +223,30 @@ class GarnetNetwork : public Network
     Stats::Scalar m_total_int_link_utilization;
     Stats::Scalar m_total_CG_link_flits_bytes;
     Stats::Scalar m_total_CG_link_flits_count;
+    Stats::Scalar m_CG_link_busy_cycles;
+    Stats::Scalar m_CG_link_occupancy;
+    Stats::Scalar m_CG_link_queueing_cycles;
+    Stats::Scalar m_CG_link_max_queueing;
+
+    // [link class x MessageSizeType]; link classes are the link_types
+    // with CG links split out of INT_
+    enum { CG_LINK_CLASS_ = NUM_LINK_TYPES_, NUM_LINK_CLASSES_ };
+    Stats::Vector2d m_link_msg_flits;
+    Stats::Vector2d m_link_msg_bytes;
     Stats::Scalar m_average_link_utilization;
     Stats::Vector m_average_vc_load;
 
     Stats::Scalar  m_total_hops;
     Stats::Formula m_avg_hops;
 
+    // flit/credit pool occupancy, sampled at stats dump
+    Stats::Scalar m_flits_live;
+    Stats::Scalar m_flits_pooled;
+    Stats::Scalar m_flits_allocated;
+    Stats::Scalar m_credits_pooled;
+    Stats::Scalar m_credits_allocated;
+    Stats::Scalar m_credits_reused;
+
   private:
     GarnetNetwork(const GarnetNetwork& obj);
     GarnetNetwork& operator=(const GarnetNetwork& obj);
@@ -211,6 +256,25 @@ class GarnetNetwork : public Network
     std::vector<NetworkLink *> m_networklinks; // All flit links in the network
     std::vector<CreditLink *> m_creditlinks; // All credit links in the network
     std::vector<NetworkInterface *> m_nis;   // All NI's in Network
+
+    FlitPool<flit> m_flit_pool;
+    FlitPool<Credit> m_credit_pool;
+
+    std::vector<NiVcMasks> m_ni_vc_masks; // indexed by NI id
+
+    std::mutex m_stats_mutex;
+
+    // partition of each router, empty when not partitioned
+    std::vector<int> m_router_partitions;
+    void checkExtLinkQueues(NetworkInterface *ni, Router *router) const;
+
+    // CG link telemetry, flushed to m_link_sample_out at every stats dump
+    void sampleLinks();
+    Cycles m_link_sample_cycles;
+    LinkSampler m_link_sampler;
+    EventFunctionWrapper m_link_sample_event;
+    OutputStream *m_link_sample_out;
+    int m_link_sample_dumps;
 };
 
 inline std::ostream&
@@ -49,6 +49,7 @@
 #include "base/stl_helpers.hh"
 #include "debug/RubyNetwork.hh"
 #include "mem/ruby/network/garnet2.0/Credit.hh"
+#include "mem/ruby/network/garnet2.0/GarnetNetwork.hh"
 #include "mem/ruby/network/garnet2.0/Router.hh"
 
 using namespace std;
@@ -165,7 +166,8 @@ InputUnit::wakeup()
 void
 InputUnit::increment_credit(int in_vc, bool free_signal, Cycles curTime)
 {
-    Credit *t_credit = new Credit(in_vc, free_signal, curTime);
+    Credit *t_credit = m_router->get_net_ptr()->getCreditPool().acquire(
+        in_vc, free_signal, curTime);
     creditQueue->insert(t_credit);
     m_credit_link->scheduleEventAbsolute(m_router->clockEdge(Cycles(1)));
 }
@@ -0,0 +1,145 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2024 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: LicenseRef-NvidiaProprietary
+ *
+ * NVIDIA CORPORATION, its affiliates and licensors retain all intellectual
+ * property and proprietary rights in and to this material, related
+ * documentation and any modifications thereto. Any use, reproduction,
+ * disclosure or distribution of this material and related documentation
+ * without an express license agreement from NVIDIA CORPORATION or
+ * its affiliates is strictly prohibited.
+ */
+
+#ifndef __MEM_RUBY_NETWORK_GARNET2_0_LINKSAMPLER_HH__
+#define __MEM_RUBY_NETWORK_GARNET2_0_LINKSAMPLER_HH__
+
+#include <algorithm>
+#include <cstdint>
+#include <ostream>
+#include <vector>
+
+#include "base/types.hh"
+#include "mem/ruby/network/garnet2.0/NetworkLink.hh"
+
+/**
+ * Windowed telemetry for a set of links (the CG links). At the end of
+ * every window sample() records, per link, the flits sent on each vnet,
+ * how many VCs carried any of them and how many flits were still on the
+ * wire. Records go to a ring preallocated for a fixed number of windows;
+ * once it is full the oldest window is overwritten.
+ *
+ * Flit counts come from the links' own per-VC counters, so sampling costs
+ * nothing per flit.
+ */
+class LinkSampler
+{
+  public:
+    void
+    init(const std::vector<NetworkLink *> &links, int num_vnets,
+         int vcs_per_vnet, int num_windows)
+    {
+        m_links = links;
+        m_num_vnets = num_vnets;
+        m_vcs_per_vnet = vcs_per_vnet;
+        m_record_size = num_vnets + 2;
+        m_last_vc_load.assign(links.size(),
+            std::vector<unsigned int>(num_vnets * vcs_per_vnet, 0));
+        m_window_end.assign(num_windows, Cycles(0));
+        m_ring.assign(num_windows * links.size() * m_record_size, 0);
+        m_head = 0;
+        m_count = 0;
+    }
+
+    // Drop all windows; the link counters have just been reset
+    void
+    reset()
+    {
+        for (auto &last : m_last_vc_load)
+            std::fill(last.begin(), last.end(), 0);
+        m_head = 0;
+        m_count = 0;
+    }
+
+    // Close the window that ends at now
+    void
+    sample(Cycles now)
+    {
+        if (m_window_end.empty())
+            return;
+
+        m_window_end[m_head] = now;
+        uint32_t *record = &m_ring[m_head * m_links.size() * m_record_size];
+        for (size_t l = 0; l < m_links.size(); ++l, record += m_record_size) {
+            std::fill(record, record + m_record_size, 0);
+
+            const std::vector<unsigned int> &vc_load =
+                m_links[l]->getVcLoad();
+            std::vector<unsigned int> &last = m_last_vc_load[l];
+            uint32_t active_vcs = 0;
+            for (size_t vc = 0; vc < vc_load.size(); ++vc) {
+                unsigned int delta = vc_load[vc] - last[vc];
+                if (delta) {
+                    record[vc / m_vcs_per_vnet] += delta;
+                    active_vcs++;
+                }
+                last[vc] = vc_load[vc];
+            }
+            record[m_num_vnets] = active_vcs;
+            record[m_num_vnets + 1] = m_links[l]->getInFlight();
+        }
+
+        m_head = (m_head + 1) % m_window_end.size();
+        if (m_count < m_window_end.size())
+            m_count++;
+    }
+
+    // One CSV row per link and window, oldest window first; the ring is
+    // emptied afterwards
+    void
+    flush(std::ostream &os, int dump)
+    {
+        size_t window = (m_head + m_window_end.size() - m_count) %
+            std::max<size_t>(m_window_end.size(), 1);
+        for (size_t n = 0; n < m_count; ++n) {
+            const uint32_t *record =
+                &m_ring[window * m_links.size() * m_record_size];
+            for (size_t l = 0; l < m_links.size();
+                 ++l, record += m_record_size) {
+                os << dump << "," << m_window_end[window] << ","
+                   << m_links[l]->get_id();
+                for (int i = 0; i < m_record_size; ++i)
+                    os << "," << record[i];
+                os << "\n";
+            }
+            window = (window + 1) % m_window_end.size();
+        }
+        os.flush();
+        m_count = 0;
+    }
+
+    void
+    printHeader(std::ostream &os) const
+    {
+        os << "dump,window_end_cycle,link";
+        for (int vnet = 0; vnet < m_num_vnets; ++vnet)
+            os << ",vnet" << vnet << "_flits";
+        os << ",active_vcs,in_flight\n";
+    }
+
+  private:
+    std::vector<NetworkLink *> m_links;
+    int m_num_vnets = 0;
+    int m_vcs_per_vnet = 1;
+    int m_record_size = 0;
+
+    // per link, the VC counters as of the last sample
+    std::vector<std::vector<unsigned int>> m_last_vc_load;
+
+    // ring of windows: end cycle, then one record per link
+    std::vector<Cycles> m_window_end;
+    std::vector<uint32_t> m_ring;
+    size_t m_head = 0;
+    size_t m_count = 0;
+};
+
+#endif // __MEM_RUBY_NETWORK_GARNET2_0_LINKSAMPLER_HH__
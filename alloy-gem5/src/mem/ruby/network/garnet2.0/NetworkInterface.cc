@@ -48,14 +48,17 @@
 
 #include <cassert>
 #include <cmath>
+#include <mutex>
 
 #include "base/cast.hh"
 #include "base/stl_helpers.hh"
 #include "debug/RubyNetwork.hh"
 #include "mem/ruby/network/MessageBuffer.hh"
+#include "mem/ruby/network/MessageSize.hh"
 #include "mem/ruby/network/garnet2.0/Credit.hh"
 #include "mem/ruby/network/garnet2.0/flitBuffer.hh"
 #include "mem/ruby/slicc_interface/Message.hh"
+#include "sim/parallel_lock.hh"
 
 using namespace std;
 using m5::stl_helpers::deletePointers;
@@ -93,6 +96,11 @@ NetworkInterface::init()
     for (int i = 0; i < m_num_vcs; i++) {
         m_out_vc_state.push_back(new OutVcState(i, m_net_ptr));
     }
+
+    // every out VC starts IDLE_ with an empty buffer
+    NiVcMasks &masks = m_net_ptr->getNiVcMasks(m_id);
+    masks.idle.init(m_num_vcs, true);
+    masks.occupied.init(m_num_vcs, false);
 }
 
 NetworkInterface::~NetworkInterface()
@@ -156,6 +164,7 @@ void
 NetworkInterface::incrementStats(flit *t_flit)
 {
     int vnet = t_flit->get_vnet();
+    ParallelLock<std::mutex> lock(m_net_ptr->statsMutex());
 
     // Latency
     m_net_ptr->increment_received_flits(vnet);
@@ -239,9 +248,9 @@ NetworkInterface::wakeup()
                 // this flit in the NI
                 sendCredit(t_flit, true);
 
-                // Update stats and delete flit pointer
+                // Update stats and recycle the flit
                 incrementStats(t_flit);
-                delete t_flit;
+                m_net_ptr->getFlitPool().release(t_flit);
             } else {
                 // No space available- Place tail flit in stall queue and set
                 // up a callback for when protocol buffer is dequeued. Stat
@@ -257,9 +266,9 @@ NetworkInterface::wakeup()
             // Non-tail flit. Send back a credit but not VC free signal.
             sendCredit(t_flit, false);
 
-            // Update stats and delete flit pointer.
+            // Update stats and recycle the flit.
             incrementStats(t_flit);
-            delete t_flit;
+            m_net_ptr->getFlitPool().release(t_flit);
         }
     }
 
@@ -270,8 +279,9 @@ NetworkInterface::wakeup()
         m_out_vc_state[t_credit->get_vc()]->increment_credit();
         if (t_credit->is_free_signal()) {
             m_out_vc_state[t_credit->get_vc()]->setState(IDLE_, curCycle());
+            m_net_ptr->getNiVcMasks(m_id).idle.set(t_credit->get_vc());
         }
-        delete t_credit;
+        m_net_ptr->getCreditPool().release(t_credit);
     }
 
 
@@ -287,7 +297,8 @@ NetworkInterface::wakeup()
 void
 NetworkInterface::sendCredit(flit *t_flit, bool is_free)
 {
-    Credit *credit_flit = new Credit(t_flit->get_vc(), is_free, curCycle());
+    Credit *credit_flit = m_net_ptr->getCreditPool().acquire(
+        t_flit->get_vc(), is_free, curCycle());
     outCreditQueue->insert(credit_flit);
 }
 
@@ -315,8 +326,8 @@ NetworkInterface::checkStallQueue()
                 // Update Stats
                 incrementStats(stallFlit);
 
-                // Flit can now safely be deleted and removed from stall queue
-                delete stallFlit;
+                // Flit can now safely be recycled and removed from stall queue
+                m_net_ptr->getFlitPool().release(stallFlit);
                 m_stall_queue.erase(stallIter);
                 m_stall_count[vnet]--;
 
@@ -348,8 +359,8 @@ NetworkInterface::flitisizeMessage(MsgPtr msg_ptr, int vnet)
 
     // Number of flits is dependent on the link bandwidth available.
     // This is expressed in terms of bytes/cycle or the flit size
-    int num_flits = (int) ceil((double) m_net_ptr->MessageSizeType_to_int(
-        net_msg_ptr->getMessageSize())/m_net_ptr->getNiFlitSize());
+    int num_flits = (int) ceil((double) messageSizeBytes(net_msg_ptr)/
+        m_net_ptr->getNiFlitSize());
 
     // loop to convert all multicast messages into unicast messages
     for (int ctr = 0; ctr < dest_nodes.size(); ctr++) {
@@ -399,11 +410,15 @@ NetworkInterface::flitisizeMessage(MsgPtr msg_ptr, int vnet)
         // so that the first router increments it to 0
         route.hops_traversed = -1;
 
-        m_net_ptr->increment_injected_packets(vnet);
+        {
+            ParallelLock<std::mutex> lock(m_net_ptr->statsMutex());
+            m_net_ptr->increment_injected_packets(vnet);
+            for (int i = 0; i < num_flits; i++)
+                m_net_ptr->increment_injected_flits(vnet);
+        }
         for (int i = 0; i < num_flits; i++) {
-            m_net_ptr->increment_injected_flits(vnet);
-            flit *fl = new flit(i, vc, vnet, route, num_flits, new_msg_ptr,
-                curCycle());
+            flit *fl = m_net_ptr->getFlitPool().acquire(i, vc, vnet, route,
+                num_flits, new_msg_ptr, curCycle());
             if ( i==0 ) {
             //   const Message* _msg_ptr = new_msg_ptr.get();
               DPRINTF(RubyNetwork, "insert flits into vent=%ld "
@@ -419,25 +434,27 @@ NetworkInterface::flitisizeMessage(MsgPtr msg_ptr, int vnet)
 
         m_ni_out_vcs_enqueue_time[vc] = curCycle();
         m_out_vc_state[vc]->setState(ACTIVE_, curCycle());
+
+        NiVcMasks &masks = m_net_ptr->getNiVcMasks(m_id);
+        masks.idle.clear(vc);
+        masks.occupied.set(vc);
     }
     return true ;
 }
 
-// Looking for a free output vc
+// Looking for a free output vc, round-robin within the vnet
 int
 NetworkInterface::calculateVC(int vnet)
 {
-    for (int i = 0; i < m_vc_per_vnet; i++) {
-        int delta = m_vc_allocator[vnet];
-        m_vc_allocator[vnet]++;
-        if (m_vc_allocator[vnet] == m_vc_per_vnet)
-            m_vc_allocator[vnet] = 0;
-
-        if (m_out_vc_state[(vnet*m_vc_per_vnet) + delta]->isInState(
-                    IDLE_, curCycle())) {
-            vc_busy_counter[vnet] = 0;
-            return ((vnet*m_vc_per_vnet) + delta);
-        }
+    int vc_base = vnet * m_vc_per_vnet;
+    int vc = m_net_ptr->getNiVcMasks(m_id).idle.nextRotated(
+        vc_base, vc_base + m_vc_per_vnet, vc_base + m_vc_allocator[vnet]);
+
+    if (vc != -1) {
+        assert(m_out_vc_state[vc]->isInState(IDLE_, curCycle()));
+        m_vc_allocator[vnet] = (vc - vc_base + 1) % m_vc_per_vnet;
+        vc_busy_counter[vnet] = 0;
+        return vc;
     }
 
     vc_busy_counter[vnet] += 1;
@@ -458,55 +475,66 @@ NetworkInterface::calculateVC(int vnet)
 void
 NetworkInterface::scheduleOutputLink()
 {
-    int vc = m_vc_round_robin;
+    // The scan starts one past where the previous one started, whether or
+    // not that one sent anything. Only VCs holding flits can be ready, so
+    // walk the occupied bitmap from the pointer to the end, then wrap.
     m_vc_round_robin++;
     if (m_vc_round_robin == m_num_vcs)
         m_vc_round_robin = 0;
 
-    for (int i = 0; i < m_num_vcs; i++) {
-        vc++;
-        if (vc == m_num_vcs)
-            vc = 0;
+    VcMask &occupied = m_net_ptr->getNiVcMasks(m_id).occupied;
 
+    auto can_send = [&](int vc) {
         // model buffer backpressure
-        if (m_ni_out_vcs[vc]->isReady(curCycle()) &&
-            m_out_vc_state[vc]->has_credit()) {
-
-            bool is_candidate_vc = true;
-            int t_vnet = get_vnet(vc);
-            int vc_base = t_vnet * m_vc_per_vnet;
-
-            if (m_net_ptr->isVNetOrdered(t_vnet)) {
-                for (int vc_offset = 0; vc_offset < m_vc_per_vnet;
-                     vc_offset++) {
-                    int t_vc = vc_base + vc_offset;
-                    if (m_ni_out_vcs[t_vc]->isReady(curCycle())) {
-                        if (m_ni_out_vcs_enqueue_time[t_vc] <
-                            m_ni_out_vcs_enqueue_time[vc]) {
-                            is_candidate_vc = false;
-                            break;
-                        }
-                    }
-                }
-            }
-            if (!is_candidate_vc)
-                continue;
-
-            m_out_vc_state[vc]->decrement_credit();
-            // Just removing the flit
-            flit *t_flit = m_ni_out_vcs[vc]->getTopFlit();
-            t_flit->set_time(curCycle() + Cycles(1));
-            outFlitQueue->insert(t_flit);
-            // schedule the out link
-            outNetLink->scheduleEventAbsolute(clockEdge(Cycles(1)));
-
-            if (t_flit->get_type() == TAIL_ ||
-               t_flit->get_type() == HEAD_TAIL_) {
-                m_ni_out_vcs_enqueue_time[vc] = Cycles(INFINITE_);
-            }
-            return;
+        if (!m_ni_out_vcs[vc]->isReady(curCycle()) ||
+            !m_out_vc_state[vc]->has_credit())
+            return false;
+
+        int t_vnet = get_vnet(vc);
+        if (!m_net_ptr->isVNetOrdered(t_vnet))
+            return true;
+
+        int vc_base = t_vnet * m_vc_per_vnet;
+        int vc_end = vc_base + m_vc_per_vnet;
+        for (int t_vc = occupied.next(vc_base, vc_end); t_vc != -1;
+             t_vc = occupied.next(t_vc + 1, vc_end)) {
+            if (m_ni_out_vcs[t_vc]->isReady(curCycle()) &&
+                m_ni_out_vcs_enqueue_time[t_vc] <
+                m_ni_out_vcs_enqueue_time[vc])
+                return false;
         }
+        return true;
+    };
+
+    int vc = -1;
+    for (int t_vc = occupied.next(m_vc_round_robin, m_num_vcs);
+         vc == -1 && t_vc != -1; t_vc = occupied.next(t_vc + 1, m_num_vcs)) {
+        if (can_send(t_vc))
+            vc = t_vc;
+    }
+    for (int t_vc = occupied.next(0, m_vc_round_robin);
+         vc == -1 && t_vc != -1;
+         t_vc = occupied.next(t_vc + 1, m_vc_round_robin)) {
+        if (can_send(t_vc))
+            vc = t_vc;
+    }
+    if (vc == -1)
+        return;
+
+    m_out_vc_state[vc]->decrement_credit();
+    // Just removing the flit
+    flit *t_flit = m_ni_out_vcs[vc]->getTopFlit();
+    t_flit->set_time(curCycle() + Cycles(1));
+    outFlitQueue->insert(t_flit);
+    // schedule the out link
+    outNetLink->scheduleEventAbsolute(clockEdge(Cycles(1)));
+
+    if (t_flit->get_type() == TAIL_ ||
+       t_flit->get_type() == HEAD_TAIL_) {
+        m_ni_out_vcs_enqueue_time[vc] = Cycles(INFINITE_);
     }
+    if (m_ni_out_vcs[vc]->isEmpty())
+        occupied.clear(vc);
 }
 
 int
@@ -538,7 +566,9 @@ NetworkInterface::checkReschedule()
         }
     }
 
-    for (int vc = 0; vc < m_num_vcs; vc++) {
+    const VcMask &occupied = m_net_ptr->getNiVcMasks(m_id).occupied;
+    for (int vc = occupied.next(0, m_num_vcs); vc != -1;
+         vc = occupied.next(vc + 1, m_num_vcs)) {
         if (m_ni_out_vcs[vc]->isReady(curCycle() + Cycles(1))) {
             scheduleEvent(Cycles(1));
             return;
@@ -46,16 +46,25 @@
 
 #include "mem/ruby/network/garnet2.0/NetworkLink.hh"
 
+#include <algorithm>
+
+#include "mem/ruby/network/MessageSize.hh"
 #include "mem/ruby/network/garnet2.0/CreditLink.hh"
 
 
 NetworkLink::NetworkLink(const Params *p)
     : ClockedObject(p), Consumer(this), m_id(p->link_id),
       m_type(NUM_LINK_TYPES_),
-      m_latency(p->link_latency),
+      m_latency(p->link_latency), m_cycles_per_flit(1), m_busy_until(0),
       linkBuffer(new flitBuffer()), link_consumer(nullptr),
       link_srcQueue(nullptr), m_link_utilized(0),
-      m_vc_load(p->vcs_per_vnet * p->virt_nets)
+      m_vc_load(p->vcs_per_vnet * p->virt_nets),
+      m_busy_cycles(0), m_queueing_cycles(0), m_max_queueing(0),
+      m_msg_class_flits(MessageSizeType_NUM, 0),
+      m_msg_class_bytes(MessageSizeType_NUM, 0),
+      m_dest_eventq(nullptr), m_quantum(0),
+      m_drain_event([this]{ drainMailbox(); }, name() + ".drainEvent",
+                    false, EventBase::Progress_Event_Pri + 1)
 {
 }
 
@@ -80,13 +89,47 @@ void
 NetworkLink::wakeup()
 {
     if (link_srcQueue->isReady(curCycle())) {
+        if (curCycle() < m_busy_until) {
+            // still serializing the previous flit
+            scheduleEventAbsolute(clockEdge(m_busy_until - curCycle()));
+            return;
+        }
+
         flit *t_flit = link_srcQueue->getTopFlit();
-        t_flit->set_time(curCycle() + m_latency);
-        linkBuffer->insert(t_flit);
-        link_consumer->scheduleEventAbsolute(clockEdge(m_latency));
+        Cycles queueing = curCycle() - t_flit->get_time();
+        m_queueing_cycles += queueing;
+        if (queueing > m_max_queueing)
+            m_max_queueing = queueing;
+
+        Cycles delay = m_latency + m_cycles_per_flit - Cycles(1);
+        m_busy_until = curCycle() + m_cycles_per_flit;
+        m_busy_cycles += m_cycles_per_flit;
+
+        t_flit->set_time(curCycle() + delay);
+        if (isCrossing()) {
+            std::lock_guard<std::mutex> lock(m_mailbox_mutex);
+            m_mailbox.push_back(Mail{curTick(), clockEdge(delay), t_flit});
+        } else {
+            linkBuffer->insert(t_flit);
+            link_consumer->scheduleEventAbsolute(clockEdge(delay));
+        }
+        if (m_cycles_per_flit > Cycles(1) &&
+            link_srcQueue->isReady(m_busy_until)) {
+            scheduleEventAbsolute(clockEdge(m_cycles_per_flit));
+        }
         m_link_utilized++;
         m_vc_load[t_flit->get_vc()]++;
 
+        // credits carry no message
+        const Message *msg = t_flit->get_msg_ptr().get();
+        if (msg) {
+            MessageSizeType msg_class = msg->getMessageSize();
+            m_msg_class_flits[msg_class]++;
+            if (t_flit->get_type() == HEAD_ ||
+                t_flit->get_type() == HEAD_TAIL_)
+                m_msg_class_bytes[msg_class] += messageSizeBytes(msg);
+        }
+
         // for DO CG link profiling
         // t_flit->get_size() is actually the packet size. The flit size in bytes is in config.ini.
         // So we depracate this stat
@@ -101,6 +144,57 @@ NetworkLink::wakeup()
     }
 }
 
+void
+NetworkLink::setCrossing(EventQueue *dest_eventq, Tick quantum)
+{
+    // a flit sent during one quantum must not be due before the next
+    fatal_if(quantum == 0 || cyclesToTicks(m_latency) < quantum,
+             "%s: partition boundary needs a quantum (%llu ticks) no "
+             "longer than the link latency (%llu ticks)\n", name(),
+             quantum, cyclesToTicks(m_latency));
+    m_dest_eventq = dest_eventq;
+    m_quantum = quantum;
+}
+
+void
+NetworkLink::startup()
+{
+    ClockedObject::startup();
+
+    // quantum boundaries are counted from where the simulation starts
+    if (isCrossing())
+        m_dest_eventq->schedule(&m_drain_event, curTick() + m_quantum);
+}
+
+/*
+ * Runs on the receiving event queue at each quantum boundary, after the
+ * global barrier. Every sending thread has then finished all ticks before
+ * now, so the mail sent before now is complete and in order; anything
+ * sent at or after now belongs to the next drain. Taking mail by send
+ * time rather than by what happens to be there keeps runs deterministic
+ * whatever the thread interleaving, and identical to a run with the same
+ * partitions on a single event queue.
+ */
+void
+NetworkLink::drainMailbox()
+{
+    std::vector<Tick> arrivals;
+    {
+        std::lock_guard<std::mutex> lock(m_mailbox_mutex);
+        while (!m_mailbox.empty() && m_mailbox.front().sent < curTick()) {
+            linkBuffer->insert(m_mailbox.front().t_flit);
+            arrivals.push_back(m_mailbox.front().arrival);
+            m_mailbox.pop_front();
+        }
+    }
+    for (Tick arrival : arrivals) {
+        assert(arrival >= curTick());
+        link_consumer->scheduleEventAbsolute(arrival);
+    }
+
+    m_dest_eventq->schedule(&m_drain_event, curTick() + m_quantum);
+}
+
 void
 NetworkLink::resetStats()
 {
@@ -109,6 +203,11 @@ NetworkLink::resetStats()
     }
 
     m_link_utilized = 0;
+    m_busy_cycles = 0;
+    m_queueing_cycles = 0;
+    m_max_queueing = Cycles(0);
+    std::fill(m_msg_class_flits.begin(), m_msg_class_flits.end(), 0);
+    std::fill(m_msg_class_bytes.begin(), m_msg_class_bytes.end(), 0);
 }
 
 NetworkLink *
@@ -126,11 +225,24 @@ CreditLinkParams::create()
 uint32_t
 NetworkLink::functionalWrite(Packet *pkt)
 {
-    return linkBuffer->functionalWrite(pkt);
+    uint32_t num_functional_writes = linkBuffer->functionalWrite(pkt);
+
+    std::lock_guard<std::mutex> lock(m_mailbox_mutex);
+    for (auto &mail : m_mailbox)
+        num_functional_writes += mail.t_flit->functionalWrite(pkt);
+    return num_functional_writes;
 }
 
 bool
 NetworkLink::functionalRead(Packet *pkt)
 {
-    return linkBuffer->functionalRead(pkt);
+    if (linkBuffer->functionalRead(pkt))
+        return true;
+
+    std::lock_guard<std::mutex> lock(m_mailbox_mutex);
+    for (auto &mail : m_mailbox) {
+        if (mail.t_flit->functionalRead(pkt))
+            return true;
+    }
+    return false;
 }
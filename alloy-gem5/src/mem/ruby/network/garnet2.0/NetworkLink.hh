@@ -47,14 +47,18 @@
 #ifndef __MEM_RUBY_NETWORK_GARNET2_0_NETWORKLINK_HH__
 #define __MEM_RUBY_NETWORK_GARNET2_0_NETWORKLINK_HH__
 
+#include <deque>
 #include <iostream>
+#include <mutex>
 #include <vector>
 
+#include "mem/protocol/MessageSizeType.hh"
 #include "mem/ruby/common/Consumer.hh"
 #include "mem/ruby/network/garnet2.0/CommonTypes.hh"
 #include "mem/ruby/network/garnet2.0/flitBuffer.hh"
 #include "params/NetworkLink.hh"
 #include "sim/clocked_object.hh"
+#include "sim/eventq.hh"
 
 class GarnetNetwork;
 
@@ -72,9 +76,16 @@ class NetworkLink : public ClockedObject, public Consumer
     void print(std::ostream& out) const {}
     int get_id() const { return m_id; }
     void wakeup();
+    void startup();
+
+    // Make this link a partition boundary: the receiving side runs on
+    // dest_eventq, possibly on another host thread (see drainMailbox)
+    void setCrossing(EventQueue *dest_eventq, Tick quantum);
+    bool isCrossing() const { return m_dest_eventq != nullptr; }
 
     unsigned int getLinkUtilization() const { return m_link_utilized; }
     const std::vector<unsigned int> & getVcLoad() const { return m_vc_load; }
+    int getInFlight() const { return linkBuffer->getSize(); }
 
     inline bool isReady(Cycles curTime)
     { return linkBuffer->isReady(curTime); }
@@ -91,10 +102,34 @@ class NetworkLink : public ClockedObject, public Consumer
     uint64_t getLinkFlitBytes() { return m_link_flit_bytes; }
     uint64_t getLinkFlitCount() { return m_link_flit_count; }
 
+    // Serialization: a flit holds the link for this many cycles, and
+    // reaches the far end that much later (minus the first cycle)
+    void setCyclesPerFlit(Cycles cycles) { m_cycles_per_flit = cycles; }
+    Cycles getCyclesPerFlit() const { return m_cycles_per_flit; }
+    uint64_t getBusyCycles() const { return m_busy_cycles; }
+    uint64_t getQueueingCycles() const { return m_queueing_cycles; }
+    Cycles getMaxQueueing() const { return m_max_queueing; }
+
+    // flits, and bytes of the messages they carry, per MessageSizeType
+    const std::vector<uint64_t> &
+    getMsgClassFlits() const
+    {
+        return m_msg_class_flits;
+    }
+    const std::vector<uint64_t> &
+    getMsgClassBytes() const
+    {
+        return m_msg_class_bytes;
+    }
+
   private:
+    void drainMailbox();
+
     const int m_id;
     link_type m_type;
     const Cycles m_latency;
+    Cycles m_cycles_per_flit;
+    Cycles m_busy_until;
 
     flitBuffer *linkBuffer;
     Consumer *link_consumer;
@@ -107,6 +142,30 @@ class NetworkLink : public ClockedObject, public Consumer
     // DO profiling
     uint64_t m_link_flit_bytes;
     uint64_t m_link_flit_count;
+
+    // cycles the link was serializing flits, and cycles flits waited in
+    // the source queue for it
+    uint64_t m_busy_cycles;
+    uint64_t m_queueing_cycles;
+    Cycles m_max_queueing;
+
+    std::vector<uint64_t> m_msg_class_flits;
+    std::vector<uint64_t> m_msg_class_bytes;
+
+    // Partition boundary. The sending side leaves flits in the mailbox
+    // instead of linkBuffer; the receiving side moves them over at every
+    // quantum boundary, after all sends of the previous quantum.
+    struct Mail
+    {
+        Tick sent;
+        Tick arrival;
+        flit *t_flit;
+    };
+    EventQueue *m_dest_eventq;
+    Tick m_quantum;
+    std::mutex m_mailbox_mutex;
+    std::deque<Mail> m_mailbox;
+    EventFunctionWrapper m_drain_event;
 };
 
 #endif // __MEM_RUBY_NETWORK_GARNET2_0_NETWORKLINK_HH__
@@ -0,0 +1,79 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2024 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: LicenseRef-NvidiaProprietary
+ *
+ * NVIDIA CORPORATION, its affiliates and licensors retain all intellectual
+ * property and proprietary rights in and to this material, related
+ * documentation and any modifications thereto. Any use, reproduction,
+ * disclosure or distribution of this material and related documentation
+ * without an express license agreement from NVIDIA CORPORATION or
+ * its affiliates is strictly prohibited.
+ */
+
+#ifndef __MEM_RUBY_NETWORK_GARNET2_0_VCMASK_HH__
+#define __MEM_RUBY_NETWORK_GARNET2_0_VCMASK_HH__
+
+#include <cstdint>
+#include <vector>
+
+#include "base/bitfield.hh"
+
+/**
+ * One bit per VC. Round-robin scans over VCs become a find-first-set from
+ * the round-robin pointer, wrapping once, so they visit the same VCs in
+ * the same order as a linear walk but skip the clear ones word by word.
+ */
+class VcMask
+{
+  public:
+    void
+    init(int size, bool value)
+    {
+        m_words.assign((size + 63) / 64, value ? ~0ULL : 0ULL);
+        if (value && size % 64)
+            m_words.back() = mask(size % 64);
+    }
+
+    void set(int i) { m_words[i / 64] |= 1ULL << (i % 64); }
+    void clear(int i) { m_words[i / 64] &= ~(1ULL << (i % 64)); }
+    bool test(int i) const { return m_words[i / 64] >> (i % 64) & 1; }
+
+    // first set bit in [from, end), or -1
+    int
+    next(int from, int end) const
+    {
+        while (from < end) {
+            uint64_t bits = m_words[from / 64] >> (from % 64);
+            if (bits) {
+                int i = from + __builtin_ctzll(bits);
+                return i < end ? i : -1;
+            }
+            from = (from / 64 + 1) * 64;
+        }
+        return -1;
+    }
+
+    // first set bit in [start, end), then in [begin, start), or -1
+    int
+    nextRotated(int begin, int end, int start) const
+    {
+        int i = next(start, end);
+        return i != -1 ? i : next(begin, start);
+    }
+
+  private:
+    std::vector<uint64_t> m_words;
+};
+
+/**
+ * Per-NI VC bitmaps, mirroring state the NI keeps elsewhere:
+ * idle     - OutVcState is IDLE_ (free for calculateVC)
+ * occupied - the NI output VC buffer holds at least one flit
+ */
+struct NiVcMasks
+{
+    VcMask idle;
+    VcMask occupied;
+};
+
+#endif // __MEM_RUBY_NETWORK_GARNET2_0_VCMASK_HH__
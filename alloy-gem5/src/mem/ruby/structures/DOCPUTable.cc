@@ -43,66 +43,281 @@
  */
 
 #include "mem/ruby/structures/DOCPUTable.hh"
+
+#include <algorithm>
+
+#include "base/bitfield.hh"
+#include "base/intmath.hh"
+#include "base/logging.hh"
 #include "base/trace.hh"
 #include "debug/DOPROTO.hh"
 #include "debug/DOSTORAGE.hh"
 
+DOCPUTable *
+DOCPUTableParams::create()
+{
+    return new DOCPUTable(this);
+}
+
+DOCPUTable::DOCPUTable(const Params *p)
+    : SimObject(p)
+{
+}
+
+void DOCPUTable::regStats() {
+    SimObject::regStats();
+
+    m_max_uncommitted_epochs
+        .name(name() + ".max_uncommitted_epochs")
+        .desc("Max uncommitted epochs held for one L2")
+        .flags(Stats::nozero);
+
+    m_uncommitted_epochs
+        .init(16)
+        .name(name() + ".uncommitted_epochs")
+        .desc("Uncommitted epochs held for an L2 after each release")
+        .flags(Stats::nozero | Stats::pdf);
+}
+
+void DOEpochRing::push(Epoch_t epoch) {
+    assert(epoch != 0);
+    assert(empty() || epoch > max());
+    if (m_tail - m_head == m_slots.size()) {
+        grow();
+    }
+    m_slots[m_tail & (m_slots.size() - 1)] = epoch;
+    ++m_tail;
+    ++m_live;
+}
+
+void DOEpochRing::erase(Epoch_t epoch) {
+    size_t mask = m_slots.size() - 1;
+    size_t i = m_head;
+    while (i != m_tail && m_slots[i & mask] != epoch) {
+        ++i;
+    }
+    assert(i != m_tail);
+    m_slots[i & mask] = 0;
+    --m_live;
+    // retire committed epochs from both ends so the ring stays compact
+    while (m_head != m_tail && m_slots[m_head & mask] == 0) {
+        ++m_head;
+    }
+    while (m_tail != m_head && m_slots[(m_tail - 1) & mask] == 0) {
+        --m_tail;
+    }
+}
+
+Epoch_t DOEpochRing::max() const {
+    if (m_head == m_tail) {
+        return 0;
+    }
+    return m_slots[(m_tail - 1) & (m_slots.size() - 1)];
+}
+
+std::vector<Epoch_t> DOEpochRing::live() const {
+    std::vector<Epoch_t> epochs;
+    epochs.reserve(m_live);
+    size_t mask = m_slots.size() - 1;
+    for (size_t i = m_head; i != m_tail; ++i) {
+        if (m_slots[i & mask] != 0) {
+            epochs.push_back(m_slots[i & mask]);
+        }
+    }
+    return epochs;
+}
+
+void DOEpochRing::grow() {
+    std::vector<Epoch_t> slots(m_slots.size() * 2, 0);
+    size_t mask = m_slots.size() - 1;
+    for (size_t i = m_head; i != m_tail; ++i) {
+        slots[i - m_head] = m_slots[i & mask];
+    }
+    m_tail -= m_head;
+    m_head = 0;
+    m_slots.swap(slots);
+    DPRINTF(DOSTORAGE, "unCommittedEpochs ring grown to %lu\n",
+            m_slots.size());
+}
+
+void DOCPUTable::serialize(CheckpointOut &cp) const {
+    SERIALIZE_SCALAR(curEpoch);
+    SERIALIZE_CONTAINER(m_index);
+    SERIALIZE_CONTAINER(m_stMask);
+    SERIALIZE_CONTAINER(m_unCommittedMask);
+    SERIALIZE_CONTAINER(m_notifySentMask);
+
+    // entries are flattened column by column; the uncommitted epochs of
+    // all entries go back to back, split by epoch_counts
+    std::vector<int> types, nums, valid;
+    std::vector<Cnt_t> st_cnts;
+    std::vector<Epoch_t> st_cnt_epochs, epochs;
+    std::vector<uint32_t> epoch_counts;
+    for (const auto &entry : m_entries) {
+        types.push_back(entry.id.type);
+        nums.push_back(entry.id.num);
+        valid.push_back(entry.valid);
+        st_cnts.push_back(entry.stCnt);
+        st_cnt_epochs.push_back(entry.stCntEpoch);
+        std::vector<Epoch_t> live = entry.unCommittedEpochs.live();
+        epoch_counts.push_back(live.size());
+        epochs.insert(epochs.end(), live.begin(), live.end());
+    }
+    SERIALIZE_CONTAINER(types);
+    SERIALIZE_CONTAINER(nums);
+    SERIALIZE_CONTAINER(valid);
+    SERIALIZE_CONTAINER(st_cnts);
+    SERIALIZE_CONTAINER(st_cnt_epochs);
+    SERIALIZE_CONTAINER(epoch_counts);
+    SERIALIZE_CONTAINER(epochs);
+}
+
+void DOCPUTable::unserialize(CheckpointIn &cp) {
+    UNSERIALIZE_SCALAR(curEpoch);
+    UNSERIALIZE_CONTAINER(m_index);
+    UNSERIALIZE_CONTAINER(m_stMask);
+    UNSERIALIZE_CONTAINER(m_unCommittedMask);
+    UNSERIALIZE_CONTAINER(m_notifySentMask);
+
+    std::vector<int> types, nums, valid;
+    std::vector<Cnt_t> st_cnts;
+    std::vector<Epoch_t> st_cnt_epochs, epochs;
+    std::vector<uint32_t> epoch_counts;
+    UNSERIALIZE_CONTAINER(types);
+    UNSERIALIZE_CONTAINER(nums);
+    UNSERIALIZE_CONTAINER(valid);
+    UNSERIALIZE_CONTAINER(st_cnts);
+    UNSERIALIZE_CONTAINER(st_cnt_epochs);
+    UNSERIALIZE_CONTAINER(epoch_counts);
+    UNSERIALIZE_CONTAINER(epochs);
+
+    m_entries.assign(types.size(), DOCPUEntry{});
+    auto epoch = epochs.begin();
+    for (size_t i = 0; i < m_entries.size(); ++i) {
+        DOCPUEntry &entry = m_entries[i];
+        entry.id = MachineID(MachineType(types[i]), NodeID(nums[i]));
+        entry.valid = valid[i];
+        entry.stCnt = st_cnts[i];
+        entry.stCntEpoch = st_cnt_epochs[i];
+        for (uint32_t j = 0; j < epoch_counts[i]; ++j) {
+            entry.unCommittedEpochs.push(*epoch++);
+        }
+    }
+    assert(epoch == epochs.end());
+    fatal_if(divCeil(m_entries.size(), MaskBits) != m_stMask.size(),
+             "%s: checkpointed L2 masks do not match its entries\n",
+             name());
+}
+
+int DOCPUTable::lookup(MachineID m_id) const {
+    NodeID num = MachineType_base_number(m_id.type) + m_id.num;
+    if (num >= m_index.size()) {
+        return -1;
+    }
+    return m_index[num];
+}
+
+int DOCPUTable::index(MachineID m_id) {
+    int idx = lookup(m_id);
+    if (idx < 0) {
+        NodeID num = MachineType_base_number(m_id.type) + m_id.num;
+        if (num >= m_index.size()) {
+            m_index.resize(num + 1, -1);
+        }
+        idx = m_entries.size();
+        m_index[num] = idx;
+        m_entries.push_back(DOCPUEntry{});
+        m_entries[idx].id = m_id;
+        size_t words = divCeil(m_entries.size(), MaskBits);
+        m_stMask.resize(words, 0);
+        m_unCommittedMask.resize(words, 0);
+        m_notifySentMask.resize(words, 0);
+    }
+    // touching an L2 allocates it, as the old map lookup did
+    m_entries[idx].valid = true;
+    return idx;
+}
+
+void DOCPUTable::setBit(std::vector<Mask_t>& mask, int idx, bool val) {
+    Mask_t bit = Mask_t(1) << (idx % MaskBits);
+    if (val) {
+        mask[idx / MaskBits] |= bit;
+    } else {
+        mask[idx / MaskBits] &= ~bit;
+    }
+}
+
+DOCPUTable::Mask_t DOCPUTable::pendingWord(size_t w, int ex_idx) const {
+    Mask_t word = (m_stMask[w] | m_unCommittedMask[w]) & ~m_notifySentMask[w];
+    if (ex_idx >= 0 && size_t(ex_idx / MaskBits) == w) {
+        word &= ~(Mask_t(1) << (ex_idx % MaskBits));
+    }
+    return word;
+}
+
 bool DOCPUTable::allocated(MachineID m_id) {
-    return m_map.find(m_id) != m_map.end();
+    int idx = lookup(m_id);
+    return idx >= 0 && m_entries[idx].valid;
 }
 
 void DOCPUTable::allocate(MachineID m_id) {
-    if (!allocated(m_id)) {
-        m_map[m_id] = DOCPUEntry{};
-    }
+    index(m_id);
 }
 
 void DOCPUTable::deallocate(MachineID m_id) {
     assert(allocated(m_id));
-    m_map.erase(m_id);
+    // the dense index stays reserved for this L2
+    int idx = lookup(m_id);
+    m_entries[idx] = DOCPUEntry{};
+    m_entries[idx].id = m_id;
+    setBit(m_stMask, idx, false);
+    setBit(m_unCommittedMask, idx, false);
+    setBit(m_notifySentMask, idx, false);
 }
 
 Cnt_t DOCPUTable::getStCnt(MachineID m_id) {
-    allocated(m_id);
-    return m_map[m_id].stCnt;
+    const DOCPUEntry &entry = m_entries[index(m_id)];
+    return entry.stCntEpoch == curEpoch ? entry.stCnt : 0;
 }
 
 void DOCPUTable::incStCnt(MachineID m_id) {
-    allocated(m_id);
-    ++(m_map[m_id].stCnt);
+    int idx = index(m_id);
+    DOCPUEntry &entry = m_entries[idx];
+    if (entry.stCntEpoch != curEpoch) {
+        entry.stCntEpoch = curEpoch;
+        entry.stCnt = 0;
+    }
+    ++entry.stCnt;
+    setBit(m_stMask, idx, true);
 }
 
 void DOCPUTable::commitEpoch(MachineID m_id, Epoch_t epoch) {
-    allocated(m_id);
-    auto& unCommittedEpochs = m_map[m_id].unCommittedEpochs;
-    assert(unCommittedEpochs.find(epoch) != unCommittedEpochs.end());
+    int idx = index(m_id);
+    auto& unCommittedEpochs = m_entries[idx].unCommittedEpochs;
     unCommittedEpochs.erase(epoch);
+    setBit(m_unCommittedMask, idx, !unCommittedEpochs.empty());
 }
 
 void DOCPUTable::addUncommittedEpoch(MachineID m_id, Epoch_t epoch) {
-    allocated(m_id);
-    auto& unCommittedEpochs = m_map[m_id].unCommittedEpochs;
-    assert(unCommittedEpochs.find(epoch) == unCommittedEpochs.end());
-    unCommittedEpochs.insert(epoch);
-    DPRINTF(DOSTORAGE, "unCommittedEpochs %lu\n", unCommittedEpochs.size());
+    int idx = index(m_id);
+    auto& unCommittedEpochs = m_entries[idx].unCommittedEpochs;
+    unCommittedEpochs.push(epoch);
+    setBit(m_unCommittedMask, idx, true);
+    m_uncommitted_epochs.sample(unCommittedEpochs.size());
+    if (unCommittedEpochs.size() > m_max_uncommitted_epochs.value()) {
+        m_max_uncommitted_epochs = unCommittedEpochs.size();
+    }
 }
 
 Epoch_t DOCPUTable::getMaxUncommittedEpoch(MachineID m_id) {
-    allocated(m_id);
-    auto& unCommittedEpochs = m_map[m_id].unCommittedEpochs;
-    if (unCommittedEpochs.empty()) {
-        return 0;
-    } else {
-        return *(unCommittedEpochs.rbegin());
-    }
+    return m_entries[index(m_id)].unCommittedEpochs.max();
 }
 
 void DOCPUTable::advanceEpoch(void) {
+    // per-entry stCnts expire through their epoch stamp
     ++curEpoch;
-    for (auto& entry : m_map) {
-        entry.second.stCnt = 0;
-        entry.second.reqNotifySent = false;
-    }
+    std::fill(m_stMask.begin(), m_stMask.end(), 0);
+    std::fill(m_notifySentMask.begin(), m_notifySentMask.end(), 0);
 }
 
 Epoch_t DOCPUTable::getEpoch(void) {
@@ -110,37 +325,38 @@ Epoch_t DOCPUTable::getEpoch(void) {
 }
 
 int DOCPUTable::getNumPendingL2s(MachineID ex_l2_id) {
-    uint32_t ret = 0;
-    for (const auto& entry : m_map) {
-        if ((entry.first != ex_l2_id)
-            && ((entry.second.stCnt != 0) || !entry.second.unCommittedEpochs.empty())
-            && (!entry.second.reqNotifySent)) {
-            DPRINTF(DOPROTO, "count pending L2[%s] = %d\n", entry.first, ret);
-            ++ret;
-        }
+    int ex_idx = lookup(ex_l2_id);
+    int ret = 0;
+    for (size_t w = 0; w < m_stMask.size(); ++w) {
+        ret += popCount(pendingWord(w, ex_idx));
     }
+    DPRINTF(DOPROTO, "count pending L2s = %d\n", ret);
     return ret;
 }
 
-MachineID DOCPUTable::popOnePendingL2(MachineID ex_l2_id) {
-    for (auto& entry : m_map) {
-        if ((entry.first != ex_l2_id)
-            && ((entry.second.stCnt != 0) || !entry.second.unCommittedEpochs.empty())
-            && (!entry.second.reqNotifySent)) {
-            entry.second.reqNotifySent = true;
-            DPRINTF(DOPROTO, "pop pending L2[%s]\n", entry.first);
-            return entry.first;
+DOReqNotifySet DOCPUTable::popPendingL2s(MachineID ex_l2_id) {
+    int ex_idx = lookup(ex_l2_id);
+    DOReqNotifySet set;
+    for (size_t w = 0; w < m_stMask.size(); ++w) {
+        Mask_t word = pendingWord(w, ex_idx);
+        m_notifySentMask[w] |= word;
+        while (word) {
+            int bit = findLsbSet(word);
+            word &= ~(Mask_t(1) << bit);
+            DOCPUEntry &entry = m_entries[w * MaskBits + bit];
+            DPRINTF(DOPROTO, "pop pending L2[%s]\n", entry.id);
+            set.add(entry.id,
+                    entry.stCntEpoch == curEpoch ? entry.stCnt : 0,
+                    entry.unCommittedEpochs.max());
         }
     }
-    return ex_l2_id;
+    return set;
 }
 
 int DOCPUTable::getNumSentReqNotify(void) {
-    uint32_t ret = 0;
-    for (const auto& entry : m_map) {
-        if (entry.second.reqNotifySent) {
-            ++ret;
-        }
+    int ret = 0;
+    for (auto word : m_notifySentMask) {
+        ret += popCount(word);
     }
     return ret;
-}
\ No newline at end of file
+}
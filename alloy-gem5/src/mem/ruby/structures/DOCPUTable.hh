@@ -42,33 +42,89 @@
 #ifndef __MEM_RUBY_STRUCTURES_DOCPUTABLE_HH__
 #define __MEM_RUBY_STRUCTURES_DOCPUTABLE_HH__
 
+#include "base/statistics.hh"
 #include "mem/ruby/common/Address.hh"
 #include "mem/ruby/common/MachineID.hh"
 #include "mem/ruby/common/NetDest.hh"
 #include "mem/ruby/common/TypeDefines.hh"
+#include "mem/ruby/structures/DOReqNotifySet.hh"
+#include "params/DOCPUTable.hh"
+#include "sim/sim_object.hh"
 
+#include <cstdint>
 #include <iostream>
-#include <set>
-#include <unordered_map>
-#include <unordered_set>
+#include <vector>
+
+// epochs this core released to one L2 and that are not acknowledged yet.
+// They are added in increasing order, so the ring is sorted and the max
+// uncommitted epoch is the newest live slot.
+class DOEpochRing {
+public:
+    void push(Epoch_t);
+    void erase(Epoch_t);
+    Epoch_t max() const;
+    bool empty() const { return m_live == 0; }
+    size_t size() const { return m_live; }
+    // live epochs, oldest first
+    std::vector<Epoch_t> live() const;
+
+private:
+    void grow();
+
+    // power-of-two capacity, 0 marks a committed (dead) slot
+    std::vector<Epoch_t> m_slots = std::vector<Epoch_t>(16, 0);
+    size_t m_head = 0;
+    size_t m_tail = 0;
+    size_t m_live = 0;
+};
 
 class DOCPUEntry {
 public:
+    MachineID id;
+    bool valid = false;
+    // stCnt is only valid while stCntEpoch matches the table's epoch, so
+    // advanceEpoch does not have to visit every entry
     Cnt_t stCnt = 0;
-    std::set<Epoch_t> unCommittedEpochs;
-    bool reqNotifySent = false;
-    // because slicc does not have for loop, we have to process the st-rel multiple pass,
-    // in each pass a req-notify is sent to one pending l2,
-    // reqNotifysent marks whether a req-notify for current epoch has been sent
+    Epoch_t stCntEpoch = 0;
+    DOEpochRing unCommittedEpochs;
 };
 
-class DOCPUTable
+// Per-L2 release state of one core. L2s get a dense index the first time
+// they are seen, and the per-epoch flags are kept as bitmasks over that
+// index: an L2 is pending while it has stores in the current epoch or
+// uncommitted epochs, and has not been sent a REQ_NOTIFY yet. A st-rel
+// pops all pending L2s at once and sends them one multicast REQ_NOTIFY.
+class DOCPUTable : public SimObject
 {
 private:
-    std::unordered_map<MachineID, DOCPUEntry, MachineIDHash> m_map;
+    typedef uint64_t Mask_t;
+    static const int MaskBits = 64;
+
+    std::vector<int> m_index;       // global machine number -> dense index
+    std::vector<DOCPUEntry> m_entries;
+    std::vector<Mask_t> m_stMask;           // stCnt != 0 in this epoch
+    std::vector<Mask_t> m_unCommittedMask;  // uncommitted epochs pending
+    std::vector<Mask_t> m_notifySentMask;   // req-notify sent in this epoch
     Epoch_t curEpoch = 1;
 
+    int lookup(MachineID) const;
+    int index(MachineID);
+    static void setBit(std::vector<Mask_t>&, int, bool);
+    Mask_t pendingWord(size_t, int) const;
+
+    // storage high watermarks, see scripts/post_process.py
+    Stats::Scalar m_max_uncommitted_epochs;
+    Stats::Histogram m_uncommitted_epochs;
+
 public:
+    typedef DOCPUTableParams Params;
+    DOCPUTable(const Params *p);
+
+    void regStats() override;
+
+    void serialize(CheckpointOut &cp) const override;
+    void unserialize(CheckpointIn &cp) override;
+
     bool allocated(MachineID);
     void allocate(MachineID);
     void deallocate(MachineID);
@@ -80,8 +136,8 @@ public:
     void advanceEpoch();
     Epoch_t getEpoch();
     int getNumPendingL2s(MachineID);
-    MachineID popOnePendingL2(MachineID);
+    DOReqNotifySet popPendingL2s(MachineID);
     int getNumSentReqNotify();
 };
 
-#endif // __MEM_RUBY_STRUCTURES_DOCPUTABLE_HH__
\ No newline at end of file
+#endif // __MEM_RUBY_STRUCTURES_DOCPUTABLE_HH__
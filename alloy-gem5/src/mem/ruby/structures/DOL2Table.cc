@@ -43,117 +43,323 @@
  */
 
 #include "mem/ruby/structures/DOL2Table.hh"
+
+#include <algorithm>
+
+#include "base/logging.hh"
 #include "base/trace.hh"
 #include "debug/DOPROTO.hh"
-#include "debug/DOSTORAGE.hh"
+#include "mem/ruby/system/RubySystem.hh"
+
+DOL2Table *
+DOL2TableParams::create()
+{
+    return new DOL2Table(this);
+}
+
+DOL2Table::DOL2Table(const Params *p)
+    : SimObject(p), m_depth(p->depth),
+      m_recycle_latency(p->recycle_latency)
+{
+    fatal_if(m_depth == 0, "%s: depth must be at least 1\n", name());
+}
+
+void DOL2Table::init() {
+    SimObject::init();
+
+    // controllers register themselves while being constructed, so the
+    // machine count is only known once everything has been created
+    int num_requestors = MachineType_base_number(MachineType_NUM);
+    m_entries.assign(num_requestors, DOL2Entry{});
+    m_slots.assign(num_requestors * m_depth, DOL2Slot{});
+    m_waiters.assign(num_requestors,
+                     std::unordered_map<Epoch_t, std::vector<DOL2Waiter>>());
+}
+
+void DOL2Table::serialize(CheckpointOut &cp) const {
+    // parked messages sit in the controller's message buffers, which are
+    // not checkpointed, so the waiter registry has to be empty
+    for (const auto &by_epoch : m_waiters) {
+        fatal_if(!by_epoch.empty(),
+                 "%s: cannot checkpoint with parked DO messages\n", name());
+    }
+
+    uint32_t depth = m_depth;
+    SERIALIZE_SCALAR(depth);
+
+    std::vector<uint32_t> allocated, max_committed_epochs;
+    std::vector<uint32_t> num_st_cnts, num_noti_cnts;
+    for (const auto &entry : m_entries) {
+        allocated.push_back(entry.allocated);
+        max_committed_epochs.push_back(entry.maxCommittedEpochs);
+        num_st_cnts.push_back(entry.numStCnts);
+        num_noti_cnts.push_back(entry.numNotiCnts);
+    }
+    SERIALIZE_CONTAINER(allocated);
+    SERIALIZE_CONTAINER(max_committed_epochs);
+    SERIALIZE_CONTAINER(num_st_cnts);
+    SERIALIZE_CONTAINER(num_noti_cnts);
+
+    std::vector<Epoch_t> slot_epochs;
+    std::vector<Cnt_t> slot_st_cnts;
+    std::vector<uint32_t> slot_noti_cnts, slot_flags;
+    for (const auto &slot : m_slots) {
+        slot_epochs.push_back(slot.epoch);
+        slot_st_cnts.push_back(slot.stCnt);
+        slot_noti_cnts.push_back(slot.notiCnt);
+        slot_flags.push_back((slot.hasStCnt ? 1 : 0) |
+                             (slot.hasNotiCnt ? 2 : 0));
+    }
+    SERIALIZE_CONTAINER(slot_epochs);
+    SERIALIZE_CONTAINER(slot_st_cnts);
+    SERIALIZE_CONTAINER(slot_noti_cnts);
+    SERIALIZE_CONTAINER(slot_flags);
+}
+
+void DOL2Table::unserialize(CheckpointIn &cp) {
+    uint32_t depth;
+    UNSERIALIZE_SCALAR(depth);
+    fatal_if(depth != m_depth, "%s: checkpoint has depth %d, not %d\n",
+             name(), depth, m_depth);
+
+    std::vector<uint32_t> allocated, max_committed_epochs;
+    std::vector<uint32_t> num_st_cnts, num_noti_cnts;
+    UNSERIALIZE_CONTAINER(allocated);
+    UNSERIALIZE_CONTAINER(max_committed_epochs);
+    UNSERIALIZE_CONTAINER(num_st_cnts);
+    UNSERIALIZE_CONTAINER(num_noti_cnts);
+    fatal_if(allocated.size() != m_entries.size(),
+             "%s: checkpoint has %d requestors, not %d\n",
+             name(), allocated.size(), m_entries.size());
+    for (size_t i = 0; i < m_entries.size(); ++i) {
+        m_entries[i].allocated = allocated[i];
+        m_entries[i].maxCommittedEpochs = max_committed_epochs[i];
+        m_entries[i].numStCnts = num_st_cnts[i];
+        m_entries[i].numNotiCnts = num_noti_cnts[i];
+    }
+
+    std::vector<Epoch_t> slot_epochs;
+    std::vector<Cnt_t> slot_st_cnts;
+    std::vector<uint32_t> slot_noti_cnts, slot_flags;
+    UNSERIALIZE_CONTAINER(slot_epochs);
+    UNSERIALIZE_CONTAINER(slot_st_cnts);
+    UNSERIALIZE_CONTAINER(slot_noti_cnts);
+    UNSERIALIZE_CONTAINER(slot_flags);
+    assert(slot_epochs.size() == m_slots.size());
+    for (size_t i = 0; i < m_slots.size(); ++i) {
+        m_slots[i].epoch = slot_epochs[i];
+        m_slots[i].stCnt = slot_st_cnts[i];
+        m_slots[i].notiCnt = slot_noti_cnts[i];
+        m_slots[i].hasStCnt = slot_flags[i] & 1;
+        m_slots[i].hasNotiCnt = slot_flags[i] & 2;
+    }
+}
+
+void DOL2Table::regStats() {
+    SimObject::regStats();
+
+    m_parked_put_rels
+        .name(name() + ".parked_put_rels")
+        .desc("Number of PUT_RELs parked waiting for their epoch to commit")
+        .flags(Stats::nozero);
+
+    m_parked_req_notifies
+        .name(name() + ".parked_req_notifies")
+        .desc("Number of REQ_NOTIFYs parked waiting for their epoch")
+        .flags(Stats::nozero);
+
+    m_parked_slot_full
+        .name(name() + ".parked_slot_full")
+        .desc("Number of DO messages back-pressured by a full epoch ring")
+        .flags(Stats::nozero);
+
+    m_wakeups
+        .name(name() + ".waiter_wakeups")
+        .desc("Number of parked DO messages woken up")
+        .flags(Stats::nozero);
+
+    m_spurious_wakeups
+        .name(name() + ".waiter_spurious_wakeups")
+        .desc("Number of woken DO messages that had to park again")
+        .flags(Stats::nozero);
+
+    m_wakeups_avoided
+        .name(name() + ".waiter_wakeups_avoided")
+        .desc("Number of recycle polls avoided by parking DO messages")
+        .flags(Stats::nozero);
+
+    m_park_cycles
+        .init(16)
+        .name(name() + ".waiter_park_cycles")
+        .desc("Cycles a DO message stayed parked before being woken")
+        .flags(Stats::nozero | Stats::pdf);
+
+    m_max_st_cnts
+        .name(name() + ".max_st_cnts")
+        .desc("Max epochs with a store count held for one requestor")
+        .flags(Stats::nozero);
+
+    m_max_noti_cnts
+        .name(name() + ".max_noti_cnts")
+        .desc("Max epochs with a notify count held for one requestor")
+        .flags(Stats::nozero);
+
+    m_max_parked_put_rels
+        .name(name() + ".max_parked_put_rels")
+        .desc("Max PUT_RELs parked at the same time")
+        .flags(Stats::nozero);
+
+    m_st_cnts
+        .init(16)
+        .name(name() + ".st_cnts")
+        .desc("Epochs with a store count held for a requestor on each PUT_NT")
+        .flags(Stats::nozero | Stats::pdf);
+
+    m_noti_cnts
+        .init(16)
+        .name(name() + ".noti_cnts")
+        .desc("Epochs with a notify count held for a requestor on each NOTIFY")
+        .flags(Stats::nozero | Stats::pdf);
+}
+
+int DOL2Table::index(MachineID c_id) const {
+    int idx = MachineType_base_number(c_id.type) + c_id.num;
+    assert(idx >= 0 && idx < m_entries.size());
+    return idx;
+}
+
+DOL2Entry& DOL2Table::entry(MachineID c_id) {
+    // touching a requestor allocates it, as the old map lookup did
+    DOL2Entry &e = m_entries[index(c_id)];
+    e.allocated = true;
+    return e;
+}
+
+DOL2Slot* DOL2Table::lookup(MachineID c_id, Epoch_t epoch) {
+    DOL2Slot &s = slot(c_id, epoch);
+    if (s.valid() && s.epoch == epoch) {
+        return &s;
+    }
+    return nullptr;
+}
+
+DOL2Slot& DOL2Table::insert(MachineID c_id, Epoch_t epoch) {
+    DOL2Slot &s = slot(c_id, epoch);
+    if (!s.valid()) {
+        s = DOL2Slot{};
+        s.epoch = epoch;
+    }
+    panic_if(s.epoch != epoch,
+             "%s: epoch %d of %s overruns the ring held by epoch %d\n",
+             name(), epoch, c_id, s.epoch);
+    return s;
+}
+
+void DOL2Table::release(MachineID c_id, DOL2Slot &s) {
+    DOL2Entry &e = entry(c_id);
+    if (s.hasStCnt) {
+        --e.numStCnts;
+    }
+    if (s.hasNotiCnt) {
+        --e.numNotiCnts;
+    }
+    s.hasStCnt = false;
+    s.hasNotiCnt = false;
+}
 
 bool DOL2Table::allocated(MachineID c_id) {
-    return m_map.find(c_id) != m_map.end();
+    return m_entries[index(c_id)].allocated;
 }
 
 void DOL2Table::allocate(MachineID c_id) {
-    if (!allocated(c_id)) {
-        m_map[c_id] = DOL2Entry{};
-    }
+    entry(c_id);
 }
 
 void DOL2Table::deallocate(MachineID c_id) {
     assert(allocated(c_id));
-    m_map.erase(c_id);
+    int idx = index(c_id);
+    m_entries[idx] = DOL2Entry{};
+    std::fill(m_slots.begin() + idx * m_depth,
+              m_slots.begin() + (idx + 1) * m_depth, DOL2Slot{});
+}
+
+bool DOL2Table::hasSlot(MachineID c_id, Epoch_t epoch) {
+    DOL2Slot &s = slot(c_id, epoch);
+    return !s.valid() || s.epoch == epoch;
 }
 
 void DOL2Table::incStCnt(MachineID c_id, Epoch_t epoch) {
-    allocated(c_id);
-    auto &stCnts = m_map[c_id].stCnts;
-    if (stCnts.find(epoch) == stCnts.end()) {
-        stCnts[epoch] = 0;
-    }
-    ++(stCnts[epoch]);
-
-    // for profiling storage overhead
-    size_t max_stCnts_size = 0;
-    for (auto &i : m_map) {
-        if (i.second.stCnts.size() > max_stCnts_size) {
-            max_stCnts_size = i.second.stCnts.size();
-        }
+    DOL2Slot &s = insert(c_id, epoch);
+    if (!s.hasStCnt) {
+        s.hasStCnt = true;
+        s.stCnt = 0;
+        ++entry(c_id).numStCnts;
+    }
+    ++s.stCnt;
+
+    uint32_t num_st_cnts = entry(c_id).numStCnts;
+    m_st_cnts.sample(num_st_cnts);
+    if (num_st_cnts > m_max_st_cnts.value()) {
+        m_max_st_cnts = num_st_cnts;
     }
-    DPRINTF(DOSTORAGE, "stCnts %lu\n", max_stCnts_size);
 }
 
 Cnt_t DOL2Table::getStCnt(MachineID c_id, Epoch_t epoch) {
-    allocated(c_id);
-    auto &stCnts = m_map[c_id].stCnts;
-    if (stCnts.find(epoch) == stCnts.end()) {
+    DOL2Slot *s = lookup(c_id, epoch);
+    if (!s || !s->hasStCnt) {
         return 0;
     }
-    return stCnts[epoch];
+    return s->stCnt;
 }
 
 void DOL2Table::incNotiCnt(MachineID c_id, Epoch_t epoch) {
-    allocated(c_id);
-    auto &notiCnts = m_map[c_id].notiCnts;
-    if (notiCnts.find(epoch) == notiCnts.end()) {
-        notiCnts[epoch] = 0;
-    }
-    ++(notiCnts[epoch]);
-
-    // for profiling storage overhead
-    size_t max_notiCnts_size = 0;
-    for (auto &i : m_map) {
-        if (i.second.notiCnts.size() > max_notiCnts_size) {
-            max_notiCnts_size = i.second.notiCnts.size();
-        }
+    DOL2Slot &s = insert(c_id, epoch);
+    if (!s.hasNotiCnt) {
+        s.hasNotiCnt = true;
+        s.notiCnt = 0;
+        ++entry(c_id).numNotiCnts;
+    }
+    ++s.notiCnt;
+
+    uint32_t num_noti_cnts = entry(c_id).numNotiCnts;
+    m_noti_cnts.sample(num_noti_cnts);
+    if (num_noti_cnts > m_max_noti_cnts.value()) {
+        m_max_noti_cnts = num_noti_cnts;
     }
-    DPRINTF(DOSTORAGE, "notiCnts %lu\n", max_notiCnts_size);
 }
 
 uint32_t DOL2Table::getNotiCnt(MachineID c_id, Epoch_t epoch) {
-    allocated(c_id);
-    auto &notiCnts = m_map[c_id].notiCnts;
-    if (notiCnts.find(epoch) == notiCnts.end()) {
+    DOL2Slot *s = lookup(c_id, epoch);
+    if (!s || !s->hasNotiCnt) {
         return 0;
     }
-    return notiCnts[epoch];
+    return s->notiCnt;
 }
 
 void DOL2Table::markCommittedEpoch(MachineID c_id, Epoch_t epoch) {
     assert(allocated(c_id));
-    auto &stCnts = m_map[c_id].stCnts;
-    stCnts.erase(epoch);
-    auto &notiCnts = m_map[c_id].notiCnts;
-    notiCnts.erase(epoch);
-    m_map[c_id].maxCommittedEpochs = epoch;
+    DOL2Slot *s = lookup(c_id, epoch);
+    if (s) {
+        release(c_id, *s);
+    }
+    entry(c_id).maxCommittedEpochs = epoch;
 }
 
 bool DOL2Table::canCommit(MachineID c_id, Epoch_t epoch, Cnt_t stCnt,
             uint32_t notiWaitCnt, Epoch_t maxUncommittedEpoch) {
-    allocated(c_id);
-    auto &stCnts = m_map[c_id].stCnts;
-    if (stCnts.find(epoch) == stCnts.end()) {
-        if (stCnt != 0) {
-            DPRINTF(DOPROTO, "cannot commit epoch[%d] msg_stcnt[%d] exp_stcnt[0]\n", epoch, stCnt);
-            return false;
-        }
-    } else {
-        if (stCnts[epoch] != stCnt) {
-            DPRINTF(DOPROTO, "cannot commit epoch[%d] msg_stcnt[%d] exp_stcnt[0]\n", epoch, stCnt, stCnts[epoch]);
-            return false;
-        }
+    DOL2Entry &e = entry(c_id);
+    Cnt_t exp_stCnt = getStCnt(c_id, epoch);
+    if (exp_stCnt != stCnt) {
+        DPRINTF(DOPROTO, "cannot commit epoch[%d] msg_stcnt[%d] exp_stcnt[%d]\n", epoch, stCnt, exp_stCnt);
+        return false;
     }
-    auto &notiCnts = m_map[c_id].notiCnts;
-    if (notiCnts.find(epoch) == notiCnts.end()) {
-        if (notiWaitCnt != 0) {
-            DPRINTF(DOPROTO, "cannot commit epoch[%d] msg_noticnt[%d] exp_noticnt[0]\n", epoch, notiWaitCnt);
-            return false;
-        }
-    } else {
-        if (notiCnts[epoch] != notiWaitCnt) {
-            DPRINTF(DOPROTO, "cannot commit epoch[%d] msg_noticnt[%d] exp_noticnt[%d]\n", epoch, notiCnts[epoch]);
-            return false;
-        }
+    uint32_t exp_notiCnt = getNotiCnt(c_id, epoch);
+    if (exp_notiCnt != notiWaitCnt) {
+        DPRINTF(DOPROTO, "cannot commit epoch[%d] msg_noticnt[%d] exp_noticnt[%d]\n", epoch, notiWaitCnt, exp_notiCnt);
+        return false;
     }
-    if (m_map[c_id].maxCommittedEpochs < maxUncommittedEpoch) {
-        DPRINTF(DOPROTO, "cannot commit epoch[%d] msg_maxUncommittedEpoch[%d] exp_maxUncommittedEpoch[%d]\n", epoch, maxUncommittedEpoch, m_map[c_id].maxCommittedEpochs);
+    if (e.maxCommittedEpochs < maxUncommittedEpoch) {
+        DPRINTF(DOPROTO, "cannot commit epoch[%d] msg_maxUncommittedEpoch[%d] exp_maxUncommittedEpoch[%d]\n", epoch, maxUncommittedEpoch, e.maxCommittedEpochs);
         return false;
     }
     DPRINTF(DOPROTO, "can commit epoch[%d]\n", epoch);
@@ -162,25 +368,174 @@ bool DOL2Table::canCommit(MachineID c_id, Epoch_t epoch, Cnt_t stCnt,
 
 bool DOL2Table::canSendNotify(MachineID c_id, Epoch_t epoch, Cnt_t stCnt,
             Epoch_t maxUncommittedEpoch) {
-    allocated(c_id);
-    auto &stCnts = m_map[c_id].stCnts;
-    if (stCnts.find(epoch) == stCnts.end()) {
-        if (stCnt != 0) {
-            return false;
+    DOL2Entry &e = entry(c_id);
+    if (getStCnt(c_id, epoch) != stCnt) {
+        return false;
+    }
+    if (e.maxCommittedEpochs < maxUncommittedEpoch) {
+        return false;
+    }
+    return true;
+}
+
+void DOL2Table::markNotiSent(MachineID c_id, Epoch_t epoch) {
+    DOL2Slot *s = lookup(c_id, epoch);
+    if (s && s->hasStCnt) {
+        s->hasStCnt = false;
+        --entry(c_id).numStCnts;
+    }
+}
+
+bool DOL2Table::blockingEpoch(MachineID c_id, const DOL2Waiter& waiter,
+                              Epoch_t &epoch) {
+    // Every condition a waiter checks belongs to one epoch of its
+    // requestor: its own counters, the commit of the epoch it is ordered
+    // behind, or the release of the epoch holding its ring slot. Each of
+    // them only changes on an event of that epoch.
+    switch (waiter.kind) {
+      case DOL2Waiter::PutRel:
+        if (getStCnt(c_id, waiter.epoch) != waiter.stCnt ||
+            getNotiCnt(c_id, waiter.epoch) != waiter.notiWaitCnt) {
+            epoch = waiter.epoch;
+            return true;
         }
-    } else {
-        if (stCnts[epoch] != stCnt) {
+        if (entry(c_id).maxCommittedEpochs < waiter.maxUncommittedEpoch) {
+            epoch = waiter.maxUncommittedEpoch;
+            return true;
+        }
+        return false;
+      case DOL2Waiter::ReqNotify:
+        if (getStCnt(c_id, waiter.epoch) != waiter.stCnt) {
+            epoch = waiter.epoch;
+            return true;
+        }
+        if (entry(c_id).maxCommittedEpochs < waiter.maxUncommittedEpoch) {
+            epoch = waiter.maxUncommittedEpoch;
+            return true;
+        }
+        return false;
+      case DOL2Waiter::Slot:
+        if (hasSlot(c_id, waiter.epoch)) {
             return false;
         }
+        epoch = slot(c_id, waiter.epoch).epoch;
+        return true;
+      default:
+        panic("unknown DOL2Waiter kind %d\n", waiter.kind);
     }
-    if (m_map[c_id].maxCommittedEpochs < maxUncommittedEpoch) {
+}
+
+Addr DOL2Table::blockingKey(MachineID c_id, const DOL2Waiter& waiter) {
+    Epoch_t epoch;
+    bool blocked = blockingEpoch(c_id, waiter, epoch);
+    panic_if(!blocked, "%s: parking a DO message of %s epoch[%d] that "
+             "is not blocked\n", name(), c_id, waiter.epoch);
+    return waiterKey(c_id, epoch);
+}
+
+Addr DOL2Table::waiterKey(MachineID c_id, Epoch_t epoch) {
+    // a line-aligned pseudo address per (requestor, epoch), far above any
+    // physical memory, under which the controller stall_and_waits the
+    // messages
+    Addr id = ((Addr)c_id.type << 16) | (Addr)c_id.num;
+    return (Addr(1) << 63) |
+           (id << (RubySystem::getBlockSizeBits() + 32)) |
+           ((Addr)epoch << RubySystem::getBlockSizeBits());
+}
+
+Addr DOL2Table::putRelWaiterKey(MachineID c_id, Epoch_t epoch, Cnt_t stCnt,
+            uint32_t notiWaitCnt, Epoch_t maxUncommittedEpoch) {
+    return blockingKey(c_id, DOL2Waiter{DOL2Waiter::PutRel, epoch, stCnt,
+                                        notiWaitCnt, maxUncommittedEpoch,
+                                        Cycles(0)});
+}
+
+Addr DOL2Table::reqNotifyWaiterKey(MachineID c_id, Epoch_t epoch,
+            Cnt_t stCnt, Epoch_t maxUncommittedEpoch) {
+    return blockingKey(c_id, DOL2Waiter{DOL2Waiter::ReqNotify, epoch, stCnt,
+                                        0, maxUncommittedEpoch, Cycles(0)});
+}
+
+Addr DOL2Table::slotWaiterKey(MachineID c_id, Epoch_t epoch) {
+    return blockingKey(c_id, DOL2Waiter{DOL2Waiter::Slot, epoch, 0, 0, 0,
+                                        Cycles(0)});
+}
+
+void DOL2Table::park(MachineID c_id, const DOL2Waiter& waiter) {
+    Epoch_t epoch;
+    bool blocked = blockingEpoch(c_id, waiter, epoch);
+    assert(blocked);
+    m_waiters[index(c_id)][epoch].push_back(waiter);
+}
+
+void DOL2Table::parkPutRel(MachineID c_id, Epoch_t epoch, Cnt_t stCnt,
+            uint32_t notiWaitCnt, Epoch_t maxUncommittedEpoch, Cycles now) {
+    DPRINTF(DOPROTO, "park PUT_REL requestor[%s] epoch[%d]\n", c_id, epoch);
+    park(c_id, DOL2Waiter{DOL2Waiter::PutRel, epoch, stCnt, notiWaitCnt,
+                          maxUncommittedEpoch, now});
+    ++m_parked_put_rels;
+    if (++m_live_put_rels > m_max_parked_put_rels.value()) {
+        m_max_parked_put_rels = m_live_put_rels;
+    }
+}
+
+void DOL2Table::parkReqNotify(MachineID c_id, Epoch_t epoch, Cnt_t stCnt,
+            Epoch_t maxUncommittedEpoch, Cycles now) {
+    DPRINTF(DOPROTO, "park REQ_NOTIFY requestor[%s] epoch[%d]\n", c_id, epoch);
+    park(c_id, DOL2Waiter{DOL2Waiter::ReqNotify, epoch, stCnt, 0,
+                          maxUncommittedEpoch, now});
+    ++m_parked_req_notifies;
+}
+
+void DOL2Table::parkSlot(MachineID c_id, Epoch_t epoch, Cycles now) {
+    DPRINTF(DOPROTO, "park on full ring requestor[%s] epoch[%d] slot epoch[%d]\n",
+            c_id, epoch, slot(c_id, epoch).epoch);
+    park(c_id, DOL2Waiter{DOL2Waiter::Slot, epoch, 0, 0, 0, now});
+    ++m_parked_slot_full;
+}
+
+bool DOL2Table::wakeWaiters(MachineID c_id, Epoch_t epoch, Cycles now) {
+    auto &by_epoch = m_waiters[index(c_id)];
+    auto it = by_epoch.find(epoch);
+    if (it == by_epoch.end()) {
+        return false;
+    }
+    auto &waiters = it->second;
+
+    // the event has to have moved at least one waiter off this epoch
+    bool any_moved = false;
+    for (const auto& waiter : waiters) {
+        Epoch_t blocking;
+        if (!blockingEpoch(c_id, waiter, blocking) || blocking != epoch) {
+            any_moved = true;
+            break;
+        }
+    }
+    if (!any_moved) {
         return false;
     }
+
+    // the controller reanalyzes every message parked under this key; those
+    // still blocked park themselves again, under the key of whatever they
+    // wait for now
+    for (const auto& waiter : waiters) {
+        uint64_t parked = now - waiter.parkCycle;
+        m_park_cycles.sample(parked);
+        ++m_wakeups;
+        Epoch_t blocking;
+        if (blockingEpoch(c_id, waiter, blocking) && blocking == epoch) {
+            ++m_spurious_wakeups;
+        }
+        if (waiter.kind == DOL2Waiter::PutRel) {
+            --m_live_put_rels;
+        }
+        uint64_t recycle_latency = m_recycle_latency;
+        if (recycle_latency > 0 && parked > recycle_latency) {
+            m_wakeups_avoided += (parked / recycle_latency) - 1;
+        }
+    }
+    DPRINTF(DOPROTO, "wake %lu waiters of requestor[%s] epoch[%d]\n",
+            waiters.size(), c_id, epoch);
+    by_epoch.erase(it);
     return true;
 }
-
-void DOL2Table::markNotiSent(MachineID c_id, Epoch_t epoch) {
-    allocated(c_id);
-    auto &stCnts = m_map[c_id].stCnts;
-    stCnts.erase(epoch);
-}
\ No newline at end of file
@@ -42,28 +42,108 @@
 #ifndef __MEM_RUBY_STRUCTURES_DOL2TABLE_HH__
 #define __MEM_RUBY_STRUCTURES_DOL2TABLE_HH__
 
+#include "base/statistics.hh"
 #include "mem/ruby/common/Address.hh"
 #include "mem/ruby/common/MachineID.hh"
 #include "mem/ruby/common/NetDest.hh"
 #include "mem/ruby/common/TypeDefines.hh"
+#include "params/DOL2Table.hh"
+#include "sim/sim_object.hh"
 
 #include <iostream>
-#include <set>
 #include <unordered_map>
-#include <unordered_set>
+#include <vector>
+
+// one epoch slot of a requestor's ring; an epoch e lives in slot
+// e % depth and is resident while it still has a store or notify count
+class DOL2Slot {
+public:
+    Epoch_t epoch;
+    Cnt_t stCnt;
+    uint32_t notiCnt;
+    bool hasStCnt;
+    bool hasNotiCnt;
+
+    bool valid() const { return hasStCnt || hasNotiCnt; }
+};
 
 class DOL2Entry {
 public:
-    std::unordered_map<Epoch_t, Cnt_t> stCnts;
-    std::unordered_map<Epoch_t, uint32_t> notiCnts;
+    bool allocated;
     Epoch_t maxCommittedEpochs;
+    uint32_t numStCnts;
+    uint32_t numNotiCnts;
 };
 
-class DOL2Table
+// a message parked at the L2 until its (requestor, epoch) counters line
+// up, or until the requestor's ring has a slot for its epoch. It carries
+// the condition it is waiting on so the table can tell when to wake it
+// instead of having the controller poll. It is parked under the one
+// epoch whose progress it needs next (see blockingEpoch()), so only
+// events of that epoch wake it.
+class DOL2Waiter {
+public:
+    enum Kind { PutRel, ReqNotify, Slot };
+
+    Kind kind;
+    Epoch_t epoch;
+    Cnt_t stCnt;
+    uint32_t notiWaitCnt;
+    Epoch_t maxUncommittedEpoch;
+    Cycles parkCycle;
+};
+
+class DOL2Table : public SimObject
 {
 private:
-    std::unordered_map<MachineID, DOL2Entry, MachineIDHash> m_map;
+    // dense, preallocated storage: one entry and `m_depth` epoch slots per
+    // requestor, indexed by the requestor's global machine number
+    const uint32_t m_depth;
+    std::vector<DOL2Entry> m_entries;
+    std::vector<DOL2Slot> m_slots;
+    // per requestor, the parked waiters by the epoch they depend on
+    std::vector<std::unordered_map<Epoch_t, std::vector<DOL2Waiter>>>
+        m_waiters;
+    const Cycles m_recycle_latency;
+
+    int index(MachineID c_id) const;
+    DOL2Entry& entry(MachineID);
+    DOL2Slot& slot(MachineID c_id, Epoch_t epoch)
+    { return m_slots[index(c_id) * m_depth + epoch % m_depth]; }
+    DOL2Slot* lookup(MachineID, Epoch_t);
+    DOL2Slot& insert(MachineID, Epoch_t);
+    void release(MachineID, DOL2Slot&);
+
+    bool blockingEpoch(MachineID, const DOL2Waiter&, Epoch_t&);
+    Addr blockingKey(MachineID, const DOL2Waiter&);
+    void park(MachineID, const DOL2Waiter&);
+
+    Stats::Scalar m_parked_put_rels;
+    Stats::Scalar m_parked_req_notifies;
+    Stats::Scalar m_parked_slot_full;
+    Stats::Scalar m_wakeups;
+    Stats::Scalar m_spurious_wakeups;
+    Stats::Scalar m_wakeups_avoided;
+    Stats::Histogram m_park_cycles;
+
+    // storage high watermarks, see scripts/post_process.py
+    uint32_t m_live_put_rels = 0;
+    Stats::Scalar m_max_st_cnts;
+    Stats::Scalar m_max_noti_cnts;
+    Stats::Scalar m_max_parked_put_rels;
+    Stats::Histogram m_st_cnts;
+    Stats::Histogram m_noti_cnts;
+
 public:
+    typedef DOL2TableParams Params;
+    DOL2Table(const Params *p);
+
+    void init() override;
+    void regStats() override;
+
+    void serialize(CheckpointOut &cp) const override;
+    void unserialize(CheckpointIn &cp) override;
+
     bool allocated(MachineID);
     void allocate(MachineID);
     void deallocate(MachineID);
@@ -75,6 +155,22 @@ public:
     bool canCommit(MachineID, Epoch_t, Cnt_t, uint32_t, Epoch_t);
     bool canSendNotify(MachineID, Epoch_t, Cnt_t, Epoch_t);
     void markNotiSent(MachineID, Epoch_t);
+
+    // false when the epoch is not resident and its slot holds another
+    // epoch; the in_port has to back-pressure the message
+    bool hasSlot(MachineID, Epoch_t);
+
+    // waiter registry, see DO_MESI-L2cache.sm. The *WaiterKey functions
+    // give the key a blocked message has to be parked under; an event of
+    // (requestor, epoch) wakes the messages under waiterKey(requestor, epoch)
+    Addr waiterKey(MachineID, Epoch_t);
+    Addr putRelWaiterKey(MachineID, Epoch_t, Cnt_t, uint32_t, Epoch_t);
+    Addr reqNotifyWaiterKey(MachineID, Epoch_t, Cnt_t, Epoch_t);
+    Addr slotWaiterKey(MachineID, Epoch_t);
+    void parkPutRel(MachineID, Epoch_t, Cnt_t, uint32_t, Epoch_t, Cycles);
+    void parkReqNotify(MachineID, Epoch_t, Cnt_t, Epoch_t, Cycles);
+    void parkSlot(MachineID, Epoch_t, Cycles);
+    bool wakeWaiters(MachineID, Epoch_t, Cycles);
 };
 
-#endif // __MEM_RUBY_STRUCTURES_DOL2TABLE_HH__
\ No newline at end of file
+#endif // __MEM_RUBY_STRUCTURES_DOL2TABLE_HH__
@@ -46,3 +46,8 @@ class RubyDOL2Table(SimObject):
     cxx_class = 'DOL2Table'
     cxx_header = "mem/ruby/structures/DOL2Table.hh"
     ruby_system = Param.RubySystem(Parent.any, "")
+    recycle_latency = Param.Cycles(Parent.recycle_latency,
+        "recycle latency the parked messages would have polled with")
+    depth = Param.UInt32(16, "epoch slots per requestor; must cover the "
+        "epochs a requestor can have in flight, newer epochs that map to an "
+        "occupied slot are back-pressured")
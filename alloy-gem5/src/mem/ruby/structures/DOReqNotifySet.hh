@@ -0,0 +1,98 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2024 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: LicenseRef-NvidiaProprietary
+ *
+ * NVIDIA CORPORATION, its affiliates and licensors retain all intellectual
+ * property and proprietary rights in and to this material, related
+ * documentation and any modifications thereto. Any use, reproduction,
+ * disclosure or distribution of this material and related documentation
+ * without an express license agreement from NVIDIA CORPORATION or
+ * its affiliates is strictly prohibited.
+ */
+
+#ifndef __MEM_RUBY_STRUCTURES_DOREQNOTIFYSET_HH__
+#define __MEM_RUBY_STRUCTURES_DOREQNOTIFYSET_HH__
+
+#include <iostream>
+#include <vector>
+
+#include "base/logging.hh"
+#include "mem/ruby/common/MachineID.hh"
+#include "mem/ruby/common/NetDest.hh"
+#include "mem/ruby/common/TypeDefines.hh"
+
+/**
+ * Payload of a multicast REQ_NOTIFY. A release sends one REQ_NOTIFY to
+ * every pending L2 at once, and each of those L2s needs the releasing
+ * core's store count and newest uncommitted epoch for that L2 only. The
+ * message carries all of them and every destination picks its own.
+ */
+class DOReqNotifySet
+{
+  public:
+    void
+    add(MachineID l2, Cnt_t stCnt, Epoch_t epochToCommit)
+    {
+        m_entries.push_back(Entry{l2, stCnt, epochToCommit});
+    }
+
+    Cnt_t getStCnt(MachineID l2) const { return find(l2).stCnt; }
+
+    Epoch_t
+    getEpochToCommit(MachineID l2) const
+    {
+        return find(l2).epochToCommit;
+    }
+
+    NetDest
+    getDestination() const
+    {
+        NetDest dest;
+        for (const auto &entry : m_entries)
+            dest.add(entry.l2);
+        return dest;
+    }
+
+    int size() const { return m_entries.size(); }
+
+    void
+    print(std::ostream &out) const
+    {
+        out << "[";
+        for (const auto &entry : m_entries) {
+            out << " " << entry.l2 << ":" << entry.stCnt << "/"
+                << entry.epochToCommit;
+        }
+        out << " ]";
+    }
+
+  private:
+    struct Entry
+    {
+        MachineID l2;
+        Cnt_t stCnt;
+        Epoch_t epochToCommit;
+    };
+
+    const Entry &
+    find(MachineID l2) const
+    {
+        for (const auto &entry : m_entries) {
+            if (entry.l2 == l2)
+                return entry;
+        }
+        panic("REQ_NOTIFY carries nothing for %s\n", l2);
+    }
+
+    std::vector<Entry> m_entries;
+};
+
+inline std::ostream &
+operator<<(std::ostream &out, const DOReqNotifySet &obj)
+{
+    obj.print(out);
+    out << std::flush;
+    return out;
+}
+
+#endif // __MEM_RUBY_STRUCTURES_DOREQNOTIFYSET_HH__
@@ -41,10 +41,13 @@
 
 #include "mem/ruby/system/DOSequencer.hh"
 
+#include <algorithm>
+
 #include "arch/x86/ldstflags.hh"
 #include "base/logging.hh"
 #include "base/str.hh"
 #include "cpu/testers/rubytest/RubyTester.hh"
+#include "cpu/thread_context.hh"
 #include "debug/MemoryAccess.hh"
 #include "debug/ProtocolTrace.hh"
 #include "debug/RubySequencer.hh"
@@ -57,17 +60,78 @@
 #include "mem/ruby/profiler/Profiler.hh"
 #include "mem/ruby/slicc_interface/RubyRequest.hh"
 #include "mem/ruby/system/RubySystem.hh"
-#include "sim/system.hh"
+#include "sim/do_range_index.hh"
 #include "sim/process.hh"
+#include "sim/system.hh"
+
+namespace
+{
+
+// Consistency-model policies. Each names the DORangeIndex classes whose
+// plain loads/stores become NT (LD_NT/ST_NT) and ordered (LD_ACQ/ST_REL)
+// requests; everything else is an ordinary LD/ST. The masks are
+// compile-time constants, so a model that never issues e.g. ST_NT has
+// that test folded away.
+struct DORCPolicy
+{
+    static const uint8_t ntClasses = DORangeIndex::DO_NT;
+    static const uint8_t relClasses = DORangeIndex::DO_REL;
+};
+
+// TSO: every DO access is ordered, NT regions included
+struct DOTSOPolicy
+{
+    static const uint8_t ntClasses = DORangeIndex::DO_NONE;
+    static const uint8_t relClasses = DORangeIndex::DO_NT |
+                                      DORangeIndex::DO_REL;
+};
+
+// TSO on a write-back protocol: DO regions are plain cached accesses
+struct DOTSOWBPolicy
+{
+    static const uint8_t ntClasses = DORangeIndex::DO_NONE;
+    static const uint8_t relClasses = DORangeIndex::DO_NONE;
+};
+
+// The model is picked once, when the sequencer is created. Overriding
+// the (already virtual) makeRequest keeps the per-packet path free of
+// any further dispatch on it.
+template <class Policy>
+class DOSequencerModel : public DOSequencer
+{
+  public:
+    DOSequencerModel(const Params *p) : DOSequencer(p) {}
+
+  protected:
+    RequestStatus
+    makeRequest(PacketPtr pkt) override
+    {
+        return makeDORequest<Policy>(pkt);
+    }
+};
+
+} // anonymous namespace
 
 DOSequencer *
 DOSequencerParams::create()
 {
-    return new DOSequencer(this);
+    switch (consistency_model) {
+      case Enums::RC:
+        return new DOSequencerModel<DORCPolicy>(this);
+      case Enums::TSO:
+        return new DOSequencerModel<DOTSOPolicy>(this);
+      case Enums::TSO_WB:
+        return new DOSequencerModel<DOTSOWBPolicy>(this);
+      default:
+        fatal("%s: unknown consistency model %d", name, consistency_model);
+    }
 }
 
 DOSequencer::DOSequencer(const Params *p)
-    : Sequencer(p)
+    : Sequencer(p), m_wc_entries(p->wc_entries),
+      m_wc_timeout(p->wc_timeout), m_wc_flush_all(p->wc_flush_all),
+      m_wc_timeout_event([this]{ wcTimeout(); },
+                         "DOSequencer write-combining timeout")
 {
     // set dummy data
     Word_t dummyVal = MARKER_ST_NT;
@@ -78,34 +142,62 @@ DOSequencer::DOSequencer(const Params *p)
 
 DOSequencer::~DOSequencer()
 {
+    if (m_wc_timeout_event.scheduled()) {
+        deschedule(m_wc_timeout_event);
+    }
 }
 
-bool
-DOSequencer::isSTNT(PacketPtr pkt)
-{
-    // return pkt->isWrite() && (pkt->getSize() == sizeof(Word_t)) && (((*(pkt->getConstPtr<Word_t>())) & (~VAL_ST_NT_MASK)) == MARKER_ST_NT) && (pkt->getAddr() < STACK_ADDR);
-    return pkt->isWrite() && system->getThreadContext(0)->getProcessPtr()->isSTNTVaddrRange(pkt->getAddr());
-}
-
-bool
-DOSequencer::isSTREL(PacketPtr pkt)
-{
-    // the reason of this stack addr check is because somehow there are unintended store releases
-    // the guess is register spill to stack. So if that happens we must not account the stack write as a release store
-    // return pkt->isWrite() && (pkt->getSize() == sizeof(Word_t)) && (((*(pkt->getConstPtr<Word_t>())) & (~VAL_ST_REL_MASK)) == MARKER_ST_REL) && (pkt->getAddr() < STACK_ADDR);
-    return pkt->isWrite() && system->getThreadContext(0)->getProcessPtr()->isSTRELVaddrRange(pkt->getAddr());
-}
-
-bool
-DOSequencer::isLDNT(PacketPtr pkt)
+void
+DOSequencer::regStats()
 {
-    return pkt->isRead() && system->getThreadContext(0)->getProcessPtr()->isSTNTVaddrRange(pkt->getAddr());
+    Sequencer::regStats();
+
+    m_wc_stores
+        .name(name() + ".wc_stores")
+        .desc("Number of ST_NTs put into the write-combining buffer")
+        .flags(Stats::nozero);
+
+    m_wc_merged
+        .name(name() + ".wc_merged")
+        .desc("Number of ST_NTs merged into an existing write-combining "
+              "entry")
+        .flags(Stats::nozero);
+
+    m_wc_flushes
+        .init(WC_FLUSH_NUM)
+        .name(name() + ".wc_flushes")
+        .desc("Number of PUT_NTs issued by the write-combining buffer, "
+              "by flush cause")
+        .flags(Stats::nozero);
+    m_wc_flushes.subname(WC_FLUSH_REL, "st_rel");
+    m_wc_flushes.subname(WC_FLUSH_CAPACITY, "capacity");
+    m_wc_flushes.subname(WC_FLUSH_TIMEOUT, "timeout");
+    m_wc_flushes.subname(WC_FLUSH_FULL_LINE, "full_line");
+    m_wc_flushes.subname(WC_FLUSH_ALIAS, "alias");
+
+    m_wc_merge_rate
+        .name(name() + ".wc_merge_rate")
+        .desc("Fraction of buffered ST_NTs that did not need their own "
+              "PUT_NT")
+        .flags(Stats::nozero);
+    m_wc_merge_rate = m_wc_merged / m_wc_stores;
+
+    m_wc_stores_per_put
+        .init(8)
+        .name(name() + ".wc_stores_per_put")
+        .desc("ST_NTs combined into each PUT_NT")
+        .flags(Stats::nozero | Stats::pdf);
 }
 
-bool
-DOSequencer::isLDACQ(PacketPtr pkt)
+uint8_t
+DOSequencer::getDOAddrClass(PacketPtr pkt)
 {
-    return pkt->isRead() && system->getThreadContext(0)->getProcessPtr()->isSTRELVaddrRange(pkt->getAddr());
+    // key on the process of the issuing thread so that multi-process SE runs
+    // classify against the right address space
+    ThreadContext *tc = pkt->req->hasContextId() ?
+        system->getThreadContext(pkt->req->contextId()) :
+        system->getThreadContext(0);
+    return tc->getProcessPtr()->getDOAddrClass(pkt->getAddr());
 }
 
 void
@@ -133,8 +225,9 @@ DOSequencer::DOMarkRemoved()
 // }
 
 
+template <class Policy>
 RequestStatus
-DOSequencer::makeRequest(PacketPtr pkt)
+DOSequencer::makeDORequest(PacketPtr pkt)
 {
     // if (m_outstanding_count >= m_max_outstanding_requests) {
         // return RequestStatus_BufferFull;
@@ -187,18 +280,31 @@ DOSequencer::makeRequest(PacketPtr pkt)
         // moyang: amo are treated as ATOMIC_RETURN, it is handled by L1
         // SLICC controller
 
+        // one index lookup classifies the packet for all DO checks below
+        uint8_t do_class = DORangeIndex::DO_NONE;
+        if (!pkt->isAtomicOp() && !pkt->req->isInstFetch() &&
+            (pkt->isWrite() || pkt->isRead())) {
+            do_class = getDOAddrClass(pkt);
+        }
+
         if (pkt->isWrite() && !pkt->isAtomicOp()) {
             //
             // Note: M5 packets do not differentiate ST from RMW_Write
             //
-            if (isSTNT(pkt)) {
+            if (do_class & Policy::ntClasses) {
                 primary_type = secondary_type = RubyRequestType_ST_NT;
-                DPRINTF(DOACC, "st-nt Addr[0x%x] isAmo[%d] islockedRMW[%d]\n", pkt->getAddr(), pkt->isAtomicOp(), pkt->req->isLockedRMW());
-            } else if (isSTREL(pkt)) {
+            } else if (do_class & Policy::relClasses) {
                 primary_type = secondary_type = RubyRequestType_ST_REL;
-                DPRINTF(DOACC, "st-rel Addr[0x%x] isAmo[%d] islockedRMW[%d]\n", pkt->getAddr(), pkt->isAtomicOp(), pkt->req->isLockedRMW());
             } else {
                 primary_type = secondary_type = RubyRequestType_ST;
+            }
+            // traces follow the address class so that they read the same
+            // under every consistency model
+            if (do_class & DORangeIndex::DO_NT) {
+                DPRINTF(DOACC, "st-nt Addr[0x%x] isAmo[%d] islockedRMW[%d]\n", pkt->getAddr(), pkt->isAtomicOp(), pkt->req->isLockedRMW());
+            } else if (do_class & DORangeIndex::DO_REL) {
+                DPRINTF(DOACC, "st-rel Addr[0x%x] isAmo[%d] islockedRMW[%d]\n", pkt->getAddr(), pkt->isAtomicOp(), pkt->req->isLockedRMW());
+            } else {
                 DPRINTF(RRC, "st-reg Addr[0x%x] isAmo[%d] islockedRMW[%d]\n", pkt->getAddr(), pkt->isAtomicOp(), pkt->req->isLockedRMW());
             }
         } else if (pkt->isRead() && !pkt->isAtomicOp()) {
@@ -218,16 +324,20 @@ DOSequencer::makeRequest(PacketPtr pkt)
                     secondary_type = RubyRequestType_ST;
                 } else {
                     
-                    if (isLDNT(pkt)) {
-                        DPRINTF(DOACC, "ld-nt Addr[0x%x]\n", pkt->getAddr());
+                    if (do_class & Policy::ntClasses) {
                         primary_type = secondary_type = RubyRequestType_LD_NT;
-                    } else if (isLDACQ(pkt)) {
-                        DPRINTF(DOACC, "ld-acq Addr[0x%x]\n", pkt->getAddr());
+                    } else if (do_class & Policy::relClasses) {
                         primary_type = secondary_type = RubyRequestType_LD_ACQ;
                     } else {
-                        DPRINTF(RRC, "ld-reg Addr[0x%x]\n", pkt->getAddr());
                         primary_type = secondary_type = RubyRequestType_LD;
                     }
+                    if (do_class & DORangeIndex::DO_NT) {
+                        DPRINTF(DOACC, "ld-nt Addr[0x%x]\n", pkt->getAddr());
+                    } else if (do_class & DORangeIndex::DO_REL) {
+                        DPRINTF(DOACC, "ld-acq Addr[0x%x]\n", pkt->getAddr());
+                    } else {
+                        DPRINTF(RRC, "ld-reg Addr[0x%x]\n", pkt->getAddr());
+                    }
                 }
             }
         } else if (pkt->cmd == MemCmd::SwapReq && pkt->isAtomicOp()) {
@@ -239,6 +349,23 @@ DOSequencer::makeRequest(PacketPtr pkt)
         }
     }
 
+    if (m_wc_entries > 0) {
+        Addr line_addr = makeLineAddress(pkt->getAddr());
+        if (primary_type == RubyRequestType_ST_NT) {
+            if (m_controller->isBlocked(line_addr)) {
+                return RequestStatus_Aliased;
+            }
+            wcStore(pkt);
+            return RequestStatus_Issued;
+        } else if (primary_type == RubyRequestType_ST_REL) {
+            // the release closes the epoch, its ST_NTs have to go first
+            wcFlushAll(WC_FLUSH_REL);
+        } else if (m_wc_index.count(line_addr)) {
+            // any other access to a buffered line sees the buffered stores
+            wcFlushLine(line_addr, WC_FLUSH_ALIAS);
+        }
+    }
+
     RequestStatus status = DOinsertRequest(pkt, primary_type);
     if (status != RequestStatus_Ready)
         return status;
@@ -596,6 +723,220 @@ DOSequencer::issueRequest(PacketPtr pkt, RubyRequestType secondary_type,
     }
 }
 
+void
+DOSequencer::startup()
+{
+    Sequencer::startup();
+
+    // a restored write-combining buffer needs its timeout back
+    if (m_wc_timeout > 0 && !m_wc_buffer.empty() &&
+        !m_wc_timeout_event.scheduled()) {
+        Cycles age = curCycle() - m_wc_buffer.front().allocCycle;
+        schedule(m_wc_timeout_event,
+                 clockEdge(age < m_wc_timeout ? m_wc_timeout - age
+                                              : Cycles(0)));
+    }
+}
+
+void
+DOSequencer::serialize(CheckpointOut &cp) const
+{
+    Sequencer::serialize(cp);
+
+    // draining waits for every outstanding request, so the DO request
+    // tables are empty here; buffered ST_NTs are not outstanding and are
+    // kept as they are so the checkpoint does not change the PUT_NT stream
+    fatal_if(!DO_writeRequestTable.empty() || !DO_readRequestTable.empty(),
+             "%s: cannot checkpoint with outstanding DO requests\n", name());
+
+    const int block_size = RubySystem::getBlockSizeBytes();
+    std::vector<Addr> wc_lines, wc_pcs;
+    std::vector<uint8_t> wc_data, wc_mask;
+    std::vector<uint64_t> wc_ages;
+    std::vector<int> wc_proc_ids, wc_num_stores;
+    for (const auto &entry : m_wc_buffer) {
+        wc_lines.push_back(entry.line);
+        const uint8_t *data = entry.data.getData(0, block_size);
+        wc_data.insert(wc_data.end(), data, data + block_size);
+        wc_mask.insert(wc_mask.end(), entry.mask.begin(), entry.mask.end());
+        wc_ages.push_back(curCycle() - entry.allocCycle);
+        wc_pcs.push_back(entry.pc);
+        wc_proc_ids.push_back(entry.procId);
+        wc_num_stores.push_back(entry.numStores);
+    }
+    SERIALIZE_CONTAINER(wc_lines);
+    SERIALIZE_CONTAINER(wc_data);
+    SERIALIZE_CONTAINER(wc_mask);
+    SERIALIZE_CONTAINER(wc_ages);
+    SERIALIZE_CONTAINER(wc_pcs);
+    SERIALIZE_CONTAINER(wc_proc_ids);
+    SERIALIZE_CONTAINER(wc_num_stores);
+}
+
+void
+DOSequencer::unserialize(CheckpointIn &cp)
+{
+    Sequencer::unserialize(cp);
+
+    const int block_size = RubySystem::getBlockSizeBytes();
+    std::vector<Addr> wc_lines, wc_pcs;
+    std::vector<uint8_t> wc_data, wc_mask;
+    std::vector<uint64_t> wc_ages;
+    std::vector<int> wc_proc_ids, wc_num_stores;
+    UNSERIALIZE_CONTAINER(wc_lines);
+    UNSERIALIZE_CONTAINER(wc_data);
+    UNSERIALIZE_CONTAINER(wc_mask);
+    UNSERIALIZE_CONTAINER(wc_ages);
+    UNSERIALIZE_CONTAINER(wc_pcs);
+    UNSERIALIZE_CONTAINER(wc_proc_ids);
+    UNSERIALIZE_CONTAINER(wc_num_stores);
+    fatal_if(wc_data.size() != wc_lines.size() * block_size,
+             "%s: checkpointed write-combining buffer has another block "
+             "size\n", name());
+
+    m_wc_buffer.clear();
+    m_wc_index.clear();
+    for (size_t i = 0; i < wc_lines.size(); ++i) {
+        WCEntry entry;
+        entry.line = wc_lines[i];
+        entry.data.setData(&wc_data[i * block_size], 0, block_size);
+        entry.mask.assign(wc_mask.begin() + i * block_size,
+                          wc_mask.begin() + (i + 1) * block_size);
+        entry.allocCycle = curCycle() > wc_ages[i] ?
+            Cycles(curCycle() - wc_ages[i]) : Cycles(0);
+        entry.pc = wc_pcs[i];
+        entry.procId = wc_proc_ids[i];
+        entry.numStores = wc_num_stores[i];
+        m_wc_index.emplace(entry.line,
+            m_wc_buffer.insert(m_wc_buffer.end(), entry));
+    }
+}
+
+void
+DOSequencer::wcStore(PacketPtr pkt)
+{
+    Addr line_addr = makeLineAddress(pkt->getAddr());
+    int offset = getOffset(pkt->getAddr());
+
+    auto idx = m_wc_index.find(line_addr);
+    if (idx == m_wc_index.end()) {
+        if (m_wc_buffer.size() >= m_wc_entries) {
+            if (m_wc_flush_all) {
+                wcFlushAll(WC_FLUSH_CAPACITY);
+            } else {
+                wcFlush(m_wc_buffer.begin(), WC_FLUSH_CAPACITY);
+            }
+        }
+
+        WCEntry entry;
+        entry.line = line_addr;
+        entry.data.clear();
+        entry.mask.assign(RubySystem::getBlockSizeBytes(), false);
+        entry.allocCycle = curCycle();
+        entry.pc = pkt->req->hasPC() ? pkt->req->getPC() : 0;
+        entry.procId = pkt->req->hasContextId() ?
+            pkt->req->contextId() : InvalidContextID;
+        entry.numStores = 0;
+        idx = m_wc_index.emplace(line_addr,
+            m_wc_buffer.insert(m_wc_buffer.end(), entry)).first;
+
+        if (m_wc_timeout > 0 && !m_wc_timeout_event.scheduled()) {
+            schedule(m_wc_timeout_event, clockEdge(m_wc_timeout));
+        }
+    } else {
+        m_wc_merged++;
+    }
+
+    WCEntry &entry = *(idx->second);
+    entry.data.setData(pkt->getConstPtr<uint8_t>(), offset, pkt->getSize());
+    for (int j = 0; j < pkt->getSize(); j++) {
+        entry.mask[offset + j] = true;
+    }
+    entry.numStores++;
+    m_wc_stores++;
+    m_numStore++;
+    DPRINTF(DOACC, "st-nt buffered Addr[0x%x] line stores[%d]\n",
+            pkt->getAddr(), entry.numStores);
+
+    // like an unbuffered st-nt, the store completes as soon as it is
+    // accepted; the data has been copied out of the packet above
+    SequencerRequest *request =
+        new SequencerRequest(pkt, RubyRequestType_ST_NT, curCycle());
+    hitCallback(request, dummyData, true, MachineType_NUM, true,
+                Cycles(0), Cycles(0), Cycles(0));
+    delete request;
+
+    if (std::find(entry.mask.begin(), entry.mask.end(), false) ==
+        entry.mask.end()) {
+        wcFlush(idx->second, WC_FLUSH_FULL_LINE);
+    }
+}
+
+void
+DOSequencer::wcFlush(WCBuffer::iterator it, WCFlushCause cause)
+{
+    WCEntry &entry = *it;
+
+    // one PUT_NT carries every byte written to the line so far
+    std::shared_ptr<RubyRequest> msg =
+        std::make_shared<RubyRequest>(clockEdge(), entry.line, nullptr,
+                                      RubySystem::getBlockSizeBytes(),
+                                      entry.pc, RubyRequestType_ST_NT,
+                                      RubyRequestType_ST_NT,
+                                      RubyAccessMode_Supervisor, nullptr,
+                                      entry.mask, entry.data,
+                                      PrefetchBit_No, entry.procId,
+                                      coreId());
+
+    DPRINTFR(ProtocolTrace, "%15s %3s %10s%20s %6s>%-6s %#x %s\n",
+             curTick(), m_version, "Seq", "Begin", "", "",
+             printAddress(msg->getPhysicalAddress()),
+             RubyRequestType_to_string(RubyRequestType_ST_NT));
+    DPRINTF(DOACC, "st-nt flush Addr[0x%x] stores[%d] cause[%d]\n",
+            entry.line, entry.numStores, cause);
+
+    assert(m_mandatory_q_ptr != NULL);
+    m_mandatory_q_ptr->enqueue(msg, clockEdge(),
+                               cyclesToTicks(m_data_cache_hit_latency));
+
+    m_wc_flushes[cause]++;
+    m_wc_stores_per_put.sample(entry.numStores);
+    m_wc_index.erase(entry.line);
+    m_wc_buffer.erase(it);
+}
+
+void
+DOSequencer::wcFlushLine(Addr line_addr, WCFlushCause cause)
+{
+    auto idx = m_wc_index.find(line_addr);
+    if (idx != m_wc_index.end()) {
+        wcFlush(idx->second, cause);
+    }
+}
+
+void
+DOSequencer::wcFlushAll(WCFlushCause cause)
+{
+    // oldest first, so PUT_NTs leave in the order their lines were written
+    while (!m_wc_buffer.empty()) {
+        wcFlush(m_wc_buffer.begin(), cause);
+    }
+}
+
+void
+DOSequencer::wcTimeout()
+{
+    Cycles now = curCycle();
+    while (!m_wc_buffer.empty() &&
+           now - m_wc_buffer.front().allocCycle >= m_wc_timeout) {
+        wcFlush(m_wc_buffer.begin(), WC_FLUSH_TIMEOUT);
+    }
+    if (!m_wc_buffer.empty()) {
+        Cycles age = now - m_wc_buffer.front().allocCycle;
+        schedule(m_wc_timeout_event, clockEdge(m_wc_timeout - age));
+    }
+}
+
 RequestStatus
 DOSequencer::DOinsertRequest(PacketPtr pkt, RubyRequestType request_type)
 {
@@ -43,13 +43,17 @@
 #define __MEM_RUBY_SYSTEM_DO_SEQUENCER_HH__
 
 #include <iostream>
+#include <list>
 #include <unordered_map>
 #include <unordered_set>
+#include <vector>
 
+#include "enums/DOConsistencyModel.hh"
 #include "mem/protocol/MachineType.hh"
 #include "mem/protocol/RubyRequestType.hh"
 #include "mem/protocol/SequencerRequestType.hh"
 #include "mem/ruby/common/Address.hh"
+#include "mem/ruby/common/DataBlock.hh"
 #include "mem/ruby/structures/CacheMemory.hh"
 #include "mem/ruby/system/RubyPort.hh"
 #include "mem/ruby/system/Sequencer.hh"
@@ -83,10 +87,18 @@ public:
                        const Cycles forwardRequestTime = Cycles(0),
                        const Cycles firstResponseTime = Cycles(0));
     void DOMarkRemoved();
+    void regStats() override;
+    void startup() override;
+
+    void serialize(CheckpointOut &cp) const override;
+    void unserialize(CheckpointIn &cp) override;
     // bool DOEmpty() const;
     // void DOPrint(std::ostream& out) const;
 protected:
-    RequestStatus makeRequest(PacketPtr pkt);
+    // request path shared by all consistency models; Policy decides which
+    // DO address classes turn into NT and ordered requests
+    template <class Policy>
+    RequestStatus makeDORequest(PacketPtr pkt);
     void issueRequest(PacketPtr pkt, RubyRequestType secondary_type,
                       RubyRequestType primary_type);
     void hitCallback(SequencerRequest* request, DataBlock& data,
@@ -118,14 +130,56 @@ private:
     DORequestTable DO_writeRequestTable;
     DORequestTable DO_readRequestTable;
 
-    bool isSTNT(PacketPtr pkt);
-    bool isSTREL(PacketPtr pkt);
-    bool isLDNT(PacketPtr pkt);
-    bool isLDACQ(PacketPtr pkt);
+    // mask of DORangeIndex::DO_NT/DO_REL for the packet's physical address,
+    // looked up in the address space of the issuing thread's process
+    uint8_t getDOAddrClass(PacketPtr pkt);
 
 #ifdef NO_WT
     std::unordered_map<Addr, DataBlock> pktDataCopy;
 #endif
+
+    // ST_NT write-combining buffer. ST_NTs to the same line are merged
+    // into one PUT_NT until an ST_REL closes the epoch, the buffer runs
+    // out of entries, the entry times out or the line is fully written.
+    enum WCFlushCause {
+        WC_FLUSH_REL,
+        WC_FLUSH_CAPACITY,
+        WC_FLUSH_TIMEOUT,
+        WC_FLUSH_FULL_LINE,
+        WC_FLUSH_ALIAS,
+        WC_FLUSH_NUM
+    };
+
+    struct WCEntry
+    {
+        Addr line;
+        DataBlock data;
+        std::vector<bool> mask;
+        Cycles allocCycle;
+        Addr pc;
+        ContextID procId;
+        int numStores;
+    };
+    typedef std::list<WCEntry> WCBuffer;
+
+    const unsigned m_wc_entries;
+    const Cycles m_wc_timeout;
+    const bool m_wc_flush_all;
+    WCBuffer m_wc_buffer;   // in allocation order
+    std::unordered_map<Addr, WCBuffer::iterator> m_wc_index;
+    EventFunctionWrapper m_wc_timeout_event;
+
+    void wcStore(PacketPtr pkt);
+    void wcFlush(WCBuffer::iterator it, WCFlushCause cause);
+    void wcFlushLine(Addr line, WCFlushCause cause);
+    void wcFlushAll(WCFlushCause cause);
+    void wcTimeout();
+
+    Stats::Scalar m_wc_stores;
+    Stats::Scalar m_wc_merged;
+    Stats::Vector m_wc_flushes;
+    Stats::Formula m_wc_merge_rate;
+    Stats::Histogram m_wc_stores_per_put;
 };
 
 #endif // __MEM_RUBY_SYSTEM_DO_SEQUENCER_HH__
@@ -42,7 +42,21 @@ from m5.params import *
 from m5.proxy  import *
 from Sequencer import *
 
+class DOConsistencyModel(Enum): vals = ['RC', 'TSO', 'TSO_WB']
+
 class DOSequencer(RubySequencer):
    type = 'DOSequencer'
    cxx_class = 'DOSequencer'
    cxx_header = "mem/ruby/system/DOSequencer.hh"
+   consistency_model = Param.DOConsistencyModel('RC',
+       "RC: NT/REL regions issue ST_NT/LD_NT and ST_REL/LD_ACQ; "
+       "TSO: all DO accesses are ST_REL/LD_ACQ; "
+       "TSO_WB: DO regions are ordinary loads and stores")
+   wc_entries = Param.Unsigned(0,
+       "ST_NT write-combining buffer entries, 0 disables combining")
+   wc_timeout = Param.Cycles(64,
+       "cycles a write-combining entry may wait before it is flushed, "
+       "0 disables the timeout")
+   wc_flush_all = Param.Bool(False,
+       "flush every write-combining entry, not only the oldest, when the "
+       "buffer is full")
@@ -46,8 +46,10 @@
 
 #include <cstdio>
 #include <list>
+#include <string>
 
 #include "base/intmath.hh"
+#include "base/logging.hh"
 #include "base/statistics.hh"
 #include "debug/RubyCacheTrace.hh"
 #include "debug/RubySystem.hh"
@@ -67,6 +69,8 @@ uint32_t RubySystem::m_block_size_bits;
 uint32_t RubySystem::m_memory_size_bits;
 uint32_t RubySystem::m_l2_bits;
 uint32_t RubySystem::m_real_phys_mem_bits;
+std::vector<int> RubySystem::m_msg_size_overrides;
+bool RubySystem::m_put_nt_size_from_mask;
 
 bool RubySystem::m_warmup_enabled = false;
 // To look forward to allowing multiple RubySystem instances, track the number
@@ -76,6 +80,10 @@ bool RubySystem::m_cooldown_enabled = false;
 
 RubySystem::RubySystem(const Params *p)
     : ClockedObject(p), m_access_backing_store(p->access_backing_store),
+      m_cg_link_bandwidth(p->cg_link_bandwidth),
+      m_cg_link_sample_cycles(p->cg_link_sample_cycles),
+      m_cg_link_sample_windows(p->cg_link_sample_windows),
+      m_router_partitions(p->router_partitions),
       m_cache_recorder(NULL)
 {
     m_randomization = p->randomization;
@@ -87,6 +95,19 @@ RubySystem::RubySystem(const Params *p)
     m_l2_bits = p->l2_bits;
     m_real_phys_mem_bits = p->real_phys_mem_bits;
 
+    m_msg_size_overrides.assign(MessageSizeType_NUM, -1);
+    for (const auto &spec : p->msg_size_overrides) {
+        size_t colon = spec.find(':');
+        fatal_if(colon == string::npos,
+                 "msg_size_overrides entry '%s' is not TYPE:bytes", spec);
+        MessageSizeType type =
+            string_to_MessageSizeType(spec.substr(0, colon));
+        int bytes = stoi(spec.substr(colon + 1));
+        fatal_if(bytes < 0, "negative size in msg_size_overrides '%s'", spec);
+        m_msg_size_overrides[type] = bytes;
+    }
+    m_put_nt_size_from_mask = p->put_nt_size_from_mask;
+
     // Resize to the size of different machine types
     m_abstract_controls.resize(MachineType_NUM);
 
@@ -48,9 +48,12 @@
 #ifndef __MEM_RUBY_SYSTEM_RUBYSYSTEM_HH__
 #define __MEM_RUBY_SYSTEM_RUBYSYSTEM_HH__
 
+#include <vector>
+
 #include "base/callback.hh"
 #include "base/output.hh"
 #include "mem/packet.hh"
+#include "mem/protocol/MessageSizeType.hh"
 #include "mem/ruby/profiler/Profiler.hh"
 #include "mem/ruby/slicc_interface/AbstractController.hh"
 #include "mem/ruby/system/CacheRecorder.hh"
@@ -76,10 +79,28 @@ class RubySystem : public ClockedObject
     static uint32_t getRealPhysMemBits() { return m_real_phys_mem_bits; }
     static bool getWarmupEnabled() { return m_warmup_enabled; }
     static bool getCooldownEnabled() { return m_cooldown_enabled; }
+    static int
+    getMsgSizeOverride(MessageSizeType type)
+    {
+        return m_msg_size_overrides[type];
+    }
+    static bool getPutNtSizeFromMask() { return m_put_nt_size_from_mask; }
 
     SimpleMemory *getPhysMem() { return m_phys_mem; }
     Cycles getStartCycle() { return m_start_cycle; }
     bool getAccessBackingStore() { return m_access_backing_store; }
+    uint32_t getCGLinkBandwidth() const { return m_cg_link_bandwidth; }
+    uint32_t getCGLinkSampleCycles() const { return m_cg_link_sample_cycles; }
+    uint32_t
+    getCGLinkSampleWindows() const
+    {
+        return m_cg_link_sample_windows;
+    }
+    const std::vector<int> &
+    getRouterPartitions() const
+    {
+        return m_router_partitions;
+    }
 
     // Public Methods
     Profiler*
@@ -140,12 +161,19 @@ class RubySystem : public ClockedObject
     static uint32_t m_memory_size_bits;
     static uint32_t m_l2_bits;
     static uint32_t m_real_phys_mem_bits;
+    // payload bytes per MessageSizeType, -1 keeps the built-in size
+    static std::vector<int> m_msg_size_overrides;
+    static bool m_put_nt_size_from_mask;
 
     static bool m_warmup_enabled;
     static unsigned m_systems_to_warmup;
     static bool m_cooldown_enabled;
     SimpleMemory *m_phys_mem;
     const bool m_access_backing_store;
+    const uint32_t m_cg_link_bandwidth;
+    const uint32_t m_cg_link_sample_cycles;
+    const uint32_t m_cg_link_sample_windows;
+    const std::vector<int> m_router_partitions;
 
     Network* m_network;
     std::vector<AbstractController *> m_abs_cntrl_vec;
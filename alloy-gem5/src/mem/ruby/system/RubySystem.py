@@ -66,4 +66,26 @@ class RubySystem(ClockedObject):
     hot_lines = Param.Bool(False, "")
     all_instructions = Param.Bool(False, "")
     num_of_sequencers = Param.Int("")
-    number_of_virtual_networks = Param.Unsigned("")
\ No newline at end of file
+    number_of_virtual_networks = Param.Unsigned("")
+
+    # Network message sizes (see Network::MessageSizeType_to_int)
+    msg_size_overrides = VectorParam.String([], "payload bytes of a \
+        MessageSizeType as 'TYPE:bytes', e.g. 'PUT_NT:256'; the network's \
+        control_msg_size is added on top")
+    put_nt_size_from_mask = Param.Bool(False, "size each PUT_NT by the \
+        number of bytes set in its write mask")
+
+    # Inter-PU (CG) link bandwidth (see GarnetNetwork::init)
+    cg_link_bandwidth = Param.UInt32(0, "bytes per network cycle of the \
+        CG links; a flit wider than this occupies the link for several \
+        cycles (0: one flit per cycle, like on-chip links)")
+    cg_link_sample_cycles = Param.UInt32(0, "length in network cycles of \
+        a CG link telemetry window (0: no sampling)")
+    cg_link_sample_windows = Param.UInt32(4096, "CG link telemetry windows \
+        kept between stats dumps; older windows are overwritten")
+
+    # Partitioned simulation (see GarnetNetwork::makeInternalLink)
+    router_partitions = VectorParam.Int([], "partition of every router, \
+        in router id order; links between partitions carry flits through \
+        a mailbox drained once per sim quantum, so each partition can run \
+        on its own event queue (empty: no partitions)")
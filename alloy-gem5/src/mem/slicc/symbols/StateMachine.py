@@ -61,6 +61,8 @@ python_class_map = {
                     "VIPERCoalescer" : "VIPERCoalescer",
                     "DirectoryMemory": "RubyDirectoryMemory",
                     "PerfectCacheMemory": "RubyPerfectCacheMemory",
+                    "DOCPUTable": "RubyDOCPUTable",
+                    "DOL2Table": "RubyDOL2Table",
                     "MemoryControl": "MemoryControl",
                     "MessageBuffer": "MessageBuffer",
                     "DMASequencer": "DMASequencer",
@@ -137,4 +137,8 @@ class System(MemObject):
 
     brg_fast_forward = Param.Bool(False, "Using --brg-fast-forward option")
     num_nodes = Param.Int(1, "Using --num-nodes option")
-    num_cores = Param.Int(1, "Using --num-cores option")
\ No newline at end of file
+    num_cores = Param.Int(1, "Using --num-cores option")
+    wait_on_address = Param.Bool(False, "suspend harts on the \
+        wait-on-address CSRs; needs the L1s to send evictions to the CPUs")
+    wake_do_watchers = Param.Bool(False, "the L2s wake the GET_NT readers \
+        of a DO line on ST_NT/ST_REL, so waits on DO lines can be armed")
\ No newline at end of file
@@ -0,0 +1,125 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2024 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: LicenseRef-NvidiaProprietary
+ *
+ * NVIDIA CORPORATION, its affiliates and licensors retain all intellectual
+ * property and proprietary rights in and to this material, related
+ * documentation and any modifications thereto. Any use, reproduction,
+ * disclosure or distribution of this material and related documentation
+ * without an express license agreement from NVIDIA CORPORATION or
+ * its affiliates is strictly prohibited.
+ */
+
+#ifndef __SIM_DO_RANGE_INDEX_HH__
+#define __SIM_DO_RANGE_INDEX_HH__
+
+#include <algorithm>
+#include <cstdint>
+#include <vector>
+
+#include "base/types.hh"
+
+/**
+ * Physical-address index of the ST_NT/ST_REL regions of one address space.
+ *
+ * Registered regions are virtual; the owner translates them page by page
+ * and feeds the resulting physical segments here. finalize() turns the
+ * (possibly overlapping) segments into a sorted list of disjoint runs so
+ * that a packet is classified with a single binary search.
+ */
+class DORangeIndex
+{
+  public:
+    static const uint8_t DO_NONE = 0x0;
+    static const uint8_t DO_NT = 0x1;
+    static const uint8_t DO_REL = 0x2;
+
+    void
+    clear()
+    {
+        segments.clear();
+        runs.clear();
+    }
+
+    void
+    addSegment(Addr begin, Addr end, uint8_t cls)
+    {
+        if (begin < end)
+            segments.push_back(Run{begin, end, cls});
+    }
+
+    void
+    finalize()
+    {
+        // sweep the segment boundaries and keep a per-class depth so that
+        // overlapping NT and REL segments resolve to the union of classes
+        std::vector<std::pair<Addr, int>> bounds;
+        bounds.reserve(segments.size() * 2);
+        for (const auto &seg : segments) {
+            bounds.emplace_back(seg.begin, (seg.cls & DO_NT ? 1 : 0) |
+                                           (seg.cls & DO_REL ? 2 : 0));
+            bounds.emplace_back(seg.end, -((seg.cls & DO_NT ? 1 : 0) |
+                                           (seg.cls & DO_REL ? 2 : 0)));
+        }
+        std::sort(bounds.begin(), bounds.end());
+
+        runs.clear();
+        int nt_depth = 0, rel_depth = 0;
+        for (size_t i = 0; i < bounds.size(); ++i) {
+            int delta = bounds[i].second;
+            int sign = delta < 0 ? -1 : 1;
+            delta *= sign;
+            if (delta & 1)
+                nt_depth += sign;
+            if (delta & 2)
+                rel_depth += sign;
+
+            if (i + 1 == bounds.size() ||
+                bounds[i + 1].first == bounds[i].first)
+                continue;
+
+            uint8_t cls = (nt_depth > 0 ? DO_NT : DO_NONE) |
+                          (rel_depth > 0 ? DO_REL : DO_NONE);
+            if (cls == DO_NONE)
+                continue;
+
+            Addr begin = bounds[i].first;
+            Addr end = bounds[i + 1].first;
+            if (!runs.empty() && runs.back().end == begin &&
+                runs.back().cls == cls) {
+                runs.back().end = end;
+            } else {
+                runs.push_back(Run{begin, end, cls});
+            }
+        }
+        segments.clear();
+        segments.shrink_to_fit();
+    }
+
+    uint8_t
+    lookup(Addr paddr) const
+    {
+        auto it = std::upper_bound(runs.begin(), runs.end(), paddr,
+                                   [](Addr a, const Run &r)
+                                   { return a < r.begin; });
+        if (it == runs.begin())
+            return DO_NONE;
+        --it;
+        return paddr < it->end ? it->cls : DO_NONE;
+    }
+
+    size_t numRuns() const { return runs.size(); }
+
+  private:
+    struct Run
+    {
+        Addr begin;
+        Addr end;
+        uint8_t cls;
+    };
+
+    std::vector<Run> segments;
+    std::vector<Run> runs;
+};
+
+#endif // __SIM_DO_RANGE_INDEX_HH__
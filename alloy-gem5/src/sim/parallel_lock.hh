@@ -0,0 +1,47 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2024 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: LicenseRef-NvidiaProprietary
+ *
+ * NVIDIA CORPORATION, its affiliates and licensors retain all intellectual
+ * property and proprietary rights in and to this material, related
+ * documentation and any modifications thereto. Any use, reproduction,
+ * disclosure or distribution of this material and related documentation
+ * without an express license agreement from NVIDIA CORPORATION or
+ * its affiliates is strictly prohibited.
+ */
+
+#ifndef __SIM_PARALLEL_LOCK_HH__
+#define __SIM_PARALLEL_LOCK_HH__
+
+#include "sim/eventq.hh"
+
+/**
+ * Scoped lock for state shared between event queues. It only locks while
+ * the queues run on separate host threads (inParallelMode), so
+ * single-threaded runs do not pay for the mutex.
+ */
+template <class Mutex>
+class ParallelLock
+{
+  public:
+    explicit ParallelLock(Mutex &mutex)
+        : m_mutex(inParallelMode ? &mutex : nullptr)
+    {
+        if (m_mutex)
+            m_mutex->lock();
+    }
+
+    ~ParallelLock()
+    {
+        if (m_mutex)
+            m_mutex->unlock();
+    }
+
+    ParallelLock(const ParallelLock &) = delete;
+    ParallelLock &operator=(const ParallelLock &) = delete;
+
+  private:
+    Mutex *m_mutex;
+};
+
+#endif // __SIM_PARALLEL_LOCK_HH__
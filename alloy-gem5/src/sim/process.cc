@@ -62,6 +62,7 @@
 #include <fcntl.h>
 #include <unistd.h>
 
+#include <algorithm>
 #include <array>
 #include <csignal>
 #include <map>
@@ -80,6 +81,7 @@
 #include "sim/emul_driver.hh"
 #include "sim/fd_array.hh"
 #include "sim/fd_entry.hh"
+#include "sim/parallel_lock.hh"
 #include "sim/syscall_desc.hh"
 #include "sim/system.hh"
 #include "debug/RRC.hh"
@@ -115,6 +117,8 @@
 using namespace std;
 using namespace TheISA;
 
+std::recursive_mutex Process::parallelMutex;
+
 Process::Process(ProcessParams *params, EmulationPageTable *pTable,
                  ObjectFile *obj_file)
     : SimObject(params), system(params->system),
@@ -123,6 +127,7 @@ Process::Process(ProcessParams *params, EmulationPageTable *pTable,
       pTable(pTable),
       initVirtMem(system->getSystemPort(), this,
                   SETranslatingPortProxy::Always),
+      doRangeIndex(new DORangeIndex),
       objFile(obj_file),
       argv(params->cmd), envp(params->env), cwd(params->cwd),
       executable(params->executable),
@@ -169,6 +174,11 @@ Process::Process(ProcessParams *params, EmulationPageTable *pTable,
     }
 }
 
+Process::~Process()
+{
+    delete doRangeIndex.load();
+}
+
 void
 Process::clone(ThreadContext *otc, ThreadContext *ntc,
                Process *np, RegVal flags)
@@ -191,6 +201,7 @@ Process::clone(ThreadContext *otc, ThreadContext *ntc,
         delete np->pTable;
         np->pTable = pTable;
         ntc->getMemProxy().setPageTable(np->pTable);
+        np->rebuildDORangeIndex();
 
         np->memState = memState;
     } else {
@@ -328,6 +339,7 @@ Process::allocateMem(Addr vaddr, int64_t size, bool clobber)
     pTable->map(vaddr, paddr, size,
                 clobber ? EmulationPageTable::Clobber :
                           EmulationPageTable::MappingFlags(0));
+    invalidateDORanges(vaddr, size);
 }
 
 void
@@ -339,6 +351,7 @@ Process::allocateMemThreadCtx(Addr vaddr, int64_t size, bool clobber, ThreadCont
     pTable->map(vaddr, paddr, size,
                 clobber ? EmulationPageTable::Clobber :
                           EmulationPageTable::MappingFlags(0));
+    invalidateDORanges(vaddr, size);
 }
 
 void
@@ -356,13 +369,75 @@ Process::replicatePage(Addr vaddr, Addr new_paddr, ThreadContext *old_tc,
     // mapping (if any existed) and then write to the new physical page.
     bool clobber = true;
     pTable->map(vaddr, new_paddr, PageBytes, clobber);
+    invalidateDORanges(vaddr, PageBytes);
     new_tc->getMemProxy().writeBlob(vaddr, buf_p, PageBytes);
     delete[] buf_p;
 }
 
+void
+Process::barrierInit(uint64_t n_threads)
+{
+    ParallelLock<std::recursive_mutex> lock(parallelMutex);
+    system->n_barrier_waiters = n_threads;
+    system->barriers.clear();
+    system->barrierArrivals.clear();
+}
+
+void
+Process::barrierWait(uint64_t bar_id, ThreadContext *tc)
+{
+    ParallelLock<std::recursive_mutex> lock(parallelMutex);
+    System::GemBarrier &bar = system->barriers[bar_id];
+    system->barrierArrivals[tc->contextId()] = {bar_id, bar.generation};
+    bar.last_arrival = std::max(bar.last_arrival, curTick());
+
+    // Partitioned runs release a barrier at the first quantum boundary
+    // after its latest arrival, and the thread that happens to arrive last
+    // on the host sleeps too. The latest arrival lies in the quantum all
+    // queues are in when the barrier opens, whatever order their threads
+    // got there in, so the release does not depend on that order.
+    bool quantized = simQuantum != 0;
+    bool opened = ++bar.arrived == system->n_barrier_waiters;
+    if (!opened || quantized) {
+        bar.sleepers.push_back(tc->contextId());
+        tc->suspend();
+    }
+    if (!opened)
+        return;
+
+    bar.arrived = 0;
+    ++bar.generation;
+    if (quantized) {
+        Tick start = system->quantumStart;
+        Tick release = start + ((bar.last_arrival - start) / simQuantum + 1)
+                               * simQuantum;
+        // sleepers are kept by context id: a CPU switch while they sleep
+        // moves them to new thread contexts
+        for (ContextID sleeper : bar.sleepers)
+            system->scheduleBarrierWake(sleeper, release);
+    } else {
+        for (ContextID sleeper : bar.sleepers)
+            system->getThreadContext(sleeper)->activate();
+    }
+    bar.sleepers.clear();
+    bar.last_arrival = 0;
+}
+
+int
+Process::barrierReady(ThreadContext *tc)
+{
+    ParallelLock<std::recursive_mutex> lock(parallelMutex);
+    auto arrival = system->barrierArrivals.find(tc->contextId());
+    if (arrival == system->barrierArrivals.end())
+        return 1;
+    const System::GemBarrier &bar = system->barriers[arrival->second.first];
+    return bar.generation != arrival->second.second;
+}
+
 bool
 Process::fixupStackFault(Addr vaddr)
 {
+    ParallelLock<std::recursive_mutex> lock(parallelMutex);
     // DPRINTF(RRC, "in fixupStackFault\n");
     Addr stack_min = memState->getStackMin();
     Addr stack_base = memState->getStackBase();
@@ -394,6 +469,7 @@ Process::fixupStackFault(Addr vaddr)
 bool
 Process::fixupStackFaultThreadCtx(Addr vaddr, ThreadContext *tc)
 {
+    ParallelLock<std::recursive_mutex> lock(parallelMutex);
     // DPRINTF(RRC, "in fixupStackFaultThreadCtx\n");
     Addr stack_min = memState->getStackMin();
     Addr stack_base = memState->getStackBase();
@@ -427,6 +503,24 @@ Process::serialize(CheckpointOut &cp) const
 {
     memState->serialize(cp);
     pTable->serialize(cp);
+
+    // the DO regions live in System but each one belongs to the page
+    // table it was registered against, so every process saves its own
+    std::vector<Addr> stnt_ranges, strel_ranges;
+    for (const auto &range : system->STNTVaddrRanges) {
+        if (range.pTable == pTable) {
+            stnt_ranges.push_back(range.begin);
+            stnt_ranges.push_back(range.end);
+        }
+    }
+    for (const auto &range : system->STRELVaddrRanges) {
+        if (range.pTable == pTable) {
+            strel_ranges.push_back(range.begin);
+            strel_ranges.push_back(range.end);
+        }
+    }
+    SERIALIZE_CONTAINER(stnt_ranges);
+    SERIALIZE_CONTAINER(strel_ranges);
     /**
      * Checkpoints for file descriptors currently do not work. Need to
      * come back and fix them at a later date.
@@ -445,6 +539,19 @@ Process::unserialize(CheckpointIn &cp)
 {
     memState->unserialize(cp);
     pTable->unserialize(cp);
+
+    std::vector<Addr> stnt_ranges, strel_ranges;
+    UNSERIALIZE_CONTAINER(stnt_ranges);
+    UNSERIALIZE_CONTAINER(strel_ranges);
+    for (size_t i = 0; i + 1 < stnt_ranges.size(); i += 2) {
+        system->STNTVaddrRanges.push_back(
+            {stnt_ranges[i], stnt_ranges[i + 1], pTable});
+    }
+    for (size_t i = 0; i + 1 < strel_ranges.size(); i += 2) {
+        system->STRELVaddrRanges.push_back(
+            {strel_ranges[i], strel_ranges[i + 1], pTable});
+    }
+    rebuildDORangeIndex();
     /**
      * Checkpoints for file descriptors currently do not work. Need to
      * come back and fix them at a later date.
@@ -467,12 +574,107 @@ Process::map(Addr vaddr, Addr paddr, int size, bool cacheable)
     pTable->map(vaddr, paddr, size,
                 cacheable ? EmulationPageTable::MappingFlags(0) :
                             EmulationPageTable::Uncacheable);
+    invalidateDORanges(vaddr, size);
     return true;
 }
 
+void
+Process::invalidateDORanges(Addr vaddr, int64_t size)
+{
+    ParallelLock<std::recursive_mutex> lock(parallelMutex);
+    auto overlaps = [&](const System::DOVaddrRange &range) {
+        return range.pTable == pTable &&
+               vaddr < range.end && range.begin < vaddr + size;
+    };
+    for (const auto &range : system->STNTVaddrRanges) {
+        if (overlaps(range)) {
+            updateDORangeIndexes();
+            return;
+        }
+    }
+    for (const auto &range : system->STRELVaddrRanges) {
+        if (overlaps(range)) {
+            updateDORangeIndexes();
+            return;
+        }
+    }
+}
+
+void
+Process::updateDORangeIndexes()
+{
+    ParallelLock<std::recursive_mutex> lock(parallelMutex);
+    // threads cloned with CLONE_VM are processes of their own that share
+    // this page table, and each of them keeps its own index
+    std::vector<Process *> sharers{this};
+    for (ThreadContext *tc : system->threadContexts) {
+        Process *p = tc->getProcessPtr();
+        if (p && p->pTable == pTable &&
+            std::find(sharers.begin(), sharers.end(), p) == sharers.end()) {
+            sharers.push_back(p);
+        }
+    }
+    for (Process *p : sharers)
+        p->rebuildDORangeIndex();
+}
+
+void
+Process::rebuildDORangeIndex()
+{
+    ParallelLock<std::recursive_mutex> lock(parallelMutex);
+
+    // Translate every page of every region owned by this address space.
+    // Pages are not guaranteed to be physically contiguous, so each page
+    // contributes its own segment; finalize() merges the adjacent ones.
+    DORangeIndex *index = new DORangeIndex;
+    auto add_range = [&](const System::DOVaddrRange &range, uint8_t cls) {
+        if (range.pTable != pTable)
+            return;
+        Addr vaddr = range.begin;
+        while (vaddr < range.end) {
+            Addr page_end = roundDown(vaddr, PageBytes) + PageBytes;
+            Addr seg_end = std::min(page_end, range.end);
+            Addr paddr;
+            if (pTable->translate(vaddr, paddr)) {
+                index->addSegment(paddr, paddr + (seg_end - vaddr), cls);
+            }
+            vaddr = seg_end;
+        }
+    };
+
+    for (const auto &range : system->STNTVaddrRanges)
+        add_range(range, DORangeIndex::DO_NT);
+    for (const auto &range : system->STRELVaddrRanges)
+        add_range(range, DORangeIndex::DO_REL);
+    index->finalize();
+    const DORangeIndex *old = doRangeIndex.exchange(index);
+
+    // A lookup runs inside one event, so one that still reads the old
+    // index ends before its queue reaches the next quantum barrier. A
+    // queue more than a quantum past the swap has crossed that barrier,
+    // and so has every other queue.
+    if (inParallelMode) {
+        retiredDORangeIndexes.emplace_back(curTick(), old);
+        auto it = retiredDORangeIndexes.begin();
+        while (it != retiredDORangeIndexes.end() &&
+               curTick() > it->first + simQuantum) {
+            ++it;
+        }
+        retiredDORangeIndexes.erase(retiredDORangeIndexes.begin(), it);
+    } else {
+        delete old;
+        retiredDORangeIndexes.clear();
+    }
+
+    DPRINTF(DOMEM, "rebuilt DO range index: %lu nt, %lu rel regions, "
+            "%lu physical runs\n", system->STNTVaddrRanges.size(),
+            system->STRELVaddrRanges.size(), index->numRuns());
+}
+
 void
 Process::syscall(int64_t callnum, ThreadContext *tc, Fault *fault)
 {
+    ParallelLock<std::recursive_mutex> lock(parallelMutex);
     numSyscalls++;
 
     SyscallDesc *desc = getDesc(callnum);
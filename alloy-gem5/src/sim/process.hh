@@ -49,7 +49,10 @@
 
 #include <inttypes.h>
 
+#include <atomic>
 #include <map>
+#include <memory>
+#include <mutex>
 #include <string>
 #include <vector>
 #include <utility>
@@ -65,6 +68,8 @@
 #include "sim/mem_state.hh"
 #include "sim/sim_object.hh"
 #include "sim/system.hh"
+#include "sim/do_range_index.hh"
+#include "sim/parallel_lock.hh"
 #include "mem/page_table.hh"
 #include "debug/RRC.hh"
 #include "debug/DOMEM.hh"
@@ -84,6 +89,7 @@ class Process : public SimObject
   public:
     Process(ProcessParams *params, EmulationPageTable *pTable,
             ObjectFile *obj_file);
+    ~Process();
 
     void serialize(CheckpointOut &cp) const override;
     void unserialize(CheckpointIn &cp) override;
@@ -135,107 +141,71 @@ class Process : public SimObject
     void allocateMem(Addr vaddr, int64_t size, bool clobber = false);
     void allocateMemThreadCtx(Addr vaddr, int64_t size, bool clobber = false, ThreadContext *tc = nullptr);
 
-    void barrierInit(uint64_t n_threads) {
-      system->n_barrier_waiters = n_threads;
-      system->n_barrier_in = 0;
-      system->n_barrier_out = 0;
-    }
-
-    void barrierWait(uint64_t bar_id) {
-      ++(system->n_barrier_in);
-      assert(system->n_barrier_in <= system->n_barrier_waiters);
-    }
-  
-    int barrierReady(int cpu_id) {
-      if (system->n_barrier_in == system->n_barrier_waiters) {
-        ++(system->n_barrier_out);
-        if (system->n_barrier_out == system->n_barrier_waiters) {
-          system->n_barrier_in = 0;
-          system->n_barrier_out = 0;          
-        }
-        return 1;
-      } else {
-        return 0;
-      }
-    }
+    void barrierInit(uint64_t n_threads);
+    // Suspends tc until the last of n_threads arrives at bar_id; with a
+    // sim quantum everybody wakes at the next quantum boundary after that
+    void barrierWait(uint64_t bar_id, ThreadContext *tc);
+    // Has the barrier tc last arrived at opened since?
+    int barrierReady(ThreadContext *tc);
 
     void registerSTNTBeginVaddr(Addr vaddr_begin, int cpu_id) {
+      ParallelLock<std::recursive_mutex> lock(parallelMutex);
       stnt_begin_vaddr[cpu_id] = vaddr_begin;
       // DPRINTF(DOMEM, "register stnt begin vaddr[0x%0llx]\n", vaddr_begin);
     }
   
     void registerSTNTEndVaddr(Addr vaddr_end, int cpu_id) {
-      system->STNTVaddrRanges.emplace_back(std::make_pair(stnt_begin_vaddr[cpu_id], vaddr_end));
+      ParallelLock<std::recursive_mutex> lock(parallelMutex);
+      system->STNTVaddrRanges.push_back({stnt_begin_vaddr[cpu_id], vaddr_end, pTable});
+      updateDORangeIndexes();
       // DPRINTF(DOMEM, "register stnt range vaddr[0x%0llx-0x%llx]\n", stnt_begin_vaddr, vaddr_end);
     }
   
     void registerSTRELBeginVaddr(Addr vaddr_begin, int cpu_id) {
+      ParallelLock<std::recursive_mutex> lock(parallelMutex);
       strel_begin_vaddr[cpu_id] = vaddr_begin;      
       // DPRINTF(DOMEM, "register strel begin vaddr[0x%0llx]\n", vaddr_begin);
     }
   
     void registerSTRELEndVaddr(Addr vaddr_end, int cpu_id) {
-      system->STRELVaddrRanges.emplace_back(std::make_pair(strel_begin_vaddr[cpu_id], vaddr_end));   
+      ParallelLock<std::recursive_mutex> lock(parallelMutex);
+      system->STRELVaddrRanges.push_back({strel_begin_vaddr[cpu_id], vaddr_end, pTable});
+      updateDORangeIndexes();
       // DPRINTF(DOMEM, "register strel range vaddr[0x%0llx-0x%llx]\n", strel_begin_vaddr, vaddr_end);   
     }
 
+    /**
+     * Classify a physical address against the ST_NT/ST_REL regions of this
+     * process' address space. Returns a mask of DORangeIndex::DO_NT and
+     * DORangeIndex::DO_REL. Does not lock: the index is rebuilt under
+     * parallelMutex when a region is registered or remapped, and a lookup
+     * only reads the published copy.
+     */
+    uint8_t getDOAddrClass(Addr paddr) {
+      return doRangeIndex.load(std::memory_order_acquire)->lookup(paddr);
+    }
+
     bool isSTNTVaddrRange(Addr paddr) {
-      Addr begin_paddr, end_paddr;
-      for (auto range : system->STNTVaddrRanges) {
-        Addr begin_vaddr = range.first;
-        Addr end_vaddr = (range.second - 1); // -1 is a must
-        if (!pTable->translate(begin_vaddr, begin_paddr)) {
-          // panic("stnt quirying unmapped vaddr[0x%x]\n", begin_vaddr);
-          return false;
-        } else {
-          // begin_paddr += (begin_vaddr % TheISA::PageBytes);
-          if (!pTable->translate(end_vaddr, end_paddr)) {
-            // panic("stnt quirying unmapped vaddr[0x%x]\n", end_vaddr);
-            return false;
-          } else {
-            // end_paddr += (end_vaddr % TheISA::PageBytes);
-            // DPRINTF(DOMEM, "stnt check paddr[0x%llx] for range v[0x%llx-0x%llx], p[0x%llx-0x%llx]\n",
-              // paddr, begin_vaddr, end_vaddr, begin_paddr, end_paddr);
-            if (paddr >= begin_paddr && paddr < end_paddr) {
-              return true;
-            }
-          }
-        }
-      }
-      return false;
+      return getDOAddrClass(paddr) & DORangeIndex::DO_NT;
     }
 
     bool isSTRELVaddrRange(Addr paddr) {
-      Addr begin_paddr, end_paddr;
-      for (auto range : system->STRELVaddrRanges) {
-        Addr begin_vaddr = range.first;
-        Addr end_vaddr = (range.second - 1); // -1 is a must
-        if (!pTable->translate(begin_vaddr, begin_paddr)) {
-          // panic("strel quirying unmapped vaddr[0x%x]\n", begin_vaddr);
-          return false;
-        } else {
-          // begin_paddr += (begin_vaddr % TheISA::PageBytes);
-          if (!pTable->translate(end_vaddr, end_paddr)) {
-            // panic("strel quirying unmapped vaddr[0x%x]\n", end_vaddr);
-            return false;
-          } else {
-            // end_paddr += (end_vaddr % TheISA::PageBytes);
-            // DPRINTF(DOMEM, "strel check paddr[0x%llx] for range v[0x%llx-0x%llx], p[0x%llx-0x%llx]\n",
-              // paddr, begin_vaddr, end_vaddr, begin_paddr, end_paddr);
-            if (paddr >= begin_paddr && paddr < end_paddr) {
-              return true;
-            }
-          }
-        }
-      }
-      return false;
+      return getDOAddrClass(paddr) & DORangeIndex::DO_REL;
     }
 
+    // Rebuild the physical indexes if [vaddr, vaddr + size) overlaps a
+    // registered region. Called whenever pages get (re)mapped.
+    void invalidateDORanges(Addr vaddr, int64_t size);
+
     /// Attempt to fix up a fault at vaddr by allocating a page on the stack.
     /// @return Whether the fault has been fixed.
     bool fixupStackFault(Addr vaddr);
     bool fixupStackFaultThreadCtx(Addr vaddr, ThreadContext *tc);
 
+    // Serializes syscalls and page allocation of all processes while event
+    // queues run in parallel; both reach host and System-wide state.
+    static std::recursive_mutex parallelMutex;
+
     // After getting registered with system object, tell process which
     // system-wide context id it is assigned.
     void
@@ -299,6 +269,16 @@ class Process : public SimObject
     std::map<int, Addr> stnt_begin_vaddr;
     std::map<int, Addr> strel_begin_vaddr;
 
+    // physical index of the DO regions, see getDOAddrClass(). DOSequencers
+    // on other event queues read it without the lock, so a rebuild swaps
+    // in a new index and keeps the old one until no lookup can hold it.
+    std::atomic<const DORangeIndex *> doRangeIndex;
+    std::vector<std::pair<Tick, std::unique_ptr<const DORangeIndex>>>
+        retiredDORangeIndexes;
+    void rebuildDORangeIndex();
+    // rebuild the index of every process sharing this page table
+    void updateDORangeIndexes();
+
     ObjectFile *objFile;
     std::vector<std::string> argv;
     std::vector<std::string> envp;
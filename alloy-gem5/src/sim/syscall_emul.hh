@@ -1215,6 +1215,8 @@ mremapFunc(SyscallDesc *desc, int callnum, Process *process, ThreadContext *tc)
                 }
 
                 process->pTable->remap(start, old_length, new_start);
+                process->invalidateDORanges(start, old_length);
+                process->invalidateDORanges(new_start, old_length);
                 warn("mremapping to new vaddr %08p-%08p, adding %d\n",
                      new_start, new_start + new_length,
                      new_length - old_length);
@@ -1236,9 +1238,12 @@ mremapFunc(SyscallDesc *desc, int callnum, Process *process, ThreadContext *tc)
             }
         }
     } else {
-        if (use_provided_address && provided_address != start)
+        if (use_provided_address && provided_address != start) {
             process->pTable->remap(start, new_length, provided_address);
+            process->invalidateDORanges(provided_address, new_length);
+        }
         process->pTable->unmap(start + new_length, old_length - new_length);
+        process->invalidateDORanges(start, old_length);
         return use_provided_address ? provided_address : start;
     }
 }
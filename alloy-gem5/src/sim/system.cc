@@ -84,6 +84,8 @@
 #include "sim/byteswap.hh"
 #include "sim/debug.hh"
 #include "sim/full_system.hh"
+#include "sim/parallel_lock.hh"
+#include "sim/process.hh"
 
 /**
  * To avoid linking errors with LTO, only include the header if we
@@ -128,7 +130,9 @@ System::System(Params *p)
       instEventQueue("system instruction-based event queue"),
       brg_fast_forward(p->brg_fast_forward),
       num_nodes(p->num_nodes),
-      num_cores(p->num_cores)
+      num_cores(p->num_cores),
+      wait_on_address(p->wait_on_address),
+      wake_do_watchers(p->wake_do_watchers)
 {
     // add self to global system list
     systemList.push_back(this);
@@ -360,6 +364,43 @@ System::initState()
     }
 }
 
+void
+System::startup()
+{
+    MemObject::startup();
+
+    quantumStart = curTick();
+
+    // threads that slept in a gem5 barrier at the checkpoint stay asleep
+    // until the last arrival wakes them, or until their wake-up tick if
+    // the barrier had already opened
+    for (const auto &it : barriers) {
+        for (ContextID sleeper : it.second.sleepers) {
+            ThreadContext *tc = getThreadContext(sleeper);
+            if (tc->status() != ThreadContext::Suspended)
+                tc->suspend();
+        }
+    }
+    std::map<ContextID, Tick> wakes;
+    wakes.swap(barrierWakes);
+    for (const auto &it : wakes) {
+        ThreadContext *tc = getThreadContext(it.first);
+        if (tc->status() != ThreadContext::Suspended)
+            tc->suspend();
+        scheduleBarrierWake(it.first, std::max(it.second, curTick()));
+    }
+
+    // the STATS_EN write that opened the ROI ran before the checkpoint
+    if (inROI && !threadContexts.empty()) {
+        std::vector<BaseCPU*> cpuList =
+            threadContexts[0]->getCpuPtr()->getCpuList();
+        for (auto cpu : cpuList) {
+            cpu->global_stats_en = true;
+            cpu->toggle_stats_en(true);
+        }
+    }
+}
+
 void
 System::replaceThreadContext(ThreadContext *tc, ContextID context_id)
 {
@@ -474,6 +515,22 @@ System::drainResume()
     totalNumInsts = 0;
 }
 
+void
+System::scheduleBarrierWake(ContextID id, Tick when)
+{
+    barrierWakes[id] = when;
+    auto wake = new EventFunctionWrapper([this, id] {
+        ParallelLock<std::recursive_mutex> lock(Process::parallelMutex);
+        barrierWakes.erase(id);
+        getThreadContext(id)->activate();
+    }, name() + ".barrierWake", true);
+    // scheduled as a global event so that it takes the asynchronous path
+    // even when id runs on the current queue: every sleeper is then woken
+    // the same way, whichever thread opened the barrier
+    getThreadContext(id)->getCpuPtr()->eventQueue()->schedule(wake, when,
+                                                              true);
+}
+
 void
 System::serialize(CheckpointOut &cp) const
 {
@@ -481,6 +538,55 @@ System::serialize(CheckpointOut &cp) const
         kernelSymtab->serialize("kernel_symtab", cp);
     // SERIALIZE_SCALAR(pagePtr);
     SERIALIZE_CONTAINER(pagePtrs);
+    SERIALIZE_SCALAR(inROI);
+
+    // gem5 barriers: a ROI checkpoint is taken after gem5_barrier_init and
+    // usually while some threads sleep in the next barrier. The sleepers
+    // of all barriers are flattened, barrier_num_sleepers says how many
+    // belong to each.
+    SERIALIZE_SCALAR(n_barrier_waiters);
+    std::vector<uint64_t> barrier_ids, barrier_arrived, barrier_generations;
+    std::vector<uint64_t> barrier_num_sleepers;
+    std::vector<Tick> barrier_last_arrivals;
+    std::vector<ContextID> barrier_sleepers;
+    for (const auto &it : barriers) {
+        barrier_ids.push_back(it.first);
+        barrier_arrived.push_back(it.second.arrived);
+        barrier_generations.push_back(it.second.generation);
+        barrier_last_arrivals.push_back(it.second.last_arrival);
+        barrier_num_sleepers.push_back(it.second.sleepers.size());
+        barrier_sleepers.insert(barrier_sleepers.end(),
+                                it.second.sleepers.begin(),
+                                it.second.sleepers.end());
+    }
+    SERIALIZE_CONTAINER(barrier_ids);
+    SERIALIZE_CONTAINER(barrier_arrived);
+    SERIALIZE_CONTAINER(barrier_generations);
+    SERIALIZE_CONTAINER(barrier_num_sleepers);
+    SERIALIZE_CONTAINER(barrier_last_arrivals);
+    SERIALIZE_CONTAINER(barrier_sleepers);
+
+    // sleepers of a barrier that opened but has not woken them yet
+    std::vector<ContextID> barrier_wake_contexts;
+    std::vector<Tick> barrier_wake_ticks;
+    for (const auto &it : barrierWakes) {
+        barrier_wake_contexts.push_back(it.first);
+        barrier_wake_ticks.push_back(it.second);
+    }
+    SERIALIZE_CONTAINER(barrier_wake_contexts);
+    SERIALIZE_CONTAINER(barrier_wake_ticks);
+
+    std::vector<ContextID> arrival_contexts;
+    std::vector<uint64_t> arrival_ids, arrival_generations;
+    for (const auto &it : barrierArrivals) {
+        arrival_contexts.push_back(it.first);
+        arrival_ids.push_back(it.second.first);
+        arrival_generations.push_back(it.second.second);
+    }
+    SERIALIZE_CONTAINER(arrival_contexts);
+    SERIALIZE_CONTAINER(arrival_ids);
+    SERIALIZE_CONTAINER(arrival_generations);
+
     serializeSymtab(cp);
 
     // also serialize the memories in the system
@@ -495,6 +601,65 @@ System::unserialize(CheckpointIn &cp)
         kernelSymtab->unserialize("kernel_symtab", cp);
     // UNSERIALIZE_SCALAR(pagePtr);
     UNSERIALIZE_CONTAINER(pagePtrs);
+    UNSERIALIZE_OPT_SCALAR(inROI);
+
+    barriers.clear();
+    barrierArrivals.clear();
+    barrierWakes.clear();
+    if (UNSERIALIZE_OPT_SCALAR(n_barrier_waiters)) {
+        std::vector<uint64_t> barrier_ids, barrier_arrived;
+        std::vector<uint64_t> barrier_generations, barrier_num_sleepers;
+        std::vector<Tick> barrier_last_arrivals;
+        std::vector<ContextID> barrier_sleepers;
+        UNSERIALIZE_CONTAINER(barrier_ids);
+        UNSERIALIZE_CONTAINER(barrier_arrived);
+        UNSERIALIZE_CONTAINER(barrier_generations);
+        UNSERIALIZE_CONTAINER(barrier_num_sleepers);
+        UNSERIALIZE_CONTAINER(barrier_last_arrivals);
+        UNSERIALIZE_CONTAINER(barrier_sleepers);
+        fatal_if(barrier_arrived.size() != barrier_ids.size() ||
+                 barrier_generations.size() != barrier_ids.size() ||
+                 barrier_num_sleepers.size() != barrier_ids.size() ||
+                 barrier_last_arrivals.size() != barrier_ids.size(),
+                 "Malformed gem5 barrier state in checkpoint\n");
+
+        auto sleeper = barrier_sleepers.begin();
+        for (size_t i = 0; i < barrier_ids.size(); ++i) {
+            GemBarrier &bar = barriers[barrier_ids[i]];
+            bar.arrived = barrier_arrived[i];
+            bar.generation = barrier_generations[i];
+            bar.last_arrival = barrier_last_arrivals[i];
+            fatal_if(barrier_sleepers.end() - sleeper <
+                     (ptrdiff_t)barrier_num_sleepers[i],
+                     "Malformed gem5 barrier state in checkpoint\n");
+            bar.sleepers.assign(sleeper, sleeper + barrier_num_sleepers[i]);
+            sleeper += barrier_num_sleepers[i];
+        }
+
+        std::vector<ContextID> arrival_contexts;
+        std::vector<uint64_t> arrival_ids, arrival_generations;
+        UNSERIALIZE_CONTAINER(arrival_contexts);
+        UNSERIALIZE_CONTAINER(arrival_ids);
+        UNSERIALIZE_CONTAINER(arrival_generations);
+        fatal_if(arrival_ids.size() != arrival_contexts.size() ||
+                 arrival_generations.size() != arrival_contexts.size(),
+                 "Malformed gem5 barrier state in checkpoint\n");
+        for (size_t i = 0; i < arrival_contexts.size(); ++i) {
+            barrierArrivals[arrival_contexts[i]] =
+                {arrival_ids[i], arrival_generations[i]};
+        }
+
+        // rescheduled in startup()
+        std::vector<ContextID> barrier_wake_contexts;
+        std::vector<Tick> barrier_wake_ticks;
+        UNSERIALIZE_CONTAINER(barrier_wake_contexts);
+        UNSERIALIZE_CONTAINER(barrier_wake_ticks);
+        fatal_if(barrier_wake_ticks.size() != barrier_wake_contexts.size(),
+                 "Malformed gem5 barrier state in checkpoint\n");
+        for (size_t i = 0; i < barrier_wake_contexts.size(); ++i)
+            barrierWakes[barrier_wake_contexts[i]] = barrier_wake_ticks[i];
+    }
+
     unserializeSymtab(cp);
 
     // also unserialize the memories in the system
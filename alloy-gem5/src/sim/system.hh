@@ -60,6 +60,7 @@
 #ifndef __SYSTEM_HH__
 #define __SYSTEM_HH__
 
+#include <map>
 #include <string>
 #include <unordered_map>
 #include <utility>
@@ -89,6 +90,7 @@
 #endif
 
 class BaseRemoteGDB;
+class EmulationPageTable;
 class KvmVM;
 class ObjectFile;
 class ThreadContext;
@@ -314,11 +316,43 @@ class System : public MemObject
      */
     ThermalModel * getThermalModel() const { return thermalModel; }
 
-    std::vector<std::pair<Addr, Addr>> STNTVaddrRanges;
-    std::vector<std::pair<Addr, Addr>> STRELVaddrRanges;
-    uint64_t n_barrier_waiters;
-    uint64_t n_barrier_in;
-    uint64_t n_barrier_out;
+    // ST_NT/ST_REL regions registered through the DO CSRs. Each region
+    // remembers the page table it was registered against, so processes
+    // that do not share an address space do not see each other's regions.
+    struct DOVaddrRange {
+        Addr begin;
+        Addr end;
+        const EmulationPageTable *pTable;
+    };
+    std::vector<DOVaddrRange> STNTVaddrRanges;
+    std::vector<DOVaddrRange> STRELVaddrRanges;
+
+    // inside the STATS_EN region; checkpointed so that a run restored
+    // from a checkpoint taken at appl::start_stats() keeps its stats on
+    bool inROI = false;
+
+    // gem5 barriers (CSR_BARRIER_*, see Process::barrierWait). Every id is
+    // its own barrier of n_barrier_waiters threads and is reusable: the
+    // last arrival opens the current generation and wakes the sleepers.
+    struct GemBarrier {
+        uint64_t arrived = 0;
+        uint64_t generation = 0;
+        // latest tick of an arrival in the current generation
+        Tick last_arrival = 0;
+        std::vector<ContextID> sleepers;
+    };
+    uint64_t n_barrier_waiters = 0;
+    std::map<uint64_t, GemBarrier> barriers;
+    // barrier id and generation of each context's last arrival
+    std::unordered_map<ContextID, std::pair<uint64_t, uint64_t>>
+        barrierArrivals;
+    // sleepers of opened barriers and the tick they wake at
+    std::map<ContextID, Tick> barrierWakes;
+    // quantum boundaries are counted from where the simulation starts
+    Tick quantumStart = 0;
+
+    // Wakes a barrier sleeper at when, on the event queue of its CPU
+    void scheduleBarrierWake(ContextID id, Tick when);
 
   protected:
 
@@ -583,6 +617,7 @@ class System : public MemObject
     ~System();
 
     void initState() override;
+    void startup() override;
 
     const Params *params() const { return (const Params *)_params; }
 
@@ -679,6 +714,18 @@ class System : public MemObject
     const bool brg_fast_forward;
     const int num_nodes;
     const int num_cores;
+
+    /**
+     * Do the wait-on-address CSRs suspend the hart? Without it they are
+     * no-ops and waiters spin as before.
+     */
+    const bool wait_on_address;
+    /**
+     * Do the L2s send a WAKE to the GET_NT readers of a DO line when it is
+     * written (DO_MESI with --wait-on-address)? Without it waits on DO
+     * lines are not armed.
+     */
+    const bool wake_do_watchers;
 };
 
 void printSystems();
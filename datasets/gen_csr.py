@@ -11,8 +11,22 @@
 
 import numpy as np
 import argparse
+import struct
 
-def build_csr_from_file(input_file, out_nbr=True):
+# Binary CSR layout, read by Pannotia/Utils.cc. All fields are
+# little-endian uint64; every array starts on a 64-byte boundary so the
+# loader can read() or mmap() it in place.
+#
+#   header (64B): magic, num_v, num_e, flags, row_ptr_off, col_idx_off,
+#                 weight_off, reserved
+#   row_ptr: num_v + 1 uint64
+#   col_idx: num_e uint64
+#   weight:  num_e float64, only with CSR_BIN_WEIGHTED
+CSR_BIN_MAGIC = 0x3152534341504c41  # "ALPACSR1"
+CSR_BIN_WEIGHTED = 0x1
+CSR_BIN_ALIGN = 64
+
+def build_csr_from_file(input_file, out_nbr=True, weighted=False):
     with open(input_file, 'r') as f:
         # Skip comments (assuming they start with non-numeric characters)
         line = f.readline().strip()
@@ -43,22 +57,36 @@ def build_csr_from_file(input_file, out_nbr=True):
             else:
                 u = dst
                 v = src
+            w = float(tokens[2]) if weighted and len(tokens) > 2 else 1.0
             
             if u not in nbrlist:
                 nbrlist[u] = []
-            nbrlist[u].append(v)
+            nbrlist[u].append((v, w))
         
         accum = 0
+        weights = []
         for u in range(num_vertices):
             row_ptr[u] = accum
             if u in nbrlist:
-                col_idx += sorted(nbrlist[u])
+                nbrs = sorted(nbrlist[u])
+                col_idx += [v for v, _ in nbrs]
+                weights += [w for _, w in nbrs]
                 accum += len(nbrlist[u])
         
         # Convert col_idx to numpy array
         col_idx = np.array(col_idx, dtype=int)
+        weights = np.array(weights, dtype=np.float64) if weighted else None
+
+        return row_ptr, col_idx, weights
 
-        return row_ptr, col_idx
+def load_csr_from_text(csr_file):
+    # the text format written by save_csr_to_file
+    with open(csr_file, 'r') as f:
+        f.readline()
+        f.readline()
+        row_ptr = np.array(f.readline().split(), dtype=np.uint64)
+        col_idx = np.array(f.readline().split(), dtype=np.uint64)
+    return row_ptr, col_idx
 
 def save_csr_to_file(output_file, row_ptr, col_idx):
     # Save as human-readable format in the same file
@@ -70,18 +98,62 @@ def save_csr_to_file(output_file, row_ptr, col_idx):
     
     print(f"CSR format saved in {output_file}")
 
+def align_up(n):
+    return (n + CSR_BIN_ALIGN - 1) // CSR_BIN_ALIGN * CSR_BIN_ALIGN
+
+def save_csr_to_binary(output_file, row_ptr, col_idx, weights=None):
+    num_v = len(row_ptr) - 1
+    num_e = len(col_idx)
+    flags = CSR_BIN_WEIGHTED if weights is not None else 0
+
+    row_ptr_off = CSR_BIN_ALIGN
+    col_idx_off = align_up(row_ptr_off + 8 * (num_v + 1))
+    weight_off = align_up(col_idx_off + 8 * num_e) if weights is not None else 0
+
+    with open(output_file, 'wb') as f:
+        f.write(struct.pack('<8Q', CSR_BIN_MAGIC, num_v, num_e, flags,
+                            row_ptr_off, col_idx_off, weight_off, 0))
+        f.seek(row_ptr_off)
+        f.write(np.asarray(row_ptr, dtype='<u8').tobytes())
+        f.seek(col_idx_off)
+        f.write(np.asarray(col_idx, dtype='<u8').tobytes())
+        if weights is not None:
+            f.seek(weight_off)
+            f.write(np.asarray(weights, dtype='<f8').tobytes())
+
+    print(f"binary CSR saved in {output_file}")
+
 def main():
     parser = argparse.ArgumentParser(description="Convert a graph file to CSR format (1-based to 0-based index, with optional weights).")
     parser.add_argument('graph_file', help="Input graph file")
     parser.add_argument('csr_file', help="Output CSR file")
     parser.add_argument('out_nbr', help="CSR represent in/out nbrs")
+    parser.add_argument('--binary', action='store_true',
+                        help="Write the binary CSR format instead of text")
+    parser.add_argument('--weights', action='store_true',
+                        help="Keep edge weights (binary format only)")
+    parser.add_argument('--from-csr', action='store_true',
+                        help="graph_file is a text CSR file to convert")
     args = parser.parse_args()
 
-    # Build CSR from input graph file
-    row_ptr, col_idx = build_csr_from_file(args.graph_file, args.out_nbr)
+    if args.weights and not args.binary:
+        parser.error("--weights needs --binary")
+
+    if args.from_csr:
+        if args.weights:
+            parser.error("text CSR files carry no weights")
+        row_ptr, col_idx = load_csr_from_text(args.graph_file)
+        weights = None
+    else:
+        # Build CSR from input graph file
+        row_ptr, col_idx, weights = build_csr_from_file(
+            args.graph_file, args.out_nbr, args.weights)
 
-    # Save CSR to human-readable text file (same as graph file)
-    save_csr_to_file(args.csr_file, row_ptr, col_idx)
+    if args.binary:
+        save_csr_to_binary(args.csr_file, row_ptr, col_idx, weights)
+    else:
+        # Save CSR to human-readable text file (same as graph file)
+        save_csr_to_file(args.csr_file, row_ptr, col_idx)
 
 if __name__ == '__main__':
     main()
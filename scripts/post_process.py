@@ -18,7 +18,35 @@ def copy_results(docker_hash):
     os.system(f'sudo docker cp {docker_hash}:/artifact_top/DO_gem5/logs/. /home/yanpeng/NVIDIA/DO_gem5/results/logs/')
     os.system(f'sudo docker cp {docker_hash}:/artifact_top/DO_gem5/m5out/. /home/yanpeng/NVIDIA/DO_gem5/results/m5out/')
     
+# MessageSizeTypes of the DO traffic (PUT_NT/PUT_REL and its notifications)
+DO_MSG_CLASSES = ('PUT_NT', 'PUT_REL', 'REQ_NOTIFY', 'NOTIFY', 'PUT_REL_ACK')
+
+def find_msg_traffic(statsfile, link_class='CG'):
+    """Flits and message bytes per MessageSizeType on one link class
+    (ext_in, ext_out, int or CG), from the network's link_msg_flits and
+    link_msg_bytes stats. Empty for stats files without them."""
+    traffic = {}
+    pattern = re.compile(r'\.link_msg_(flits|bytes)_' + link_class +
+                         r'::(\w+)\s+(\d+)')
+    with open(statsfile, 'r') as stats:
+        for line in stats:
+            match = pattern.search(line)
+            if match and match.group(2) != 'total':
+                entry = traffic.setdefault(match.group(2),
+                                           {'flits': 0, 'bytes': 0})
+                entry[match.group(1)] = int(match.group(3))
+    return traffic
+
 def find_flits_count(statsfile, flit_size):
+    """Inter-PU traffic in bytes on the wire: (all, DO messages only)."""
+    traffic = find_msg_traffic(statsfile)
+    if traffic:
+        general_traffic = sum(t['flits'] for t in traffic.values()) * flit_size
+        target_traffic = sum(traffic[c]['flits'] for c in DO_MSG_CLASSES
+                             if c in traffic) * flit_size
+        return general_traffic, target_traffic
+
+    # older stats files: DO traffic was approximated as vnet >= 3
     general_traffic = 0
     target_traffic = 0
     with open(statsfile, 'r') as stats:
@@ -205,32 +233,31 @@ def process_logfile_comp_time_strel_ldacq_per_thread(logfile, r):
 
     return avg_ld_st_diff
 
-def calculate_storage(logfile, stCnt_bw, epoch_bw, n_procs, n_dirs):
+def calculate_storage(statsfile, stCnt_bw, epoch_bw, n_procs, n_dirs):
     max_pendingEpochs_entries = 0
     max_stCnts_entries = 0
     max_notiCnts_entries = 0
     max_recycled_st_rel = 0
-    
-    with open(logfile, 'r') as log:
-        for line in log:
-            match = re.search(r'\b\w+\s+(\d+)\b', line)
-            if 'unCommittedEpochs' in line:
-                size = int(match.group(1))
-                if size > max_pendingEpochs_entries:
-                    max_pendingEpochs_entries = size
-            elif 'notiCnts' in line:
-                size = int(match.group(1))
-                if size > max_notiCnts_entries:
-                    max_notiCnts_entries = size
-            elif 'stCnts' in line:
-                size = int(match.group(1))
-                if size > max_stCnts_entries:
-                    max_stCnts_entries = size
-            elif 'recycledStRel' in line:
-                size = int(match.group(1))
-                if size > max_recycled_st_rel:
-                    max_recycled_st_rel = size
-    
+
+    # high watermarks kept by DOCPUTable, DOL2Table and MessageBuffer; take
+    # the max over all controllers and stats dumps
+    with open(statsfile, 'r') as stats:
+        for line in stats:
+            match = re.match(r'^(\S+)\s+(\d+)', line)
+            if not match:
+                continue
+            name = match.group(1)
+            size = int(match.group(2))
+            if name.endswith('.max_uncommitted_epochs'):
+                max_pendingEpochs_entries = max(max_pendingEpochs_entries, size)
+            elif name.endswith('.max_noti_cnts'):
+                max_notiCnts_entries = max(max_notiCnts_entries, size)
+            elif name.endswith('.max_st_cnts'):
+                max_stCnts_entries = max(max_stCnts_entries, size)
+            elif name.endswith('.max_parked_put_rels') or \
+                 (name.endswith('.max_recycled_msgs') and 'STREL' in name):
+                max_recycled_st_rel = max(max_recycled_st_rel, size)
+
     dir_bw = (n_dirs - 1).bit_length()
     proc_bw = (n_procs - 1).bit_length()
     st_rel_pkt_bw = 256
@@ -293,11 +320,14 @@ if __name__ == "__main__":
             print(f"inter-PU Traffic: general: {general_traffic} B, target: {target_traffic} B")
         else:
             print("Line with 'system.ruby.network.CG_link_flits_count' not found.")
+
+        for msg_class, t in sorted(find_msg_traffic(args.statsfile).items()):
+            print(f"  {msg_class}: {t['flits']} flits, {t['bytes']} B")
     
     if args.storage:
         stCnt_bw = 32
         epoch_bw = 8
         n_procs = args.n_PUs * 8
         n_dirs = args.n_PUs
-        proc_epoch, proc_stCnt, proc_pendingEpochs, dir_stCnt, dir_notiCnt, dir_maxCommittedEpochs, dir_network_buffer = calculate_storage(args.logfile, stCnt_bw, epoch_bw, n_procs, n_dirs)
+        proc_epoch, proc_stCnt, proc_pendingEpochs, dir_stCnt, dir_notiCnt, dir_maxCommittedEpochs, dir_network_buffer = calculate_storage(args.statsfile, stCnt_bw, epoch_bw, n_procs, n_dirs)
         print(f"Storage overheads(B) proc_epoch {proc_epoch}, proc_stCnt {proc_stCnt}, proc_pendingEpochs {proc_pendingEpochs}, dir_stCnt {dir_stCnt}, dir_notiCnt {dir_notiCnt}, dir_maxCommittedEpochs {dir_maxCommittedEpochs}, dir_network_buffer {dir_network_buffer}")
\ No newline at end of file
@@ -34,7 +34,7 @@ if __name__ == "__main__":
                 proc_pendingEpochs,\
                 dir_stCnt, dir_notiCnt,\
                 dir_maxCommittedEpochs, dir_network_buffer\
-                = pp.calculate_storage(f'../results/logs/log{file_id}.txt',\
+                = pp.calculate_storage(f'../results/m5out/stats{file_id}.txt',\
                     stCnt_bw=32, epoch_bw=8, n_procs=int(n_nodes) * 8, n_dirs=int(n_nodes))
                 proc_total = proc_epoch + proc_stCnt + proc_pendingEpochs
                 dir_total = dir_stCnt + dir_notiCnt + dir_maxCommittedEpochs + dir_network_buffer
@@ -18,7 +18,7 @@ sync_grans=("16" "128" "1024" "8192" "65536") # in floats
 for sync_gran in "${sync_grans[@]}"; do
     for sys in "${syss[@]}"; do
         for latency in "${latencies[@]}"; do
-            nohup /artifact_top/alloy-gem5/build/RISCV_${sys}_64B/gem5.opt --stats-file=stats${exp_id}.txt --debug-flags=DOMEM,DOACC --listener-mode=off /artifact_top/alloy-gem5/configs/brg/sc3.py --cpu-type TimingSimpleCPU --link-latency 20 --CG_link_latency ${latency} --garnet-deadlock-threshold 100000 --l2_size 16384kB --l2_assoc 8 --num-dirs 8 --brg-fast-forward --num-cpus 64 --network garnet2.0 --buffer-size 0 --mem-size 4GB --ruby --l1d_size 64kB --mem-type SimpleMemory --num-l1-cache-ports 8 --num-l2caches 8 --ports 16 --l1i_size 64kB --topology TwoMeshXY -c /artifact_top/alloy-apps/build-applrts_sc3/run_sendrecv_pad -o "-w 0 -r 1 -n 2 -c 8 -f ${sync_gran} -s 8 -p 21" --vcs-per-vnet 64 --buffers-per-data-vc 65536 --buffers-per-ctrl-vc 1024 > logs/log${exp_id}.txt &
+            nohup /artifact_top/alloy-gem5/build/RISCV_${sys}/gem5.opt --stats-file=stats${exp_id}.txt --debug-flags=DOMEM,DOACC --listener-mode=off /artifact_top/alloy-gem5/configs/brg/sc3.py --msg-size PUT_NT:64 --cpu-type TimingSimpleCPU --link-latency 20 --CG_link_latency ${latency} --garnet-deadlock-threshold 100000 --l2_size 16384kB --l2_assoc 8 --num-dirs 8 --brg-fast-forward --num-cpus 64 --network garnet2.0 --buffer-size 0 --mem-size 4GB --ruby --l1d_size 64kB --mem-type SimpleMemory --num-l1-cache-ports 8 --num-l2caches 8 --ports 16 --l1i_size 64kB --topology TwoMeshXY -c /artifact_top/alloy-apps/build-applrts_sc3/run_sendrecv_pad -o "-w 0 -r 1 -n 2 -c 8 -f ${sync_gran} -s 8 -p 21" --vcs-per-vnet 64 --buffers-per-data-vc 65536 --buffers-per-ctrl-vc 1024 > logs/log${exp_id}.txt &
             exp_id=$((exp_id + 1))
         done
     done
@@ -30,21 +30,21 @@ for sync_gran in "${sync_grans[@]}"; do # additionally test for small sync gran
     for fanout in "${fanouts[@]}"; do
         for sys in "${syss[@]}"; do
             for latency in "${latencies[@]}"; do
-                nohup /artifact_top/alloy-gem5/build/RISCV_${sys}_64B/gem5.opt --stats-file=stats${exp_id}.txt --debug-flags=DOMEM,DOACC --listener-mode=off /artifact_top/alloy-gem5/configs/brg/sc3.py --cpu-type TimingSimpleCPU --link-latency 20 --CG_link_latency ${latency} --garnet-deadlock-threshold 100000 --l2_size 16384kB --l2_assoc 8 --num-dirs 8 --brg-fast-forward --num-cpus 64 --network garnet2.0 --buffer-size 0 --mem-size 4GB --ruby --l1d_size 64kB --mem-type SimpleMemory --num-l1-cache-ports 8 --num-l2caches 8 --ports 16 --l1i_size 64kB --topology TwoMeshXY -c /artifact_top/alloy-apps/build-applrts_sc3/run_sendrecv_pad -o "-w 0 -r 1 -n ${fanout} -c 8 -f ${sync_gran} -s 8 -p 21" --vcs-per-vnet 64 --buffers-per-data-vc 65536 --buffers-per-ctrl-vc 1024 > logs/log${exp_id}.txt &
+                nohup /artifact_top/alloy-gem5/build/RISCV_${sys}/gem5.opt --stats-file=stats${exp_id}.txt --debug-flags=DOMEM,DOACC --listener-mode=off /artifact_top/alloy-gem5/configs/brg/sc3.py --msg-size PUT_NT:64 --cpu-type TimingSimpleCPU --link-latency 20 --CG_link_latency ${latency} --garnet-deadlock-threshold 100000 --l2_size 16384kB --l2_assoc 8 --num-dirs 8 --brg-fast-forward --num-cpus 64 --network garnet2.0 --buffer-size 0 --mem-size 4GB --ruby --l1d_size 64kB --mem-type SimpleMemory --num-l1-cache-ports 8 --num-l2caches 8 --ports 16 --l1i_size 64kB --topology TwoMeshXY -c /artifact_top/alloy-apps/build-applrts_sc3/run_sendrecv_pad -o "-w 0 -r 1 -n ${fanout} -c 8 -f ${sync_gran} -s 8 -p 21" --vcs-per-vnet 64 --buffers-per-data-vc 65536 --buffers-per-ctrl-vc 1024 > logs/log${exp_id}.txt &
                 exp_id=$((exp_id + 1))
             done
         done
     done
 done
 
-store_grans=("" "_64B" "_256B" "_1KB" "_4KB")
+msg_sizes=("" "--msg-size PUT_NT:64" "--msg-size PUT_NT:256" "--msg-size PUT_NT:1024" "--msg-size PUT_NT:4096")
 strides=("1" "8" "32" "128" "512")
-for ((i=0; i<${#store_grans[@]}; i++)); do
-    store_gran=${store_grans[i]}
+for ((i=0; i<${#msg_sizes[@]}; i++)); do
+    msg_size=${msg_sizes[i]}
     stride=${strides[i]}
     for sys in "${syss[@]}"; do
         for latency in "${latencies[@]}"; do
-            nohup /artifact_top/alloy-gem5/build/RISCV_${sys}${store_gran}/gem5.opt --stats-file=stats${exp_id}.txt --debug-flags=DOMEM,DOACC --listener-mode=off /artifact_top/alloy-gem5/configs/brg/sc3.py --cpu-type TimingSimpleCPU --link-latency 20 --CG_link_latency ${latency} --garnet-deadlock-threshold 100000 --l2_size 16384kB --l2_assoc 8 --num-dirs 8 --brg-fast-forward --num-cpus 64 --network garnet2.0 --buffer-size 0 --mem-size 4GB --ruby --l1d_size 64kB --mem-type SimpleMemory --num-l1-cache-ports 8 --num-l2caches 8 --ports 16 --l1i_size 64kB --topology TwoMeshXY -c /artifact_top/alloy-apps/build-applrts_sc3/run_sendrecv_pad -o "-w 0 -r 1 -n 2 -c 8 -f 1024 -s ${stride} -p 21" --vcs-per-vnet 64 --buffers-per-data-vc 65536 --buffers-per-ctrl-vc 1024 > logs/log${exp_id}.txt &
+            nohup /artifact_top/alloy-gem5/build/RISCV_${sys}/gem5.opt --stats-file=stats${exp_id}.txt --debug-flags=DOMEM,DOACC --listener-mode=off /artifact_top/alloy-gem5/configs/brg/sc3.py ${msg_size} --cpu-type TimingSimpleCPU --link-latency 20 --CG_link_latency ${latency} --garnet-deadlock-threshold 100000 --l2_size 16384kB --l2_assoc 8 --num-dirs 8 --brg-fast-forward --num-cpus 64 --network garnet2.0 --buffer-size 0 --mem-size 4GB --ruby --l1d_size 64kB --mem-type SimpleMemory --num-l1-cache-ports 8 --num-l2caches 8 --ports 16 --l1i_size 64kB --topology TwoMeshXY -c /artifact_top/alloy-apps/build-applrts_sc3/run_sendrecv_pad -o "-w 0 -r 1 -n 2 -c 8 -f 1024 -s ${stride} -p 21" --vcs-per-vnet 64 --buffers-per-data-vc 65536 --buffers-per-ctrl-vc 1024 > logs/log${exp_id}.txt &
             exp_id=$((exp_id + 1))
         done
     done
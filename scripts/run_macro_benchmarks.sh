@@ -32,34 +32,34 @@ nohup /artifact_top/alloy-gem5/build/RISCV_MP/gem5.opt --stats-file=stats120.txt
 nohup /artifact_top/alloy-gem5/build/RISCV_MP/gem5.opt --stats-file=stats121.txt --debug-flags=DOMEM,DOACC --listener-mode=off /artifact_top/alloy-gem5/configs/brg/sc3.py --cpu-type TimingSimpleCPU --link-latency 20 --CG_link_latency 150 --garnet-deadlock-threshold 100000 --l2_size 16384kB --l2_assoc 8 --num-dirs 8 --brg-fast-forward --num-cpus 64 --network garnet2.0 --buffer-size 0 --mem-size 16GB --ruby --l1d_size 64kB --mem-type SimpleMemory --num-l1-cache-ports 8 --num-l2caches 8 --ports 16 --l1i_size 64kB --topology TwoMeshXY -c /artifact_top/alloy-apps/build-applrts_sc3/PR -o "-w 0 -r 0 -n 8 -c 8 -t 8 -f /artifact_top/DO_gem5/datasets/wing_out.csr" --vcs-per-vnet 64 --buffers-per-data-vc 65536 --buffers-per-ctrl-vc 1024 > logs/log121.txt &
 
 # PAD 122-125
-nohup /artifact_top/alloy-gem5/build/RISCV_DO_MESI_64B/gem5.opt --stats-file=stats122.txt --debug-flags=DOMEM,DOACC --listener-mode=off /artifact_top/alloy-gem5/configs/brg/sc3.py --cpu-type TimingSimpleCPU --link-latency 20 --CG_link_latency 150 --garnet-deadlock-threshold 100000 --l2_size 16384kB --l2_assoc 8 --num-dirs 8 --brg-fast-forward --num-cpus 64 --network garnet2.0 --buffer-size 0 --mem-size 16GB --ruby --l1d_size 64kB --mem-type SimpleMemory --num-l1-cache-ports 8 --num-l2caches 8 --ports 16 --l1i_size 64kB --topology TwoMeshXY -c /artifact_top/alloy-apps/build-applrts_sc3/PAD_RC_CXL -o "-w 0 -r 1 -n 8 -c 8 -t 8 -p 1" --vcs-per-vnet 64 --buffers-per-data-vc 65536 --buffers-per-ctrl-vc 1024 > logs/log122.txt &
-nohup /artifact_top/alloy-gem5/build/RISCV_WT_MESI_64B/gem5.opt --stats-file=stats123.txt --debug-flags=DOMEM,DOACC --listener-mode=off /artifact_top/alloy-gem5/configs/brg/sc3.py --cpu-type TimingSimpleCPU --link-latency 20 --CG_link_latency 150 --garnet-deadlock-threshold 100000 --l2_size 16384kB --l2_assoc 8 --num-dirs 8 --brg-fast-forward --num-cpus 64 --network garnet2.0 --buffer-size 0 --mem-size 16GB --ruby --l1d_size 64kB --mem-type SimpleMemory --num-l1-cache-ports 8 --num-l2caches 8 --ports 16 --l1i_size 64kB --topology TwoMeshXY -c /artifact_top/alloy-apps/build-applrts_sc3/PAD_RC_CXL -o "-w 0 -r 1 -n 8 -c 8 -t 8 -p 1" --vcs-per-vnet 64 --buffers-per-data-vc 65536 --buffers-per-ctrl-vc 1024 > logs/log123.txt &
+nohup /artifact_top/alloy-gem5/build/RISCV_DO_MESI/gem5.opt --stats-file=stats122.txt --debug-flags=DOMEM,DOACC --listener-mode=off /artifact_top/alloy-gem5/configs/brg/sc3.py --msg-size PUT_NT:64 --cpu-type TimingSimpleCPU --link-latency 20 --CG_link_latency 150 --garnet-deadlock-threshold 100000 --l2_size 16384kB --l2_assoc 8 --num-dirs 8 --brg-fast-forward --num-cpus 64 --network garnet2.0 --buffer-size 0 --mem-size 16GB --ruby --l1d_size 64kB --mem-type SimpleMemory --num-l1-cache-ports 8 --num-l2caches 8 --ports 16 --l1i_size 64kB --topology TwoMeshXY -c /artifact_top/alloy-apps/build-applrts_sc3/PAD_RC_CXL -o "-w 0 -r 1 -n 8 -c 8 -t 8 -p 1" --vcs-per-vnet 64 --buffers-per-data-vc 65536 --buffers-per-ctrl-vc 1024 > logs/log122.txt &
+nohup /artifact_top/alloy-gem5/build/RISCV_WT_MESI/gem5.opt --stats-file=stats123.txt --debug-flags=DOMEM,DOACC --listener-mode=off /artifact_top/alloy-gem5/configs/brg/sc3.py --msg-size PUT_NT:64 --cpu-type TimingSimpleCPU --link-latency 20 --CG_link_latency 150 --garnet-deadlock-threshold 100000 --l2_size 16384kB --l2_assoc 8 --num-dirs 8 --brg-fast-forward --num-cpus 64 --network garnet2.0 --buffer-size 0 --mem-size 16GB --ruby --l1d_size 64kB --mem-type SimpleMemory --num-l1-cache-ports 8 --num-l2caches 8 --ports 16 --l1i_size 64kB --topology TwoMeshXY -c /artifact_top/alloy-apps/build-applrts_sc3/PAD_RC_CXL -o "-w 0 -r 1 -n 8 -c 8 -t 8 -p 1" --vcs-per-vnet 64 --buffers-per-data-vc 65536 --buffers-per-ctrl-vc 1024 > logs/log123.txt &
 nohup /artifact_top/alloy-gem5/build/RISCV_MESI/gem5.opt --stats-file=stats124.txt --debug-flags=DOMEM,DOACC --listener-mode=off /artifact_top/alloy-gem5/configs/brg/sc3.py --cpu-type TimingSimpleCPU --link-latency 20 --CG_link_latency 150 --garnet-deadlock-threshold 100000 --l2_size 16384kB --l2_assoc 8 --num-dirs 8 --brg-fast-forward --num-cpus 64 --network garnet2.0 --buffer-size 0 --mem-size 16GB --ruby --l1d_size 64kB --mem-type SimpleMemory --num-l1-cache-ports 8 --num-l2caches 8 --ports 16 --l1i_size 64kB --topology TwoMeshXY -c /artifact_top/alloy-apps/build-applrts_sc3/PAD_RC_CXL -o "-w 0 -r 1 -n 8 -c 8 -t 8 -p 1" --vcs-per-vnet 64 --buffers-per-data-vc 65536 --buffers-per-ctrl-vc 1024 > logs/log124.txt &
-nohup /artifact_top/alloy-gem5/build/RISCV_MP_64B/gem5.opt --stats-file=stats125.txt --debug-flags=DOMEM,DOACC --listener-mode=off /artifact_top/alloy-gem5/configs/brg/sc3.py --cpu-type TimingSimpleCPU --link-latency 20 --CG_link_latency 150 --garnet-deadlock-threshold 100000 --l2_size 16384kB --l2_assoc 8 --num-dirs 8 --brg-fast-forward --num-cpus 64 --network garnet2.0 --buffer-size 0 --mem-size 16GB --ruby --l1d_size 64kB --mem-type SimpleMemory --num-l1-cache-ports 8 --num-l2caches 8 --ports 16 --l1i_size 64kB --topology TwoMeshXY -c /artifact_top/alloy-apps/build-applrts_sc3/PAD_RC_CXL -o "-w 0 -r 1 -n 8 -c 8 -t 8 -p 1" --vcs-per-vnet 64 --buffers-per-data-vc 65536 --buffers-per-ctrl-vc 1024 > logs/log125.txt &
+nohup /artifact_top/alloy-gem5/build/RISCV_MP/gem5.opt --stats-file=stats125.txt --debug-flags=DOMEM,DOACC --listener-mode=off /artifact_top/alloy-gem5/configs/brg/sc3.py --msg-size PUT_NT:64 --cpu-type TimingSimpleCPU --link-latency 20 --CG_link_latency 150 --garnet-deadlock-threshold 100000 --l2_size 16384kB --l2_assoc 8 --num-dirs 8 --brg-fast-forward --num-cpus 64 --network garnet2.0 --buffer-size 0 --mem-size 16GB --ruby --l1d_size 64kB --mem-type SimpleMemory --num-l1-cache-ports 8 --num-l2caches 8 --ports 16 --l1i_size 64kB --topology TwoMeshXY -c /artifact_top/alloy-apps/build-applrts_sc3/PAD_RC_CXL -o "-w 0 -r 1 -n 8 -c 8 -t 8 -p 1" --vcs-per-vnet 64 --buffers-per-data-vc 65536 --buffers-per-ctrl-vc 1024 > logs/log125.txt &
 
 # TQH 126-129 SO traffic is buggy, need special handling
-nohup /artifact_top/alloy-gem5/build/RISCV_DO_MESI_64B/gem5.opt --stats-file=stats126.txt --debug-flags=DOMEM,DOACC --listener-mode=off /artifact_top/alloy-gem5/configs/brg/sc3.py --cpu-type TimingSimpleCPU --link-latency 20 --CG_link_latency 150 --garnet-deadlock-threshold 100000 --l2_size 16384kB --l2_assoc 8 --num-dirs 8 --brg-fast-forward --num-cpus 64 --network garnet2.0 --buffer-size 0 --mem-size 16GB --ruby --l1d_size 64kB --mem-type SimpleMemory --num-l1-cache-ports 8 --num-l2caches 8 --ports 16 --l1i_size 64kB --topology TwoMeshXY -c /artifact_top/alloy-apps/build-applrts_sc3/TQH -o "-w 0 -r 2 -n 8 -c 8 -t 8 -p 32 -f /artifact_top/DO_gem5/datasets/basket" --vcs-per-vnet 64 --buffers-per-data-vc 65536 --buffers-per-ctrl-vc 1024 > logs/log126.txt &
-nohup /artifact_top/alloy-gem5/build/RISCV_WT_MESI_64B/gem5.opt --stats-file=stats127.txt --debug-flags=DOMEM,DOACC --listener-mode=off /artifact_top/alloy-gem5/configs/brg/sc3.py --cpu-type TimingSimpleCPU --link-latency 20 --CG_link_latency 150 --garnet-deadlock-threshold 100000 --l2_size 16384kB --l2_assoc 8 --num-dirs 8 --brg-fast-forward --num-cpus 64 --network garnet2.0 --buffer-size 0 --mem-size 16GB --ruby --l1d_size 64kB --mem-type SimpleMemory --num-l1-cache-ports 8 --num-l2caches 8 --ports 16 --l1i_size 64kB --topology TwoMeshXY -c /artifact_top/alloy-apps/build-applrts_sc3/TQH -o "-w 0 -r 2 -n 8 -c 8 -t 8 -p 32 -f /artifact_top/DO_gem5/datasets/basket" --vcs-per-vnet 64 --buffers-per-data-vc 65536 --buffers-per-ctrl-vc 1024 > logs/log127.txt &
+nohup /artifact_top/alloy-gem5/build/RISCV_DO_MESI/gem5.opt --stats-file=stats126.txt --debug-flags=DOMEM,DOACC --listener-mode=off /artifact_top/alloy-gem5/configs/brg/sc3.py --msg-size PUT_NT:64 --cpu-type TimingSimpleCPU --link-latency 20 --CG_link_latency 150 --garnet-deadlock-threshold 100000 --l2_size 16384kB --l2_assoc 8 --num-dirs 8 --brg-fast-forward --num-cpus 64 --network garnet2.0 --buffer-size 0 --mem-size 16GB --ruby --l1d_size 64kB --mem-type SimpleMemory --num-l1-cache-ports 8 --num-l2caches 8 --ports 16 --l1i_size 64kB --topology TwoMeshXY -c /artifact_top/alloy-apps/build-applrts_sc3/TQH -o "-w 0 -r 2 -n 8 -c 8 -t 8 -p 32 -f /artifact_top/DO_gem5/datasets/basket" --vcs-per-vnet 64 --buffers-per-data-vc 65536 --buffers-per-ctrl-vc 1024 > logs/log126.txt &
+nohup /artifact_top/alloy-gem5/build/RISCV_WT_MESI/gem5.opt --stats-file=stats127.txt --debug-flags=DOMEM,DOACC --listener-mode=off /artifact_top/alloy-gem5/configs/brg/sc3.py --msg-size PUT_NT:64 --cpu-type TimingSimpleCPU --link-latency 20 --CG_link_latency 150 --garnet-deadlock-threshold 100000 --l2_size 16384kB --l2_assoc 8 --num-dirs 8 --brg-fast-forward --num-cpus 64 --network garnet2.0 --buffer-size 0 --mem-size 16GB --ruby --l1d_size 64kB --mem-type SimpleMemory --num-l1-cache-ports 8 --num-l2caches 8 --ports 16 --l1i_size 64kB --topology TwoMeshXY -c /artifact_top/alloy-apps/build-applrts_sc3/TQH -o "-w 0 -r 2 -n 8 -c 8 -t 8 -p 32 -f /artifact_top/DO_gem5/datasets/basket" --vcs-per-vnet 64 --buffers-per-data-vc 65536 --buffers-per-ctrl-vc 1024 > logs/log127.txt &
 nohup /artifact_top/alloy-gem5/build/RISCV_MESI/gem5.opt --stats-file=stats128.txt --debug-flags=DOMEM,DOACC --listener-mode=off /artifact_top/alloy-gem5/configs/brg/sc3.py --cpu-type TimingSimpleCPU --link-latency 20 --CG_link_latency 150 --garnet-deadlock-threshold 100000 --l2_size 16384kB --l2_assoc 8 --num-dirs 8 --brg-fast-forward --num-cpus 64 --network garnet2.0 --buffer-size 0 --mem-size 16GB --ruby --l1d_size 64kB --mem-type SimpleMemory --num-l1-cache-ports 8 --num-l2caches 8 --ports 16 --l1i_size 64kB --topology TwoMeshXY -c /artifact_top/alloy-apps/build-applrts_sc3/TQH -o "-w 0 -r 2 -n 8 -c 8 -t 8 -p 32 -f /artifact_top/DO_gem5/datasets/basket" --vcs-per-vnet 64 --buffers-per-data-vc 65536 --buffers-per-ctrl-vc 1024 > logs/log128.txt &
-nohup /artifact_top/alloy-gem5/build/RISCV_MP_64B/gem5.opt --stats-file=stats129.txt --debug-flags=DOMEM,DOACC --listener-mode=off /artifact_top/alloy-gem5/configs/brg/sc3.py --cpu-type TimingSimpleCPU --link-latency 20 --CG_link_latency 150 --garnet-deadlock-threshold 100000 --l2_size 16384kB --l2_assoc 8 --num-dirs 8 --brg-fast-forward --num-cpus 64 --network garnet2.0 --buffer-size 0 --mem-size 16GB --ruby --l1d_size 64kB --mem-type SimpleMemory --num-l1-cache-ports 8 --num-l2caches 8 --ports 16 --l1i_size 64kB --topology TwoMeshXY -c /artifact_top/alloy-apps/build-applrts_sc3/TQH -o "-w 0 -r 2 -n 8 -c 8 -t 8 -p 32 -f /artifact_top/DO_gem5/datasets/basket" --vcs-per-vnet 64 --buffers-per-data-vc 65536 --buffers-per-ctrl-vc 1024 > logs/log129.txt &
+nohup /artifact_top/alloy-gem5/build/RISCV_MP/gem5.opt --stats-file=stats129.txt --debug-flags=DOMEM,DOACC --listener-mode=off /artifact_top/alloy-gem5/configs/brg/sc3.py --msg-size PUT_NT:64 --cpu-type TimingSimpleCPU --link-latency 20 --CG_link_latency 150 --garnet-deadlock-threshold 100000 --l2_size 16384kB --l2_assoc 8 --num-dirs 8 --brg-fast-forward --num-cpus 64 --network garnet2.0 --buffer-size 0 --mem-size 16GB --ruby --l1d_size 64kB --mem-type SimpleMemory --num-l1-cache-ports 8 --num-l2caches 8 --ports 16 --l1i_size 64kB --topology TwoMeshXY -c /artifact_top/alloy-apps/build-applrts_sc3/TQH -o "-w 0 -r 2 -n 8 -c 8 -t 8 -p 32 -f /artifact_top/DO_gem5/datasets/basket" --vcs-per-vnet 64 --buffers-per-data-vc 65536 --buffers-per-ctrl-vc 1024 > logs/log129.txt &
 
 # alltoall_10KB 130-133
-nohup /artifact_top/alloy-gem5/build/RISCV_DO_MESI_64B/gem5.opt --stats-file=stats130.txt --debug-flags=DOMEM,DOACC --listener-mode=off /artifact_top/alloy-gem5/configs/brg/sc3.py --cpu-type TimingSimpleCPU --link-latency 20 --CG_link_latency 150 --garnet-deadlock-threshold 100000 --l2_size 16384kB --l2_assoc 8 --num-dirs 8 --brg-fast-forward --num-cpus 64 --network garnet2.0 --buffer-size 0 --mem-size 16GB --ruby --l1d_size 64kB --mem-type SimpleMemory --num-l1-cache-ports 8 --num-l2caches 8 --ports 16 --l1i_size 64kB --topology TwoMeshXY -c /artifact_top/alloy-apps/build-applrts_sc3/run_alltoall -o "-w 0 -r 1 -n 8 -c 8 -t 8 -f 2560 -s 8 -v 0" --vcs-per-vnet 64 --buffers-per-data-vc 65536 --buffers-per-ctrl-vc 1024 > logs/log130.txt &
-nohup /artifact_top/alloy-gem5/build/RISCV_WT_MESI_64B/gem5.opt --stats-file=stats131.txt --debug-flags=DOMEM,DOACC --listener-mode=off /artifact_top/alloy-gem5/configs/brg/sc3.py --cpu-type TimingSimpleCPU --link-latency 20 --CG_link_latency 150 --garnet-deadlock-threshold 100000 --l2_size 16384kB --l2_assoc 8 --num-dirs 8 --brg-fast-forward --num-cpus 64 --network garnet2.0 --buffer-size 0 --mem-size 16GB --ruby --l1d_size 64kB --mem-type SimpleMemory --num-l1-cache-ports 8 --num-l2caches 8 --ports 16 --l1i_size 64kB --topology TwoMeshXY -c /artifact_top/alloy-apps/build-applrts_sc3/run_alltoall -o "-w 0 -r 1 -n 8 -c 8 -t 8 -f 2560 -s 8 -v 0" --vcs-per-vnet 64 --buffers-per-data-vc 65536 --buffers-per-ctrl-vc 1024 > logs/log131.txt &
+nohup /artifact_top/alloy-gem5/build/RISCV_DO_MESI/gem5.opt --stats-file=stats130.txt --debug-flags=DOMEM,DOACC --listener-mode=off /artifact_top/alloy-gem5/configs/brg/sc3.py --msg-size PUT_NT:64 --cpu-type TimingSimpleCPU --link-latency 20 --CG_link_latency 150 --garnet-deadlock-threshold 100000 --l2_size 16384kB --l2_assoc 8 --num-dirs 8 --brg-fast-forward --num-cpus 64 --network garnet2.0 --buffer-size 0 --mem-size 16GB --ruby --l1d_size 64kB --mem-type SimpleMemory --num-l1-cache-ports 8 --num-l2caches 8 --ports 16 --l1i_size 64kB --topology TwoMeshXY -c /artifact_top/alloy-apps/build-applrts_sc3/run_alltoall -o "-w 0 -r 1 -n 8 -c 8 -t 8 -f 2560 -s 8 -v 0" --vcs-per-vnet 64 --buffers-per-data-vc 65536 --buffers-per-ctrl-vc 1024 > logs/log130.txt &
+nohup /artifact_top/alloy-gem5/build/RISCV_WT_MESI/gem5.opt --stats-file=stats131.txt --debug-flags=DOMEM,DOACC --listener-mode=off /artifact_top/alloy-gem5/configs/brg/sc3.py --msg-size PUT_NT:64 --cpu-type TimingSimpleCPU --link-latency 20 --CG_link_latency 150 --garnet-deadlock-threshold 100000 --l2_size 16384kB --l2_assoc 8 --num-dirs 8 --brg-fast-forward --num-cpus 64 --network garnet2.0 --buffer-size 0 --mem-size 16GB --ruby --l1d_size 64kB --mem-type SimpleMemory --num-l1-cache-ports 8 --num-l2caches 8 --ports 16 --l1i_size 64kB --topology TwoMeshXY -c /artifact_top/alloy-apps/build-applrts_sc3/run_alltoall -o "-w 0 -r 1 -n 8 -c 8 -t 8 -f 2560 -s 8 -v 0" --vcs-per-vnet 64 --buffers-per-data-vc 65536 --buffers-per-ctrl-vc 1024 > logs/log131.txt &
 nohup /artifact_top/alloy-gem5/build/RISCV_MESI/gem5.opt --stats-file=stats132.txt --debug-flags=DOMEM,DOACC --listener-mode=off /artifact_top/alloy-gem5/configs/brg/sc3.py --cpu-type TimingSimpleCPU --link-latency 20 --CG_link_latency 150 --garnet-deadlock-threshold 100000 --l2_size 16384kB --l2_assoc 8 --num-dirs 8 --brg-fast-forward --num-cpus 64 --network garnet2.0 --buffer-size 0 --mem-size 16GB --ruby --l1d_size 64kB --mem-type SimpleMemory --num-l1-cache-ports 8 --num-l2caches 8 --ports 16 --l1i_size 64kB --topology TwoMeshXY -c /artifact_top/alloy-apps/build-applrts_sc3/run_alltoall -o "-w 0 -r 1 -n 8 -c 8 -t 8 -f 2560 -s 8 -v 0" --vcs-per-vnet 64 --buffers-per-data-vc 65536 --buffers-per-ctrl-vc 1024 > logs/log132.txt &
-nohup /artifact_top/alloy-gem5/build/RISCV_MP_64B/gem5.opt --stats-file=stats133.txt --debug-flags=DOMEM,DOACC --listener-mode=off /artifact_top/alloy-gem5/configs/brg/sc3.py --cpu-type TimingSimpleCPU --link-latency 20 --CG_link_latency 150 --garnet-deadlock-threshold 100000 --l2_size 16384kB --l2_assoc 8 --num-dirs 8 --brg-fast-forward --num-cpus 64 --network garnet2.0 --buffer-size 0 --mem-size 16GB --ruby --l1d_size 64kB --mem-type SimpleMemory --num-l1-cache-ports 8 --num-l2caches 8 --ports 16 --l1i_size 64kB --topology TwoMeshXY -c /artifact_top/alloy-apps/build-applrts_sc3/run_alltoall -o "-w 0 -r 1 -n 8 -c 8 -t 8 -f 2560 -s 8 -v 0" --vcs-per-vnet 64 --buffers-per-data-vc 65536 --buffers-per-ctrl-vc 1024 > logs/log133.txt &
+nohup /artifact_top/alloy-gem5/build/RISCV_MP/gem5.opt --stats-file=stats133.txt --debug-flags=DOMEM,DOACC --listener-mode=off /artifact_top/alloy-gem5/configs/brg/sc3.py --msg-size PUT_NT:64 --cpu-type TimingSimpleCPU --link-latency 20 --CG_link_latency 150 --garnet-deadlock-threshold 100000 --l2_size 16384kB --l2_assoc 8 --num-dirs 8 --brg-fast-forward --num-cpus 64 --network garnet2.0 --buffer-size 0 --mem-size 16GB --ruby --l1d_size 64kB --mem-type SimpleMemory --num-l1-cache-ports 8 --num-l2caches 8 --ports 16 --l1i_size 64kB --topology TwoMeshXY -c /artifact_top/alloy-apps/build-applrts_sc3/run_alltoall -o "-w 0 -r 1 -n 8 -c 8 -t 8 -f 2560 -s 8 -v 0" --vcs-per-vnet 64 --buffers-per-data-vc 65536 --buffers-per-ctrl-vc 1024 > logs/log133.txt &
 
 # reduce_256B 134-137
-nohup /artifact_top/alloy-gem5/build/RISCV_DO_MESI_64B/gem5.opt --stats-file=stats134.txt --debug-flags=DOMEM,DOACC --listener-mode=off /artifact_top/alloy-gem5/configs/brg/sc3.py --cpu-type TimingSimpleCPU --link-latency 20 --CG_link_latency 150 --garnet-deadlock-threshold 100000 --l2_size 16384kB --l2_assoc 8 --num-dirs 8 --brg-fast-forward --num-cpus 64 --network garnet2.0 --buffer-size 0 --mem-size 16GB --ruby --l1d_size 64kB --mem-type SimpleMemory --num-l1-cache-ports 8 --num-l2caches 8 --ports 16 --l1i_size 64kB --topology TwoMeshXY -c /artifact_top/alloy-apps/build-applrts_sc3/run_reduce -o "-w 0 -r 2 -n 8 -c 8 -t 4 -f 64 -s 8 -v 0" --vcs-per-vnet 64 --buffers-per-data-vc 65536 --buffers-per-ctrl-vc 1024 > logs/log134.txt &
-nohup /artifact_top/alloy-gem5/build/RISCV_WT_MESI_64B/gem5.opt --stats-file=stats135.txt --debug-flags=DOMEM,DOACC --listener-mode=off /artifact_top/alloy-gem5/configs/brg/sc3.py --cpu-type TimingSimpleCPU --link-latency 20 --CG_link_latency 150 --garnet-deadlock-threshold 100000 --l2_size 16384kB --l2_assoc 8 --num-dirs 8 --brg-fast-forward --num-cpus 64 --network garnet2.0 --buffer-size 0 --mem-size 16GB --ruby --l1d_size 64kB --mem-type SimpleMemory --num-l1-cache-ports 8 --num-l2caches 8 --ports 16 --l1i_size 64kB --topology TwoMeshXY -c /artifact_top/alloy-apps/build-applrts_sc3/run_reduce -o "-w 0 -r 2 -n 8 -c 8 -t 4 -f 64 -s 8 -v 0" --vcs-per-vnet 64 --buffers-per-data-vc 65536 --buffers-per-ctrl-vc 1024 > logs/log135.txt &
+nohup /artifact_top/alloy-gem5/build/RISCV_DO_MESI/gem5.opt --stats-file=stats134.txt --debug-flags=DOMEM,DOACC --listener-mode=off /artifact_top/alloy-gem5/configs/brg/sc3.py --msg-size PUT_NT:64 --cpu-type TimingSimpleCPU --link-latency 20 --CG_link_latency 150 --garnet-deadlock-threshold 100000 --l2_size 16384kB --l2_assoc 8 --num-dirs 8 --brg-fast-forward --num-cpus 64 --network garnet2.0 --buffer-size 0 --mem-size 16GB --ruby --l1d_size 64kB --mem-type SimpleMemory --num-l1-cache-ports 8 --num-l2caches 8 --ports 16 --l1i_size 64kB --topology TwoMeshXY -c /artifact_top/alloy-apps/build-applrts_sc3/run_reduce -o "-w 0 -r 2 -n 8 -c 8 -t 4 -f 64 -s 8 -v 0" --vcs-per-vnet 64 --buffers-per-data-vc 65536 --buffers-per-ctrl-vc 1024 > logs/log134.txt &
+nohup /artifact_top/alloy-gem5/build/RISCV_WT_MESI/gem5.opt --stats-file=stats135.txt --debug-flags=DOMEM,DOACC --listener-mode=off /artifact_top/alloy-gem5/configs/brg/sc3.py --msg-size PUT_NT:64 --cpu-type TimingSimpleCPU --link-latency 20 --CG_link_latency 150 --garnet-deadlock-threshold 100000 --l2_size 16384kB --l2_assoc 8 --num-dirs 8 --brg-fast-forward --num-cpus 64 --network garnet2.0 --buffer-size 0 --mem-size 16GB --ruby --l1d_size 64kB --mem-type SimpleMemory --num-l1-cache-ports 8 --num-l2caches 8 --ports 16 --l1i_size 64kB --topology TwoMeshXY -c /artifact_top/alloy-apps/build-applrts_sc3/run_reduce -o "-w 0 -r 2 -n 8 -c 8 -t 4 -f 64 -s 8 -v 0" --vcs-per-vnet 64 --buffers-per-data-vc 65536 --buffers-per-ctrl-vc 1024 > logs/log135.txt &
 nohup /artifact_top/alloy-gem5/build/RISCV_MESI/gem5.opt --stats-file=stats136.txt --debug-flags=DOMEM,DOACC --listener-mode=off /artifact_top/alloy-gem5/configs/brg/sc3.py --cpu-type TimingSimpleCPU --link-latency 20 --CG_link_latency 150 --garnet-deadlock-threshold 100000 --l2_size 16384kB --l2_assoc 8 --num-dirs 8 --brg-fast-forward --num-cpus 64 --network garnet2.0 --buffer-size 0 --mem-size 16GB --ruby --l1d_size 64kB --mem-type SimpleMemory --num-l1-cache-ports 8 --num-l2caches 8 --ports 16 --l1i_size 64kB --topology TwoMeshXY -c /artifact_top/alloy-apps/build-applrts_sc3/run_reduce -o "-w 0 -r 2 -n 8 -c 8 -t 4 -f 64 -s 8 -v 0" --vcs-per-vnet 64 --buffers-per-data-vc 65536 --buffers-per-ctrl-vc 1024 > logs/log136.txt &
-nohup /artifact_top/alloy-gem5/build/RISCV_MP_64B/gem5.opt --stats-file=stats137.txt --debug-flags=DOMEM,DOACC --listener-mode=off /artifact_top/alloy-gem5/configs/brg/sc3.py --cpu-type TimingSimpleCPU --link-latency 20 --CG_link_latency 150 --garnet-deadlock-threshold 100000 --l2_size 16384kB --l2_assoc 8 --num-dirs 8 --brg-fast-forward --num-cpus 64 --network garnet2.0 --buffer-size 0 --mem-size 16GB --ruby --l1d_size 64kB --mem-type SimpleMemory --num-l1-cache-ports 8 --num-l2caches 8 --ports 16 --l1i_size 64kB --topology TwoMeshXY -c /artifact_top/alloy-apps/build-applrts_sc3/run_reduce -o "-w 0 -r 2 -n 8 -c 8 -t 4 -f 64 -s 8 -v 0" --vcs-per-vnet 64 --buffers-per-data-vc 65536 --buffers-per-ctrl-vc 1024 > logs/log137.txt &
+nohup /artifact_top/alloy-gem5/build/RISCV_MP/gem5.opt --stats-file=stats137.txt --debug-flags=DOMEM,DOACC --listener-mode=off /artifact_top/alloy-gem5/configs/brg/sc3.py --msg-size PUT_NT:64 --cpu-type TimingSimpleCPU --link-latency 20 --CG_link_latency 150 --garnet-deadlock-threshold 100000 --l2_size 16384kB --l2_assoc 8 --num-dirs 8 --brg-fast-forward --num-cpus 64 --network garnet2.0 --buffer-size 0 --mem-size 16GB --ruby --l1d_size 64kB --mem-type SimpleMemory --num-l1-cache-ports 8 --num-l2caches 8 --ports 16 --l1i_size 64kB --topology TwoMeshXY -c /artifact_top/alloy-apps/build-applrts_sc3/run_reduce -o "-w 0 -r 2 -n 8 -c 8 -t 4 -f 64 -s 8 -v 0" --vcs-per-vnet 64 --buffers-per-data-vc 65536 --buffers-per-ctrl-vc 1024 > logs/log137.txt &
 
 # reduce_14KB 138-141
-nohup /artifact_top/alloy-gem5/build/RISCV_DO_MESI_64B/gem5.opt --stats-file=stats138.txt --debug-flags=DOMEM,DOACC --listener-mode=off /artifact_top/alloy-gem5/configs/brg/sc3.py --cpu-type TimingSimpleCPU --link-latency 20 --CG_link_latency 150 --garnet-deadlock-threshold 100000 --l2_size 16384kB --l2_assoc 8 --num-dirs 8 --brg-fast-forward --num-cpus 64 --network garnet2.0 --buffer-size 0 --mem-size 16GB --ruby --l1d_size 64kB --mem-type SimpleMemory --num-l1-cache-ports 8 --num-l2caches 8 --ports 16 --l1i_size 64kB --topology TwoMeshXY -c /artifact_top/alloy-apps/build-applrts_sc3/run_reduce -o "-w 0 -r 2 -n 8 -c 8 -t 8 -f 3584 -s 8 -v 0" --vcs-per-vnet 64 --buffers-per-data-vc 65536 --buffers-per-ctrl-vc 1024 > logs/log138.txt &
-nohup /artifact_top/alloy-gem5/build/RISCV_WT_MESI_64B/gem5.opt --stats-file=stats139.txt --debug-flags=DOMEM,DOACC --listener-mode=off /artifact_top/alloy-gem5/configs/brg/sc3.py --cpu-type TimingSimpleCPU --link-latency 20 --CG_link_latency 150 --garnet-deadlock-threshold 100000 --l2_size 16384kB --l2_assoc 8 --num-dirs 8 --brg-fast-forward --num-cpus 64 --network garnet2.0 --buffer-size 0 --mem-size 16GB --ruby --l1d_size 64kB --mem-type SimpleMemory --num-l1-cache-ports 8 --num-l2caches 8 --ports 16 --l1i_size 64kB --topology TwoMeshXY -c /artifact_top/alloy-apps/build-applrts_sc3/run_reduce -o "-w 0 -r 2 -n 8 -c 8 -t 8 -f 3584 -s 8 -v 0" --vcs-per-vnet 64 --buffers-per-data-vc 65536 --buffers-per-ctrl-vc 1024 > logs/log139.txt &
+nohup /artifact_top/alloy-gem5/build/RISCV_DO_MESI/gem5.opt --stats-file=stats138.txt --debug-flags=DOMEM,DOACC --listener-mode=off /artifact_top/alloy-gem5/configs/brg/sc3.py --msg-size PUT_NT:64 --cpu-type TimingSimpleCPU --link-latency 20 --CG_link_latency 150 --garnet-deadlock-threshold 100000 --l2_size 16384kB --l2_assoc 8 --num-dirs 8 --brg-fast-forward --num-cpus 64 --network garnet2.0 --buffer-size 0 --mem-size 16GB --ruby --l1d_size 64kB --mem-type SimpleMemory --num-l1-cache-ports 8 --num-l2caches 8 --ports 16 --l1i_size 64kB --topology TwoMeshXY -c /artifact_top/alloy-apps/build-applrts_sc3/run_reduce -o "-w 0 -r 2 -n 8 -c 8 -t 8 -f 3584 -s 8 -v 0" --vcs-per-vnet 64 --buffers-per-data-vc 65536 --buffers-per-ctrl-vc 1024 > logs/log138.txt &
+nohup /artifact_top/alloy-gem5/build/RISCV_WT_MESI/gem5.opt --stats-file=stats139.txt --debug-flags=DOMEM,DOACC --listener-mode=off /artifact_top/alloy-gem5/configs/brg/sc3.py --msg-size PUT_NT:64 --cpu-type TimingSimpleCPU --link-latency 20 --CG_link_latency 150 --garnet-deadlock-threshold 100000 --l2_size 16384kB --l2_assoc 8 --num-dirs 8 --brg-fast-forward --num-cpus 64 --network garnet2.0 --buffer-size 0 --mem-size 16GB --ruby --l1d_size 64kB --mem-type SimpleMemory --num-l1-cache-ports 8 --num-l2caches 8 --ports 16 --l1i_size 64kB --topology TwoMeshXY -c /artifact_top/alloy-apps/build-applrts_sc3/run_reduce -o "-w 0 -r 2 -n 8 -c 8 -t 8 -f 3584 -s 8 -v 0" --vcs-per-vnet 64 --buffers-per-data-vc 65536 --buffers-per-ctrl-vc 1024 > logs/log139.txt &
 nohup /artifact_top/alloy-gem5/build/RISCV_MESI/gem5.opt --stats-file=stats140.txt --debug-flags=DOMEM,DOACC --listener-mode=off /artifact_top/alloy-gem5/configs/brg/sc3.py --cpu-type TimingSimpleCPU --link-latency 20 --CG_link_latency 150 --garnet-deadlock-threshold 100000 --l2_size 16384kB --l2_assoc 8 --num-dirs 8 --brg-fast-forward --num-cpus 64 --network garnet2.0 --buffer-size 0 --mem-size 16GB --ruby --l1d_size 64kB --mem-type SimpleMemory --num-l1-cache-ports 8 --num-l2caches 8 --ports 16 --l1i_size 64kB --topology TwoMeshXY -c /artifact_top/alloy-apps/build-applrts_sc3/run_reduce -o "-w 0 -r 2 -n 8 -c 8 -t 8 -f 3584 -s 8 -v 0" --vcs-per-vnet 64 --buffers-per-data-vc 65536 --buffers-per-ctrl-vc 1024 > logs/log140.txt &
-nohup /artifact_top/alloy-gem5/build/RISCV_MP_64B/gem5.opt --stats-file=stats141.txt --debug-flags=DOMEM,DOACC --listener-mode=off /artifact_top/alloy-gem5/configs/brg/sc3.py --cpu-type TimingSimpleCPU --link-latency 20 --CG_link_latency 150 --garnet-deadlock-threshold 100000 --l2_size 16384kB --l2_assoc 8 --num-dirs 8 --brg-fast-forward --num-cpus 64 --network garnet2.0 --buffer-size 0 --mem-size 16GB --ruby --l1d_size 64kB --mem-type SimpleMemory --num-l1-cache-ports 8 --num-l2caches 8 --ports 16 --l1i_size 64kB --topology TwoMeshXY -c /artifact_top/alloy-apps/build-applrts_sc3/run_reduce -o "-w 0 -r 2 -n 8 -c 8 -t 8 -f 3584 -s 8 -v 0" --vcs-per-vnet 64 --buffers-per-data-vc 65536 --buffers-per-ctrl-vc 1024 > logs/log141.txt &
+nohup /artifact_top/alloy-gem5/build/RISCV_MP/gem5.opt --stats-file=stats141.txt --debug-flags=DOMEM,DOACC --listener-mode=off /artifact_top/alloy-gem5/configs/brg/sc3.py --msg-size PUT_NT:64 --cpu-type TimingSimpleCPU --link-latency 20 --CG_link_latency 150 --garnet-deadlock-threshold 100000 --l2_size 16384kB --l2_assoc 8 --num-dirs 8 --brg-fast-forward --num-cpus 64 --network garnet2.0 --buffer-size 0 --mem-size 16GB --ruby --l1d_size 64kB --mem-type SimpleMemory --num-l1-cache-ports 8 --num-l2caches 8 --ports 16 --l1i_size 64kB --topology TwoMeshXY -c /artifact_top/alloy-apps/build-applrts_sc3/run_reduce -o "-w 0 -r 2 -n 8 -c 8 -t 8 -f 3584 -s 8 -v 0" --vcs-per-vnet 64 --buffers-per-data-vc 65536 --buffers-per-ctrl-vc 1024 > logs/log141.txt &
 
 # allreduce_8B 142-145
 nohup /artifact_top/alloy-gem5/build/RISCV_DO_MESI/gem5.opt --stats-file=stats142.txt --debug-flags=DOMEM,DOACC --listener-mode=off /artifact_top/alloy-gem5/configs/brg/sc3.py --cpu-type TimingSimpleCPU --link-latency 20 --CG_link_latency 150 --garnet-deadlock-threshold 100000 --l2_size 16384kB --l2_assoc 8 --num-dirs 8 --brg-fast-forward --num-cpus 64 --network garnet2.0 --buffer-size 0 --mem-size 16GB --ruby --l1d_size 64kB --mem-type SimpleMemory --num-l1-cache-ports 8 --num-l2caches 8 --ports 16 --l1i_size 64kB --topology TwoMeshXY -c /artifact_top/alloy-apps/build-applrts_sc3/run_allreduce -o "-w 0 -r 2 -n 8 -c 8 -t 1 -f 128 -s 1000 -v 0" --vcs-per-vnet 64 --buffers-per-data-vc 65536 --buffers-per-ctrl-vc 1024 > logs/log142.txt &
@@ -80,10 +80,10 @@ nohup /artifact_top/alloy-gem5/build/RISCV_MESI/gem5.opt --stats-file=stats152.t
 nohup /artifact_top/alloy-gem5/build/RISCV_MP/gem5.opt --stats-file=stats153.txt --debug-flags=DOMEM,DOACC --listener-mode=off /artifact_top/alloy-gem5/configs/brg/sc3.py --cpu-type TimingSimpleCPU --link-latency 20 --CG_link_latency 150 --garnet-deadlock-threshold 100000 --l2_size 16384kB --l2_assoc 8 --num-dirs 8 --brg-fast-forward --num-cpus 64 --network garnet2.0 --buffer-size 0 --mem-size 16GB --ruby --l1d_size 64kB --mem-type SimpleMemory --num-l1-cache-ports 8 --num-l2caches 8 --ports 16 --l1i_size 64kB --topology TwoMeshXY -c /artifact_top/alloy-apps/build-applrts_sc3/run_sendrecv -o "-w 0 -r 2 -c 8 -f 16 -s 1000" --vcs-per-vnet 64 --buffers-per-data-vc 65536 --buffers-per-ctrl-vc 1024 > logs/log153.txt &
 
 # sendrecv_512B 154-157
-nohup /artifact_top/alloy-gem5/build/RISCV_DO_MESI_64B/gem5.opt --stats-file=stats154.txt --debug-flags=DOMEM,DOACC --listener-mode=off /artifact_top/alloy-gem5/configs/brg/sc3.py --cpu-type TimingSimpleCPU --link-latency 20 --CG_link_latency 150 --garnet-deadlock-threshold 100000 --l2_size 16384kB --l2_assoc 8 --num-dirs 8 --brg-fast-forward --num-cpus 64 --network garnet2.0 --buffer-size 0 --mem-size 16GB --ruby --l1d_size 64kB --mem-type SimpleMemory --num-l1-cache-ports 8 --num-l2caches 8 --ports 16 --l1i_size 64kB --topology TwoMeshXY -c /artifact_top/alloy-apps/build-applrts_sc3/run_sendrecv -o "-w 0 -r 2 -c 8 -f 128 -s 8" --vcs-per-vnet 64 --buffers-per-data-vc 65536 --buffers-per-ctrl-vc 1024 > logs/log154.txt &
-nohup /artifact_top/alloy-gem5/build/RISCV_WT_MESI_64B/gem5.opt --stats-file=stats155.txt --debug-flags=DOMEM,DOACC --listener-mode=off /artifact_top/alloy-gem5/configs/brg/sc3.py --cpu-type TimingSimpleCPU --link-latency 20 --CG_link_latency 150 --garnet-deadlock-threshold 100000 --l2_size 16384kB --l2_assoc 8 --num-dirs 8 --brg-fast-forward --num-cpus 64 --network garnet2.0 --buffer-size 0 --mem-size 16GB --ruby --l1d_size 64kB --mem-type SimpleMemory --num-l1-cache-ports 8 --num-l2caches 8 --ports 16 --l1i_size 64kB --topology TwoMeshXY -c /artifact_top/alloy-apps/build-applrts_sc3/run_sendrecv -o "-w 0 -r 2 -c 8 -f 128 -s 8" --vcs-per-vnet 64 --buffers-per-data-vc 65536 --buffers-per-ctrl-vc 1024 > logs/log155.txt &
+nohup /artifact_top/alloy-gem5/build/RISCV_DO_MESI/gem5.opt --stats-file=stats154.txt --debug-flags=DOMEM,DOACC --listener-mode=off /artifact_top/alloy-gem5/configs/brg/sc3.py --msg-size PUT_NT:64 --cpu-type TimingSimpleCPU --link-latency 20 --CG_link_latency 150 --garnet-deadlock-threshold 100000 --l2_size 16384kB --l2_assoc 8 --num-dirs 8 --brg-fast-forward --num-cpus 64 --network garnet2.0 --buffer-size 0 --mem-size 16GB --ruby --l1d_size 64kB --mem-type SimpleMemory --num-l1-cache-ports 8 --num-l2caches 8 --ports 16 --l1i_size 64kB --topology TwoMeshXY -c /artifact_top/alloy-apps/build-applrts_sc3/run_sendrecv -o "-w 0 -r 2 -c 8 -f 128 -s 8" --vcs-per-vnet 64 --buffers-per-data-vc 65536 --buffers-per-ctrl-vc 1024 > logs/log154.txt &
+nohup /artifact_top/alloy-gem5/build/RISCV_WT_MESI/gem5.opt --stats-file=stats155.txt --debug-flags=DOMEM,DOACC --listener-mode=off /artifact_top/alloy-gem5/configs/brg/sc3.py --msg-size PUT_NT:64 --cpu-type TimingSimpleCPU --link-latency 20 --CG_link_latency 150 --garnet-deadlock-threshold 100000 --l2_size 16384kB --l2_assoc 8 --num-dirs 8 --brg-fast-forward --num-cpus 64 --network garnet2.0 --buffer-size 0 --mem-size 16GB --ruby --l1d_size 64kB --mem-type SimpleMemory --num-l1-cache-ports 8 --num-l2caches 8 --ports 16 --l1i_size 64kB --topology TwoMeshXY -c /artifact_top/alloy-apps/build-applrts_sc3/run_sendrecv -o "-w 0 -r 2 -c 8 -f 128 -s 8" --vcs-per-vnet 64 --buffers-per-data-vc 65536 --buffers-per-ctrl-vc 1024 > logs/log155.txt &
 nohup /artifact_top/alloy-gem5/build/RISCV_MESI/gem5.opt --stats-file=stats156.txt --debug-flags=DOMEM,DOACC --listener-mode=off /artifact_top/alloy-gem5/configs/brg/sc3.py --cpu-type TimingSimpleCPU --link-latency 20 --CG_link_latency 150 --garnet-deadlock-threshold 100000 --l2_size 16384kB --l2_assoc 8 --num-dirs 8 --brg-fast-forward --num-cpus 64 --network garnet2.0 --buffer-size 0 --mem-size 16GB --ruby --l1d_size 64kB --mem-type SimpleMemory --num-l1-cache-ports 8 --num-l2caches 8 --ports 16 --l1i_size 64kB --topology TwoMeshXY -c /artifact_top/alloy-apps/build-applrts_sc3/run_sendrecv -o "-w 0 -r 2 -c 8 -f 128 -s 8" --vcs-per-vnet 64 --buffers-per-data-vc 65536 --buffers-per-ctrl-vc 1024 > logs/log156.txt &
-nohup /artifact_top/alloy-gem5/build/RISCV_MP_64B/gem5.opt --stats-file=stats157.txt --debug-flags=DOMEM,DOACC --listener-mode=off /artifact_top/alloy-gem5/configs/brg/sc3.py --cpu-type TimingSimpleCPU --link-latency 20 --CG_link_latency 150 --garnet-deadlock-threshold 100000 --l2_size 16384kB --l2_assoc 8 --num-dirs 8 --brg-fast-forward --num-cpus 64 --network garnet2.0 --buffer-size 0 --mem-size 16GB --ruby --l1d_size 64kB --mem-type SimpleMemory --num-l1-cache-ports 8 --num-l2caches 8 --ports 16 --l1i_size 64kB --topology TwoMeshXY -c /artifact_top/alloy-apps/build-applrts_sc3/run_sendrecv -o "-w 0 -r 2 -c 8 -f 128 -s 8" --vcs-per-vnet 64 --buffers-per-data-vc 65536 --buffers-per-ctrl-vc 1024 > logs/log157.txt &
+nohup /artifact_top/alloy-gem5/build/RISCV_MP/gem5.opt --stats-file=stats157.txt --debug-flags=DOMEM,DOACC --listener-mode=off /artifact_top/alloy-gem5/configs/brg/sc3.py --msg-size PUT_NT:64 --cpu-type TimingSimpleCPU --link-latency 20 --CG_link_latency 150 --garnet-deadlock-threshold 100000 --l2_size 16384kB --l2_assoc 8 --num-dirs 8 --brg-fast-forward --num-cpus 64 --network garnet2.0 --buffer-size 0 --mem-size 16GB --ruby --l1d_size 64kB --mem-type SimpleMemory --num-l1-cache-ports 8 --num-l2caches 8 --ports 16 --l1i_size 64kB --topology TwoMeshXY -c /artifact_top/alloy-apps/build-applrts_sc3/run_sendrecv -o "-w 0 -r 2 -c 8 -f 128 -s 8" --vcs-per-vnet 64 --buffers-per-data-vc 65536 --buffers-per-ctrl-vc 1024 > logs/log157.txt &
 
 # barrier 158-161
 nohup /artifact_top/alloy-gem5/build/RISCV_DO_MESI/gem5.opt --stats-file=stats158.txt --debug-flags=DOMEM,DOACC --listener-mode=off /artifact_top/alloy-gem5/configs/brg/sc3.py --cpu-type TimingSimpleCPU --link-latency 20 --CG_link_latency 150 --garnet-deadlock-threshold 100000 --l2_size 16384kB --l2_assoc 8 --num-dirs 8 --brg-fast-forward --num-cpus 64 --network garnet2.0 --buffer-size 0 --mem-size 16GB --ruby --l1d_size 64kB --mem-type SimpleMemory --num-l1-cache-ports 8 --num-l2caches 8 --ports 16 --l1i_size 64kB --topology TwoMeshXY -c /artifact_top/alloy-apps/build-applrts_sc3/run_barrier -o "-w 0 -r 2 -n 8 -c 8 -t 8" --vcs-per-vnet 64 --buffers-per-data-vc 65536 --buffers-per-ctrl-vc 1024 > logs/log158.txt &
@@ -113,34 +113,34 @@ nohup /artifact_top/alloy-gem5/build/RISCV_MP/gem5.opt --stats-file=stats173.txt
 nohup /artifact_top/alloy-gem5/build/RISCV_MP/gem5.opt --stats-file=stats174.txt --debug-flags=DOMEM,DOACC --listener-mode=off /artifact_top/alloy-gem5/configs/brg/sc3.py --cpu-type TimingSimpleCPU --link-latency 20 --CG_link_latency 50 --garnet-deadlock-threshold 100000 --l2_size 16384kB --l2_assoc 8 --num-dirs 8 --brg-fast-forward --num-cpus 64 --network garnet2.0 --buffer-size 0 --mem-size 16GB --ruby --l1d_size 64kB --mem-type SimpleMemory --num-l1-cache-ports 8 --num-l2caches 8 --ports 16 --l1i_size 64kB --topology TwoMeshXY -c /artifact_top/alloy-apps/build-applrts_sc3/PR -o "-w 0 -r 0 -n 8 -c 8 -t 8 -f /artifact_top/DO_gem5/datasets/wing_out.csr" --vcs-per-vnet 64 --buffers-per-data-vc 65536 --buffers-per-ctrl-vc 1024 > logs/log174.txt &
 
 # PAD 175-178
-nohup /artifact_top/alloy-gem5/build/RISCV_DO_MESI_64B/gem5.opt --stats-file=stats175.txt --debug-flags=DOMEM,DOACC --listener-mode=off /artifact_top/alloy-gem5/configs/brg/sc3.py --cpu-type TimingSimpleCPU --link-latency 20 --CG_link_latency 50 --garnet-deadlock-threshold 100000 --l2_size 16384kB --l2_assoc 8 --num-dirs 8 --brg-fast-forward --num-cpus 64 --network garnet2.0 --buffer-size 0 --mem-size 16GB --ruby --l1d_size 64kB --mem-type SimpleMemory --num-l1-cache-ports 8 --num-l2caches 8 --ports 16 --l1i_size 64kB --topology TwoMeshXY -c /artifact_top/alloy-apps/build-applrts_sc3/PAD_RC_UPI -o "-w 0 -r 1 -n 8 -c 8 -t 8 -p 1" --vcs-per-vnet 64 --buffers-per-data-vc 65536 --buffers-per-ctrl-vc 1024 > logs/log175.txt &
-nohup /artifact_top/alloy-gem5/build/RISCV_WT_MESI_64B/gem5.opt --stats-file=stats176.txt --debug-flags=DOMEM,DOACC --listener-mode=off /artifact_top/alloy-gem5/configs/brg/sc3.py --cpu-type TimingSimpleCPU --link-latency 20 --CG_link_latency 50 --garnet-deadlock-threshold 100000 --l2_size 16384kB --l2_assoc 8 --num-dirs 8 --brg-fast-forward --num-cpus 64 --network garnet2.0 --buffer-size 0 --mem-size 16GB --ruby --l1d_size 64kB --mem-type SimpleMemory --num-l1-cache-ports 8 --num-l2caches 8 --ports 16 --l1i_size 64kB --topology TwoMeshXY -c /artifact_top/alloy-apps/build-applrts_sc3/PAD_RC_UPI -o "-w 0 -r 1 -n 8 -c 8 -t 8 -p 1" --vcs-per-vnet 64 --buffers-per-data-vc 65536 --buffers-per-ctrl-vc 1024 > logs/log176.txt &
+nohup /artifact_top/alloy-gem5/build/RISCV_DO_MESI/gem5.opt --stats-file=stats175.txt --debug-flags=DOMEM,DOACC --listener-mode=off /artifact_top/alloy-gem5/configs/brg/sc3.py --msg-size PUT_NT:64 --cpu-type TimingSimpleCPU --link-latency 20 --CG_link_latency 50 --garnet-deadlock-threshold 100000 --l2_size 16384kB --l2_assoc 8 --num-dirs 8 --brg-fast-forward --num-cpus 64 --network garnet2.0 --buffer-size 0 --mem-size 16GB --ruby --l1d_size 64kB --mem-type SimpleMemory --num-l1-cache-ports 8 --num-l2caches 8 --ports 16 --l1i_size 64kB --topology TwoMeshXY -c /artifact_top/alloy-apps/build-applrts_sc3/PAD_RC_UPI -o "-w 0 -r 1 -n 8 -c 8 -t 8 -p 1" --vcs-per-vnet 64 --buffers-per-data-vc 65536 --buffers-per-ctrl-vc 1024 > logs/log175.txt &
+nohup /artifact_top/alloy-gem5/build/RISCV_WT_MESI/gem5.opt --stats-file=stats176.txt --debug-flags=DOMEM,DOACC --listener-mode=off /artifact_top/alloy-gem5/configs/brg/sc3.py --msg-size PUT_NT:64 --cpu-type TimingSimpleCPU --link-latency 20 --CG_link_latency 50 --garnet-deadlock-threshold 100000 --l2_size 16384kB --l2_assoc 8 --num-dirs 8 --brg-fast-forward --num-cpus 64 --network garnet2.0 --buffer-size 0 --mem-size 16GB --ruby --l1d_size 64kB --mem-type SimpleMemory --num-l1-cache-ports 8 --num-l2caches 8 --ports 16 --l1i_size 64kB --topology TwoMeshXY -c /artifact_top/alloy-apps/build-applrts_sc3/PAD_RC_UPI -o "-w 0 -r 1 -n 8 -c 8 -t 8 -p 1" --vcs-per-vnet 64 --buffers-per-data-vc 65536 --buffers-per-ctrl-vc 1024 > logs/log176.txt &
 nohup /artifact_top/alloy-gem5/build/RISCV_MESI/gem5.opt --stats-file=stats177.txt --debug-flags=DOMEM,DOACC --listener-mode=off /artifact_top/alloy-gem5/configs/brg/sc3.py --cpu-type TimingSimpleCPU --link-latency 20 --CG_link_latency 50 --garnet-deadlock-threshold 100000 --l2_size 16384kB --l2_assoc 8 --num-dirs 8 --brg-fast-forward --num-cpus 64 --network garnet2.0 --buffer-size 0 --mem-size 16GB --ruby --l1d_size 64kB --mem-type SimpleMemory --num-l1-cache-ports 8 --num-l2caches 8 --ports 16 --l1i_size 64kB --topology TwoMeshXY -c /artifact_top/alloy-apps/build-applrts_sc3/PAD_RC_UPI -o "-w 0 -r 1 -n 8 -c 8 -t 8 -p 1" --vcs-per-vnet 64 --buffers-per-data-vc 65536 --buffers-per-ctrl-vc 1024 > logs/log177.txt &
-nohup /artifact_top/alloy-gem5/build/RISCV_MP_64B/gem5.opt --stats-file=stats178.txt --debug-flags=DOMEM,DOACC --listener-mode=off /artifact_top/alloy-gem5/configs/brg/sc3.py --cpu-type TimingSimpleCPU --link-latency 20 --CG_link_latency 50 --garnet-deadlock-threshold 100000 --l2_size 16384kB --l2_assoc 8 --num-dirs 8 --brg-fast-forward --num-cpus 64 --network garnet2.0 --buffer-size 0 --mem-size 16GB --ruby --l1d_size 64kB --mem-type SimpleMemory --num-l1-cache-ports 8 --num-l2caches 8 --ports 16 --l1i_size 64kB --topology TwoMeshXY -c /artifact_top/alloy-apps/build-applrts_sc3/PAD_RC_UPI -o "-w 0 -r 1 -n 8 -c 8 -t 8 -p 1" --vcs-per-vnet 64 --buffers-per-data-vc 65536 --buffers-per-ctrl-vc 1024 > logs/log178.txt &
+nohup /artifact_top/alloy-gem5/build/RISCV_MP/gem5.opt --stats-file=stats178.txt --debug-flags=DOMEM,DOACC --listener-mode=off /artifact_top/alloy-gem5/configs/brg/sc3.py --msg-size PUT_NT:64 --cpu-type TimingSimpleCPU --link-latency 20 --CG_link_latency 50 --garnet-deadlock-threshold 100000 --l2_size 16384kB --l2_assoc 8 --num-dirs 8 --brg-fast-forward --num-cpus 64 --network garnet2.0 --buffer-size 0 --mem-size 16GB --ruby --l1d_size 64kB --mem-type SimpleMemory --num-l1-cache-ports 8 --num-l2caches 8 --ports 16 --l1i_size 64kB --topology TwoMeshXY -c /artifact_top/alloy-apps/build-applrts_sc3/PAD_RC_UPI -o "-w 0 -r 1 -n 8 -c 8 -t 8 -p 1" --vcs-per-vnet 64 --buffers-per-data-vc 65536 --buffers-per-ctrl-vc 1024 > logs/log178.txt &
 
 # TQH 179-182 SO traffic is buggy, need special handling
-nohup /artifact_top/alloy-gem5/build/RISCV_DO_MESI_64B/gem5.opt --stats-file=stats179.txt --debug-flags=DOMEM,DOACC --listener-mode=off /artifact_top/alloy-gem5/configs/brg/sc3.py --cpu-type TimingSimpleCPU --link-latency 20 --CG_link_latency 50 --garnet-deadlock-threshold 100000 --l2_size 16384kB --l2_assoc 8 --num-dirs 8 --brg-fast-forward --num-cpus 64 --network garnet2.0 --buffer-size 0 --mem-size 16GB --ruby --l1d_size 64kB --mem-type SimpleMemory --num-l1-cache-ports 8 --num-l2caches 8 --ports 16 --l1i_size 64kB --topology TwoMeshXY -c /artifact_top/alloy-apps/build-applrts_sc3/TQH -o "-w 0 -r 2 -n 8 -c 8 -t 8 -p 32 -f /artifact_top/DO_gem5/datasets/basket" --vcs-per-vnet 64 --buffers-per-data-vc 65536 --buffers-per-ctrl-vc 1024 > logs/log179.txt &
-nohup /artifact_top/alloy-gem5/build/RISCV_WT_MESI_64B/gem5.opt --stats-file=stats180.txt --debug-flags=DOMEM,DOACC --listener-mode=off /artifact_top/alloy-gem5/configs/brg/sc3.py --cpu-type TimingSimpleCPU --link-latency 20 --CG_link_latency 50 --garnet-deadlock-threshold 100000 --l2_size 16384kB --l2_assoc 8 --num-dirs 8 --brg-fast-forward --num-cpus 64 --network garnet2.0 --buffer-size 0 --mem-size 16GB --ruby --l1d_size 64kB --mem-type SimpleMemory --num-l1-cache-ports 8 --num-l2caches 8 --ports 16 --l1i_size 64kB --topology TwoMeshXY -c /artifact_top/alloy-apps/build-applrts_sc3/TQH -o "-w 0 -r 2 -n 8 -c 8 -t 8 -p 32 -f /artifact_top/DO_gem5/datasets/basket" --vcs-per-vnet 64 --buffers-per-data-vc 65536 --buffers-per-ctrl-vc 1024 > logs/log180.txt &
+nohup /artifact_top/alloy-gem5/build/RISCV_DO_MESI/gem5.opt --stats-file=stats179.txt --debug-flags=DOMEM,DOACC --listener-mode=off /artifact_top/alloy-gem5/configs/brg/sc3.py --msg-size PUT_NT:64 --cpu-type TimingSimpleCPU --link-latency 20 --CG_link_latency 50 --garnet-deadlock-threshold 100000 --l2_size 16384kB --l2_assoc 8 --num-dirs 8 --brg-fast-forward --num-cpus 64 --network garnet2.0 --buffer-size 0 --mem-size 16GB --ruby --l1d_size 64kB --mem-type SimpleMemory --num-l1-cache-ports 8 --num-l2caches 8 --ports 16 --l1i_size 64kB --topology TwoMeshXY -c /artifact_top/alloy-apps/build-applrts_sc3/TQH -o "-w 0 -r 2 -n 8 -c 8 -t 8 -p 32 -f /artifact_top/DO_gem5/datasets/basket" --vcs-per-vnet 64 --buffers-per-data-vc 65536 --buffers-per-ctrl-vc 1024 > logs/log179.txt &
+nohup /artifact_top/alloy-gem5/build/RISCV_WT_MESI/gem5.opt --stats-file=stats180.txt --debug-flags=DOMEM,DOACC --listener-mode=off /artifact_top/alloy-gem5/configs/brg/sc3.py --msg-size PUT_NT:64 --cpu-type TimingSimpleCPU --link-latency 20 --CG_link_latency 50 --garnet-deadlock-threshold 100000 --l2_size 16384kB --l2_assoc 8 --num-dirs 8 --brg-fast-forward --num-cpus 64 --network garnet2.0 --buffer-size 0 --mem-size 16GB --ruby --l1d_size 64kB --mem-type SimpleMemory --num-l1-cache-ports 8 --num-l2caches 8 --ports 16 --l1i_size 64kB --topology TwoMeshXY -c /artifact_top/alloy-apps/build-applrts_sc3/TQH -o "-w 0 -r 2 -n 8 -c 8 -t 8 -p 32 -f /artifact_top/DO_gem5/datasets/basket" --vcs-per-vnet 64 --buffers-per-data-vc 65536 --buffers-per-ctrl-vc 1024 > logs/log180.txt &
 nohup /artifact_top/alloy-gem5/build/RISCV_MESI/gem5.opt --stats-file=stats181.txt --debug-flags=DOMEM,DOACC --listener-mode=off /artifact_top/alloy-gem5/configs/brg/sc3.py --cpu-type TimingSimpleCPU --link-latency 20 --CG_link_latency 50 --garnet-deadlock-threshold 100000 --l2_size 16384kB --l2_assoc 8 --num-dirs 8 --brg-fast-forward --num-cpus 64 --network garnet2.0 --buffer-size 0 --mem-size 16GB --ruby --l1d_size 64kB --mem-type SimpleMemory --num-l1-cache-ports 8 --num-l2caches 8 --ports 16 --l1i_size 64kB --topology TwoMeshXY -c /artifact_top/alloy-apps/build-applrts_sc3/TQH -o "-w 0 -r 2 -n 8 -c 8 -t 8 -p 32 -f /artifact_top/DO_gem5/datasets/basket" --vcs-per-vnet 64 --buffers-per-data-vc 65536 --buffers-per-ctrl-vc 1024 > logs/log181.txt &
-nohup /artifact_top/alloy-gem5/build/RISCV_MP_64B/gem5.opt --stats-file=stats182.txt --debug-flags=DOMEM,DOACC --listener-mode=off /artifact_top/alloy-gem5/configs/brg/sc3.py --cpu-type TimingSimpleCPU --link-latency 20 --CG_link_latency 50 --garnet-deadlock-threshold 100000 --l2_size 16384kB --l2_assoc 8 --num-dirs 8 --brg-fast-forward --num-cpus 64 --network garnet2.0 --buffer-size 0 --mem-size 16GB --ruby --l1d_size 64kB --mem-type SimpleMemory --num-l1-cache-ports 8 --num-l2caches 8 --ports 16 --l1i_size 64kB --topology TwoMeshXY -c /artifact_top/alloy-apps/build-applrts_sc3/TQH -o "-w 0 -r 2 -n 8 -c 8 -t 8 -p 32 -f /artifact_top/DO_gem5/datasets/basket" --vcs-per-vnet 64 --buffers-per-data-vc 65536 --buffers-per-ctrl-vc 1024 > logs/log182.txt &
+nohup /artifact_top/alloy-gem5/build/RISCV_MP/gem5.opt --stats-file=stats182.txt --debug-flags=DOMEM,DOACC --listener-mode=off /artifact_top/alloy-gem5/configs/brg/sc3.py --msg-size PUT_NT:64 --cpu-type TimingSimpleCPU --link-latency 20 --CG_link_latency 50 --garnet-deadlock-threshold 100000 --l2_size 16384kB --l2_assoc 8 --num-dirs 8 --brg-fast-forward --num-cpus 64 --network garnet2.0 --buffer-size 0 --mem-size 16GB --ruby --l1d_size 64kB --mem-type SimpleMemory --num-l1-cache-ports 8 --num-l2caches 8 --ports 16 --l1i_size 64kB --topology TwoMeshXY -c /artifact_top/alloy-apps/build-applrts_sc3/TQH -o "-w 0 -r 2 -n 8 -c 8 -t 8 -p 32 -f /artifact_top/DO_gem5/datasets/basket" --vcs-per-vnet 64 --buffers-per-data-vc 65536 --buffers-per-ctrl-vc 1024 > logs/log182.txt &
 
 # alltoall_10KB 183-186
-nohup /artifact_top/alloy-gem5/build/RISCV_DO_MESI_64B/gem5.opt --stats-file=stats183.txt --debug-flags=DOMEM,DOACC --listener-mode=off /artifact_top/alloy-gem5/configs/brg/sc3.py --cpu-type TimingSimpleCPU --link-latency 20 --CG_link_latency 50 --garnet-deadlock-threshold 100000 --l2_size 16384kB --l2_assoc 8 --num-dirs 8 --brg-fast-forward --num-cpus 64 --network garnet2.0 --buffer-size 0 --mem-size 16GB --ruby --l1d_size 64kB --mem-type SimpleMemory --num-l1-cache-ports 8 --num-l2caches 8 --ports 16 --l1i_size 64kB --topology TwoMeshXY -c /artifact_top/alloy-apps/build-applrts_sc3/run_alltoall -o "-w 0 -r 1 -n 8 -c 8 -t 8 -f 2560 -s 8 -v 0" --vcs-per-vnet 64 --buffers-per-data-vc 65536 --buffers-per-ctrl-vc 1024 > logs/log183.txt &
-nohup /artifact_top/alloy-gem5/build/RISCV_WT_MESI_64B/gem5.opt --stats-file=stats184.txt --debug-flags=DOMEM,DOACC --listener-mode=off /artifact_top/alloy-gem5/configs/brg/sc3.py --cpu-type TimingSimpleCPU --link-latency 20 --CG_link_latency 50 --garnet-deadlock-threshold 100000 --l2_size 16384kB --l2_assoc 8 --num-dirs 8 --brg-fast-forward --num-cpus 64 --network garnet2.0 --buffer-size 0 --mem-size 16GB --ruby --l1d_size 64kB --mem-type SimpleMemory --num-l1-cache-ports 8 --num-l2caches 8 --ports 16 --l1i_size 64kB --topology TwoMeshXY -c /artifact_top/alloy-apps/build-applrts_sc3/run_alltoall -o "-w 0 -r 1 -n 8 -c 8 -t 8 -f 2560 -s 8 -v 0" --vcs-per-vnet 64 --buffers-per-data-vc 65536 --buffers-per-ctrl-vc 1024 > logs/log184.txt &
+nohup /artifact_top/alloy-gem5/build/RISCV_DO_MESI/gem5.opt --stats-file=stats183.txt --debug-flags=DOMEM,DOACC --listener-mode=off /artifact_top/alloy-gem5/configs/brg/sc3.py --msg-size PUT_NT:64 --cpu-type TimingSimpleCPU --link-latency 20 --CG_link_latency 50 --garnet-deadlock-threshold 100000 --l2_size 16384kB --l2_assoc 8 --num-dirs 8 --brg-fast-forward --num-cpus 64 --network garnet2.0 --buffer-size 0 --mem-size 16GB --ruby --l1d_size 64kB --mem-type SimpleMemory --num-l1-cache-ports 8 --num-l2caches 8 --ports 16 --l1i_size 64kB --topology TwoMeshXY -c /artifact_top/alloy-apps/build-applrts_sc3/run_alltoall -o "-w 0 -r 1 -n 8 -c 8 -t 8 -f 2560 -s 8 -v 0" --vcs-per-vnet 64 --buffers-per-data-vc 65536 --buffers-per-ctrl-vc 1024 > logs/log183.txt &
+nohup /artifact_top/alloy-gem5/build/RISCV_WT_MESI/gem5.opt --stats-file=stats184.txt --debug-flags=DOMEM,DOACC --listener-mode=off /artifact_top/alloy-gem5/configs/brg/sc3.py --msg-size PUT_NT:64 --cpu-type TimingSimpleCPU --link-latency 20 --CG_link_latency 50 --garnet-deadlock-threshold 100000 --l2_size 16384kB --l2_assoc 8 --num-dirs 8 --brg-fast-forward --num-cpus 64 --network garnet2.0 --buffer-size 0 --mem-size 16GB --ruby --l1d_size 64kB --mem-type SimpleMemory --num-l1-cache-ports 8 --num-l2caches 8 --ports 16 --l1i_size 64kB --topology TwoMeshXY -c /artifact_top/alloy-apps/build-applrts_sc3/run_alltoall -o "-w 0 -r 1 -n 8 -c 8 -t 8 -f 2560 -s 8 -v 0" --vcs-per-vnet 64 --buffers-per-data-vc 65536 --buffers-per-ctrl-vc 1024 > logs/log184.txt &
 nohup /artifact_top/alloy-gem5/build/RISCV_MESI/gem5.opt --stats-file=stats185.txt --debug-flags=DOMEM,DOACC --listener-mode=off /artifact_top/alloy-gem5/configs/brg/sc3.py --cpu-type TimingSimpleCPU --link-latency 20 --CG_link_latency 50 --garnet-deadlock-threshold 100000 --l2_size 16384kB --l2_assoc 8 --num-dirs 8 --brg-fast-forward --num-cpus 64 --network garnet2.0 --buffer-size 0 --mem-size 16GB --ruby --l1d_size 64kB --mem-type SimpleMemory --num-l1-cache-ports 8 --num-l2caches 8 --ports 16 --l1i_size 64kB --topology TwoMeshXY -c /artifact_top/alloy-apps/build-applrts_sc3/run_alltoall -o "-w 0 -r 1 -n 8 -c 8 -t 8 -f 2560 -s 8 -v 0" --vcs-per-vnet 64 --buffers-per-data-vc 65536 --buffers-per-ctrl-vc 1024 > logs/log185.txt &
-nohup /artifact_top/alloy-gem5/build/RISCV_MP_64B/gem5.opt --stats-file=stats186.txt --debug-flags=DOMEM,DOACC --listener-mode=off /artifact_top/alloy-gem5/configs/brg/sc3.py --cpu-type TimingSimpleCPU --link-latency 20 --CG_link_latency 50 --garnet-deadlock-threshold 100000 --l2_size 16384kB --l2_assoc 8 --num-dirs 8 --brg-fast-forward --num-cpus 64 --network garnet2.0 --buffer-size 0 --mem-size 16GB --ruby --l1d_size 64kB --mem-type SimpleMemory --num-l1-cache-ports 8 --num-l2caches 8 --ports 16 --l1i_size 64kB --topology TwoMeshXY -c /artifact_top/alloy-apps/build-applrts_sc3/run_alltoall -o "-w 0 -r 1 -n 8 -c 8 -t 8 -f 2560 -s 8 -v 0" --vcs-per-vnet 64 --buffers-per-data-vc 65536 --buffers-per-ctrl-vc 1024 > logs/log186.txt &
+nohup /artifact_top/alloy-gem5/build/RISCV_MP/gem5.opt --stats-file=stats186.txt --debug-flags=DOMEM,DOACC --listener-mode=off /artifact_top/alloy-gem5/configs/brg/sc3.py --msg-size PUT_NT:64 --cpu-type TimingSimpleCPU --link-latency 20 --CG_link_latency 50 --garnet-deadlock-threshold 100000 --l2_size 16384kB --l2_assoc 8 --num-dirs 8 --brg-fast-forward --num-cpus 64 --network garnet2.0 --buffer-size 0 --mem-size 16GB --ruby --l1d_size 64kB --mem-type SimpleMemory --num-l1-cache-ports 8 --num-l2caches 8 --ports 16 --l1i_size 64kB --topology TwoMeshXY -c /artifact_top/alloy-apps/build-applrts_sc3/run_alltoall -o "-w 0 -r 1 -n 8 -c 8 -t 8 -f 2560 -s 8 -v 0" --vcs-per-vnet 64 --buffers-per-data-vc 65536 --buffers-per-ctrl-vc 1024 > logs/log186.txt &
 
 # reduce_256B 187-190
-nohup /artifact_top/alloy-gem5/build/RISCV_DO_MESI_64B/gem5.opt --stats-file=stats187.txt --debug-flags=DOMEM,DOACC --listener-mode=off /artifact_top/alloy-gem5/configs/brg/sc3.py --cpu-type TimingSimpleCPU --link-latency 20 --CG_link_latency 50 --garnet-deadlock-threshold 100000 --l2_size 16384kB --l2_assoc 8 --num-dirs 8 --brg-fast-forward --num-cpus 64 --network garnet2.0 --buffer-size 0 --mem-size 16GB --ruby --l1d_size 64kB --mem-type SimpleMemory --num-l1-cache-ports 8 --num-l2caches 8 --ports 16 --l1i_size 64kB --topology TwoMeshXY -c /artifact_top/alloy-apps/build-applrts_sc3/run_reduce -o "-w 0 -r 2 -n 8 -c 8 -t 4 -f 64 -s 8 -v 0" --vcs-per-vnet 64 --buffers-per-data-vc 65536 --buffers-per-ctrl-vc 1024 > logs/log187.txt &
-nohup /artifact_top/alloy-gem5/build/RISCV_WT_MESI_64B/gem5.opt --stats-file=stats188.txt --debug-flags=DOMEM,DOACC --listener-mode=off /artifact_top/alloy-gem5/configs/brg/sc3.py --cpu-type TimingSimpleCPU --link-latency 20 --CG_link_latency 50 --garnet-deadlock-threshold 100000 --l2_size 16384kB --l2_assoc 8 --num-dirs 8 --brg-fast-forward --num-cpus 64 --network garnet2.0 --buffer-size 0 --mem-size 16GB --ruby --l1d_size 64kB --mem-type SimpleMemory --num-l1-cache-ports 8 --num-l2caches 8 --ports 16 --l1i_size 64kB --topology TwoMeshXY -c /artifact_top/alloy-apps/build-applrts_sc3/run_reduce -o "-w 0 -r 2 -n 8 -c 8 -t 4 -f 64 -s 8 -v 0" --vcs-per-vnet 64 --buffers-per-data-vc 65536 --buffers-per-ctrl-vc 1024 > logs/log188.txt &
+nohup /artifact_top/alloy-gem5/build/RISCV_DO_MESI/gem5.opt --stats-file=stats187.txt --debug-flags=DOMEM,DOACC --listener-mode=off /artifact_top/alloy-gem5/configs/brg/sc3.py --msg-size PUT_NT:64 --cpu-type TimingSimpleCPU --link-latency 20 --CG_link_latency 50 --garnet-deadlock-threshold 100000 --l2_size 16384kB --l2_assoc 8 --num-dirs 8 --brg-fast-forward --num-cpus 64 --network garnet2.0 --buffer-size 0 --mem-size 16GB --ruby --l1d_size 64kB --mem-type SimpleMemory --num-l1-cache-ports 8 --num-l2caches 8 --ports 16 --l1i_size 64kB --topology TwoMeshXY -c /artifact_top/alloy-apps/build-applrts_sc3/run_reduce -o "-w 0 -r 2 -n 8 -c 8 -t 4 -f 64 -s 8 -v 0" --vcs-per-vnet 64 --buffers-per-data-vc 65536 --buffers-per-ctrl-vc 1024 > logs/log187.txt &
+nohup /artifact_top/alloy-gem5/build/RISCV_WT_MESI/gem5.opt --stats-file=stats188.txt --debug-flags=DOMEM,DOACC --listener-mode=off /artifact_top/alloy-gem5/configs/brg/sc3.py --msg-size PUT_NT:64 --cpu-type TimingSimpleCPU --link-latency 20 --CG_link_latency 50 --garnet-deadlock-threshold 100000 --l2_size 16384kB --l2_assoc 8 --num-dirs 8 --brg-fast-forward --num-cpus 64 --network garnet2.0 --buffer-size 0 --mem-size 16GB --ruby --l1d_size 64kB --mem-type SimpleMemory --num-l1-cache-ports 8 --num-l2caches 8 --ports 16 --l1i_size 64kB --topology TwoMeshXY -c /artifact_top/alloy-apps/build-applrts_sc3/run_reduce -o "-w 0 -r 2 -n 8 -c 8 -t 4 -f 64 -s 8 -v 0" --vcs-per-vnet 64 --buffers-per-data-vc 65536 --buffers-per-ctrl-vc 1024 > logs/log188.txt &
 nohup /artifact_top/alloy-gem5/build/RISCV_MESI/gem5.opt --stats-file=stats189.txt --debug-flags=DOMEM,DOACC --listener-mode=off /artifact_top/alloy-gem5/configs/brg/sc3.py --cpu-type TimingSimpleCPU --link-latency 20 --CG_link_latency 50 --garnet-deadlock-threshold 100000 --l2_size 16384kB --l2_assoc 8 --num-dirs 8 --brg-fast-forward --num-cpus 64 --network garnet2.0 --buffer-size 0 --mem-size 16GB --ruby --l1d_size 64kB --mem-type SimpleMemory --num-l1-cache-ports 8 --num-l2caches 8 --ports 16 --l1i_size 64kB --topology TwoMeshXY -c /artifact_top/alloy-apps/build-applrts_sc3/run_reduce -o "-w 0 -r 2 -n 8 -c 8 -t 4 -f 64 -s 8 -v 0" --vcs-per-vnet 64 --buffers-per-data-vc 65536 --buffers-per-ctrl-vc 1024 > logs/log189.txt &
-nohup /artifact_top/alloy-gem5/build/RISCV_MP_64B/gem5.opt --stats-file=stats190.txt --debug-flags=DOMEM,DOACC --listener-mode=off /artifact_top/alloy-gem5/configs/brg/sc3.py --cpu-type TimingSimpleCPU --link-latency 20 --CG_link_latency 50 --garnet-deadlock-threshold 100000 --l2_size 16384kB --l2_assoc 8 --num-dirs 8 --brg-fast-forward --num-cpus 64 --network garnet2.0 --buffer-size 0 --mem-size 16GB --ruby --l1d_size 64kB --mem-type SimpleMemory --num-l1-cache-ports 8 --num-l2caches 8 --ports 16 --l1i_size 64kB --topology TwoMeshXY -c /artifact_top/alloy-apps/build-applrts_sc3/run_reduce -o "-w 0 -r 2 -n 8 -c 8 -t 4 -f 64 -s 8 -v 0" --vcs-per-vnet 64 --buffers-per-data-vc 65536 --buffers-per-ctrl-vc 1024 > logs/log190.txt &
+nohup /artifact_top/alloy-gem5/build/RISCV_MP/gem5.opt --stats-file=stats190.txt --debug-flags=DOMEM,DOACC --listener-mode=off /artifact_top/alloy-gem5/configs/brg/sc3.py --msg-size PUT_NT:64 --cpu-type TimingSimpleCPU --link-latency 20 --CG_link_latency 50 --garnet-deadlock-threshold 100000 --l2_size 16384kB --l2_assoc 8 --num-dirs 8 --brg-fast-forward --num-cpus 64 --network garnet2.0 --buffer-size 0 --mem-size 16GB --ruby --l1d_size 64kB --mem-type SimpleMemory --num-l1-cache-ports 8 --num-l2caches 8 --ports 16 --l1i_size 64kB --topology TwoMeshXY -c /artifact_top/alloy-apps/build-applrts_sc3/run_reduce -o "-w 0 -r 2 -n 8 -c 8 -t 4 -f 64 -s 8 -v 0" --vcs-per-vnet 64 --buffers-per-data-vc 65536 --buffers-per-ctrl-vc 1024 > logs/log190.txt &
 
 # reduce_14KB 191-194
-nohup /artifact_top/alloy-gem5/build/RISCV_DO_MESI_64B/gem5.opt --stats-file=stats191.txt --debug-flags=DOMEM,DOACC --listener-mode=off /artifact_top/alloy-gem5/configs/brg/sc3.py --cpu-type TimingSimpleCPU --link-latency 20 --CG_link_latency 50 --garnet-deadlock-threshold 100000 --l2_size 16384kB --l2_assoc 8 --num-dirs 8 --brg-fast-forward --num-cpus 64 --network garnet2.0 --buffer-size 0 --mem-size 16GB --ruby --l1d_size 64kB --mem-type SimpleMemory --num-l1-cache-ports 8 --num-l2caches 8 --ports 16 --l1i_size 64kB --topology TwoMeshXY -c /artifact_top/alloy-apps/build-applrts_sc3/run_reduce -o "-w 0 -r 2 -n 8 -c 8 -t 8 -f 3584 -s 8 -v 0" --vcs-per-vnet 64 --buffers-per-data-vc 65536 --buffers-per-ctrl-vc 1024 > logs/log191.txt &
-nohup /artifact_top/alloy-gem5/build/RISCV_WT_MESI_64B/gem5.opt --stats-file=stats192.txt --debug-flags=DOMEM,DOACC --listener-mode=off /artifact_top/alloy-gem5/configs/brg/sc3.py --cpu-type TimingSimpleCPU --link-latency 20 --CG_link_latency 50 --garnet-deadlock-threshold 100000 --l2_size 16384kB --l2_assoc 8 --num-dirs 8 --brg-fast-forward --num-cpus 64 --network garnet2.0 --buffer-size 0 --mem-size 16GB --ruby --l1d_size 64kB --mem-type SimpleMemory --num-l1-cache-ports 8 --num-l2caches 8 --ports 16 --l1i_size 64kB --topology TwoMeshXY -c /artifact_top/alloy-apps/build-applrts_sc3/run_reduce -o "-w 0 -r 2 -n 8 -c 8 -t 8 -f 3584 -s 8 -v 0" --vcs-per-vnet 64 --buffers-per-data-vc 65536 --buffers-per-ctrl-vc 1024 > logs/log192.txt &
+nohup /artifact_top/alloy-gem5/build/RISCV_DO_MESI/gem5.opt --stats-file=stats191.txt --debug-flags=DOMEM,DOACC --listener-mode=off /artifact_top/alloy-gem5/configs/brg/sc3.py --msg-size PUT_NT:64 --cpu-type TimingSimpleCPU --link-latency 20 --CG_link_latency 50 --garnet-deadlock-threshold 100000 --l2_size 16384kB --l2_assoc 8 --num-dirs 8 --brg-fast-forward --num-cpus 64 --network garnet2.0 --buffer-size 0 --mem-size 16GB --ruby --l1d_size 64kB --mem-type SimpleMemory --num-l1-cache-ports 8 --num-l2caches 8 --ports 16 --l1i_size 64kB --topology TwoMeshXY -c /artifact_top/alloy-apps/build-applrts_sc3/run_reduce -o "-w 0 -r 2 -n 8 -c 8 -t 8 -f 3584 -s 8 -v 0" --vcs-per-vnet 64 --buffers-per-data-vc 65536 --buffers-per-ctrl-vc 1024 > logs/log191.txt &
+nohup /artifact_top/alloy-gem5/build/RISCV_WT_MESI/gem5.opt --stats-file=stats192.txt --debug-flags=DOMEM,DOACC --listener-mode=off /artifact_top/alloy-gem5/configs/brg/sc3.py --msg-size PUT_NT:64 --cpu-type TimingSimpleCPU --link-latency 20 --CG_link_latency 50 --garnet-deadlock-threshold 100000 --l2_size 16384kB --l2_assoc 8 --num-dirs 8 --brg-fast-forward --num-cpus 64 --network garnet2.0 --buffer-size 0 --mem-size 16GB --ruby --l1d_size 64kB --mem-type SimpleMemory --num-l1-cache-ports 8 --num-l2caches 8 --ports 16 --l1i_size 64kB --topology TwoMeshXY -c /artifact_top/alloy-apps/build-applrts_sc3/run_reduce -o "-w 0 -r 2 -n 8 -c 8 -t 8 -f 3584 -s 8 -v 0" --vcs-per-vnet 64 --buffers-per-data-vc 65536 --buffers-per-ctrl-vc 1024 > logs/log192.txt &
 nohup /artifact_top/alloy-gem5/build/RISCV_MESI/gem5.opt --stats-file=stats193.txt --debug-flags=DOMEM,DOACC --listener-mode=off /artifact_top/alloy-gem5/configs/brg/sc3.py --cpu-type TimingSimpleCPU --link-latency 20 --CG_link_latency 50 --garnet-deadlock-threshold 100000 --l2_size 16384kB --l2_assoc 8 --num-dirs 8 --brg-fast-forward --num-cpus 64 --network garnet2.0 --buffer-size 0 --mem-size 16GB --ruby --l1d_size 64kB --mem-type SimpleMemory --num-l1-cache-ports 8 --num-l2caches 8 --ports 16 --l1i_size 64kB --topology TwoMeshXY -c /artifact_top/alloy-apps/build-applrts_sc3/run_reduce -o "-w 0 -r 2 -n 8 -c 8 -t 8 -f 3584 -s 8 -v 0" --vcs-per-vnet 64 --buffers-per-data-vc 65536 --buffers-per-ctrl-vc 1024 > logs/log193.txt &
-nohup /artifact_top/alloy-gem5/build/RISCV_MP_64B/gem5.opt --stats-file=stats194.txt --debug-flags=DOMEM,DOACC --listener-mode=off /artifact_top/alloy-gem5/configs/brg/sc3.py --cpu-type TimingSimpleCPU --link-latency 20 --CG_link_latency 50 --garnet-deadlock-threshold 100000 --l2_size 16384kB --l2_assoc 8 --num-dirs 8 --brg-fast-forward --num-cpus 64 --network garnet2.0 --buffer-size 0 --mem-size 16GB --ruby --l1d_size 64kB --mem-type SimpleMemory --num-l1-cache-ports 8 --num-l2caches 8 --ports 16 --l1i_size 64kB --topology TwoMeshXY -c /artifact_top/alloy-apps/build-applrts_sc3/run_reduce -o "-w 0 -r 2 -n 8 -c 8 -t 8 -f 3584 -s 8 -v 0" --vcs-per-vnet 64 --buffers-per-data-vc 65536 --buffers-per-ctrl-vc 1024 > logs/log194.txt &
+nohup /artifact_top/alloy-gem5/build/RISCV_MP/gem5.opt --stats-file=stats194.txt --debug-flags=DOMEM,DOACC --listener-mode=off /artifact_top/alloy-gem5/configs/brg/sc3.py --msg-size PUT_NT:64 --cpu-type TimingSimpleCPU --link-latency 20 --CG_link_latency 50 --garnet-deadlock-threshold 100000 --l2_size 16384kB --l2_assoc 8 --num-dirs 8 --brg-fast-forward --num-cpus 64 --network garnet2.0 --buffer-size 0 --mem-size 16GB --ruby --l1d_size 64kB --mem-type SimpleMemory --num-l1-cache-ports 8 --num-l2caches 8 --ports 16 --l1i_size 64kB --topology TwoMeshXY -c /artifact_top/alloy-apps/build-applrts_sc3/run_reduce -o "-w 0 -r 2 -n 8 -c 8 -t 8 -f 3584 -s 8 -v 0" --vcs-per-vnet 64 --buffers-per-data-vc 65536 --buffers-per-ctrl-vc 1024 > logs/log194.txt &
 
 # allreduce_8B 195-198
 nohup /artifact_top/alloy-gem5/build/RISCV_DO_MESI/gem5.opt --stats-file=stats195.txt --debug-flags=DOMEM,DOACC --listener-mode=off /artifact_top/alloy-gem5/configs/brg/sc3.py --cpu-type TimingSimpleCPU --link-latency 20 --CG_link_latency 50 --garnet-deadlock-threshold 100000 --l2_size 16384kB --l2_assoc 8 --num-dirs 8 --brg-fast-forward --num-cpus 64 --network garnet2.0 --buffer-size 0 --mem-size 16GB --ruby --l1d_size 64kB --mem-type SimpleMemory --num-l1-cache-ports 8 --num-l2caches 8 --ports 16 --l1i_size 64kB --topology TwoMeshXY -c /artifact_top/alloy-apps/build-applrts_sc3/run_allreduce -o "-w 0 -r 2 -n 8 -c 8 -t 1 -f 128 -s 1000 -v 0" --vcs-per-vnet 64 --buffers-per-data-vc 65536 --buffers-per-ctrl-vc 1024 > logs/log195.txt &
@@ -161,10 +161,10 @@ nohup /artifact_top/alloy-gem5/build/RISCV_MESI/gem5.opt --stats-file=stats205.t
 nohup /artifact_top/alloy-gem5/build/RISCV_MP/gem5.opt --stats-file=stats206.txt --debug-flags=DOMEM,DOACC --listener-mode=off /artifact_top/alloy-gem5/configs/brg/sc3.py --cpu-type TimingSimpleCPU --link-latency 20 --CG_link_latency 50 --garnet-deadlock-threshold 100000 --l2_size 16384kB --l2_assoc 8 --num-dirs 8 --brg-fast-forward --num-cpus 64 --network garnet2.0 --buffer-size 0 --mem-size 16GB --ruby --l1d_size 64kB --mem-type SimpleMemory --num-l1-cache-ports 8 --num-l2caches 8 --ports 16 --l1i_size 64kB --topology TwoMeshXY -c /artifact_top/alloy-apps/build-applrts_sc3/run_sendrecv -o "-w 0 -r 2 -c 8 -f 16 -s 1000" --vcs-per-vnet 64 --buffers-per-data-vc 65536 --buffers-per-ctrl-vc 1024 > logs/log206.txt &
 
 # sendrecv_512B 207-210
-nohup /artifact_top/alloy-gem5/build/RISCV_DO_MESI_64B/gem5.opt --stats-file=stats207.txt --debug-flags=DOMEM,DOACC --listener-mode=off /artifact_top/alloy-gem5/configs/brg/sc3.py --cpu-type TimingSimpleCPU --link-latency 20 --CG_link_latency 50 --garnet-deadlock-threshold 100000 --l2_size 16384kB --l2_assoc 8 --num-dirs 8 --brg-fast-forward --num-cpus 64 --network garnet2.0 --buffer-size 0 --mem-size 16GB --ruby --l1d_size 64kB --mem-type SimpleMemory --num-l1-cache-ports 8 --num-l2caches 8 --ports 16 --l1i_size 64kB --topology TwoMeshXY -c /artifact_top/alloy-apps/build-applrts_sc3/run_sendrecv -o "-w 0 -r 2 -c 8 -f 128 -s 8" --vcs-per-vnet 64 --buffers-per-data-vc 65536 --buffers-per-ctrl-vc 1024 > logs/log207.txt &
-nohup /artifact_top/alloy-gem5/build/RISCV_WT_MESI_64B/gem5.opt --stats-file=stats208.txt --debug-flags=DOMEM,DOACC --listener-mode=off /artifact_top/alloy-gem5/configs/brg/sc3.py --cpu-type TimingSimpleCPU --link-latency 20 --CG_link_latency 50 --garnet-deadlock-threshold 100000 --l2_size 16384kB --l2_assoc 8 --num-dirs 8 --brg-fast-forward --num-cpus 64 --network garnet2.0 --buffer-size 0 --mem-size 16GB --ruby --l1d_size 64kB --mem-type SimpleMemory --num-l1-cache-ports 8 --num-l2caches 8 --ports 16 --l1i_size 64kB --topology TwoMeshXY -c /artifact_top/alloy-apps/build-applrts_sc3/run_sendrecv -o "-w 0 -r 2 -c 8 -f 128 -s 8" --vcs-per-vnet 64 --buffers-per-data-vc 65536 --buffers-per-ctrl-vc 1024 > logs/log208.txt &
+nohup /artifact_top/alloy-gem5/build/RISCV_DO_MESI/gem5.opt --stats-file=stats207.txt --debug-flags=DOMEM,DOACC --listener-mode=off /artifact_top/alloy-gem5/configs/brg/sc3.py --msg-size PUT_NT:64 --cpu-type TimingSimpleCPU --link-latency 20 --CG_link_latency 50 --garnet-deadlock-threshold 100000 --l2_size 16384kB --l2_assoc 8 --num-dirs 8 --brg-fast-forward --num-cpus 64 --network garnet2.0 --buffer-size 0 --mem-size 16GB --ruby --l1d_size 64kB --mem-type SimpleMemory --num-l1-cache-ports 8 --num-l2caches 8 --ports 16 --l1i_size 64kB --topology TwoMeshXY -c /artifact_top/alloy-apps/build-applrts_sc3/run_sendrecv -o "-w 0 -r 2 -c 8 -f 128 -s 8" --vcs-per-vnet 64 --buffers-per-data-vc 65536 --buffers-per-ctrl-vc 1024 > logs/log207.txt &
+nohup /artifact_top/alloy-gem5/build/RISCV_WT_MESI/gem5.opt --stats-file=stats208.txt --debug-flags=DOMEM,DOACC --listener-mode=off /artifact_top/alloy-gem5/configs/brg/sc3.py --msg-size PUT_NT:64 --cpu-type TimingSimpleCPU --link-latency 20 --CG_link_latency 50 --garnet-deadlock-threshold 100000 --l2_size 16384kB --l2_assoc 8 --num-dirs 8 --brg-fast-forward --num-cpus 64 --network garnet2.0 --buffer-size 0 --mem-size 16GB --ruby --l1d_size 64kB --mem-type SimpleMemory --num-l1-cache-ports 8 --num-l2caches 8 --ports 16 --l1i_size 64kB --topology TwoMeshXY -c /artifact_top/alloy-apps/build-applrts_sc3/run_sendrecv -o "-w 0 -r 2 -c 8 -f 128 -s 8" --vcs-per-vnet 64 --buffers-per-data-vc 65536 --buffers-per-ctrl-vc 1024 > logs/log208.txt &
 nohup /artifact_top/alloy-gem5/build/RISCV_MESI/gem5.opt --stats-file=stats209.txt --debug-flags=DOMEM,DOACC --listener-mode=off /artifact_top/alloy-gem5/configs/brg/sc3.py --cpu-type TimingSimpleCPU --link-latency 20 --CG_link_latency 50 --garnet-deadlock-threshold 100000 --l2_size 16384kB --l2_assoc 8 --num-dirs 8 --brg-fast-forward --num-cpus 64 --network garnet2.0 --buffer-size 0 --mem-size 16GB --ruby --l1d_size 64kB --mem-type SimpleMemory --num-l1-cache-ports 8 --num-l2caches 8 --ports 16 --l1i_size 64kB --topology TwoMeshXY -c /artifact_top/alloy-apps/build-applrts_sc3/run_sendrecv -o "-w 0 -r 2 -c 8 -f 128 -s 8" --vcs-per-vnet 64 --buffers-per-data-vc 65536 --buffers-per-ctrl-vc 1024 > logs/log209.txt &
-nohup /artifact_top/alloy-gem5/build/RISCV_MP_64B/gem5.opt --stats-file=stats210.txt --debug-flags=DOMEM,DOACC --listener-mode=off /artifact_top/alloy-gem5/configs/brg/sc3.py --cpu-type TimingSimpleCPU --link-latency 20 --CG_link_latency 50 --garnet-deadlock-threshold 100000 --l2_size 16384kB --l2_assoc 8 --num-dirs 8 --brg-fast-forward --num-cpus 64 --network garnet2.0 --buffer-size 0 --mem-size 16GB --ruby --l1d_size 64kB --mem-type SimpleMemory --num-l1-cache-ports 8 --num-l2caches 8 --ports 16 --l1i_size 64kB --topology TwoMeshXY -c /artifact_top/alloy-apps/build-applrts_sc3/run_sendrecv -o "-w 0 -r 2 -c 8 -f 128 -s 8" --vcs-per-vnet 64 --buffers-per-data-vc 65536 --buffers-per-ctrl-vc 1024 > logs/log210.txt &
+nohup /artifact_top/alloy-gem5/build/RISCV_MP/gem5.opt --stats-file=stats210.txt --debug-flags=DOMEM,DOACC --listener-mode=off /artifact_top/alloy-gem5/configs/brg/sc3.py --msg-size PUT_NT:64 --cpu-type TimingSimpleCPU --link-latency 20 --CG_link_latency 50 --garnet-deadlock-threshold 100000 --l2_size 16384kB --l2_assoc 8 --num-dirs 8 --brg-fast-forward --num-cpus 64 --network garnet2.0 --buffer-size 0 --mem-size 16GB --ruby --l1d_size 64kB --mem-type SimpleMemory --num-l1-cache-ports 8 --num-l2caches 8 --ports 16 --l1i_size 64kB --topology TwoMeshXY -c /artifact_top/alloy-apps/build-applrts_sc3/run_sendrecv -o "-w 0 -r 2 -c 8 -f 128 -s 8" --vcs-per-vnet 64 --buffers-per-data-vc 65536 --buffers-per-ctrl-vc 1024 > logs/log210.txt &
 
 # barrier 211-214
 nohup /artifact_top/alloy-gem5/build/RISCV_DO_MESI/gem5.opt --stats-file=stats211.txt --debug-flags=DOMEM,DOACC --listener-mode=off /artifact_top/alloy-gem5/configs/brg/sc3.py --cpu-type TimingSimpleCPU --link-latency 20 --CG_link_latency 50 --garnet-deadlock-threshold 100000 --l2_size 16384kB --l2_assoc 8 --num-dirs 8 --brg-fast-forward --num-cpus 64 --network garnet2.0 --buffer-size 0 --mem-size 16GB --ruby --l1d_size 64kB --mem-type SimpleMemory --num-l1-cache-ports 8 --num-l2caches 8 --ports 16 --l1i_size 64kB --topology TwoMeshXY -c /artifact_top/alloy-apps/build-applrts_sc3/run_barrier -o "-w 0 -r 2 -n 8 -c 8 -t 8" --vcs-per-vnet 64 --buffers-per-data-vc 65536 --buffers-per-ctrl-vc 1024 > logs/log211.txt &
@@ -173,16 +173,16 @@ nohup /artifact_top/alloy-gem5/build/RISCV_MESI/gem5.opt --stats-file=stats213.t
 nohup /artifact_top/alloy-gem5/build/RISCV_MP/gem5.opt --stats-file=stats214.txt --debug-flags=DOMEM,DOACC --listener-mode=off /artifact_top/alloy-gem5/configs/brg/sc3.py --cpu-type TimingSimpleCPU --link-latency 20 --CG_link_latency 50 --garnet-deadlock-threshold 100000 --l2_size 16384kB --l2_assoc 8 --num-dirs 8 --brg-fast-forward --num-cpus 64 --network garnet2.0 --buffer-size 0 --mem-size 16GB --ruby --l1d_size 64kB --mem-type SimpleMemory --num-l1-cache-ports 8 --num-l2caches 8 --ports 16 --l1i_size 64kB --topology TwoMeshXY -c /artifact_top/alloy-apps/build-applrts_sc3/run_barrier -o "-w 0 -r 2 -n 8 -c 8 -t 8" --vcs-per-vnet 64 --buffers-per-data-vc 65536 --buffers-per-ctrl-vc 1024 > logs/log214.txt &
 
 # HSTI 215-218 SO traffic is buggy, need special handling
-nohup /artifact_top/alloy-gem5/build/RISCV_DO_MESI_64B/gem5.opt --stats-file=stats215.txt --debug-flags=DOMEM,DOACC --listener-mode=off /artifact_top/alloy-gem5/configs/brg/sc3.py --cpu-type TimingSimpleCPU --link-latency 20 --CG_link_latency 150 --garnet-deadlock-threshold 100000 --l2_size 16384kB --l2_assoc 8 --num-dirs 8 --brg-fast-forward --num-cpus 64 --network garnet2.0 --buffer-size 0 --mem-size 16GB --ruby --l1d_size 64kB --mem-type SimpleMemory --num-l1-cache-ports 8 --num-l2caches 8 --ports 16 --l1i_size 64kB --topology TwoMeshXY -c /artifact_top/alloy-apps/build-applrts_sc3/TQH -o "-w 0 -r 1 -n 8 -c 8 -t 8 -p 32 -f /artifact_top/DO_gem5/datasets/basket" --vcs-per-vnet 64 --buffers-per-data-vc 65536 --buffers-per-ctrl-vc 1024 > logs/log215.txt &
-nohup /artifact_top/alloy-gem5/build/RISCV_WT_MESI_64B/gem5.opt --stats-file=stats216.txt --debug-flags=DOMEM,DOACC --listener-mode=off /artifact_top/alloy-gem5/configs/brg/sc3.py --cpu-type TimingSimpleCPU --link-latency 20 --CG_link_latency 150 --garnet-deadlock-threshold 100000 --l2_size 16384kB --l2_assoc 8 --num-dirs 8 --brg-fast-forward --num-cpus 64 --network garnet2.0 --buffer-size 0 --mem-size 16GB --ruby --l1d_size 64kB --mem-type SimpleMemory --num-l1-cache-ports 8 --num-l2caches 8 --ports 16 --l1i_size 64kB --topology TwoMeshXY -c /artifact_top/alloy-apps/build-applrts_sc3/TQH -o "-w 0 -r 1 -n 8 -c 8 -t 8 -p 32 -f /artifact_top/DO_gem5/datasets/basket" --vcs-per-vnet 64 --buffers-per-data-vc 65536 --buffers-per-ctrl-vc 1024 > logs/log216.txt &
+nohup /artifact_top/alloy-gem5/build/RISCV_DO_MESI/gem5.opt --stats-file=stats215.txt --debug-flags=DOMEM,DOACC --listener-mode=off /artifact_top/alloy-gem5/configs/brg/sc3.py --msg-size PUT_NT:64 --cpu-type TimingSimpleCPU --link-latency 20 --CG_link_latency 150 --garnet-deadlock-threshold 100000 --l2_size 16384kB --l2_assoc 8 --num-dirs 8 --brg-fast-forward --num-cpus 64 --network garnet2.0 --buffer-size 0 --mem-size 16GB --ruby --l1d_size 64kB --mem-type SimpleMemory --num-l1-cache-ports 8 --num-l2caches 8 --ports 16 --l1i_size 64kB --topology TwoMeshXY -c /artifact_top/alloy-apps/build-applrts_sc3/TQH -o "-w 0 -r 1 -n 8 -c 8 -t 8 -p 32 -f /artifact_top/DO_gem5/datasets/basket" --vcs-per-vnet 64 --buffers-per-data-vc 65536 --buffers-per-ctrl-vc 1024 > logs/log215.txt &
+nohup /artifact_top/alloy-gem5/build/RISCV_WT_MESI/gem5.opt --stats-file=stats216.txt --debug-flags=DOMEM,DOACC --listener-mode=off /artifact_top/alloy-gem5/configs/brg/sc3.py --msg-size PUT_NT:64 --cpu-type TimingSimpleCPU --link-latency 20 --CG_link_latency 150 --garnet-deadlock-threshold 100000 --l2_size 16384kB --l2_assoc 8 --num-dirs 8 --brg-fast-forward --num-cpus 64 --network garnet2.0 --buffer-size 0 --mem-size 16GB --ruby --l1d_size 64kB --mem-type SimpleMemory --num-l1-cache-ports 8 --num-l2caches 8 --ports 16 --l1i_size 64kB --topology TwoMeshXY -c /artifact_top/alloy-apps/build-applrts_sc3/TQH -o "-w 0 -r 1 -n 8 -c 8 -t 8 -p 32 -f /artifact_top/DO_gem5/datasets/basket" --vcs-per-vnet 64 --buffers-per-data-vc 65536 --buffers-per-ctrl-vc 1024 > logs/log216.txt &
 nohup /artifact_top/alloy-gem5/build/RISCV_MESI/gem5.opt --stats-file=stats217.txt --debug-flags=DOMEM,DOACC --listener-mode=off /artifact_top/alloy-gem5/configs/brg/sc3.py --cpu-type TimingSimpleCPU --link-latency 20 --CG_link_latency 150 --garnet-deadlock-threshold 100000 --l2_size 16384kB --l2_assoc 8 --num-dirs 8 --brg-fast-forward --num-cpus 64 --network garnet2.0 --buffer-size 0 --mem-size 16GB --ruby --l1d_size 64kB --mem-type SimpleMemory --num-l1-cache-ports 8 --num-l2caches 8 --ports 16 --l1i_size 64kB --topology TwoMeshXY -c /artifact_top/alloy-apps/build-applrts_sc3/TQH -o "-w 0 -r 1 -n 8 -c 8 -t 8 -p 32 -f /artifact_top/DO_gem5/datasets/basket" --vcs-per-vnet 64 --buffers-per-data-vc 65536 --buffers-per-ctrl-vc 1024 > logs/log217.txt &
-nohup /artifact_top/alloy-gem5/build/RISCV_MP_64B/gem5.opt --stats-file=stats218.txt --debug-flags=DOMEM,DOACC --listener-mode=off /artifact_top/alloy-gem5/configs/brg/sc3.py --cpu-type TimingSimpleCPU --link-latency 20 --CG_link_latency 150 --garnet-deadlock-threshold 100000 --l2_size 16384kB --l2_assoc 8 --num-dirs 8 --brg-fast-forward --num-cpus 64 --network garnet2.0 --buffer-size 0 --mem-size 16GB --ruby --l1d_size 64kB --mem-type SimpleMemory --num-l1-cache-ports 8 --num-l2caches 8 --ports 16 --l1i_size 64kB --topology TwoMeshXY -c /artifact_top/alloy-apps/build-applrts_sc3/TQH -o "-w 0 -r 1 -n 8 -c 8 -t 8 -p 32 -f /artifact_top/DO_gem5/datasets/basket" --vcs-per-vnet 64 --buffers-per-data-vc 65536 --buffers-per-ctrl-vc 1024 > logs/log218.txt &
+nohup /artifact_top/alloy-gem5/build/RISCV_MP/gem5.opt --stats-file=stats218.txt --debug-flags=DOMEM,DOACC --listener-mode=off /artifact_top/alloy-gem5/configs/brg/sc3.py --msg-size PUT_NT:64 --cpu-type TimingSimpleCPU --link-latency 20 --CG_link_latency 150 --garnet-deadlock-threshold 100000 --l2_size 16384kB --l2_assoc 8 --num-dirs 8 --brg-fast-forward --num-cpus 64 --network garnet2.0 --buffer-size 0 --mem-size 16GB --ruby --l1d_size 64kB --mem-type SimpleMemory --num-l1-cache-ports 8 --num-l2caches 8 --ports 16 --l1i_size 64kB --topology TwoMeshXY -c /artifact_top/alloy-apps/build-applrts_sc3/TQH -o "-w 0 -r 1 -n 8 -c 8 -t 8 -p 32 -f /artifact_top/DO_gem5/datasets/basket" --vcs-per-vnet 64 --buffers-per-data-vc 65536 --buffers-per-ctrl-vc 1024 > logs/log218.txt &
 
 # HSTI 219-222 SO traffic is buggy, need special handling
-nohup /artifact_top/alloy-gem5/build/RISCV_DO_MESI_64B/gem5.opt --stats-file=stats219.txt --debug-flags=DOMEM,DOACC --listener-mode=off /artifact_top/alloy-gem5/configs/brg/sc3.py --cpu-type TimingSimpleCPU --link-latency 20 --CG_link_latency 50 --garnet-deadlock-threshold 100000 --l2_size 16384kB --l2_assoc 8 --num-dirs 8 --brg-fast-forward --num-cpus 64 --network garnet2.0 --buffer-size 0 --mem-size 16GB --ruby --l1d_size 64kB --mem-type SimpleMemory --num-l1-cache-ports 8 --num-l2caches 8 --ports 16 --l1i_size 64kB --topology TwoMeshXY -c /artifact_top/alloy-apps/build-applrts_sc3/TQH -o "-w 0 -r 1 -n 8 -c 8 -t 8 -p 32 -f /artifact_top/DO_gem5/datasets/basket" --vcs-per-vnet 64 --buffers-per-data-vc 65536 --buffers-per-ctrl-vc 1024 > logs/log219.txt &
-nohup /artifact_top/alloy-gem5/build/RISCV_WT_MESI_64B/gem5.opt --stats-file=stats220.txt --debug-flags=DOMEM,DOACC --listener-mode=off /artifact_top/alloy-gem5/configs/brg/sc3.py --cpu-type TimingSimpleCPU --link-latency 20 --CG_link_latency 50 --garnet-deadlock-threshold 100000 --l2_size 16384kB --l2_assoc 8 --num-dirs 8 --brg-fast-forward --num-cpus 64 --network garnet2.0 --buffer-size 0 --mem-size 16GB --ruby --l1d_size 64kB --mem-type SimpleMemory --num-l1-cache-ports 8 --num-l2caches 8 --ports 16 --l1i_size 64kB --topology TwoMeshXY -c /artifact_top/alloy-apps/build-applrts_sc3/TQH -o "-w 0 -r 1 -n 8 -c 8 -t 8 -p 32 -f /artifact_top/DO_gem5/datasets/basket" --vcs-per-vnet 64 --buffers-per-data-vc 65536 --buffers-per-ctrl-vc 1024 > logs/log220.txt &
+nohup /artifact_top/alloy-gem5/build/RISCV_DO_MESI/gem5.opt --stats-file=stats219.txt --debug-flags=DOMEM,DOACC --listener-mode=off /artifact_top/alloy-gem5/configs/brg/sc3.py --msg-size PUT_NT:64 --cpu-type TimingSimpleCPU --link-latency 20 --CG_link_latency 50 --garnet-deadlock-threshold 100000 --l2_size 16384kB --l2_assoc 8 --num-dirs 8 --brg-fast-forward --num-cpus 64 --network garnet2.0 --buffer-size 0 --mem-size 16GB --ruby --l1d_size 64kB --mem-type SimpleMemory --num-l1-cache-ports 8 --num-l2caches 8 --ports 16 --l1i_size 64kB --topology TwoMeshXY -c /artifact_top/alloy-apps/build-applrts_sc3/TQH -o "-w 0 -r 1 -n 8 -c 8 -t 8 -p 32 -f /artifact_top/DO_gem5/datasets/basket" --vcs-per-vnet 64 --buffers-per-data-vc 65536 --buffers-per-ctrl-vc 1024 > logs/log219.txt &
+nohup /artifact_top/alloy-gem5/build/RISCV_WT_MESI/gem5.opt --stats-file=stats220.txt --debug-flags=DOMEM,DOACC --listener-mode=off /artifact_top/alloy-gem5/configs/brg/sc3.py --msg-size PUT_NT:64 --cpu-type TimingSimpleCPU --link-latency 20 --CG_link_latency 50 --garnet-deadlock-threshold 100000 --l2_size 16384kB --l2_assoc 8 --num-dirs 8 --brg-fast-forward --num-cpus 64 --network garnet2.0 --buffer-size 0 --mem-size 16GB --ruby --l1d_size 64kB --mem-type SimpleMemory --num-l1-cache-ports 8 --num-l2caches 8 --ports 16 --l1i_size 64kB --topology TwoMeshXY -c /artifact_top/alloy-apps/build-applrts_sc3/TQH -o "-w 0 -r 1 -n 8 -c 8 -t 8 -p 32 -f /artifact_top/DO_gem5/datasets/basket" --vcs-per-vnet 64 --buffers-per-data-vc 65536 --buffers-per-ctrl-vc 1024 > logs/log220.txt &
 nohup /artifact_top/alloy-gem5/build/RISCV_MESI/gem5.opt --stats-file=stats221.txt --debug-flags=DOMEM,DOACC --listener-mode=off /artifact_top/alloy-gem5/configs/brg/sc3.py --cpu-type TimingSimpleCPU --link-latency 20 --CG_link_latency 50 --garnet-deadlock-threshold 100000 --l2_size 16384kB --l2_assoc 8 --num-dirs 8 --brg-fast-forward --num-cpus 64 --network garnet2.0 --buffer-size 0 --mem-size 16GB --ruby --l1d_size 64kB --mem-type SimpleMemory --num-l1-cache-ports 8 --num-l2caches 8 --ports 16 --l1i_size 64kB --topology TwoMeshXY -c /artifact_top/alloy-apps/build-applrts_sc3/TQH -o "-w 0 -r 1 -n 8 -c 8 -t 8 -p 32 -f /artifact_top/DO_gem5/datasets/basket" --vcs-per-vnet 64 --buffers-per-data-vc 65536 --buffers-per-ctrl-vc 1024 > logs/log221.txt &
-nohup /artifact_top/alloy-gem5/build/RISCV_MP_64B/gem5.opt --stats-file=stats222.txt --debug-flags=DOMEM,DOACC --listener-mode=off /artifact_top/alloy-gem5/configs/brg/sc3.py --cpu-type TimingSimpleCPU --link-latency 20 --CG_link_latency 50 --garnet-deadlock-threshold 100000 --l2_size 16384kB --l2_assoc 8 --num-dirs 8 --brg-fast-forward --num-cpus 64 --network garnet2.0 --buffer-size 0 --mem-size 16GB --ruby --l1d_size 64kB --mem-type SimpleMemory --num-l1-cache-ports 8 --num-l2caches 8 --ports 16 --l1i_size 64kB --topology TwoMeshXY -c /artifact_top/alloy-apps/build-applrts_sc3/TQH -o "-w 0 -r 1 -n 8 -c 8 -t 8 -p 32 -f /artifact_top/DO_gem5/datasets/basket" --vcs-per-vnet 64 --buffers-per-data-vc 65536 --buffers-per-ctrl-vc 1024 > logs/log222.txt &
+nohup /artifact_top/alloy-gem5/build/RISCV_MP/gem5.opt --stats-file=stats222.txt --debug-flags=DOMEM,DOACC --listener-mode=off /artifact_top/alloy-gem5/configs/brg/sc3.py --msg-size PUT_NT:64 --cpu-type TimingSimpleCPU --link-latency 20 --CG_link_latency 50 --garnet-deadlock-threshold 100000 --l2_size 16384kB --l2_assoc 8 --num-dirs 8 --brg-fast-forward --num-cpus 64 --network garnet2.0 --buffer-size 0 --mem-size 16GB --ruby --l1d_size 64kB --mem-type SimpleMemory --num-l1-cache-ports 8 --num-l2caches 8 --ports 16 --l1i_size 64kB --topology TwoMeshXY -c /artifact_top/alloy-apps/build-applrts_sc3/TQH -o "-w 0 -r 1 -n 8 -c 8 -t 8 -p 32 -f /artifact_top/DO_gem5/datasets/basket" --vcs-per-vnet 64 --buffers-per-data-vc 65536 --buffers-per-ctrl-vc 1024 > logs/log222.txt &
 
 # # PR 223-226
 # nohup /artifact_top/alloy-gem5/build/RISCV_DO_MESI/gem5.opt --stats-file=stats223.txt --debug-flags=DOMEM,DOACC --listener-mode=off /artifact_top/alloy-gem5/configs/brg/sc3.py --cpu-type TimingSimpleCPU --link-latency 20 --CG_link_latency 140 --garnet-deadlock-threshold 100000 --l2_size 16384kB --l2_assoc 8 --num-dirs 8 --brg-fast-forward --num-cpus 64 --network garnet2.0 --buffer-size 0 --mem-size 16GB --ruby --l1d_size 64kB --mem-type SimpleMemory --num-l1-cache-ports 8 --num-l2caches 8 --ports 16 --l1i_size 64kB --topology TwoMeshXY -c /artifact_top/alloy-apps/build-applrts_sc3/BC -o "-w 0 -r 1 -n 8 -c 8 -t 8 -f /artifact_top/DO_gem5/datasets/mark3jac020_out.csr" --vcs-per-vnet 64 --buffers-per-data-vc 65536 --buffers-per-ctrl-vc 1024 > logs/log223.txt &
@@ -197,15 +197,15 @@ nohup /artifact_top/alloy-gem5/build/RISCV_MP_64B/gem5.opt --stats-file=stats222
 # nohup /artifact_top/alloy-gem5/build/RISCV_MP/gem5.opt --stats-file=stats230.txt --debug-flags=DOMEM,DOACC --listener-mode=off /artifact_top/alloy-gem5/configs/brg/sc3.py --cpu-type TimingSimpleCPU --link-latency 20 --CG_link_latency 50 --garnet-deadlock-threshold 100000 --l2_size 16384kB --l2_assoc 8 --num-dirs 8 --brg-fast-forward --num-cpus 64 --network garnet2.0 --buffer-size 0 --mem-size 16GB --ruby --l1d_size 64kB --mem-type SimpleMemory --num-l1-cache-ports 8 --num-l2caches 8 --ports 16 --l1i_size 64kB --topology TwoMeshXY -c /artifact_top/alloy-apps/build-applrts_sc3/BC -o "-w 0 -r 1 -n 8 -c 8 -t 8 -f /artifact_top/DO_gem5/datasets/mark3jac020_out.csr" --vcs-per-vnet 64 --buffers-per-data-vc 65536 --buffers-per-ctrl-vc 1024 > logs/log230.txt &
 
 # TRNS 231-234
-nohup /artifact_top/alloy-gem5/build/RISCV_DO_MESI_64B/gem5.opt --stats-file=stats231.txt --debug-flags=DOMEM,DOACC --listener-mode=off /artifact_top/alloy-gem5/configs/brg/sc3.py --cpu-type TimingSimpleCPU --link-latency 20 --CG_link_latency 150 --garnet-deadlock-threshold 100000 --l2_size 16384kB --l2_assoc 8 --num-dirs 8 --brg-fast-forward --num-cpus 64 --network garnet2.0 --buffer-size 0 --mem-size 16GB --ruby --l1d_size 64kB --mem-type SimpleMemory --num-l1-cache-ports 8 --num-l2caches 8 --ports 16 --l1i_size 64kB --topology TwoMeshXY -c /artifact_top/alloy-apps/build-applrts_sc3/TRNS -o "-n 8 -c 8 -t 8 -r 1 -w 0 -m 8" --vcs-per-vnet 64 --buffers-per-data-vc 65536 --buffers-per-ctrl-vc 1024 > logs/log231.txt &
-nohup /artifact_top/alloy-gem5/build/RISCV_WT_MESI_64B/gem5.opt --stats-file=stats232.txt --debug-flags=DOMEM,DOACC --listener-mode=off /artifact_top/alloy-gem5/configs/brg/sc3.py --cpu-type TimingSimpleCPU --link-latency 20 --CG_link_latency 150 --garnet-deadlock-threshold 100000 --l2_size 16384kB --l2_assoc 8 --num-dirs 8 --brg-fast-forward --num-cpus 64 --network garnet2.0 --buffer-size 0 --mem-size 16GB --ruby --l1d_size 64kB --mem-type SimpleMemory --num-l1-cache-ports 8 --num-l2caches 8 --ports 16 --l1i_size 64kB --topology TwoMeshXY -c /artifact_top/alloy-apps/build-applrts_sc3/TRNS -o "-n 8 -c 8 -t 8 -r 1 -w 0 -m 8" --vcs-per-vnet 64 --buffers-per-data-vc 65536 --buffers-per-ctrl-vc 1024 > logs/log232.txt &
+nohup /artifact_top/alloy-gem5/build/RISCV_DO_MESI/gem5.opt --stats-file=stats231.txt --debug-flags=DOMEM,DOACC --listener-mode=off /artifact_top/alloy-gem5/configs/brg/sc3.py --msg-size PUT_NT:64 --cpu-type TimingSimpleCPU --link-latency 20 --CG_link_latency 150 --garnet-deadlock-threshold 100000 --l2_size 16384kB --l2_assoc 8 --num-dirs 8 --brg-fast-forward --num-cpus 64 --network garnet2.0 --buffer-size 0 --mem-size 16GB --ruby --l1d_size 64kB --mem-type SimpleMemory --num-l1-cache-ports 8 --num-l2caches 8 --ports 16 --l1i_size 64kB --topology TwoMeshXY -c /artifact_top/alloy-apps/build-applrts_sc3/TRNS -o "-n 8 -c 8 -t 8 -r 1 -w 0 -m 8" --vcs-per-vnet 64 --buffers-per-data-vc 65536 --buffers-per-ctrl-vc 1024 > logs/log231.txt &
+nohup /artifact_top/alloy-gem5/build/RISCV_WT_MESI/gem5.opt --stats-file=stats232.txt --debug-flags=DOMEM,DOACC --listener-mode=off /artifact_top/alloy-gem5/configs/brg/sc3.py --msg-size PUT_NT:64 --cpu-type TimingSimpleCPU --link-latency 20 --CG_link_latency 150 --garnet-deadlock-threshold 100000 --l2_size 16384kB --l2_assoc 8 --num-dirs 8 --brg-fast-forward --num-cpus 64 --network garnet2.0 --buffer-size 0 --mem-size 16GB --ruby --l1d_size 64kB --mem-type SimpleMemory --num-l1-cache-ports 8 --num-l2caches 8 --ports 16 --l1i_size 64kB --topology TwoMeshXY -c /artifact_top/alloy-apps/build-applrts_sc3/TRNS -o "-n 8 -c 8 -t 8 -r 1 -w 0 -m 8" --vcs-per-vnet 64 --buffers-per-data-vc 65536 --buffers-per-ctrl-vc 1024 > logs/log232.txt &
 nohup /artifact_top/alloy-gem5/build/RISCV_MESI/gem5.opt --stats-file=stats233.txt --debug-flags=DOMEM,DOACC --listener-mode=off /artifact_top/alloy-gem5/configs/brg/sc3.py --cpu-type TimingSimpleCPU --link-latency 20 --CG_link_latency 150 --garnet-deadlock-threshold 100000 --l2_size 16384kB --l2_assoc 8 --num-dirs 8 --brg-fast-forward --num-cpus 64 --network garnet2.0 --buffer-size 0 --mem-size 16GB --ruby --l1d_size 64kB --mem-type SimpleMemory --num-l1-cache-ports 8 --num-l2caches 8 --ports 16 --l1i_size 64kB --topology TwoMeshXY -c /artifact_top/alloy-apps/build-applrts_sc3/TRNS -o "-n 8 -c 8 -t 8 -r 1 -w 0 -m 8" --vcs-per-vnet 64 --buffers-per-data-vc 65536 --buffers-per-ctrl-vc 1024 > logs/log233.txt &
-nohup /artifact_top/alloy-gem5/build/RISCV_MP_64B/gem5.opt --stats-file=stats234.txt --debug-flags=DOMEM,DOACC --listener-mode=off /artifact_top/alloy-gem5/configs/brg/sc3.py --cpu-type TimingSimpleCPU --link-latency 20 --CG_link_latency 150 --garnet-deadlock-threshold 100000 --l2_size 16384kB --l2_assoc 8 --num-dirs 8 --brg-fast-forward --num-cpus 64 --network garnet2.0 --buffer-size 0 --mem-size 16GB --ruby --l1d_size 64kB --mem-type SimpleMemory --num-l1-cache-ports 8 --num-l2caches 8 --ports 16 --l1i_size 64kB --topology TwoMeshXY -c /artifact_top/alloy-apps/build-applrts_sc3/TRNS -o "-n 8 -c 8 -t 8 -r 1 -w 0 -m 8" --vcs-per-vnet 64 --buffers-per-data-vc 65536 --buffers-per-ctrl-vc 1024 > logs/log234.txt &
+nohup /artifact_top/alloy-gem5/build/RISCV_MP/gem5.opt --stats-file=stats234.txt --debug-flags=DOMEM,DOACC --listener-mode=off /artifact_top/alloy-gem5/configs/brg/sc3.py --msg-size PUT_NT:64 --cpu-type TimingSimpleCPU --link-latency 20 --CG_link_latency 150 --garnet-deadlock-threshold 100000 --l2_size 16384kB --l2_assoc 8 --num-dirs 8 --brg-fast-forward --num-cpus 64 --network garnet2.0 --buffer-size 0 --mem-size 16GB --ruby --l1d_size 64kB --mem-type SimpleMemory --num-l1-cache-ports 8 --num-l2caches 8 --ports 16 --l1i_size 64kB --topology TwoMeshXY -c /artifact_top/alloy-apps/build-applrts_sc3/TRNS -o "-n 8 -c 8 -t 8 -r 1 -w 0 -m 8" --vcs-per-vnet 64 --buffers-per-data-vc 65536 --buffers-per-ctrl-vc 1024 > logs/log234.txt &
 
 # TRNS 235-238
-nohup /artifact_top/alloy-gem5/build/RISCV_DO_MESI_64B/gem5.opt --stats-file=stats235.txt --debug-flags=DOMEM,DOACC --listener-mode=off /artifact_top/alloy-gem5/configs/brg/sc3.py --cpu-type TimingSimpleCPU --link-latency 20 --CG_link_latency 50 --garnet-deadlock-threshold 100000 --l2_size 16384kB --l2_assoc 8 --num-dirs 8 --brg-fast-forward --num-cpus 64 --network garnet2.0 --buffer-size 0 --mem-size 16GB --ruby --l1d_size 64kB --mem-type SimpleMemory --num-l1-cache-ports 8 --num-l2caches 8 --ports 16 --l1i_size 64kB --topology TwoMeshXY -c /artifact_top/alloy-apps/build-applrts_sc3/TRNS -o "-n 8 -c 8 -t 8 -r 1 -w 0 -m 8" --vcs-per-vnet 64 --buffers-per-data-vc 65536 --buffers-per-ctrl-vc 1024 > logs/log235.txt &
-nohup /artifact_top/alloy-gem5/build/RISCV_WT_MESI_64B/gem5.opt --stats-file=stats236.txt --debug-flags=DOMEM,DOACC --listener-mode=off /artifact_top/alloy-gem5/configs/brg/sc3.py --cpu-type TimingSimpleCPU --link-latency 20 --CG_link_latency 50 --garnet-deadlock-threshold 100000 --l2_size 16384kB --l2_assoc 8 --num-dirs 8 --brg-fast-forward --num-cpus 64 --network garnet2.0 --buffer-size 0 --mem-size 16GB --ruby --l1d_size 64kB --mem-type SimpleMemory --num-l1-cache-ports 8 --num-l2caches 8 --ports 16 --l1i_size 64kB --topology TwoMeshXY -c /artifact_top/alloy-apps/build-applrts_sc3/TRNS -o "-n 8 -c 8 -t 8 -r 1 -w 0 -m 8" --vcs-per-vnet 64 --buffers-per-data-vc 65536 --buffers-per-ctrl-vc 1024 > logs/log236.txt &
+nohup /artifact_top/alloy-gem5/build/RISCV_DO_MESI/gem5.opt --stats-file=stats235.txt --debug-flags=DOMEM,DOACC --listener-mode=off /artifact_top/alloy-gem5/configs/brg/sc3.py --msg-size PUT_NT:64 --cpu-type TimingSimpleCPU --link-latency 20 --CG_link_latency 50 --garnet-deadlock-threshold 100000 --l2_size 16384kB --l2_assoc 8 --num-dirs 8 --brg-fast-forward --num-cpus 64 --network garnet2.0 --buffer-size 0 --mem-size 16GB --ruby --l1d_size 64kB --mem-type SimpleMemory --num-l1-cache-ports 8 --num-l2caches 8 --ports 16 --l1i_size 64kB --topology TwoMeshXY -c /artifact_top/alloy-apps/build-applrts_sc3/TRNS -o "-n 8 -c 8 -t 8 -r 1 -w 0 -m 8" --vcs-per-vnet 64 --buffers-per-data-vc 65536 --buffers-per-ctrl-vc 1024 > logs/log235.txt &
+nohup /artifact_top/alloy-gem5/build/RISCV_WT_MESI/gem5.opt --stats-file=stats236.txt --debug-flags=DOMEM,DOACC --listener-mode=off /artifact_top/alloy-gem5/configs/brg/sc3.py --msg-size PUT_NT:64 --cpu-type TimingSimpleCPU --link-latency 20 --CG_link_latency 50 --garnet-deadlock-threshold 100000 --l2_size 16384kB --l2_assoc 8 --num-dirs 8 --brg-fast-forward --num-cpus 64 --network garnet2.0 --buffer-size 0 --mem-size 16GB --ruby --l1d_size 64kB --mem-type SimpleMemory --num-l1-cache-ports 8 --num-l2caches 8 --ports 16 --l1i_size 64kB --topology TwoMeshXY -c /artifact_top/alloy-apps/build-applrts_sc3/TRNS -o "-n 8 -c 8 -t 8 -r 1 -w 0 -m 8" --vcs-per-vnet 64 --buffers-per-data-vc 65536 --buffers-per-ctrl-vc 1024 > logs/log236.txt &
 nohup /artifact_top/alloy-gem5/build/RISCV_MESI/gem5.opt --stats-file=stats237.txt --debug-flags=DOMEM,DOACC --listener-mode=off /artifact_top/alloy-gem5/configs/brg/sc3.py --cpu-type TimingSimpleCPU --link-latency 20 --CG_link_latency 50 --garnet-deadlock-threshold 100000 --l2_size 16384kB --l2_assoc 8 --num-dirs 8 --brg-fast-forward --num-cpus 64 --network garnet2.0 --buffer-size 0 --mem-size 16GB --ruby --l1d_size 64kB --mem-type SimpleMemory --num-l1-cache-ports 8 --num-l2caches 8 --ports 16 --l1i_size 64kB --topology TwoMeshXY -c /artifact_top/alloy-apps/build-applrts_sc3/TRNS -o "-n 8 -c 8 -t 8 -r 1 -w 0 -m 8" --vcs-per-vnet 64 --buffers-per-data-vc 65536 --buffers-per-ctrl-vc 1024 > logs/log237.txt &
-nohup /artifact_top/alloy-gem5/build/RISCV_MP_64B/gem5.opt --stats-file=stats238.txt --debug-flags=DOMEM,DOACC --listener-mode=off /artifact_top/alloy-gem5/configs/brg/sc3.py --cpu-type TimingSimpleCPU --link-latency 20 --CG_link_latency 50 --garnet-deadlock-threshold 100000 --l2_size 16384kB --l2_assoc 8 --num-dirs 8 --brg-fast-forward --num-cpus 64 --network garnet2.0 --buffer-size 0 --mem-size 16GB --ruby --l1d_size 64kB --mem-type SimpleMemory --num-l1-cache-ports 8 --num-l2caches 8 --ports 16 --l1i_size 64kB --topology TwoMeshXY -c /artifact_top/alloy-apps/build-applrts_sc3/TRNS -o "-n 8 -c 8 -t 8 -r 1 -w 0 -m 8" --vcs-per-vnet 64 --buffers-per-data-vc 65536 --buffers-per-ctrl-vc 1024 > logs/log238.txt &
+nohup /artifact_top/alloy-gem5/build/RISCV_MP/gem5.opt --stats-file=stats238.txt --debug-flags=DOMEM,DOACC --listener-mode=off /artifact_top/alloy-gem5/configs/brg/sc3.py --msg-size PUT_NT:64 --cpu-type TimingSimpleCPU --link-latency 20 --CG_link_latency 50 --garnet-deadlock-threshold 100000 --l2_size 16384kB --l2_assoc 8 --num-dirs 8 --brg-fast-forward --num-cpus 64 --network garnet2.0 --buffer-size 0 --mem-size 16GB --ruby --l1d_size 64kB --mem-type SimpleMemory --num-l1-cache-ports 8 --num-l2caches 8 --ports 16 --l1i_size 64kB --topology TwoMeshXY -c /artifact_top/alloy-apps/build-applrts_sc3/TRNS -o "-n 8 -c 8 -t 8 -r 1 -w 0 -m 8" --vcs-per-vnet 64 --buffers-per-data-vc 65536 --buffers-per-ctrl-vc 1024 > logs/log238.txt &
 
 wait
\ No newline at end of file
@@ -13,199 +13,199 @@
 # 8 node CXL
 
 # SSSP 109-112
-nohup /artifact_top/alloy-gem5/build/RISCV_DO_MESI_TSO/gem5.opt --stats-file=stats1109.txt --debug-flags=DOMEM,DOACC --listener-mode=off /artifact_top/alloy-gem5/configs/brg/sc3.py --cpu-type TimingSimpleCPU --link-latency 20 --CG_link_latency 150 --garnet-deadlock-threshold 100000 --l2_size 16384kB --l2_assoc 8 --num-dirs 8 --brg-fast-forward --num-cpus 64 --network garnet2.0 --buffer-size 0 --mem-size 16GB --ruby --l1d_size 64kB --mem-type SimpleMemory --num-l1-cache-ports 8 --num-l2caches 8 --ports 16 --l1i_size 64kB --topology TwoMeshXY -c /artifact_top/alloy-apps/build-applrts_sc3/SSSP -o "-w 0 -r 1 -n 8 -c 8 -t 8 -l 1 -u 64 -b 32 -f /artifact_top/DO_gem5/datasets/olesnik0_out.csr" --vcs-per-vnet 64 --buffers-per-data-vc 65536 --buffers-per-ctrl-vc 1024 > logs/log1109.txt &
-nohup /artifact_top/alloy-gem5/build/RISCV_WT_MESI_TSO/gem5.opt --stats-file=stats1110.txt --debug-flags=DOMEM,DOACC --listener-mode=off /artifact_top/alloy-gem5/configs/brg/sc3.py --cpu-type TimingSimpleCPU --link-latency 20 --CG_link_latency 150 --garnet-deadlock-threshold 100000 --l2_size 16384kB --l2_assoc 8 --num-dirs 8 --brg-fast-forward --num-cpus 64 --network garnet2.0 --buffer-size 0 --mem-size 16GB --ruby --l1d_size 64kB --mem-type SimpleMemory --num-l1-cache-ports 8 --num-l2caches 8 --ports 16 --l1i_size 64kB --topology TwoMeshXY -c /artifact_top/alloy-apps/build-applrts_sc3/SSSP -o "-w 0 -r 1 -n 8 -c 8 -t 8 -l 1 -u 64 -b 32 -f /artifact_top/DO_gem5/datasets/olesnik0_out.csr" --vcs-per-vnet 64 --buffers-per-data-vc 65536 --buffers-per-ctrl-vc 1024 > logs/log1110.txt &
-nohup /artifact_top/alloy-gem5/build/RISCV_MESI_TSO/gem5.opt --stats-file=stats1111.txt --debug-flags=DOMEM,DOACC --listener-mode=off /artifact_top/alloy-gem5/configs/brg/sc3.py --cpu-type TimingSimpleCPU --link-latency 20 --CG_link_latency 150 --garnet-deadlock-threshold 100000 --l2_size 16384kB --l2_assoc 8 --num-dirs 8 --brg-fast-forward --num-cpus 64 --network garnet2.0 --buffer-size 0 --mem-size 16GB --ruby --l1d_size 64kB --mem-type SimpleMemory --num-l1-cache-ports 8 --num-l2caches 8 --ports 16 --l1i_size 64kB --topology TwoMeshXY -c /artifact_top/alloy-apps/build-applrts_sc3/SSSP -o "-w 0 -r 1 -n 8 -c 8 -t 8 -l 1 -u 64 -b 32 -f /artifact_top/DO_gem5/datasets/olesnik0_out.csr" --vcs-per-vnet 64 --buffers-per-data-vc 65536 --buffers-per-ctrl-vc 1024 > logs/log1111.txt &
-nohup /artifact_top/alloy-gem5/build/RISCV_MP_TSO/gem5.opt --stats-file=stats1112.txt --debug-flags=DOMEM,DOACC --listener-mode=off /artifact_top/alloy-gem5/configs/brg/sc3.py --cpu-type TimingSimpleCPU --link-latency 20 --CG_link_latency 150 --garnet-deadlock-threshold 100000 --l2_size 16384kB --l2_assoc 8 --num-dirs 8 --brg-fast-forward --num-cpus 64 --network garnet2.0 --buffer-size 0 --mem-size 16GB --ruby --l1d_size 64kB --mem-type SimpleMemory --num-l1-cache-ports 8 --num-l2caches 8 --ports 16 --l1i_size 64kB --topology TwoMeshXY -c /artifact_top/alloy-apps/build-applrts_sc3/SSSP -o "-w 0 -r 1 -n 8 -c 8 -t 8 -l 1 -u 64 -b 32 -f /artifact_top/DO_gem5/datasets/olesnik0_out.csr" --vcs-per-vnet 64 --buffers-per-data-vc 65536 --buffers-per-ctrl-vc 1024 > logs/log1112.txt &
+nohup /artifact_top/alloy-gem5/build/RISCV_DO_MESI/gem5.opt --stats-file=stats1109.txt --debug-flags=DOMEM,DOACC --listener-mode=off /artifact_top/alloy-gem5/configs/brg/sc3.py --do-consistency-model TSO --cpu-type TimingSimpleCPU --link-latency 20 --CG_link_latency 150 --garnet-deadlock-threshold 100000 --l2_size 16384kB --l2_assoc 8 --num-dirs 8 --brg-fast-forward --num-cpus 64 --network garnet2.0 --buffer-size 0 --mem-size 16GB --ruby --l1d_size 64kB --mem-type SimpleMemory --num-l1-cache-ports 8 --num-l2caches 8 --ports 16 --l1i_size 64kB --topology TwoMeshXY -c /artifact_top/alloy-apps/build-applrts_sc3/SSSP -o "-w 0 -r 1 -n 8 -c 8 -t 8 -l 1 -u 64 -b 32 -f /artifact_top/DO_gem5/datasets/olesnik0_out.csr" --vcs-per-vnet 64 --buffers-per-data-vc 65536 --buffers-per-ctrl-vc 1024 > logs/log1109.txt &
+nohup /artifact_top/alloy-gem5/build/RISCV_WT_MESI_TSO/gem5.opt --stats-file=stats1110.txt --debug-flags=DOMEM,DOACC --listener-mode=off /artifact_top/alloy-gem5/configs/brg/sc3.py --do-consistency-model TSO --cpu-type TimingSimpleCPU --link-latency 20 --CG_link_latency 150 --garnet-deadlock-threshold 100000 --l2_size 16384kB --l2_assoc 8 --num-dirs 8 --brg-fast-forward --num-cpus 64 --network garnet2.0 --buffer-size 0 --mem-size 16GB --ruby --l1d_size 64kB --mem-type SimpleMemory --num-l1-cache-ports 8 --num-l2caches 8 --ports 16 --l1i_size 64kB --topology TwoMeshXY -c /artifact_top/alloy-apps/build-applrts_sc3/SSSP -o "-w 0 -r 1 -n 8 -c 8 -t 8 -l 1 -u 64 -b 32 -f /artifact_top/DO_gem5/datasets/olesnik0_out.csr" --vcs-per-vnet 64 --buffers-per-data-vc 65536 --buffers-per-ctrl-vc 1024 > logs/log1110.txt &
+nohup /artifact_top/alloy-gem5/build/RISCV_MESI/gem5.opt --stats-file=stats1111.txt --debug-flags=DOMEM,DOACC --listener-mode=off /artifact_top/alloy-gem5/configs/brg/sc3.py --do-consistency-model TSO_WB --cpu-type TimingSimpleCPU --link-latency 20 --CG_link_latency 150 --garnet-deadlock-threshold 100000 --l2_size 16384kB --l2_assoc 8 --num-dirs 8 --brg-fast-forward --num-cpus 64 --network garnet2.0 --buffer-size 0 --mem-size 16GB --ruby --l1d_size 64kB --mem-type SimpleMemory --num-l1-cache-ports 8 --num-l2caches 8 --ports 16 --l1i_size 64kB --topology TwoMeshXY -c /artifact_top/alloy-apps/build-applrts_sc3/SSSP -o "-w 0 -r 1 -n 8 -c 8 -t 8 -l 1 -u 64 -b 32 -f /artifact_top/DO_gem5/datasets/olesnik0_out.csr" --vcs-per-vnet 64 --buffers-per-data-vc 65536 --buffers-per-ctrl-vc 1024 > logs/log1111.txt &
+nohup /artifact_top/alloy-gem5/build/RISCV_MP/gem5.opt --stats-file=stats1112.txt --debug-flags=DOMEM,DOACC --listener-mode=off /artifact_top/alloy-gem5/configs/brg/sc3.py --do-consistency-model TSO --cpu-type TimingSimpleCPU --link-latency 20 --CG_link_latency 150 --garnet-deadlock-threshold 100000 --l2_size 16384kB --l2_assoc 8 --num-dirs 8 --brg-fast-forward --num-cpus 64 --network garnet2.0 --buffer-size 0 --mem-size 16GB --ruby --l1d_size 64kB --mem-type SimpleMemory --num-l1-cache-ports 8 --num-l2caches 8 --ports 16 --l1i_size 64kB --topology TwoMeshXY -c /artifact_top/alloy-apps/build-applrts_sc3/SSSP -o "-w 0 -r 1 -n 8 -c 8 -t 8 -l 1 -u 64 -b 32 -f /artifact_top/DO_gem5/datasets/olesnik0_out.csr" --vcs-per-vnet 64 --buffers-per-data-vc 65536 --buffers-per-ctrl-vc 1024 > logs/log1112.txt &
 # SSSP warmup runs 113-116
-nohup /artifact_top/alloy-gem5/build/RISCV_DO_MESI_TSO/gem5.opt --stats-file=stats1113.txt --debug-flags=DOMEM,DOACC --listener-mode=off /artifact_top/alloy-gem5/configs/brg/sc3.py --cpu-type TimingSimpleCPU --link-latency 20 --CG_link_latency 150 --garnet-deadlock-threshold 100000 --l2_size 16384kB --l2_assoc 8 --num-dirs 8 --brg-fast-forward --num-cpus 64 --network garnet2.0 --buffer-size 0 --mem-size 16GB --ruby --l1d_size 64kB --mem-type SimpleMemory --num-l1-cache-ports 8 --num-l2caches 8 --ports 16 --l1i_size 64kB --topology TwoMeshXY -c /artifact_top/alloy-apps/build-applrts_sc3/SSSP -o "-w 0 -r 1 -n 8 -c 8 -t 8 -l 1 -u 32 -b 32 -f /artifact_top/DO_gem5/datasets/olesnik0_out.csr" --vcs-per-vnet 64 --buffers-per-data-vc 65536 --buffers-per-ctrl-vc 1024 > logs/log1113.txt &
-nohup /artifact_top/alloy-gem5/build/RISCV_WT_MESI_TSO/gem5.opt --stats-file=stats1114.txt --debug-flags=DOMEM,DOACC --listener-mode=off /artifact_top/alloy-gem5/configs/brg/sc3.py --cpu-type TimingSimpleCPU --link-latency 20 --CG_link_latency 150 --garnet-deadlock-threshold 100000 --l2_size 16384kB --l2_assoc 8 --num-dirs 8 --brg-fast-forward --num-cpus 64 --network garnet2.0 --buffer-size 0 --mem-size 16GB --ruby --l1d_size 64kB --mem-type SimpleMemory --num-l1-cache-ports 8 --num-l2caches 8 --ports 16 --l1i_size 64kB --topology TwoMeshXY -c /artifact_top/alloy-apps/build-applrts_sc3/SSSP -o "-w 0 -r 1 -n 8 -c 8 -t 8 -l 1 -u 32 -b 32 -f /artifact_top/DO_gem5/datasets/olesnik0_out.csr" --vcs-per-vnet 64 --buffers-per-data-vc 65536 --buffers-per-ctrl-vc 1024 > logs/log1114.txt &
-nohup /artifact_top/alloy-gem5/build/RISCV_MESI_TSO/gem5.opt --stats-file=stats1115.txt --debug-flags=DOMEM,DOACC --listener-mode=off /artifact_top/alloy-gem5/configs/brg/sc3.py --cpu-type TimingSimpleCPU --link-latency 20 --CG_link_latency 150 --garnet-deadlock-threshold 100000 --l2_size 16384kB --l2_assoc 8 --num-dirs 8 --brg-fast-forward --num-cpus 64 --network garnet2.0 --buffer-size 0 --mem-size 16GB --ruby --l1d_size 64kB --mem-type SimpleMemory --num-l1-cache-ports 8 --num-l2caches 8 --ports 16 --l1i_size 64kB --topology TwoMeshXY -c /artifact_top/alloy-apps/build-applrts_sc3/SSSP -o "-w 0 -r 1 -n 8 -c 8 -t 8 -l 1 -u 32 -b 32 -f /artifact_top/DO_gem5/datasets/olesnik0_out.csr" --vcs-per-vnet 64 --buffers-per-data-vc 65536 --buffers-per-ctrl-vc 1024 > logs/log1115.txt &
-nohup /artifact_top/alloy-gem5/build/RISCV_MP_TSO/gem5.opt --stats-file=stats1116.txt --debug-flags=DOMEM,DOACC --listener-mode=off /artifact_top/alloy-gem5/configs/brg/sc3.py --cpu-type TimingSimpleCPU --link-latency 20 --CG_link_latency 150 --garnet-deadlock-threshold 100000 --l2_size 16384kB --l2_assoc 8 --num-dirs 8 --brg-fast-forward --num-cpus 64 --network garnet2.0 --buffer-size 0 --mem-size 16GB --ruby --l1d_size 64kB --mem-type SimpleMemory --num-l1-cache-ports 8 --num-l2caches 8 --ports 16 --l1i_size 64kB --topology TwoMeshXY -c /artifact_top/alloy-apps/build-applrts_sc3/SSSP -o "-w 0 -r 1 -n 8 -c 8 -t 8 -l 1 -u 32 -b 32 -f /artifact_top/DO_gem5/datasets/olesnik0_out.csr" --vcs-per-vnet 64 --buffers-per-data-vc 65536 --buffers-per-ctrl-vc 1024 > logs/log1116.txt &
+nohup /artifact_top/alloy-gem5/build/RISCV_DO_MESI/gem5.opt --stats-file=stats1113.txt --debug-flags=DOMEM,DOACC --listener-mode=off /artifact_top/alloy-gem5/configs/brg/sc3.py --do-consistency-model TSO --cpu-type TimingSimpleCPU --link-latency 20 --CG_link_latency 150 --garnet-deadlock-threshold 100000 --l2_size 16384kB --l2_assoc 8 --num-dirs 8 --brg-fast-forward --num-cpus 64 --network garnet2.0 --buffer-size 0 --mem-size 16GB --ruby --l1d_size 64kB --mem-type SimpleMemory --num-l1-cache-ports 8 --num-l2caches 8 --ports 16 --l1i_size 64kB --topology TwoMeshXY -c /artifact_top/alloy-apps/build-applrts_sc3/SSSP -o "-w 0 -r 1 -n 8 -c 8 -t 8 -l 1 -u 32 -b 32 -f /artifact_top/DO_gem5/datasets/olesnik0_out.csr" --vcs-per-vnet 64 --buffers-per-data-vc 65536 --buffers-per-ctrl-vc 1024 > logs/log1113.txt &
+nohup /artifact_top/alloy-gem5/build/RISCV_WT_MESI_TSO/gem5.opt --stats-file=stats1114.txt --debug-flags=DOMEM,DOACC --listener-mode=off /artifact_top/alloy-gem5/configs/brg/sc3.py --do-consistency-model TSO --cpu-type TimingSimpleCPU --link-latency 20 --CG_link_latency 150 --garnet-deadlock-threshold 100000 --l2_size 16384kB --l2_assoc 8 --num-dirs 8 --brg-fast-forward --num-cpus 64 --network garnet2.0 --buffer-size 0 --mem-size 16GB --ruby --l1d_size 64kB --mem-type SimpleMemory --num-l1-cache-ports 8 --num-l2caches 8 --ports 16 --l1i_size 64kB --topology TwoMeshXY -c /artifact_top/alloy-apps/build-applrts_sc3/SSSP -o "-w 0 -r 1 -n 8 -c 8 -t 8 -l 1 -u 32 -b 32 -f /artifact_top/DO_gem5/datasets/olesnik0_out.csr" --vcs-per-vnet 64 --buffers-per-data-vc 65536 --buffers-per-ctrl-vc 1024 > logs/log1114.txt &
+nohup /artifact_top/alloy-gem5/build/RISCV_MESI/gem5.opt --stats-file=stats1115.txt --debug-flags=DOMEM,DOACC --listener-mode=off /artifact_top/alloy-gem5/configs/brg/sc3.py --do-consistency-model TSO_WB --cpu-type TimingSimpleCPU --link-latency 20 --CG_link_latency 150 --garnet-deadlock-threshold 100000 --l2_size 16384kB --l2_assoc 8 --num-dirs 8 --brg-fast-forward --num-cpus 64 --network garnet2.0 --buffer-size 0 --mem-size 16GB --ruby --l1d_size 64kB --mem-type SimpleMemory --num-l1-cache-ports 8 --num-l2caches 8 --ports 16 --l1i_size 64kB --topology TwoMeshXY -c /artifact_top/alloy-apps/build-applrts_sc3/SSSP -o "-w 0 -r 1 -n 8 -c 8 -t 8 -l 1 -u 32 -b 32 -f /artifact_top/DO_gem5/datasets/olesnik0_out.csr" --vcs-per-vnet 64 --buffers-per-data-vc 65536 --buffers-per-ctrl-vc 1024 > logs/log1115.txt &
+nohup /artifact_top/alloy-gem5/build/RISCV_MP/gem5.opt --stats-file=stats1116.txt --debug-flags=DOMEM,DOACC --listener-mode=off /artifact_top/alloy-gem5/configs/brg/sc3.py --do-consistency-model TSO --cpu-type TimingSimpleCPU --link-latency 20 --CG_link_latency 150 --garnet-deadlock-threshold 100000 --l2_size 16384kB --l2_assoc 8 --num-dirs 8 --brg-fast-forward --num-cpus 64 --network garnet2.0 --buffer-size 0 --mem-size 16GB --ruby --l1d_size 64kB --mem-type SimpleMemory --num-l1-cache-ports 8 --num-l2caches 8 --ports 16 --l1i_size 64kB --topology TwoMeshXY -c /artifact_top/alloy-apps/build-applrts_sc3/SSSP -o "-w 0 -r 1 -n 8 -c 8 -t 8 -l 1 -u 32 -b 32 -f /artifact_top/DO_gem5/datasets/olesnik0_out.csr" --vcs-per-vnet 64 --buffers-per-data-vc 65536 --buffers-per-ctrl-vc 1024 > logs/log1116.txt &
 
 # PR 117-120
-nohup /artifact_top/alloy-gem5/build/RISCV_DO_MESI_TSO/gem5.opt --stats-file=stats1117.txt --debug-flags=DOMEM,DOACC --listener-mode=off /artifact_top/alloy-gem5/configs/brg/sc3.py --cpu-type TimingSimpleCPU --link-latency 20 --CG_link_latency 110 --garnet-deadlock-threshold 100000 --l2_size 16384kB --l2_assoc 8 --num-dirs 8 --brg-fast-forward --num-cpus 64 --network garnet2.0 --buffer-size 0 --mem-size 16GB --ruby --l1d_size 64kB --mem-type SimpleMemory --num-l1-cache-ports 8 --num-l2caches 8 --ports 16 --l1i_size 64kB --topology TwoMeshXY -c /artifact_top/alloy-apps/build-applrts_sc3/PR -o "-w 0 -r 1 -n 8 -c 8 -t 8 -f /artifact_top/DO_gem5/datasets/wing_out.csr" --vcs-per-vnet 64 --buffers-per-data-vc 65536 --buffers-per-ctrl-vc 1024 > logs/log1117.txt &
-nohup /artifact_top/alloy-gem5/build/RISCV_WT_MESI_TSO/gem5.opt --stats-file=stats1118.txt --debug-flags=DOMEM,DOACC --listener-mode=off /artifact_top/alloy-gem5/configs/brg/sc3.py --cpu-type TimingSimpleCPU --link-latency 20 --CG_link_latency 110 --garnet-deadlock-threshold 100000 --l2_size 16384kB --l2_assoc 8 --num-dirs 8 --brg-fast-forward --num-cpus 64 --network garnet2.0 --buffer-size 0 --mem-size 16GB --ruby --l1d_size 64kB --mem-type SimpleMemory --num-l1-cache-ports 8 --num-l2caches 8 --ports 16 --l1i_size 64kB --topology TwoMeshXY -c /artifact_top/alloy-apps/build-applrts_sc3/PR -o "-w 0 -r 1 -n 8 -c 8 -t 8 -f /artifact_top/DO_gem5/datasets/wing_out.csr" --vcs-per-vnet 64 --buffers-per-data-vc 65536 --buffers-per-ctrl-vc 1024 > logs/log1118.txt &
-nohup /artifact_top/alloy-gem5/build/RISCV_MESI_TSO/gem5.opt --stats-file=stats1119.txt --debug-flags=DOMEM,DOACC --listener-mode=off /artifact_top/alloy-gem5/configs/brg/sc3.py --cpu-type TimingSimpleCPU --link-latency 20 --CG_link_latency 110 --garnet-deadlock-threshold 100000 --l2_size 16384kB --l2_assoc 8 --num-dirs 8 --brg-fast-forward --num-cpus 64 --network garnet2.0 --buffer-size 0 --mem-size 16GB --ruby --l1d_size 64kB --mem-type SimpleMemory --num-l1-cache-ports 8 --num-l2caches 8 --ports 16 --l1i_size 64kB --topology TwoMeshXY -c /artifact_top/alloy-apps/build-applrts_sc3/PR -o "-w 0 -r 1 -n 8 -c 8 -t 8 -f /artifact_top/DO_gem5/datasets/wing_out.csr" --vcs-per-vnet 64 --buffers-per-data-vc 65536 --buffers-per-ctrl-vc 1024 > logs/log1119.txt &
-nohup /artifact_top/alloy-gem5/build/RISCV_MP_TSO/gem5.opt --stats-file=stats1120.txt --debug-flags=DOMEM,DOACC --listener-mode=off /artifact_top/alloy-gem5/configs/brg/sc3.py --cpu-type TimingSimpleCPU --link-latency 20 --CG_link_latency 110 --garnet-deadlock-threshold 100000 --l2_size 16384kB --l2_assoc 8 --num-dirs 8 --brg-fast-forward --num-cpus 64 --network garnet2.0 --buffer-size 0 --mem-size 16GB --ruby --l1d_size 64kB --mem-type SimpleMemory --num-l1-cache-ports 8 --num-l2caches 8 --ports 16 --l1i_size 64kB --topology TwoMeshXY -c /artifact_top/alloy-apps/build-applrts_sc3/PR -o "-w 0 -r 1 -n 8 -c 8 -t 8 -f /artifact_top/DO_gem5/datasets/wing_out.csr" --vcs-per-vnet 64 --buffers-per-data-vc 65536 --buffers-per-ctrl-vc 1024 > logs/log1120.txt &
+nohup /artifact_top/alloy-gem5/build/RISCV_DO_MESI/gem5.opt --stats-file=stats1117.txt --debug-flags=DOMEM,DOACC --listener-mode=off /artifact_top/alloy-gem5/configs/brg/sc3.py --do-consistency-model TSO --cpu-type TimingSimpleCPU --link-latency 20 --CG_link_latency 110 --garnet-deadlock-threshold 100000 --l2_size 16384kB --l2_assoc 8 --num-dirs 8 --brg-fast-forward --num-cpus 64 --network garnet2.0 --buffer-size 0 --mem-size 16GB --ruby --l1d_size 64kB --mem-type SimpleMemory --num-l1-cache-ports 8 --num-l2caches 8 --ports 16 --l1i_size 64kB --topology TwoMeshXY -c /artifact_top/alloy-apps/build-applrts_sc3/PR -o "-w 0 -r 1 -n 8 -c 8 -t 8 -f /artifact_top/DO_gem5/datasets/wing_out.csr" --vcs-per-vnet 64 --buffers-per-data-vc 65536 --buffers-per-ctrl-vc 1024 > logs/log1117.txt &
+nohup /artifact_top/alloy-gem5/build/RISCV_WT_MESI_TSO/gem5.opt --stats-file=stats1118.txt --debug-flags=DOMEM,DOACC --listener-mode=off /artifact_top/alloy-gem5/configs/brg/sc3.py --do-consistency-model TSO --cpu-type TimingSimpleCPU --link-latency 20 --CG_link_latency 110 --garnet-deadlock-threshold 100000 --l2_size 16384kB --l2_assoc 8 --num-dirs 8 --brg-fast-forward --num-cpus 64 --network garnet2.0 --buffer-size 0 --mem-size 16GB --ruby --l1d_size 64kB --mem-type SimpleMemory --num-l1-cache-ports 8 --num-l2caches 8 --ports 16 --l1i_size 64kB --topology TwoMeshXY -c /artifact_top/alloy-apps/build-applrts_sc3/PR -o "-w 0 -r 1 -n 8 -c 8 -t 8 -f /artifact_top/DO_gem5/datasets/wing_out.csr" --vcs-per-vnet 64 --buffers-per-data-vc 65536 --buffers-per-ctrl-vc 1024 > logs/log1118.txt &
+nohup /artifact_top/alloy-gem5/build/RISCV_MESI/gem5.opt --stats-file=stats1119.txt --debug-flags=DOMEM,DOACC --listener-mode=off /artifact_top/alloy-gem5/configs/brg/sc3.py --do-consistency-model TSO_WB --cpu-type TimingSimpleCPU --link-latency 20 --CG_link_latency 110 --garnet-deadlock-threshold 100000 --l2_size 16384kB --l2_assoc 8 --num-dirs 8 --brg-fast-forward --num-cpus 64 --network garnet2.0 --buffer-size 0 --mem-size 16GB --ruby --l1d_size 64kB --mem-type SimpleMemory --num-l1-cache-ports 8 --num-l2caches 8 --ports 16 --l1i_size 64kB --topology TwoMeshXY -c /artifact_top/alloy-apps/build-applrts_sc3/PR -o "-w 0 -r 1 -n 8 -c 8 -t 8 -f /artifact_top/DO_gem5/datasets/wing_out.csr" --vcs-per-vnet 64 --buffers-per-data-vc 65536 --buffers-per-ctrl-vc 1024 > logs/log1119.txt &
+nohup /artifact_top/alloy-gem5/build/RISCV_MP/gem5.opt --stats-file=stats1120.txt --debug-flags=DOMEM,DOACC --listener-mode=off /artifact_top/alloy-gem5/configs/brg/sc3.py --do-consistency-model TSO --cpu-type TimingSimpleCPU --link-latency 20 --CG_link_latency 110 --garnet-deadlock-threshold 100000 --l2_size 16384kB --l2_assoc 8 --num-dirs 8 --brg-fast-forward --num-cpus 64 --network garnet2.0 --buffer-size 0 --mem-size 16GB --ruby --l1d_size 64kB --mem-type SimpleMemory --num-l1-cache-ports 8 --num-l2caches 8 --ports 16 --l1i_size 64kB --topology TwoMeshXY -c /artifact_top/alloy-apps/build-applrts_sc3/PR -o "-w 0 -r 1 -n 8 -c 8 -t 8 -f /artifact_top/DO_gem5/datasets/wing_out.csr" --vcs-per-vnet 64 --buffers-per-data-vc 65536 --buffers-per-ctrl-vc 1024 > logs/log1120.txt &
 # PR 121
-nohup /artifact_top/alloy-gem5/build/RISCV_MP_TSO/gem5.opt --stats-file=stats1121.txt --debug-flags=DOMEM,DOACC --listener-mode=off /artifact_top/alloy-gem5/configs/brg/sc3.py --cpu-type TimingSimpleCPU --link-latency 20 --CG_link_latency 110 --garnet-deadlock-threshold 100000 --l2_size 16384kB --l2_assoc 8 --num-dirs 8 --brg-fast-forward --num-cpus 64 --network garnet2.0 --buffer-size 0 --mem-size 16GB --ruby --l1d_size 64kB --mem-type SimpleMemory --num-l1-cache-ports 8 --num-l2caches 8 --ports 16 --l1i_size 64kB --topology TwoMeshXY -c /artifact_top/alloy-apps/build-applrts_sc3/PR -o "-w 0 -r 0 -n 8 -c 8 -t 8 -f /artifact_top/DO_gem5/datasets/wing_out.csr" --vcs-per-vnet 64 --buffers-per-data-vc 65536 --buffers-per-ctrl-vc 1024 > logs/log1121.txt &
+nohup /artifact_top/alloy-gem5/build/RISCV_MP/gem5.opt --stats-file=stats1121.txt --debug-flags=DOMEM,DOACC --listener-mode=off /artifact_top/alloy-gem5/configs/brg/sc3.py --do-consistency-model TSO --cpu-type TimingSimpleCPU --link-latency 20 --CG_link_latency 110 --garnet-deadlock-threshold 100000 --l2_size 16384kB --l2_assoc 8 --num-dirs 8 --brg-fast-forward --num-cpus 64 --network garnet2.0 --buffer-size 0 --mem-size 16GB --ruby --l1d_size 64kB --mem-type SimpleMemory --num-l1-cache-ports 8 --num-l2caches 8 --ports 16 --l1i_size 64kB --topology TwoMeshXY -c /artifact_top/alloy-apps/build-applrts_sc3/PR -o "-w 0 -r 0 -n 8 -c 8 -t 8 -f /artifact_top/DO_gem5/datasets/wing_out.csr" --vcs-per-vnet 64 --buffers-per-data-vc 65536 --buffers-per-ctrl-vc 1024 > logs/log1121.txt &
 
 # PAD 122-125
-nohup /artifact_top/alloy-gem5/build/RISCV_DO_MESI_64B_TSO/gem5.opt --stats-file=stats1122.txt --debug-flags=DOMEM,DOACC --listener-mode=off /artifact_top/alloy-gem5/configs/brg/sc3.py --cpu-type TimingSimpleCPU --link-latency 20 --CG_link_latency 150 --garnet-deadlock-threshold 100000 --l2_size 16384kB --l2_assoc 8 --num-dirs 8 --brg-fast-forward --num-cpus 64 --network garnet2.0 --buffer-size 0 --mem-size 16GB --ruby --l1d_size 64kB --mem-type SimpleMemory --num-l1-cache-ports 8 --num-l2caches 8 --ports 16 --l1i_size 64kB --topology TwoMeshXY -c /artifact_top/alloy-apps/build-applrts_sc3/PAD -o "-w 0 -r 1 -n 8 -c 8 -t 8 -p 1" --vcs-per-vnet 64 --buffers-per-data-vc 65536 --buffers-per-ctrl-vc 1024 > logs/log1122.txt &
-nohup /artifact_top/alloy-gem5/build/RISCV_WT_MESI_64B_TSO/gem5.opt --stats-file=stats1123.txt --debug-flags=DOMEM,DOACC --listener-mode=off /artifact_top/alloy-gem5/configs/brg/sc3.py --cpu-type TimingSimpleCPU --link-latency 20 --CG_link_latency 150 --garnet-deadlock-threshold 100000 --l2_size 16384kB --l2_assoc 8 --num-dirs 8 --brg-fast-forward --num-cpus 64 --network garnet2.0 --buffer-size 0 --mem-size 16GB --ruby --l1d_size 64kB --mem-type SimpleMemory --num-l1-cache-ports 8 --num-l2caches 8 --ports 16 --l1i_size 64kB --topology TwoMeshXY -c /artifact_top/alloy-apps/build-applrts_sc3/PAD -o "-w 0 -r 1 -n 8 -c 8 -t 8 -p 1" --vcs-per-vnet 64 --buffers-per-data-vc 65536 --buffers-per-ctrl-vc 1024 > logs/log1123.txt &
-nohup /artifact_top/alloy-gem5/build/RISCV_MESI_TSO/gem5.opt --stats-file=stats1124.txt --debug-flags=DOMEM,DOACC --listener-mode=off /artifact_top/alloy-gem5/configs/brg/sc3.py --cpu-type TimingSimpleCPU --link-latency 20 --CG_link_latency 150 --garnet-deadlock-threshold 100000 --l2_size 16384kB --l2_assoc 8 --num-dirs 8 --brg-fast-forward --num-cpus 64 --network garnet2.0 --buffer-size 0 --mem-size 16GB --ruby --l1d_size 64kB --mem-type SimpleMemory --num-l1-cache-ports 8 --num-l2caches 8 --ports 16 --l1i_size 64kB --topology TwoMeshXY -c /artifact_top/alloy-apps/build-applrts_sc3/PAD -o "-w 0 -r 1 -n 8 -c 8 -t 8 -p 1" --vcs-per-vnet 64 --buffers-per-data-vc 65536 --buffers-per-ctrl-vc 1024 > logs/log1124.txt &
-nohup /artifact_top/alloy-gem5/build/RISCV_MP_64B_TSO/gem5.opt --stats-file=stats1125.txt --debug-flags=DOMEM,DOACC --listener-mode=off /artifact_top/alloy-gem5/configs/brg/sc3.py --cpu-type TimingSimpleCPU --link-latency 20 --CG_link_latency 150 --garnet-deadlock-threshold 100000 --l2_size 16384kB --l2_assoc 8 --num-dirs 8 --brg-fast-forward --num-cpus 64 --network garnet2.0 --buffer-size 0 --mem-size 16GB --ruby --l1d_size 64kB --mem-type SimpleMemory --num-l1-cache-ports 8 --num-l2caches 8 --ports 16 --l1i_size 64kB --topology TwoMeshXY -c /artifact_top/alloy-apps/build-applrts_sc3/PAD -o "-w 0 -r 1 -n 8 -c 8 -t 8 -p 1" --vcs-per-vnet 64 --buffers-per-data-vc 65536 --buffers-per-ctrl-vc 1024 > logs/log1125.txt &
+nohup /artifact_top/alloy-gem5/build/RISCV_DO_MESI/gem5.opt --stats-file=stats1122.txt --debug-flags=DOMEM,DOACC --listener-mode=off /artifact_top/alloy-gem5/configs/brg/sc3.py --do-consistency-model TSO --msg-size PUT_NT:64 --msg-size PUT_REL:72 --cpu-type TimingSimpleCPU --link-latency 20 --CG_link_latency 150 --garnet-deadlock-threshold 100000 --l2_size 16384kB --l2_assoc 8 --num-dirs 8 --brg-fast-forward --num-cpus 64 --network garnet2.0 --buffer-size 0 --mem-size 16GB --ruby --l1d_size 64kB --mem-type SimpleMemory --num-l1-cache-ports 8 --num-l2caches 8 --ports 16 --l1i_size 64kB --topology TwoMeshXY -c /artifact_top/alloy-apps/build-applrts_sc3/PAD -o "-w 0 -r 1 -n 8 -c 8 -t 8 -p 1" --vcs-per-vnet 64 --buffers-per-data-vc 65536 --buffers-per-ctrl-vc 1024 > logs/log1122.txt &
+nohup /artifact_top/alloy-gem5/build/RISCV_WT_MESI_TSO/gem5.opt --stats-file=stats1123.txt --debug-flags=DOMEM,DOACC --listener-mode=off /artifact_top/alloy-gem5/configs/brg/sc3.py --do-consistency-model TSO --msg-size PUT_NT:64 --msg-size PUT_REL:72 --cpu-type TimingSimpleCPU --link-latency 20 --CG_link_latency 150 --garnet-deadlock-threshold 100000 --l2_size 16384kB --l2_assoc 8 --num-dirs 8 --brg-fast-forward --num-cpus 64 --network garnet2.0 --buffer-size 0 --mem-size 16GB --ruby --l1d_size 64kB --mem-type SimpleMemory --num-l1-cache-ports 8 --num-l2caches 8 --ports 16 --l1i_size 64kB --topology TwoMeshXY -c /artifact_top/alloy-apps/build-applrts_sc3/PAD -o "-w 0 -r 1 -n 8 -c 8 -t 8 -p 1" --vcs-per-vnet 64 --buffers-per-data-vc 65536 --buffers-per-ctrl-vc 1024 > logs/log1123.txt &
+nohup /artifact_top/alloy-gem5/build/RISCV_MESI/gem5.opt --stats-file=stats1124.txt --debug-flags=DOMEM,DOACC --listener-mode=off /artifact_top/alloy-gem5/configs/brg/sc3.py --do-consistency-model TSO_WB --cpu-type TimingSimpleCPU --link-latency 20 --CG_link_latency 150 --garnet-deadlock-threshold 100000 --l2_size 16384kB --l2_assoc 8 --num-dirs 8 --brg-fast-forward --num-cpus 64 --network garnet2.0 --buffer-size 0 --mem-size 16GB --ruby --l1d_size 64kB --mem-type SimpleMemory --num-l1-cache-ports 8 --num-l2caches 8 --ports 16 --l1i_size 64kB --topology TwoMeshXY -c /artifact_top/alloy-apps/build-applrts_sc3/PAD -o "-w 0 -r 1 -n 8 -c 8 -t 8 -p 1" --vcs-per-vnet 64 --buffers-per-data-vc 65536 --buffers-per-ctrl-vc 1024 > logs/log1124.txt &
+nohup /artifact_top/alloy-gem5/build/RISCV_MP/gem5.opt --stats-file=stats1125.txt --debug-flags=DOMEM,DOACC --listener-mode=off /artifact_top/alloy-gem5/configs/brg/sc3.py --do-consistency-model TSO --msg-size PUT_NT:64 --msg-size PUT_REL:72 --cpu-type TimingSimpleCPU --link-latency 20 --CG_link_latency 150 --garnet-deadlock-threshold 100000 --l2_size 16384kB --l2_assoc 8 --num-dirs 8 --brg-fast-forward --num-cpus 64 --network garnet2.0 --buffer-size 0 --mem-size 16GB --ruby --l1d_size 64kB --mem-type SimpleMemory --num-l1-cache-ports 8 --num-l2caches 8 --ports 16 --l1i_size 64kB --topology TwoMeshXY -c /artifact_top/alloy-apps/build-applrts_sc3/PAD -o "-w 0 -r 1 -n 8 -c 8 -t 8 -p 1" --vcs-per-vnet 64 --buffers-per-data-vc 65536 --buffers-per-ctrl-vc 1024 > logs/log1125.txt &
 
 # TQH 126-129 SO traffic is buggy, need special handling
-nohup /artifact_top/alloy-gem5/build/RISCV_DO_MESI_64B_TSO/gem5.opt --stats-file=stats1126.txt --debug-flags=DOMEM,DOACC --listener-mode=off /artifact_top/alloy-gem5/configs/brg/sc3.py --cpu-type TimingSimpleCPU --link-latency 20 --CG_link_latency 150 --garnet-deadlock-threshold 100000 --l2_size 16384kB --l2_assoc 8 --num-dirs 8 --brg-fast-forward --num-cpus 64 --network garnet2.0 --buffer-size 0 --mem-size 16GB --ruby --l1d_size 64kB --mem-type SimpleMemory --num-l1-cache-ports 8 --num-l2caches 8 --ports 16 --l1i_size 64kB --topology TwoMeshXY -c /artifact_top/alloy-apps/build-applrts_sc3/TQH -o "-w 0 -r 2 -n 8 -c 8 -t 8 -p 32 -f /artifact_top/DO_gem5/datasets/basket" --vcs-per-vnet 64 --buffers-per-data-vc 65536 --buffers-per-ctrl-vc 1024 > logs/log1126.txt &
-nohup /artifact_top/alloy-gem5/build/RISCV_WT_MESI_64B_TSO/gem5.opt --stats-file=stats1127.txt --debug-flags=DOMEM,DOACC --listener-mode=off /artifact_top/alloy-gem5/configs/brg/sc3.py --cpu-type TimingSimpleCPU --link-latency 20 --CG_link_latency 150 --garnet-deadlock-threshold 100000 --l2_size 16384kB --l2_assoc 8 --num-dirs 8 --brg-fast-forward --num-cpus 64 --network garnet2.0 --buffer-size 0 --mem-size 16GB --ruby --l1d_size 64kB --mem-type SimpleMemory --num-l1-cache-ports 8 --num-l2caches 8 --ports 16 --l1i_size 64kB --topology TwoMeshXY -c /artifact_top/alloy-apps/build-applrts_sc3/TQH -o "-w 0 -r 2 -n 8 -c 8 -t 8 -p 32 -f /artifact_top/DO_gem5/datasets/basket" --vcs-per-vnet 64 --buffers-per-data-vc 65536 --buffers-per-ctrl-vc 1024 > logs/log1127.txt &
-nohup /artifact_top/alloy-gem5/build/RISCV_MESI_TSO/gem5.opt --stats-file=stats1128.txt --debug-flags=DOMEM,DOACC --listener-mode=off /artifact_top/alloy-gem5/configs/brg/sc3.py --cpu-type TimingSimpleCPU --link-latency 20 --CG_link_latency 150 --garnet-deadlock-threshold 100000 --l2_size 16384kB --l2_assoc 8 --num-dirs 8 --brg-fast-forward --num-cpus 64 --network garnet2.0 --buffer-size 0 --mem-size 16GB --ruby --l1d_size 64kB --mem-type SimpleMemory --num-l1-cache-ports 8 --num-l2caches 8 --ports 16 --l1i_size 64kB --topology TwoMeshXY -c /artifact_top/alloy-apps/build-applrts_sc3/TQH -o "-w 0 -r 2 -n 8 -c 8 -t 8 -p 32 -f /artifact_top/DO_gem5/datasets/basket" --vcs-per-vnet 64 --buffers-per-data-vc 65536 --buffers-per-ctrl-vc 1024 > logs/log1128.txt &
-nohup /artifact_top/alloy-gem5/build/RISCV_MP_64B_TSO/gem5.opt --stats-file=stats1129.txt --debug-flags=DOMEM,DOACC --listener-mode=off /artifact_top/alloy-gem5/configs/brg/sc3.py --cpu-type TimingSimpleCPU --link-latency 20 --CG_link_latency 150 --garnet-deadlock-threshold 100000 --l2_size 16384kB --l2_assoc 8 --num-dirs 8 --brg-fast-forward --num-cpus 64 --network garnet2.0 --buffer-size 0 --mem-size 16GB --ruby --l1d_size 64kB --mem-type SimpleMemory --num-l1-cache-ports 8 --num-l2caches 8 --ports 16 --l1i_size 64kB --topology TwoMeshXY -c /artifact_top/alloy-apps/build-applrts_sc3/TQH -o "-w 0 -r 2 -n 8 -c 8 -t 8 -p 32 -f /artifact_top/DO_gem5/datasets/basket" --vcs-per-vnet 64 --buffers-per-data-vc 65536 --buffers-per-ctrl-vc 1024 > logs/log1129.txt &
+nohup /artifact_top/alloy-gem5/build/RISCV_DO_MESI/gem5.opt --stats-file=stats1126.txt --debug-flags=DOMEM,DOACC --listener-mode=off /artifact_top/alloy-gem5/configs/brg/sc3.py --do-consistency-model TSO --msg-size PUT_NT:64 --msg-size PUT_REL:72 --cpu-type TimingSimpleCPU --link-latency 20 --CG_link_latency 150 --garnet-deadlock-threshold 100000 --l2_size 16384kB --l2_assoc 8 --num-dirs 8 --brg-fast-forward --num-cpus 64 --network garnet2.0 --buffer-size 0 --mem-size 16GB --ruby --l1d_size 64kB --mem-type SimpleMemory --num-l1-cache-ports 8 --num-l2caches 8 --ports 16 --l1i_size 64kB --topology TwoMeshXY -c /artifact_top/alloy-apps/build-applrts_sc3/TQH -o "-w 0 -r 2 -n 8 -c 8 -t 8 -p 32 -f /artifact_top/DO_gem5/datasets/basket" --vcs-per-vnet 64 --buffers-per-data-vc 65536 --buffers-per-ctrl-vc 1024 > logs/log1126.txt &
+nohup /artifact_top/alloy-gem5/build/RISCV_WT_MESI_TSO/gem5.opt --stats-file=stats1127.txt --debug-flags=DOMEM,DOACC --listener-mode=off /artifact_top/alloy-gem5/configs/brg/sc3.py --do-consistency-model TSO --msg-size PUT_NT:64 --msg-size PUT_REL:72 --cpu-type TimingSimpleCPU --link-latency 20 --CG_link_latency 150 --garnet-deadlock-threshold 100000 --l2_size 16384kB --l2_assoc 8 --num-dirs 8 --brg-fast-forward --num-cpus 64 --network garnet2.0 --buffer-size 0 --mem-size 16GB --ruby --l1d_size 64kB --mem-type SimpleMemory --num-l1-cache-ports 8 --num-l2caches 8 --ports 16 --l1i_size 64kB --topology TwoMeshXY -c /artifact_top/alloy-apps/build-applrts_sc3/TQH -o "-w 0 -r 2 -n 8 -c 8 -t 8 -p 32 -f /artifact_top/DO_gem5/datasets/basket" --vcs-per-vnet 64 --buffers-per-data-vc 65536 --buffers-per-ctrl-vc 1024 > logs/log1127.txt &
+nohup /artifact_top/alloy-gem5/build/RISCV_MESI/gem5.opt --stats-file=stats1128.txt --debug-flags=DOMEM,DOACC --listener-mode=off /artifact_top/alloy-gem5/configs/brg/sc3.py --do-consistency-model TSO_WB --cpu-type TimingSimpleCPU --link-latency 20 --CG_link_latency 150 --garnet-deadlock-threshold 100000 --l2_size 16384kB --l2_assoc 8 --num-dirs 8 --brg-fast-forward --num-cpus 64 --network garnet2.0 --buffer-size 0 --mem-size 16GB --ruby --l1d_size 64kB --mem-type SimpleMemory --num-l1-cache-ports 8 --num-l2caches 8 --ports 16 --l1i_size 64kB --topology TwoMeshXY -c /artifact_top/alloy-apps/build-applrts_sc3/TQH -o "-w 0 -r 2 -n 8 -c 8 -t 8 -p 32 -f /artifact_top/DO_gem5/datasets/basket" --vcs-per-vnet 64 --buffers-per-data-vc 65536 --buffers-per-ctrl-vc 1024 > logs/log1128.txt &
+nohup /artifact_top/alloy-gem5/build/RISCV_MP/gem5.opt --stats-file=stats1129.txt --debug-flags=DOMEM,DOACC --listener-mode=off /artifact_top/alloy-gem5/configs/brg/sc3.py --do-consistency-model TSO --msg-size PUT_NT:64 --msg-size PUT_REL:72 --cpu-type TimingSimpleCPU --link-latency 20 --CG_link_latency 150 --garnet-deadlock-threshold 100000 --l2_size 16384kB --l2_assoc 8 --num-dirs 8 --brg-fast-forward --num-cpus 64 --network garnet2.0 --buffer-size 0 --mem-size 16GB --ruby --l1d_size 64kB --mem-type SimpleMemory --num-l1-cache-ports 8 --num-l2caches 8 --ports 16 --l1i_size 64kB --topology TwoMeshXY -c /artifact_top/alloy-apps/build-applrts_sc3/TQH -o "-w 0 -r 2 -n 8 -c 8 -t 8 -p 32 -f /artifact_top/DO_gem5/datasets/basket" --vcs-per-vnet 64 --buffers-per-data-vc 65536 --buffers-per-ctrl-vc 1024 > logs/log1129.txt &
 
 # alltoall_10KB 130-133
-nohup /artifact_top/alloy-gem5/build/RISCV_DO_MESI_64B_TSO/gem5.opt --stats-file=stats1130.txt --debug-flags=DOMEM,DOACC --listener-mode=off /artifact_top/alloy-gem5/configs/brg/sc3.py --cpu-type TimingSimpleCPU --link-latency 20 --CG_link_latency 150 --garnet-deadlock-threshold 100000 --l2_size 16384kB --l2_assoc 8 --num-dirs 8 --brg-fast-forward --num-cpus 64 --network garnet2.0 --buffer-size 0 --mem-size 16GB --ruby --l1d_size 64kB --mem-type SimpleMemory --num-l1-cache-ports 8 --num-l2caches 8 --ports 16 --l1i_size 64kB --topology TwoMeshXY -c /artifact_top/alloy-apps/build-applrts_sc3/run_alltoall -o "-w 0 -r 1 -n 8 -c 8 -t 8 -f 1280 -s 8 -v 0" --vcs-per-vnet 64 --buffers-per-data-vc 65536 --buffers-per-ctrl-vc 1024 > logs/log1130.txt &
-nohup /artifact_top/alloy-gem5/build/RISCV_WT_MESI_64B_TSO/gem5.opt --stats-file=stats1131.txt --debug-flags=DOMEM,DOACC --listener-mode=off /artifact_top/alloy-gem5/configs/brg/sc3.py --cpu-type TimingSimpleCPU --link-latency 20 --CG_link_latency 150 --garnet-deadlock-threshold 100000 --l2_size 16384kB --l2_assoc 8 --num-dirs 8 --brg-fast-forward --num-cpus 64 --network garnet2.0 --buffer-size 0 --mem-size 16GB --ruby --l1d_size 64kB --mem-type SimpleMemory --num-l1-cache-ports 8 --num-l2caches 8 --ports 16 --l1i_size 64kB --topology TwoMeshXY -c /artifact_top/alloy-apps/build-applrts_sc3/run_alltoall -o "-w 0 -r 1 -n 8 -c 8 -t 8 -f 1280 -s 8 -v 0" --vcs-per-vnet 64 --buffers-per-data-vc 65536 --buffers-per-ctrl-vc 1024 > logs/log1131.txt &
-nohup /artifact_top/alloy-gem5/build/RISCV_MESI_TSO/gem5.opt --stats-file=stats1132.txt --debug-flags=DOMEM,DOACC --listener-mode=off /artifact_top/alloy-gem5/configs/brg/sc3.py --cpu-type TimingSimpleCPU --link-latency 20 --CG_link_latency 150 --garnet-deadlock-threshold 100000 --l2_size 16384kB --l2_assoc 8 --num-dirs 8 --brg-fast-forward --num-cpus 64 --network garnet2.0 --buffer-size 0 --mem-size 16GB --ruby --l1d_size 64kB --mem-type SimpleMemory --num-l1-cache-ports 8 --num-l2caches 8 --ports 16 --l1i_size 64kB --topology TwoMeshXY -c /artifact_top/alloy-apps/build-applrts_sc3/run_alltoall -o "-w 0 -r 1 -n 8 -c 8 -t 8 -f 1280 -s 8 -v 0" --vcs-per-vnet 64 --buffers-per-data-vc 65536 --buffers-per-ctrl-vc 1024 > logs/log1132.txt &
-nohup /artifact_top/alloy-gem5/build/RISCV_MP_64B_TSO/gem5.opt --stats-file=stats1133.txt --debug-flags=DOMEM,DOACC --listener-mode=off /artifact_top/alloy-gem5/configs/brg/sc3.py --cpu-type TimingSimpleCPU --link-latency 20 --CG_link_latency 150 --garnet-deadlock-threshold 100000 --l2_size 16384kB --l2_assoc 8 --num-dirs 8 --brg-fast-forward --num-cpus 64 --network garnet2.0 --buffer-size 0 --mem-size 16GB --ruby --l1d_size 64kB --mem-type SimpleMemory --num-l1-cache-ports 8 --num-l2caches 8 --ports 16 --l1i_size 64kB --topology TwoMeshXY -c /artifact_top/alloy-apps/build-applrts_sc3/run_alltoall -o "-w 0 -r 1 -n 8 -c 8 -t 8 -f 1280 -s 8 -v 0" --vcs-per-vnet 64 --buffers-per-data-vc 65536 --buffers-per-ctrl-vc 1024 > logs/log1133.txt &
+nohup /artifact_top/alloy-gem5/build/RISCV_DO_MESI/gem5.opt --stats-file=stats1130.txt --debug-flags=DOMEM,DOACC --listener-mode=off /artifact_top/alloy-gem5/configs/brg/sc3.py --do-consistency-model TSO --msg-size PUT_NT:64 --msg-size PUT_REL:72 --cpu-type TimingSimpleCPU --link-latency 20 --CG_link_latency 150 --garnet-deadlock-threshold 100000 --l2_size 16384kB --l2_assoc 8 --num-dirs 8 --brg-fast-forward --num-cpus 64 --network garnet2.0 --buffer-size 0 --mem-size 16GB --ruby --l1d_size 64kB --mem-type SimpleMemory --num-l1-cache-ports 8 --num-l2caches 8 --ports 16 --l1i_size 64kB --topology TwoMeshXY -c /artifact_top/alloy-apps/build-applrts_sc3/run_alltoall -o "-w 0 -r 1 -n 8 -c 8 -t 8 -f 1280 -s 8 -v 0" --vcs-per-vnet 64 --buffers-per-data-vc 65536 --buffers-per-ctrl-vc 1024 > logs/log1130.txt &
+nohup /artifact_top/alloy-gem5/build/RISCV_WT_MESI_TSO/gem5.opt --stats-file=stats1131.txt --debug-flags=DOMEM,DOACC --listener-mode=off /artifact_top/alloy-gem5/configs/brg/sc3.py --do-consistency-model TSO --msg-size PUT_NT:64 --msg-size PUT_REL:72 --cpu-type TimingSimpleCPU --link-latency 20 --CG_link_latency 150 --garnet-deadlock-threshold 100000 --l2_size 16384kB --l2_assoc 8 --num-dirs 8 --brg-fast-forward --num-cpus 64 --network garnet2.0 --buffer-size 0 --mem-size 16GB --ruby --l1d_size 64kB --mem-type SimpleMemory --num-l1-cache-ports 8 --num-l2caches 8 --ports 16 --l1i_size 64kB --topology TwoMeshXY -c /artifact_top/alloy-apps/build-applrts_sc3/run_alltoall -o "-w 0 -r 1 -n 8 -c 8 -t 8 -f 1280 -s 8 -v 0" --vcs-per-vnet 64 --buffers-per-data-vc 65536 --buffers-per-ctrl-vc 1024 > logs/log1131.txt &
+nohup /artifact_top/alloy-gem5/build/RISCV_MESI/gem5.opt --stats-file=stats1132.txt --debug-flags=DOMEM,DOACC --listener-mode=off /artifact_top/alloy-gem5/configs/brg/sc3.py --do-consistency-model TSO_WB --cpu-type TimingSimpleCPU --link-latency 20 --CG_link_latency 150 --garnet-deadlock-threshold 100000 --l2_size 16384kB --l2_assoc 8 --num-dirs 8 --brg-fast-forward --num-cpus 64 --network garnet2.0 --buffer-size 0 --mem-size 16GB --ruby --l1d_size 64kB --mem-type SimpleMemory --num-l1-cache-ports 8 --num-l2caches 8 --ports 16 --l1i_size 64kB --topology TwoMeshXY -c /artifact_top/alloy-apps/build-applrts_sc3/run_alltoall -o "-w 0 -r 1 -n 8 -c 8 -t 8 -f 1280 -s 8 -v 0" --vcs-per-vnet 64 --buffers-per-data-vc 65536 --buffers-per-ctrl-vc 1024 > logs/log1132.txt &
+nohup /artifact_top/alloy-gem5/build/RISCV_MP/gem5.opt --stats-file=stats1133.txt --debug-flags=DOMEM,DOACC --listener-mode=off /artifact_top/alloy-gem5/configs/brg/sc3.py --do-consistency-model TSO --msg-size PUT_NT:64 --msg-size PUT_REL:72 --cpu-type TimingSimpleCPU --link-latency 20 --CG_link_latency 150 --garnet-deadlock-threshold 100000 --l2_size 16384kB --l2_assoc 8 --num-dirs 8 --brg-fast-forward --num-cpus 64 --network garnet2.0 --buffer-size 0 --mem-size 16GB --ruby --l1d_size 64kB --mem-type SimpleMemory --num-l1-cache-ports 8 --num-l2caches 8 --ports 16 --l1i_size 64kB --topology TwoMeshXY -c /artifact_top/alloy-apps/build-applrts_sc3/run_alltoall -o "-w 0 -r 1 -n 8 -c 8 -t 8 -f 1280 -s 8 -v 0" --vcs-per-vnet 64 --buffers-per-data-vc 65536 --buffers-per-ctrl-vc 1024 > logs/log1133.txt &
 
 # reduce_256B 134-137
-nohup /artifact_top/alloy-gem5/build/RISCV_DO_MESI_64B_TSO/gem5.opt --stats-file=stats1134.txt --debug-flags=DOMEM,DOACC --listener-mode=off /artifact_top/alloy-gem5/configs/brg/sc3.py --cpu-type TimingSimpleCPU --link-latency 20 --CG_link_latency 150 --garnet-deadlock-threshold 100000 --l2_size 16384kB --l2_assoc 8 --num-dirs 8 --brg-fast-forward --num-cpus 64 --network garnet2.0 --buffer-size 0 --mem-size 16GB --ruby --l1d_size 64kB --mem-type SimpleMemory --num-l1-cache-ports 8 --num-l2caches 8 --ports 16 --l1i_size 64kB --topology TwoMeshXY -c /artifact_top/alloy-apps/build-applrts_sc3/run_reduce -o "-w 0 -r 1 -n 8 -c 8 -t 4 -f 64 -s 8 -v 0" --vcs-per-vnet 64 --buffers-per-data-vc 65536 --buffers-per-ctrl-vc 1024 > logs/log1134.txt &
-nohup /artifact_top/alloy-gem5/build/RISCV_WT_MESI_64B_TSO/gem5.opt --stats-file=stats1135.txt --debug-flags=DOMEM,DOACC --listener-mode=off /artifact_top/alloy-gem5/configs/brg/sc3.py --cpu-type TimingSimpleCPU --link-latency 20 --CG_link_latency 150 --garnet-deadlock-threshold 100000 --l2_size 16384kB --l2_assoc 8 --num-dirs 8 --brg-fast-forward --num-cpus 64 --network garnet2.0 --buffer-size 0 --mem-size 16GB --ruby --l1d_size 64kB --mem-type SimpleMemory --num-l1-cache-ports 8 --num-l2caches 8 --ports 16 --l1i_size 64kB --topology TwoMeshXY -c /artifact_top/alloy-apps/build-applrts_sc3/run_reduce -o "-w 0 -r 1 -n 8 -c 8 -t 4 -f 64 -s 8 -v 0" --vcs-per-vnet 64 --buffers-per-data-vc 65536 --buffers-per-ctrl-vc 1024 > logs/log1135.txt &
-nohup /artifact_top/alloy-gem5/build/RISCV_MESI_TSO/gem5.opt --stats-file=stats1136.txt --debug-flags=DOMEM,DOACC --listener-mode=off /artifact_top/alloy-gem5/configs/brg/sc3.py --cpu-type TimingSimpleCPU --link-latency 20 --CG_link_latency 150 --garnet-deadlock-threshold 100000 --l2_size 16384kB --l2_assoc 8 --num-dirs 8 --brg-fast-forward --num-cpus 64 --network garnet2.0 --buffer-size 0 --mem-size 16GB --ruby --l1d_size 64kB --mem-type SimpleMemory --num-l1-cache-ports 8 --num-l2caches 8 --ports 16 --l1i_size 64kB --topology TwoMeshXY -c /artifact_top/alloy-apps/build-applrts_sc3/run_reduce -o "-w 0 -r 1 -n 8 -c 8 -t 4 -f 64 -s 8 -v 0" --vcs-per-vnet 64 --buffers-per-data-vc 65536 --buffers-per-ctrl-vc 1024 > logs/log1136.txt &
-nohup /artifact_top/alloy-gem5/build/RISCV_MP_64B_TSO/gem5.opt --stats-file=stats1137.txt --debug-flags=DOMEM,DOACC --listener-mode=off /artifact_top/alloy-gem5/configs/brg/sc3.py --cpu-type TimingSimpleCPU --link-latency 20 --CG_link_latency 150 --garnet-deadlock-threshold 100000 --l2_size 16384kB --l2_assoc 8 --num-dirs 8 --brg-fast-forward --num-cpus 64 --network garnet2.0 --buffer-size 0 --mem-size 16GB --ruby --l1d_size 64kB --mem-type SimpleMemory --num-l1-cache-ports 8 --num-l2caches 8 --ports 16 --l1i_size 64kB --topology TwoMeshXY -c /artifact_top/alloy-apps/build-applrts_sc3/run_reduce -o "-w 0 -r 1 -n 8 -c 8 -t 4 -f 64 -s 8 -v 0" --vcs-per-vnet 64 --buffers-per-data-vc 65536 --buffers-per-ctrl-vc 1024 > logs/log1137.txt &
+nohup /artifact_top/alloy-gem5/build/RISCV_DO_MESI/gem5.opt --stats-file=stats1134.txt --debug-flags=DOMEM,DOACC --listener-mode=off /artifact_top/alloy-gem5/configs/brg/sc3.py --do-consistency-model TSO --msg-size PUT_NT:64 --msg-size PUT_REL:72 --cpu-type TimingSimpleCPU --link-latency 20 --CG_link_latency 150 --garnet-deadlock-threshold 100000 --l2_size 16384kB --l2_assoc 8 --num-dirs 8 --brg-fast-forward --num-cpus 64 --network garnet2.0 --buffer-size 0 --mem-size 16GB --ruby --l1d_size 64kB --mem-type SimpleMemory --num-l1-cache-ports 8 --num-l2caches 8 --ports 16 --l1i_size 64kB --topology TwoMeshXY -c /artifact_top/alloy-apps/build-applrts_sc3/run_reduce -o "-w 0 -r 1 -n 8 -c 8 -t 4 -f 64 -s 8 -v 0" --vcs-per-vnet 64 --buffers-per-data-vc 65536 --buffers-per-ctrl-vc 1024 > logs/log1134.txt &
+nohup /artifact_top/alloy-gem5/build/RISCV_WT_MESI_TSO/gem5.opt --stats-file=stats1135.txt --debug-flags=DOMEM,DOACC --listener-mode=off /artifact_top/alloy-gem5/configs/brg/sc3.py --do-consistency-model TSO --msg-size PUT_NT:64 --msg-size PUT_REL:72 --cpu-type TimingSimpleCPU --link-latency 20 --CG_link_latency 150 --garnet-deadlock-threshold 100000 --l2_size 16384kB --l2_assoc 8 --num-dirs 8 --brg-fast-forward --num-cpus 64 --network garnet2.0 --buffer-size 0 --mem-size 16GB --ruby --l1d_size 64kB --mem-type SimpleMemory --num-l1-cache-ports 8 --num-l2caches 8 --ports 16 --l1i_size 64kB --topology TwoMeshXY -c /artifact_top/alloy-apps/build-applrts_sc3/run_reduce -o "-w 0 -r 1 -n 8 -c 8 -t 4 -f 64 -s 8 -v 0" --vcs-per-vnet 64 --buffers-per-data-vc 65536 --buffers-per-ctrl-vc 1024 > logs/log1135.txt &
+nohup /artifact_top/alloy-gem5/build/RISCV_MESI/gem5.opt --stats-file=stats1136.txt --debug-flags=DOMEM,DOACC --listener-mode=off /artifact_top/alloy-gem5/configs/brg/sc3.py --do-consistency-model TSO_WB --cpu-type TimingSimpleCPU --link-latency 20 --CG_link_latency 150 --garnet-deadlock-threshold 100000 --l2_size 16384kB --l2_assoc 8 --num-dirs 8 --brg-fast-forward --num-cpus 64 --network garnet2.0 --buffer-size 0 --mem-size 16GB --ruby --l1d_size 64kB --mem-type SimpleMemory --num-l1-cache-ports 8 --num-l2caches 8 --ports 16 --l1i_size 64kB --topology TwoMeshXY -c /artifact_top/alloy-apps/build-applrts_sc3/run_reduce -o "-w 0 -r 1 -n 8 -c 8 -t 4 -f 64 -s 8 -v 0" --vcs-per-vnet 64 --buffers-per-data-vc 65536 --buffers-per-ctrl-vc 1024 > logs/log1136.txt &
+nohup /artifact_top/alloy-gem5/build/RISCV_MP/gem5.opt --stats-file=stats1137.txt --debug-flags=DOMEM,DOACC --listener-mode=off /artifact_top/alloy-gem5/configs/brg/sc3.py --do-consistency-model TSO --msg-size PUT_NT:64 --msg-size PUT_REL:72 --cpu-type TimingSimpleCPU --link-latency 20 --CG_link_latency 150 --garnet-deadlock-threshold 100000 --l2_size 16384kB --l2_assoc 8 --num-dirs 8 --brg-fast-forward --num-cpus 64 --network garnet2.0 --buffer-size 0 --mem-size 16GB --ruby --l1d_size 64kB --mem-type SimpleMemory --num-l1-cache-ports 8 --num-l2caches 8 --ports 16 --l1i_size 64kB --topology TwoMeshXY -c /artifact_top/alloy-apps/build-applrts_sc3/run_reduce -o "-w 0 -r 1 -n 8 -c 8 -t 4 -f 64 -s 8 -v 0" --vcs-per-vnet 64 --buffers-per-data-vc 65536 --buffers-per-ctrl-vc 1024 > logs/log1137.txt &
 
 # reduce_14KB 138-141
-nohup /artifact_top/alloy-gem5/build/RISCV_DO_MESI_64B_TSO/gem5.opt --stats-file=stats1138.txt --debug-flags=DOMEM,DOACC --listener-mode=off /artifact_top/alloy-gem5/configs/brg/sc3.py --cpu-type TimingSimpleCPU --link-latency 20 --CG_link_latency 150 --garnet-deadlock-threshold 100000 --l2_size 16384kB --l2_assoc 8 --num-dirs 8 --brg-fast-forward --num-cpus 64 --network garnet2.0 --buffer-size 0 --mem-size 16GB --ruby --l1d_size 64kB --mem-type SimpleMemory --num-l1-cache-ports 8 --num-l2caches 8 --ports 16 --l1i_size 64kB --topology TwoMeshXY -c /artifact_top/alloy-apps/build-applrts_sc3/run_reduce -o "-w 0 -r 1 -n 8 -c 8 -t 8 -f 3584 -s 8 -v 0" --vcs-per-vnet 64 --buffers-per-data-vc 65536 --buffers-per-ctrl-vc 1024 > logs/log1138.txt &
-nohup /artifact_top/alloy-gem5/build/RISCV_WT_MESI_64B_TSO/gem5.opt --stats-file=stats1139.txt --debug-flags=DOMEM,DOACC --listener-mode=off /artifact_top/alloy-gem5/configs/brg/sc3.py --cpu-type TimingSimpleCPU --link-latency 20 --CG_link_latency 150 --garnet-deadlock-threshold 100000 --l2_size 16384kB --l2_assoc 8 --num-dirs 8 --brg-fast-forward --num-cpus 64 --network garnet2.0 --buffer-size 0 --mem-size 16GB --ruby --l1d_size 64kB --mem-type SimpleMemory --num-l1-cache-ports 8 --num-l2caches 8 --ports 16 --l1i_size 64kB --topology TwoMeshXY -c /artifact_top/alloy-apps/build-applrts_sc3/run_reduce -o "-w 0 -r 1 -n 8 -c 8 -t 8 -f 3584 -s 8 -v 0" --vcs-per-vnet 64 --buffers-per-data-vc 65536 --buffers-per-ctrl-vc 1024 > logs/log1139.txt &
-nohup /artifact_top/alloy-gem5/build/RISCV_MESI_TSO/gem5.opt --stats-file=stats1140.txt --debug-flags=DOMEM,DOACC --listener-mode=off /artifact_top/alloy-gem5/configs/brg/sc3.py --cpu-type TimingSimpleCPU --link-latency 20 --CG_link_latency 150 --garnet-deadlock-threshold 100000 --l2_size 16384kB --l2_assoc 8 --num-dirs 8 --brg-fast-forward --num-cpus 64 --network garnet2.0 --buffer-size 0 --mem-size 16GB --ruby --l1d_size 64kB --mem-type SimpleMemory --num-l1-cache-ports 8 --num-l2caches 8 --ports 16 --l1i_size 64kB --topology TwoMeshXY -c /artifact_top/alloy-apps/build-applrts_sc3/run_reduce -o "-w 0 -r 1 -n 8 -c 8 -t 8 -f 3584 -s 8 -v 0" --vcs-per-vnet 64 --buffers-per-data-vc 65536 --buffers-per-ctrl-vc 1024 > logs/log1140.txt &
-nohup /artifact_top/alloy-gem5/build/RISCV_MP_64B_TSO/gem5.opt --stats-file=stats1141.txt --debug-flags=DOMEM,DOACC --listener-mode=off /artifact_top/alloy-gem5/configs/brg/sc3.py --cpu-type TimingSimpleCPU --link-latency 20 --CG_link_latency 150 --garnet-deadlock-threshold 100000 --l2_size 16384kB --l2_assoc 8 --num-dirs 8 --brg-fast-forward --num-cpus 64 --network garnet2.0 --buffer-size 0 --mem-size 16GB --ruby --l1d_size 64kB --mem-type SimpleMemory --num-l1-cache-ports 8 --num-l2caches 8 --ports 16 --l1i_size 64kB --topology TwoMeshXY -c /artifact_top/alloy-apps/build-applrts_sc3/run_reduce -o "-w 0 -r 1 -n 8 -c 8 -t 8 -f 3584 -s 8 -v 0" --vcs-per-vnet 64 --buffers-per-data-vc 65536 --buffers-per-ctrl-vc 1024 > logs/log1141.txt &
+nohup /artifact_top/alloy-gem5/build/RISCV_DO_MESI/gem5.opt --stats-file=stats1138.txt --debug-flags=DOMEM,DOACC --listener-mode=off /artifact_top/alloy-gem5/configs/brg/sc3.py --do-consistency-model TSO --msg-size PUT_NT:64 --msg-size PUT_REL:72 --cpu-type TimingSimpleCPU --link-latency 20 --CG_link_latency 150 --garnet-deadlock-threshold 100000 --l2_size 16384kB --l2_assoc 8 --num-dirs 8 --brg-fast-forward --num-cpus 64 --network garnet2.0 --buffer-size 0 --mem-size 16GB --ruby --l1d_size 64kB --mem-type SimpleMemory --num-l1-cache-ports 8 --num-l2caches 8 --ports 16 --l1i_size 64kB --topology TwoMeshXY -c /artifact_top/alloy-apps/build-applrts_sc3/run_reduce -o "-w 0 -r 1 -n 8 -c 8 -t 8 -f 3584 -s 8 -v 0" --vcs-per-vnet 64 --buffers-per-data-vc 65536 --buffers-per-ctrl-vc 1024 > logs/log1138.txt &
+nohup /artifact_top/alloy-gem5/build/RISCV_WT_MESI_TSO/gem5.opt --stats-file=stats1139.txt --debug-flags=DOMEM,DOACC --listener-mode=off /artifact_top/alloy-gem5/configs/brg/sc3.py --do-consistency-model TSO --msg-size PUT_NT:64 --msg-size PUT_REL:72 --cpu-type TimingSimpleCPU --link-latency 20 --CG_link_latency 150 --garnet-deadlock-threshold 100000 --l2_size 16384kB --l2_assoc 8 --num-dirs 8 --brg-fast-forward --num-cpus 64 --network garnet2.0 --buffer-size 0 --mem-size 16GB --ruby --l1d_size 64kB --mem-type SimpleMemory --num-l1-cache-ports 8 --num-l2caches 8 --ports 16 --l1i_size 64kB --topology TwoMeshXY -c /artifact_top/alloy-apps/build-applrts_sc3/run_reduce -o "-w 0 -r 1 -n 8 -c 8 -t 8 -f 3584 -s 8 -v 0" --vcs-per-vnet 64 --buffers-per-data-vc 65536 --buffers-per-ctrl-vc 1024 > logs/log1139.txt &
+nohup /artifact_top/alloy-gem5/build/RISCV_MESI/gem5.opt --stats-file=stats1140.txt --debug-flags=DOMEM,DOACC --listener-mode=off /artifact_top/alloy-gem5/configs/brg/sc3.py --do-consistency-model TSO_WB --cpu-type TimingSimpleCPU --link-latency 20 --CG_link_latency 150 --garnet-deadlock-threshold 100000 --l2_size 16384kB --l2_assoc 8 --num-dirs 8 --brg-fast-forward --num-cpus 64 --network garnet2.0 --buffer-size 0 --mem-size 16GB --ruby --l1d_size 64kB --mem-type SimpleMemory --num-l1-cache-ports 8 --num-l2caches 8 --ports 16 --l1i_size 64kB --topology TwoMeshXY -c /artifact_top/alloy-apps/build-applrts_sc3/run_reduce -o "-w 0 -r 1 -n 8 -c 8 -t 8 -f 3584 -s 8 -v 0" --vcs-per-vnet 64 --buffers-per-data-vc 65536 --buffers-per-ctrl-vc 1024 > logs/log1140.txt &
+nohup /artifact_top/alloy-gem5/build/RISCV_MP/gem5.opt --stats-file=stats1141.txt --debug-flags=DOMEM,DOACC --listener-mode=off /artifact_top/alloy-gem5/configs/brg/sc3.py --do-consistency-model TSO --msg-size PUT_NT:64 --msg-size PUT_REL:72 --cpu-type TimingSimpleCPU --link-latency 20 --CG_link_latency 150 --garnet-deadlock-threshold 100000 --l2_size 16384kB --l2_assoc 8 --num-dirs 8 --brg-fast-forward --num-cpus 64 --network garnet2.0 --buffer-size 0 --mem-size 16GB --ruby --l1d_size 64kB --mem-type SimpleMemory --num-l1-cache-ports 8 --num-l2caches 8 --ports 16 --l1i_size 64kB --topology TwoMeshXY -c /artifact_top/alloy-apps/build-applrts_sc3/run_reduce -o "-w 0 -r 1 -n 8 -c 8 -t 8 -f 3584 -s 8 -v 0" --vcs-per-vnet 64 --buffers-per-data-vc 65536 --buffers-per-ctrl-vc 1024 > logs/log1141.txt &
 
 # allreduce_8B 142-145
-nohup /artifact_top/alloy-gem5/build/RISCV_DO_MESI_TSO/gem5.opt --stats-file=stats1142.txt --debug-flags=DOMEM,DOACC --listener-mode=off /artifact_top/alloy-gem5/configs/brg/sc3.py --cpu-type TimingSimpleCPU --link-latency 20 --CG_link_latency 150 --garnet-deadlock-threshold 100000 --l2_size 16384kB --l2_assoc 8 --num-dirs 8 --brg-fast-forward --num-cpus 64 --network garnet2.0 --buffer-size 0 --mem-size 16GB --ruby --l1d_size 64kB --mem-type SimpleMemory --num-l1-cache-ports 8 --num-l2caches 8 --ports 16 --l1i_size 64kB --topology TwoMeshXY -c /artifact_top/alloy-apps/build-applrts_sc3/run_allreduce -o "-w 0 -r 2 -n 8 -c 8 -t 1 -f 128 -s 1000 -v 0" --vcs-per-vnet 64 --buffers-per-data-vc 65536 --buffers-per-ctrl-vc 1024 > logs/log1142.txt &
-nohup /artifact_top/alloy-gem5/build/RISCV_WT_MESI_TSO/gem5.opt --stats-file=stats1143.txt --debug-flags=DOMEM,DOACC --listener-mode=off /artifact_top/alloy-gem5/configs/brg/sc3.py --cpu-type TimingSimpleCPU --link-latency 20 --CG_link_latency 150 --garnet-deadlock-threshold 100000 --l2_size 16384kB --l2_assoc 8 --num-dirs 8 --brg-fast-forward --num-cpus 64 --network garnet2.0 --buffer-size 0 --mem-size 16GB --ruby --l1d_size 64kB --mem-type SimpleMemory --num-l1-cache-ports 8 --num-l2caches 8 --ports 16 --l1i_size 64kB --topology TwoMeshXY -c /artifact_top/alloy-apps/build-applrts_sc3/run_allreduce -o "-w 0 -r 2 -n 8 -c 8 -t 1 -f 128 -s 1000 -v 0" --vcs-per-vnet 64 --buffers-per-data-vc 65536 --buffers-per-ctrl-vc 1024 > logs/log1143.txt &
-nohup /artifact_top/alloy-gem5/build/RISCV_MESI_TSO/gem5.opt --stats-file=stats1144.txt --debug-flags=DOMEM,DOACC --listener-mode=off /artifact_top/alloy-gem5/configs/brg/sc3.py --cpu-type TimingSimpleCPU --link-latency 20 --CG_link_latency 150 --garnet-deadlock-threshold 100000 --l2_size 16384kB --l2_assoc 8 --num-dirs 8 --brg-fast-forward --num-cpus 64 --network garnet2.0 --buffer-size 0 --mem-size 16GB --ruby --l1d_size 64kB --mem-type SimpleMemory --num-l1-cache-ports 8 --num-l2caches 8 --ports 16 --l1i_size 64kB --topology TwoMeshXY -c /artifact_top/alloy-apps/build-applrts_sc3/run_allreduce -o "-w 0 -r 2 -n 8 -c 8 -t 1 -f 128 -s 1000 -v 0" --vcs-per-vnet 64 --buffers-per-data-vc 65536 --buffers-per-ctrl-vc 1024 > logs/log1144.txt &
-nohup /artifact_top/alloy-gem5/build/RISCV_MP_TSO/gem5.opt --stats-file=stats1145.txt --debug-flags=DOMEM,DOACC --listener-mode=off /artifact_top/alloy-gem5/configs/brg/sc3.py --cpu-type TimingSimpleCPU --link-latency 20 --CG_link_latency 150 --garnet-deadlock-threshold 100000 --l2_size 16384kB --l2_assoc 8 --num-dirs 8 --brg-fast-forward --num-cpus 64 --network garnet2.0 --buffer-size 0 --mem-size 16GB --ruby --l1d_size 64kB --mem-type SimpleMemory --num-l1-cache-ports 8 --num-l2caches 8 --ports 16 --l1i_size 64kB --topology TwoMeshXY -c /artifact_top/alloy-apps/build-applrts_sc3/run_allreduce -o "-w 0 -r 2 -n 8 -c 8 -t 1 -f 128 -s 1000 -v 0" --vcs-per-vnet 64 --buffers-per-data-vc 65536 --buffers-per-ctrl-vc 1024 > logs/log1145.txt &
+nohup /artifact_top/alloy-gem5/build/RISCV_DO_MESI/gem5.opt --stats-file=stats1142.txt --debug-flags=DOMEM,DOACC --listener-mode=off /artifact_top/alloy-gem5/configs/brg/sc3.py --do-consistency-model TSO --cpu-type TimingSimpleCPU --link-latency 20 --CG_link_latency 150 --garnet-deadlock-threshold 100000 --l2_size 16384kB --l2_assoc 8 --num-dirs 8 --brg-fast-forward --num-cpus 64 --network garnet2.0 --buffer-size 0 --mem-size 16GB --ruby --l1d_size 64kB --mem-type SimpleMemory --num-l1-cache-ports 8 --num-l2caches 8 --ports 16 --l1i_size 64kB --topology TwoMeshXY -c /artifact_top/alloy-apps/build-applrts_sc3/run_allreduce -o "-w 0 -r 2 -n 8 -c 8 -t 1 -f 128 -s 1000 -v 0" --vcs-per-vnet 64 --buffers-per-data-vc 65536 --buffers-per-ctrl-vc 1024 > logs/log1142.txt &
+nohup /artifact_top/alloy-gem5/build/RISCV_WT_MESI_TSO/gem5.opt --stats-file=stats1143.txt --debug-flags=DOMEM,DOACC --listener-mode=off /artifact_top/alloy-gem5/configs/brg/sc3.py --do-consistency-model TSO --cpu-type TimingSimpleCPU --link-latency 20 --CG_link_latency 150 --garnet-deadlock-threshold 100000 --l2_size 16384kB --l2_assoc 8 --num-dirs 8 --brg-fast-forward --num-cpus 64 --network garnet2.0 --buffer-size 0 --mem-size 16GB --ruby --l1d_size 64kB --mem-type SimpleMemory --num-l1-cache-ports 8 --num-l2caches 8 --ports 16 --l1i_size 64kB --topology TwoMeshXY -c /artifact_top/alloy-apps/build-applrts_sc3/run_allreduce -o "-w 0 -r 2 -n 8 -c 8 -t 1 -f 128 -s 1000 -v 0" --vcs-per-vnet 64 --buffers-per-data-vc 65536 --buffers-per-ctrl-vc 1024 > logs/log1143.txt &
+nohup /artifact_top/alloy-gem5/build/RISCV_MESI/gem5.opt --stats-file=stats1144.txt --debug-flags=DOMEM,DOACC --listener-mode=off /artifact_top/alloy-gem5/configs/brg/sc3.py --do-consistency-model TSO_WB --cpu-type TimingSimpleCPU --link-latency 20 --CG_link_latency 150 --garnet-deadlock-threshold 100000 --l2_size 16384kB --l2_assoc 8 --num-dirs 8 --brg-fast-forward --num-cpus 64 --network garnet2.0 --buffer-size 0 --mem-size 16GB --ruby --l1d_size 64kB --mem-type SimpleMemory --num-l1-cache-ports 8 --num-l2caches 8 --ports 16 --l1i_size 64kB --topology TwoMeshXY -c /artifact_top/alloy-apps/build-applrts_sc3/run_allreduce -o "-w 0 -r 2 -n 8 -c 8 -t 1 -f 128 -s 1000 -v 0" --vcs-per-vnet 64 --buffers-per-data-vc 65536 --buffers-per-ctrl-vc 1024 > logs/log1144.txt &
+nohup /artifact_top/alloy-gem5/build/RISCV_MP/gem5.opt --stats-file=stats1145.txt --debug-flags=DOMEM,DOACC --listener-mode=off /artifact_top/alloy-gem5/configs/brg/sc3.py --do-consistency-model TSO --cpu-type TimingSimpleCPU --link-latency 20 --CG_link_latency 150 --garnet-deadlock-threshold 100000 --l2_size 16384kB --l2_assoc 8 --num-dirs 8 --brg-fast-forward --num-cpus 64 --network garnet2.0 --buffer-size 0 --mem-size 16GB --ruby --l1d_size 64kB --mem-type SimpleMemory --num-l1-cache-ports 8 --num-l2caches 8 --ports 16 --l1i_size 64kB --topology TwoMeshXY -c /artifact_top/alloy-apps/build-applrts_sc3/run_allreduce -o "-w 0 -r 2 -n 8 -c 8 -t 1 -f 128 -s 1000 -v 0" --vcs-per-vnet 64 --buffers-per-data-vc 65536 --buffers-per-ctrl-vc 1024 > logs/log1145.txt &
 
 # bcast_8B 146-149
-nohup /artifact_top/alloy-gem5/build/RISCV_DO_MESI_TSO/gem5.opt --stats-file=stats1146.txt --debug-flags=DOMEM,DOACC --listener-mode=off /artifact_top/alloy-gem5/configs/brg/sc3.py --cpu-type TimingSimpleCPU --link-latency 20 --CG_link_latency 150 --garnet-deadlock-threshold 100000 --l2_size 16384kB --l2_assoc 8 --num-dirs 8 --brg-fast-forward --num-cpus 64 --network garnet2.0 --buffer-size 0 --mem-size 16GB --ruby --l1d_size 64kB --mem-type SimpleMemory --num-l1-cache-ports 8 --num-l2caches 8 --ports 16 --l1i_size 64kB --topology TwoMeshXY -c /artifact_top/alloy-apps/build-applrts_sc3/run_scatter -o "-w 0 -r 2 -n 8 -c 8 -t 1 -f 16 -s 1000 -v 0" --vcs-per-vnet 64 --buffers-per-data-vc 65536 --buffers-per-ctrl-vc 1024 > logs/log1146.txt &
-nohup /artifact_top/alloy-gem5/build/RISCV_WT_MESI_TSO/gem5.opt --stats-file=stats1147.txt --debug-flags=DOMEM,DOACC --listener-mode=off /artifact_top/alloy-gem5/configs/brg/sc3.py --cpu-type TimingSimpleCPU --link-latency 20 --CG_link_latency 150 --garnet-deadlock-threshold 100000 --l2_size 16384kB --l2_assoc 8 --num-dirs 8 --brg-fast-forward --num-cpus 64 --network garnet2.0 --buffer-size 0 --mem-size 16GB --ruby --l1d_size 64kB --mem-type SimpleMemory --num-l1-cache-ports 8 --num-l2caches 8 --ports 16 --l1i_size 64kB --topology TwoMeshXY -c /artifact_top/alloy-apps/build-applrts_sc3/run_scatter -o "-w 0 -r 2 -n 8 -c 8 -t 1 -f 16 -s 1000 -v 0" --vcs-per-vnet 64 --buffers-per-data-vc 65536 --buffers-per-ctrl-vc 1024 > logs/log1147.txt &
-nohup /artifact_top/alloy-gem5/build/RISCV_MESI_TSO/gem5.opt --stats-file=stats1148.txt --debug-flags=DOMEM,DOACC --listener-mode=off /artifact_top/alloy-gem5/configs/brg/sc3.py --cpu-type TimingSimpleCPU --link-latency 20 --CG_link_latency 150 --garnet-deadlock-threshold 100000 --l2_size 16384kB --l2_assoc 8 --num-dirs 8 --brg-fast-forward --num-cpus 64 --network garnet2.0 --buffer-size 0 --mem-size 16GB --ruby --l1d_size 64kB --mem-type SimpleMemory --num-l1-cache-ports 8 --num-l2caches 8 --ports 16 --l1i_size 64kB --topology TwoMeshXY -c /artifact_top/alloy-apps/build-applrts_sc3/run_scatter -o "-w 0 -r 2 -n 8 -c 8 -t 1 -f 16 -s 1000 -v 0" --vcs-per-vnet 64 --buffers-per-data-vc 65536 --buffers-per-ctrl-vc 1024 > logs/log1148.txt &
-nohup /artifact_top/alloy-gem5/build/RISCV_MP_TSO/gem5.opt --stats-file=stats1149.txt --debug-flags=DOMEM,DOACC --listener-mode=off /artifact_top/alloy-gem5/configs/brg/sc3.py --cpu-type TimingSimpleCPU --link-latency 20 --CG_link_latency 150 --garnet-deadlock-threshold 100000 --l2_size 16384kB --l2_assoc 8 --num-dirs 8 --brg-fast-forward --num-cpus 64 --network garnet2.0 --buffer-size 0 --mem-size 16GB --ruby --l1d_size 64kB --mem-type SimpleMemory --num-l1-cache-ports 8 --num-l2caches 8 --ports 16 --l1i_size 64kB --topology TwoMeshXY -c /artifact_top/alloy-apps/build-applrts_sc3/run_scatter -o "-w 0 -r 2 -n 8 -c 8 -t 1 -f 16 -s 1000 -v 0" --vcs-per-vnet 64 --buffers-per-data-vc 65536 --buffers-per-ctrl-vc 1024 > logs/log1149.txt &
+nohup /artifact_top/alloy-gem5/build/RISCV_DO_MESI/gem5.opt --stats-file=stats1146.txt --debug-flags=DOMEM,DOACC --listener-mode=off /artifact_top/alloy-gem5/configs/brg/sc3.py --do-consistency-model TSO --cpu-type TimingSimpleCPU --link-latency 20 --CG_link_latency 150 --garnet-deadlock-threshold 100000 --l2_size 16384kB --l2_assoc 8 --num-dirs 8 --brg-fast-forward --num-cpus 64 --network garnet2.0 --buffer-size 0 --mem-size 16GB --ruby --l1d_size 64kB --mem-type SimpleMemory --num-l1-cache-ports 8 --num-l2caches 8 --ports 16 --l1i_size 64kB --topology TwoMeshXY -c /artifact_top/alloy-apps/build-applrts_sc3/run_scatter -o "-w 0 -r 2 -n 8 -c 8 -t 1 -f 16 -s 1000 -v 0" --vcs-per-vnet 64 --buffers-per-data-vc 65536 --buffers-per-ctrl-vc 1024 > logs/log1146.txt &
+nohup /artifact_top/alloy-gem5/build/RISCV_WT_MESI_TSO/gem5.opt --stats-file=stats1147.txt --debug-flags=DOMEM,DOACC --listener-mode=off /artifact_top/alloy-gem5/configs/brg/sc3.py --do-consistency-model TSO --cpu-type TimingSimpleCPU --link-latency 20 --CG_link_latency 150 --garnet-deadlock-threshold 100000 --l2_size 16384kB --l2_assoc 8 --num-dirs 8 --brg-fast-forward --num-cpus 64 --network garnet2.0 --buffer-size 0 --mem-size 16GB --ruby --l1d_size 64kB --mem-type SimpleMemory --num-l1-cache-ports 8 --num-l2caches 8 --ports 16 --l1i_size 64kB --topology TwoMeshXY -c /artifact_top/alloy-apps/build-applrts_sc3/run_scatter -o "-w 0 -r 2 -n 8 -c 8 -t 1 -f 16 -s 1000 -v 0" --vcs-per-vnet 64 --buffers-per-data-vc 65536 --buffers-per-ctrl-vc 1024 > logs/log1147.txt &
+nohup /artifact_top/alloy-gem5/build/RISCV_MESI/gem5.opt --stats-file=stats1148.txt --debug-flags=DOMEM,DOACC --listener-mode=off /artifact_top/alloy-gem5/configs/brg/sc3.py --do-consistency-model TSO_WB --cpu-type TimingSimpleCPU --link-latency 20 --CG_link_latency 150 --garnet-deadlock-threshold 100000 --l2_size 16384kB --l2_assoc 8 --num-dirs 8 --brg-fast-forward --num-cpus 64 --network garnet2.0 --buffer-size 0 --mem-size 16GB --ruby --l1d_size 64kB --mem-type SimpleMemory --num-l1-cache-ports 8 --num-l2caches 8 --ports 16 --l1i_size 64kB --topology TwoMeshXY -c /artifact_top/alloy-apps/build-applrts_sc3/run_scatter -o "-w 0 -r 2 -n 8 -c 8 -t 1 -f 16 -s 1000 -v 0" --vcs-per-vnet 64 --buffers-per-data-vc 65536 --buffers-per-ctrl-vc 1024 > logs/log1148.txt &
+nohup /artifact_top/alloy-gem5/build/RISCV_MP/gem5.opt --stats-file=stats1149.txt --debug-flags=DOMEM,DOACC --listener-mode=off /artifact_top/alloy-gem5/configs/brg/sc3.py --do-consistency-model TSO --cpu-type TimingSimpleCPU --link-latency 20 --CG_link_latency 150 --garnet-deadlock-threshold 100000 --l2_size 16384kB --l2_assoc 8 --num-dirs 8 --brg-fast-forward --num-cpus 64 --network garnet2.0 --buffer-size 0 --mem-size 16GB --ruby --l1d_size 64kB --mem-type SimpleMemory --num-l1-cache-ports 8 --num-l2caches 8 --ports 16 --l1i_size 64kB --topology TwoMeshXY -c /artifact_top/alloy-apps/build-applrts_sc3/run_scatter -o "-w 0 -r 2 -n 8 -c 8 -t 1 -f 16 -s 1000 -v 0" --vcs-per-vnet 64 --buffers-per-data-vc 65536 --buffers-per-ctrl-vc 1024 > logs/log1149.txt &
 
 # sendrecv_8B 150-153
-nohup /artifact_top/alloy-gem5/build/RISCV_DO_MESI_TSO/gem5.opt --stats-file=stats1150.txt --debug-flags=DOMEM,DOACC --listener-mode=off /artifact_top/alloy-gem5/configs/brg/sc3.py --cpu-type TimingSimpleCPU --link-latency 20 --CG_link_latency 150 --garnet-deadlock-threshold 100000 --l2_size 16384kB --l2_assoc 8 --num-dirs 8 --brg-fast-forward --num-cpus 64 --network garnet2.0 --buffer-size 0 --mem-size 16GB --ruby --l1d_size 64kB --mem-type SimpleMemory --num-l1-cache-ports 8 --num-l2caches 8 --ports 16 --l1i_size 64kB --topology TwoMeshXY -c /artifact_top/alloy-apps/build-applrts_sc3/run_sendrecv -o "-w 0 -r 2 -c 8 -f 16 -s 1000" --vcs-per-vnet 64 --buffers-per-data-vc 65536 --buffers-per-ctrl-vc 1024 > logs/log1150.txt &
-nohup /artifact_top/alloy-gem5/build/RISCV_WT_MESI_TSO/gem5.opt --stats-file=stats1151.txt --debug-flags=DOMEM,DOACC --listener-mode=off /artifact_top/alloy-gem5/configs/brg/sc3.py --cpu-type TimingSimpleCPU --link-latency 20 --CG_link_latency 150 --garnet-deadlock-threshold 100000 --l2_size 16384kB --l2_assoc 8 --num-dirs 8 --brg-fast-forward --num-cpus 64 --network garnet2.0 --buffer-size 0 --mem-size 16GB --ruby --l1d_size 64kB --mem-type SimpleMemory --num-l1-cache-ports 8 --num-l2caches 8 --ports 16 --l1i_size 64kB --topology TwoMeshXY -c /artifact_top/alloy-apps/build-applrts_sc3/run_sendrecv -o "-w 0 -r 2 -c 8 -f 16 -s 1000" --vcs-per-vnet 64 --buffers-per-data-vc 65536 --buffers-per-ctrl-vc 1024 > logs/log1151.txt &
-nohup /artifact_top/alloy-gem5/build/RISCV_MESI_TSO/gem5.opt --stats-file=stats1152.txt --debug-flags=DOMEM,DOACC --listener-mode=off /artifact_top/alloy-gem5/configs/brg/sc3.py --cpu-type TimingSimpleCPU --link-latency 20 --CG_link_latency 150 --garnet-deadlock-threshold 100000 --l2_size 16384kB --l2_assoc 8 --num-dirs 8 --brg-fast-forward --num-cpus 64 --network garnet2.0 --buffer-size 0 --mem-size 16GB --ruby --l1d_size 64kB --mem-type SimpleMemory --num-l1-cache-ports 8 --num-l2caches 8 --ports 16 --l1i_size 64kB --topology TwoMeshXY -c /artifact_top/alloy-apps/build-applrts_sc3/run_sendrecv -o "-w 0 -r 2 -c 8 -f 16 -s 1000" --vcs-per-vnet 64 --buffers-per-data-vc 65536 --buffers-per-ctrl-vc 1024 > logs/log1152.txt &
-nohup /artifact_top/alloy-gem5/build/RISCV_MP_TSO/gem5.opt --stats-file=stats1153.txt --debug-flags=DOMEM,DOACC --listener-mode=off /artifact_top/alloy-gem5/configs/brg/sc3.py --cpu-type TimingSimpleCPU --link-latency 20 --CG_link_latency 150 --garnet-deadlock-threshold 100000 --l2_size 16384kB --l2_assoc 8 --num-dirs 8 --brg-fast-forward --num-cpus 64 --network garnet2.0 --buffer-size 0 --mem-size 16GB --ruby --l1d_size 64kB --mem-type SimpleMemory --num-l1-cache-ports 8 --num-l2caches 8 --ports 16 --l1i_size 64kB --topology TwoMeshXY -c /artifact_top/alloy-apps/build-applrts_sc3/run_sendrecv -o "-w 0 -r 2 -c 8 -f 16 -s 1000" --vcs-per-vnet 64 --buffers-per-data-vc 65536 --buffers-per-ctrl-vc 1024 > logs/log1153.txt &
+nohup /artifact_top/alloy-gem5/build/RISCV_DO_MESI/gem5.opt --stats-file=stats1150.txt --debug-flags=DOMEM,DOACC --listener-mode=off /artifact_top/alloy-gem5/configs/brg/sc3.py --do-consistency-model TSO --cpu-type TimingSimpleCPU --link-latency 20 --CG_link_latency 150 --garnet-deadlock-threshold 100000 --l2_size 16384kB --l2_assoc 8 --num-dirs 8 --brg-fast-forward --num-cpus 64 --network garnet2.0 --buffer-size 0 --mem-size 16GB --ruby --l1d_size 64kB --mem-type SimpleMemory --num-l1-cache-ports 8 --num-l2caches 8 --ports 16 --l1i_size 64kB --topology TwoMeshXY -c /artifact_top/alloy-apps/build-applrts_sc3/run_sendrecv -o "-w 0 -r 2 -c 8 -f 16 -s 1000" --vcs-per-vnet 64 --buffers-per-data-vc 65536 --buffers-per-ctrl-vc 1024 > logs/log1150.txt &
+nohup /artifact_top/alloy-gem5/build/RISCV_WT_MESI_TSO/gem5.opt --stats-file=stats1151.txt --debug-flags=DOMEM,DOACC --listener-mode=off /artifact_top/alloy-gem5/configs/brg/sc3.py --do-consistency-model TSO --cpu-type TimingSimpleCPU --link-latency 20 --CG_link_latency 150 --garnet-deadlock-threshold 100000 --l2_size 16384kB --l2_assoc 8 --num-dirs 8 --brg-fast-forward --num-cpus 64 --network garnet2.0 --buffer-size 0 --mem-size 16GB --ruby --l1d_size 64kB --mem-type SimpleMemory --num-l1-cache-ports 8 --num-l2caches 8 --ports 16 --l1i_size 64kB --topology TwoMeshXY -c /artifact_top/alloy-apps/build-applrts_sc3/run_sendrecv -o "-w 0 -r 2 -c 8 -f 16 -s 1000" --vcs-per-vnet 64 --buffers-per-data-vc 65536 --buffers-per-ctrl-vc 1024 > logs/log1151.txt &
+nohup /artifact_top/alloy-gem5/build/RISCV_MESI/gem5.opt --stats-file=stats1152.txt --debug-flags=DOMEM,DOACC --listener-mode=off /artifact_top/alloy-gem5/configs/brg/sc3.py --do-consistency-model TSO_WB --cpu-type TimingSimpleCPU --link-latency 20 --CG_link_latency 150 --garnet-deadlock-threshold 100000 --l2_size 16384kB --l2_assoc 8 --num-dirs 8 --brg-fast-forward --num-cpus 64 --network garnet2.0 --buffer-size 0 --mem-size 16GB --ruby --l1d_size 64kB --mem-type SimpleMemory --num-l1-cache-ports 8 --num-l2caches 8 --ports 16 --l1i_size 64kB --topology TwoMeshXY -c /artifact_top/alloy-apps/build-applrts_sc3/run_sendrecv -o "-w 0 -r 2 -c 8 -f 16 -s 1000" --vcs-per-vnet 64 --buffers-per-data-vc 65536 --buffers-per-ctrl-vc 1024 > logs/log1152.txt &
+nohup /artifact_top/alloy-gem5/build/RISCV_MP/gem5.opt --stats-file=stats1153.txt --debug-flags=DOMEM,DOACC --listener-mode=off /artifact_top/alloy-gem5/configs/brg/sc3.py --do-consistency-model TSO --cpu-type TimingSimpleCPU --link-latency 20 --CG_link_latency 150 --garnet-deadlock-threshold 100000 --l2_size 16384kB --l2_assoc 8 --num-dirs 8 --brg-fast-forward --num-cpus 64 --network garnet2.0 --buffer-size 0 --mem-size 16GB --ruby --l1d_size 64kB --mem-type SimpleMemory --num-l1-cache-ports 8 --num-l2caches 8 --ports 16 --l1i_size 64kB --topology TwoMeshXY -c /artifact_top/alloy-apps/build-applrts_sc3/run_sendrecv -o "-w 0 -r 2 -c 8 -f 16 -s 1000" --vcs-per-vnet 64 --buffers-per-data-vc 65536 --buffers-per-ctrl-vc 1024 > logs/log1153.txt &
 
 # sendrecv_512B 154-157
-nohup /artifact_top/alloy-gem5/build/RISCV_DO_MESI_64B_TSO/gem5.opt --stats-file=stats1154.txt --debug-flags=DOMEM,DOACC --listener-mode=off /artifact_top/alloy-gem5/configs/brg/sc3.py --cpu-type TimingSimpleCPU --link-latency 20 --CG_link_latency 150 --garnet-deadlock-threshold 100000 --l2_size 16384kB --l2_assoc 8 --num-dirs 8 --brg-fast-forward --num-cpus 64 --network garnet2.0 --buffer-size 0 --mem-size 16GB --ruby --l1d_size 64kB --mem-type SimpleMemory --num-l1-cache-ports 8 --num-l2caches 8 --ports 16 --l1i_size 64kB --topology TwoMeshXY -c /artifact_top/alloy-apps/build-applrts_sc3/run_sendrecv -o "-w 0 -r 2 -c 8 -f 128 -s 8" --vcs-per-vnet 64 --buffers-per-data-vc 65536 --buffers-per-ctrl-vc 1024 > logs/log1154.txt &
-nohup /artifact_top/alloy-gem5/build/RISCV_WT_MESI_64B_TSO/gem5.opt --stats-file=stats1155.txt --debug-flags=DOMEM,DOACC --listener-mode=off /artifact_top/alloy-gem5/configs/brg/sc3.py --cpu-type TimingSimpleCPU --link-latency 20 --CG_link_latency 150 --garnet-deadlock-threshold 100000 --l2_size 16384kB --l2_assoc 8 --num-dirs 8 --brg-fast-forward --num-cpus 64 --network garnet2.0 --buffer-size 0 --mem-size 16GB --ruby --l1d_size 64kB --mem-type SimpleMemory --num-l1-cache-ports 8 --num-l2caches 8 --ports 16 --l1i_size 64kB --topology TwoMeshXY -c /artifact_top/alloy-apps/build-applrts_sc3/run_sendrecv -o "-w 0 -r 2 -c 8 -f 128 -s 8" --vcs-per-vnet 64 --buffers-per-data-vc 65536 --buffers-per-ctrl-vc 1024 > logs/log1155.txt &
-nohup /artifact_top/alloy-gem5/build/RISCV_MESI_TSO/gem5.opt --stats-file=stats1156.txt --debug-flags=DOMEM,DOACC --listener-mode=off /artifact_top/alloy-gem5/configs/brg/sc3.py --cpu-type TimingSimpleCPU --link-latency 20 --CG_link_latency 150 --garnet-deadlock-threshold 100000 --l2_size 16384kB --l2_assoc 8 --num-dirs 8 --brg-fast-forward --num-cpus 64 --network garnet2.0 --buffer-size 0 --mem-size 16GB --ruby --l1d_size 64kB --mem-type SimpleMemory --num-l1-cache-ports 8 --num-l2caches 8 --ports 16 --l1i_size 64kB --topology TwoMeshXY -c /artifact_top/alloy-apps/build-applrts_sc3/run_sendrecv -o "-w 0 -r 2 -c 8 -f 128 -s 8" --vcs-per-vnet 64 --buffers-per-data-vc 65536 --buffers-per-ctrl-vc 1024 > logs/log1156.txt &
-nohup /artifact_top/alloy-gem5/build/RISCV_MP_64B_TSO/gem5.opt --stats-file=stats1157.txt --debug-flags=DOMEM,DOACC --listener-mode=off /artifact_top/alloy-gem5/configs/brg/sc3.py --cpu-type TimingSimpleCPU --link-latency 20 --CG_link_latency 150 --garnet-deadlock-threshold 100000 --l2_size 16384kB --l2_assoc 8 --num-dirs 8 --brg-fast-forward --num-cpus 64 --network garnet2.0 --buffer-size 0 --mem-size 16GB --ruby --l1d_size 64kB --mem-type SimpleMemory --num-l1-cache-ports 8 --num-l2caches 8 --ports 16 --l1i_size 64kB --topology TwoMeshXY -c /artifact_top/alloy-apps/build-applrts_sc3/run_sendrecv -o "-w 0 -r 2 -c 8 -f 128 -s 8" --vcs-per-vnet 64 --buffers-per-data-vc 65536 --buffers-per-ctrl-vc 1024 > logs/log1157.txt &
+nohup /artifact_top/alloy-gem5/build/RISCV_DO_MESI/gem5.opt --stats-file=stats1154.txt --debug-flags=DOMEM,DOACC --listener-mode=off /artifact_top/alloy-gem5/configs/brg/sc3.py --do-consistency-model TSO --msg-size PUT_NT:64 --msg-size PUT_REL:72 --cpu-type TimingSimpleCPU --link-latency 20 --CG_link_latency 150 --garnet-deadlock-threshold 100000 --l2_size 16384kB --l2_assoc 8 --num-dirs 8 --brg-fast-forward --num-cpus 64 --network garnet2.0 --buffer-size 0 --mem-size 16GB --ruby --l1d_size 64kB --mem-type SimpleMemory --num-l1-cache-ports 8 --num-l2caches 8 --ports 16 --l1i_size 64kB --topology TwoMeshXY -c /artifact_top/alloy-apps/build-applrts_sc3/run_sendrecv -o "-w 0 -r 2 -c 8 -f 128 -s 8" --vcs-per-vnet 64 --buffers-per-data-vc 65536 --buffers-per-ctrl-vc 1024 > logs/log1154.txt &
+nohup /artifact_top/alloy-gem5/build/RISCV_WT_MESI_TSO/gem5.opt --stats-file=stats1155.txt --debug-flags=DOMEM,DOACC --listener-mode=off /artifact_top/alloy-gem5/configs/brg/sc3.py --do-consistency-model TSO --msg-size PUT_NT:64 --msg-size PUT_REL:72 --cpu-type TimingSimpleCPU --link-latency 20 --CG_link_latency 150 --garnet-deadlock-threshold 100000 --l2_size 16384kB --l2_assoc 8 --num-dirs 8 --brg-fast-forward --num-cpus 64 --network garnet2.0 --buffer-size 0 --mem-size 16GB --ruby --l1d_size 64kB --mem-type SimpleMemory --num-l1-cache-ports 8 --num-l2caches 8 --ports 16 --l1i_size 64kB --topology TwoMeshXY -c /artifact_top/alloy-apps/build-applrts_sc3/run_sendrecv -o "-w 0 -r 2 -c 8 -f 128 -s 8" --vcs-per-vnet 64 --buffers-per-data-vc 65536 --buffers-per-ctrl-vc 1024 > logs/log1155.txt &
+nohup /artifact_top/alloy-gem5/build/RISCV_MESI/gem5.opt --stats-file=stats1156.txt --debug-flags=DOMEM,DOACC --listener-mode=off /artifact_top/alloy-gem5/configs/brg/sc3.py --do-consistency-model TSO_WB --cpu-type TimingSimpleCPU --link-latency 20 --CG_link_latency 150 --garnet-deadlock-threshold 100000 --l2_size 16384kB --l2_assoc 8 --num-dirs 8 --brg-fast-forward --num-cpus 64 --network garnet2.0 --buffer-size 0 --mem-size 16GB --ruby --l1d_size 64kB --mem-type SimpleMemory --num-l1-cache-ports 8 --num-l2caches 8 --ports 16 --l1i_size 64kB --topology TwoMeshXY -c /artifact_top/alloy-apps/build-applrts_sc3/run_sendrecv -o "-w 0 -r 2 -c 8 -f 128 -s 8" --vcs-per-vnet 64 --buffers-per-data-vc 65536 --buffers-per-ctrl-vc 1024 > logs/log1156.txt &
+nohup /artifact_top/alloy-gem5/build/RISCV_MP/gem5.opt --stats-file=stats1157.txt --debug-flags=DOMEM,DOACC --listener-mode=off /artifact_top/alloy-gem5/configs/brg/sc3.py --do-consistency-model TSO --msg-size PUT_NT:64 --msg-size PUT_REL:72 --cpu-type TimingSimpleCPU --link-latency 20 --CG_link_latency 150 --garnet-deadlock-threshold 100000 --l2_size 16384kB --l2_assoc 8 --num-dirs 8 --brg-fast-forward --num-cpus 64 --network garnet2.0 --buffer-size 0 --mem-size 16GB --ruby --l1d_size 64kB --mem-type SimpleMemory --num-l1-cache-ports 8 --num-l2caches 8 --ports 16 --l1i_size 64kB --topology TwoMeshXY -c /artifact_top/alloy-apps/build-applrts_sc3/run_sendrecv -o "-w 0 -r 2 -c 8 -f 128 -s 8" --vcs-per-vnet 64 --buffers-per-data-vc 65536 --buffers-per-ctrl-vc 1024 > logs/log1157.txt &
 
 # barrier 158-161
-nohup /artifact_top/alloy-gem5/build/RISCV_DO_MESI_TSO/gem5.opt --stats-file=stats1158.txt --debug-flags=DOMEM,DOACC --listener-mode=off /artifact_top/alloy-gem5/configs/brg/sc3.py --cpu-type TimingSimpleCPU --link-latency 20 --CG_link_latency 150 --garnet-deadlock-threshold 100000 --l2_size 16384kB --l2_assoc 8 --num-dirs 8 --brg-fast-forward --num-cpus 64 --network garnet2.0 --buffer-size 0 --mem-size 16GB --ruby --l1d_size 64kB --mem-type SimpleMemory --num-l1-cache-ports 8 --num-l2caches 8 --ports 16 --l1i_size 64kB --topology TwoMeshXY -c /artifact_top/alloy-apps/build-applrts_sc3/run_barrier -o "-w 0 -r 2 -n 8 -c 8 -t 8" --vcs-per-vnet 64 --buffers-per-data-vc 65536 --buffers-per-ctrl-vc 1024 > logs/log1158.txt &
-nohup /artifact_top/alloy-gem5/build/RISCV_WT_MESI_TSO/gem5.opt --stats-file=stats1159.txt --debug-flags=DOMEM,DOACC --listener-mode=off /artifact_top/alloy-gem5/configs/brg/sc3.py --cpu-type TimingSimpleCPU --link-latency 20 --CG_link_latency 150 --garnet-deadlock-threshold 100000 --l2_size 16384kB --l2_assoc 8 --num-dirs 8 --brg-fast-forward --num-cpus 64 --network garnet2.0 --buffer-size 0 --mem-size 16GB --ruby --l1d_size 64kB --mem-type SimpleMemory --num-l1-cache-ports 8 --num-l2caches 8 --ports 16 --l1i_size 64kB --topology TwoMeshXY -c /artifact_top/alloy-apps/build-applrts_sc3/run_barrier -o "-w 0 -r 2 -n 8 -c 8 -t 8" --vcs-per-vnet 64 --buffers-per-data-vc 65536 --buffers-per-ctrl-vc 1024 > logs/log1159.txt &
-nohup /artifact_top/alloy-gem5/build/RISCV_MESI_TSO/gem5.opt --stats-file=stats1160.txt --debug-flags=DOMEM,DOACC --listener-mode=off /artifact_top/alloy-gem5/configs/brg/sc3.py --cpu-type TimingSimpleCPU --link-latency 20 --CG_link_latency 150 --garnet-deadlock-threshold 100000 --l2_size 16384kB --l2_assoc 8 --num-dirs 8 --brg-fast-forward --num-cpus 64 --network garnet2.0 --buffer-size 0 --mem-size 16GB --ruby --l1d_size 64kB --mem-type SimpleMemory --num-l1-cache-ports 8 --num-l2caches 8 --ports 16 --l1i_size 64kB --topology TwoMeshXY -c /artifact_top/alloy-apps/build-applrts_sc3/run_barrier -o "-w 0 -r 2 -n 8 -c 8 -t 8" --vcs-per-vnet 64 --buffers-per-data-vc 65536 --buffers-per-ctrl-vc 1024 > logs/log1160.txt &
-nohup /artifact_top/alloy-gem5/build/RISCV_MP_TSO/gem5.opt --stats-file=stats1161.txt --debug-flags=DOMEM,DOACC --listener-mode=off /artifact_top/alloy-gem5/configs/brg/sc3.py --cpu-type TimingSimpleCPU --link-latency 20 --CG_link_latency 150 --garnet-deadlock-threshold 100000 --l2_size 16384kB --l2_assoc 8 --num-dirs 8 --brg-fast-forward --num-cpus 64 --network garnet2.0 --buffer-size 0 --mem-size 16GB --ruby --l1d_size 64kB --mem-type SimpleMemory --num-l1-cache-ports 8 --num-l2caches 8 --ports 16 --l1i_size 64kB --topology TwoMeshXY -c /artifact_top/alloy-apps/build-applrts_sc3/run_barrier -o "-w 0 -r 2 -n 8 -c 8 -t 8" --vcs-per-vnet 64 --buffers-per-data-vc 65536 --buffers-per-ctrl-vc 1024 > logs/log1161.txt &
+nohup /artifact_top/alloy-gem5/build/RISCV_DO_MESI/gem5.opt --stats-file=stats1158.txt --debug-flags=DOMEM,DOACC --listener-mode=off /artifact_top/alloy-gem5/configs/brg/sc3.py --do-consistency-model TSO --cpu-type TimingSimpleCPU --link-latency 20 --CG_link_latency 150 --garnet-deadlock-threshold 100000 --l2_size 16384kB --l2_assoc 8 --num-dirs 8 --brg-fast-forward --num-cpus 64 --network garnet2.0 --buffer-size 0 --mem-size 16GB --ruby --l1d_size 64kB --mem-type SimpleMemory --num-l1-cache-ports 8 --num-l2caches 8 --ports 16 --l1i_size 64kB --topology TwoMeshXY -c /artifact_top/alloy-apps/build-applrts_sc3/run_barrier -o "-w 0 -r 2 -n 8 -c 8 -t 8" --vcs-per-vnet 64 --buffers-per-data-vc 65536 --buffers-per-ctrl-vc 1024 > logs/log1158.txt &
+nohup /artifact_top/alloy-gem5/build/RISCV_WT_MESI_TSO/gem5.opt --stats-file=stats1159.txt --debug-flags=DOMEM,DOACC --listener-mode=off /artifact_top/alloy-gem5/configs/brg/sc3.py --do-consistency-model TSO --cpu-type TimingSimpleCPU --link-latency 20 --CG_link_latency 150 --garnet-deadlock-threshold 100000 --l2_size 16384kB --l2_assoc 8 --num-dirs 8 --brg-fast-forward --num-cpus 64 --network garnet2.0 --buffer-size 0 --mem-size 16GB --ruby --l1d_size 64kB --mem-type SimpleMemory --num-l1-cache-ports 8 --num-l2caches 8 --ports 16 --l1i_size 64kB --topology TwoMeshXY -c /artifact_top/alloy-apps/build-applrts_sc3/run_barrier -o "-w 0 -r 2 -n 8 -c 8 -t 8" --vcs-per-vnet 64 --buffers-per-data-vc 65536 --buffers-per-ctrl-vc 1024 > logs/log1159.txt &
+nohup /artifact_top/alloy-gem5/build/RISCV_MESI/gem5.opt --stats-file=stats1160.txt --debug-flags=DOMEM,DOACC --listener-mode=off /artifact_top/alloy-gem5/configs/brg/sc3.py --do-consistency-model TSO_WB --cpu-type TimingSimpleCPU --link-latency 20 --CG_link_latency 150 --garnet-deadlock-threshold 100000 --l2_size 16384kB --l2_assoc 8 --num-dirs 8 --brg-fast-forward --num-cpus 64 --network garnet2.0 --buffer-size 0 --mem-size 16GB --ruby --l1d_size 64kB --mem-type SimpleMemory --num-l1-cache-ports 8 --num-l2caches 8 --ports 16 --l1i_size 64kB --topology TwoMeshXY -c /artifact_top/alloy-apps/build-applrts_sc3/run_barrier -o "-w 0 -r 2 -n 8 -c 8 -t 8" --vcs-per-vnet 64 --buffers-per-data-vc 65536 --buffers-per-ctrl-vc 1024 > logs/log1160.txt &
+nohup /artifact_top/alloy-gem5/build/RISCV_MP/gem5.opt --stats-file=stats1161.txt --debug-flags=DOMEM,DOACC --listener-mode=off /artifact_top/alloy-gem5/configs/brg/sc3.py --do-consistency-model TSO --cpu-type TimingSimpleCPU --link-latency 20 --CG_link_latency 150 --garnet-deadlock-threshold 100000 --l2_size 16384kB --l2_assoc 8 --num-dirs 8 --brg-fast-forward --num-cpus 64 --network garnet2.0 --buffer-size 0 --mem-size 16GB --ruby --l1d_size 64kB --mem-type SimpleMemory --num-l1-cache-ports 8 --num-l2caches 8 --ports 16 --l1i_size 64kB --topology TwoMeshXY -c /artifact_top/alloy-apps/build-applrts_sc3/run_barrier -o "-w 0 -r 2 -n 8 -c 8 -t 8" --vcs-per-vnet 64 --buffers-per-data-vc 65536 --buffers-per-ctrl-vc 1024 > logs/log1161.txt &
 
 # UPI
 
 # SSSP 162-165
-nohup /artifact_top/alloy-gem5/build/RISCV_DO_MESI_TSO/gem5.opt --stats-file=stats1162.txt --debug-flags=DOMEM,DOACC --listener-mode=off /artifact_top/alloy-gem5/configs/brg/sc3.py --cpu-type TimingSimpleCPU --link-latency 20 --CG_link_latency 50 --garnet-deadlock-threshold 100000 --l2_size 16384kB --l2_assoc 8 --num-dirs 8 --brg-fast-forward --num-cpus 64 --network garnet2.0 --buffer-size 0 --mem-size 16GB --ruby --l1d_size 64kB --mem-type SimpleMemory --num-l1-cache-ports 8 --num-l2caches 8 --ports 16 --l1i_size 64kB --topology TwoMeshXY -c /artifact_top/alloy-apps/build-applrts_sc3/SSSP -o "-w 0 -r 1 -n 8 -c 8 -t 8 -l 1 -u 64 -b 32 -f /artifact_top/DO_gem5/datasets/olesnik0_out.csr" --vcs-per-vnet 64 --buffers-per-data-vc 65536 --buffers-per-ctrl-vc 1024 > logs/log1162.txt &
-nohup /artifact_top/alloy-gem5/build/RISCV_WT_MESI_TSO/gem5.opt --stats-file=stats1163.txt --debug-flags=DOMEM,DOACC --listener-mode=off /artifact_top/alloy-gem5/configs/brg/sc3.py --cpu-type TimingSimpleCPU --link-latency 20 --CG_link_latency 50 --garnet-deadlock-threshold 100000 --l2_size 16384kB --l2_assoc 8 --num-dirs 8 --brg-fast-forward --num-cpus 64 --network garnet2.0 --buffer-size 0 --mem-size 16GB --ruby --l1d_size 64kB --mem-type SimpleMemory --num-l1-cache-ports 8 --num-l2caches 8 --ports 16 --l1i_size 64kB --topology TwoMeshXY -c /artifact_top/alloy-apps/build-applrts_sc3/SSSP -o "-w 0 -r 1 -n 8 -c 8 -t 8 -l 1 -u 64 -b 32 -f /artifact_top/DO_gem5/datasets/olesnik0_out.csr" --vcs-per-vnet 64 --buffers-per-data-vc 65536 --buffers-per-ctrl-vc 1024 > logs/log1163.txt &
-nohup /artifact_top/alloy-gem5/build/RISCV_MESI_TSO/gem5.opt --stats-file=stats1164.txt --debug-flags=DOMEM,DOACC --listener-mode=off /artifact_top/alloy-gem5/configs/brg/sc3.py --cpu-type TimingSimpleCPU --link-latency 20 --CG_link_latency 50 --garnet-deadlock-threshold 100000 --l2_size 16384kB --l2_assoc 8 --num-dirs 8 --brg-fast-forward --num-cpus 64 --network garnet2.0 --buffer-size 0 --mem-size 16GB --ruby --l1d_size 64kB --mem-type SimpleMemory --num-l1-cache-ports 8 --num-l2caches 8 --ports 16 --l1i_size 64kB --topology TwoMeshXY -c /artifact_top/alloy-apps/build-applrts_sc3/SSSP -o "-w 0 -r 1 -n 8 -c 8 -t 8 -l 1 -u 64 -b 32 -f /artifact_top/DO_gem5/datasets/olesnik0_out.csr" --vcs-per-vnet 64 --buffers-per-data-vc 65536 --buffers-per-ctrl-vc 1024 > logs/log1164.txt &
-nohup /artifact_top/alloy-gem5/build/RISCV_MP_TSO/gem5.opt --stats-file=stats1165.txt --debug-flags=DOMEM,DOACC --listener-mode=off /artifact_top/alloy-gem5/configs/brg/sc3.py --cpu-type TimingSimpleCPU --link-latency 20 --CG_link_latency 50 --garnet-deadlock-threshold 100000 --l2_size 16384kB --l2_assoc 8 --num-dirs 8 --brg-fast-forward --num-cpus 64 --network garnet2.0 --buffer-size 0 --mem-size 16GB --ruby --l1d_size 64kB --mem-type SimpleMemory --num-l1-cache-ports 8 --num-l2caches 8 --ports 16 --l1i_size 64kB --topology TwoMeshXY -c /artifact_top/alloy-apps/build-applrts_sc3/SSSP -o "-w 0 -r 1 -n 8 -c 8 -t 8 -l 1 -u 64 -b 32 -f /artifact_top/DO_gem5/datasets/olesnik0_out.csr" --vcs-per-vnet 64 --buffers-per-data-vc 65536 --buffers-per-ctrl-vc 1024 > logs/log1165.txt &
+nohup /artifact_top/alloy-gem5/build/RISCV_DO_MESI/gem5.opt --stats-file=stats1162.txt --debug-flags=DOMEM,DOACC --listener-mode=off /artifact_top/alloy-gem5/configs/brg/sc3.py --do-consistency-model TSO --cpu-type TimingSimpleCPU --link-latency 20 --CG_link_latency 50 --garnet-deadlock-threshold 100000 --l2_size 16384kB --l2_assoc 8 --num-dirs 8 --brg-fast-forward --num-cpus 64 --network garnet2.0 --buffer-size 0 --mem-size 16GB --ruby --l1d_size 64kB --mem-type SimpleMemory --num-l1-cache-ports 8 --num-l2caches 8 --ports 16 --l1i_size 64kB --topology TwoMeshXY -c /artifact_top/alloy-apps/build-applrts_sc3/SSSP -o "-w 0 -r 1 -n 8 -c 8 -t 8 -l 1 -u 64 -b 32 -f /artifact_top/DO_gem5/datasets/olesnik0_out.csr" --vcs-per-vnet 64 --buffers-per-data-vc 65536 --buffers-per-ctrl-vc 1024 > logs/log1162.txt &
+nohup /artifact_top/alloy-gem5/build/RISCV_WT_MESI_TSO/gem5.opt --stats-file=stats1163.txt --debug-flags=DOMEM,DOACC --listener-mode=off /artifact_top/alloy-gem5/configs/brg/sc3.py --do-consistency-model TSO --cpu-type TimingSimpleCPU --link-latency 20 --CG_link_latency 50 --garnet-deadlock-threshold 100000 --l2_size 16384kB --l2_assoc 8 --num-dirs 8 --brg-fast-forward --num-cpus 64 --network garnet2.0 --buffer-size 0 --mem-size 16GB --ruby --l1d_size 64kB --mem-type SimpleMemory --num-l1-cache-ports 8 --num-l2caches 8 --ports 16 --l1i_size 64kB --topology TwoMeshXY -c /artifact_top/alloy-apps/build-applrts_sc3/SSSP -o "-w 0 -r 1 -n 8 -c 8 -t 8 -l 1 -u 64 -b 32 -f /artifact_top/DO_gem5/datasets/olesnik0_out.csr" --vcs-per-vnet 64 --buffers-per-data-vc 65536 --buffers-per-ctrl-vc 1024 > logs/log1163.txt &
+nohup /artifact_top/alloy-gem5/build/RISCV_MESI/gem5.opt --stats-file=stats1164.txt --debug-flags=DOMEM,DOACC --listener-mode=off /artifact_top/alloy-gem5/configs/brg/sc3.py --do-consistency-model TSO_WB --cpu-type TimingSimpleCPU --link-latency 20 --CG_link_latency 50 --garnet-deadlock-threshold 100000 --l2_size 16384kB --l2_assoc 8 --num-dirs 8 --brg-fast-forward --num-cpus 64 --network garnet2.0 --buffer-size 0 --mem-size 16GB --ruby --l1d_size 64kB --mem-type SimpleMemory --num-l1-cache-ports 8 --num-l2caches 8 --ports 16 --l1i_size 64kB --topology TwoMeshXY -c /artifact_top/alloy-apps/build-applrts_sc3/SSSP -o "-w 0 -r 1 -n 8 -c 8 -t 8 -l 1 -u 64 -b 32 -f /artifact_top/DO_gem5/datasets/olesnik0_out.csr" --vcs-per-vnet 64 --buffers-per-data-vc 65536 --buffers-per-ctrl-vc 1024 > logs/log1164.txt &
+nohup /artifact_top/alloy-gem5/build/RISCV_MP/gem5.opt --stats-file=stats1165.txt --debug-flags=DOMEM,DOACC --listener-mode=off /artifact_top/alloy-gem5/configs/brg/sc3.py --do-consistency-model TSO --cpu-type TimingSimpleCPU --link-latency 20 --CG_link_latency 50 --garnet-deadlock-threshold 100000 --l2_size 16384kB --l2_assoc 8 --num-dirs 8 --brg-fast-forward --num-cpus 64 --network garnet2.0 --buffer-size 0 --mem-size 16GB --ruby --l1d_size 64kB --mem-type SimpleMemory --num-l1-cache-ports 8 --num-l2caches 8 --ports 16 --l1i_size 64kB --topology TwoMeshXY -c /artifact_top/alloy-apps/build-applrts_sc3/SSSP -o "-w 0 -r 1 -n 8 -c 8 -t 8 -l 1 -u 64 -b 32 -f /artifact_top/DO_gem5/datasets/olesnik0_out.csr" --vcs-per-vnet 64 --buffers-per-data-vc 65536 --buffers-per-ctrl-vc 1024 > logs/log1165.txt &
 # SSSP warmup runs 166-169
-nohup /artifact_top/alloy-gem5/build/RISCV_DO_MESI_TSO/gem5.opt --stats-file=stats1166.txt --debug-flags=DOMEM,DOACC --listener-mode=off /artifact_top/alloy-gem5/configs/brg/sc3.py --cpu-type TimingSimpleCPU --link-latency 20 --CG_link_latency 50 --garnet-deadlock-threshold 100000 --l2_size 16384kB --l2_assoc 8 --num-dirs 8 --brg-fast-forward --num-cpus 64 --network garnet2.0 --buffer-size 0 --mem-size 16GB --ruby --l1d_size 64kB --mem-type SimpleMemory --num-l1-cache-ports 8 --num-l2caches 8 --ports 16 --l1i_size 64kB --topology TwoMeshXY -c /artifact_top/alloy-apps/build-applrts_sc3/SSSP -o "-w 0 -r 1 -n 8 -c 8 -t 8 -l 1 -u 32 -b 32 -f /artifact_top/DO_gem5/datasets/olesnik0_out.csr" --vcs-per-vnet 64 --buffers-per-data-vc 65536 --buffers-per-ctrl-vc 1024 > logs/log1166.txt &
-nohup /artifact_top/alloy-gem5/build/RISCV_WT_MESI_TSO/gem5.opt --stats-file=stats1167.txt --debug-flags=DOMEM,DOACC --listener-mode=off /artifact_top/alloy-gem5/configs/brg/sc3.py --cpu-type TimingSimpleCPU --link-latency 20 --CG_link_latency 50 --garnet-deadlock-threshold 100000 --l2_size 16384kB --l2_assoc 8 --num-dirs 8 --brg-fast-forward --num-cpus 64 --network garnet2.0 --buffer-size 0 --mem-size 16GB --ruby --l1d_size 64kB --mem-type SimpleMemory --num-l1-cache-ports 8 --num-l2caches 8 --ports 16 --l1i_size 64kB --topology TwoMeshXY -c /artifact_top/alloy-apps/build-applrts_sc3/SSSP -o "-w 0 -r 1 -n 8 -c 8 -t 8 -l 1 -u 32 -b 32 -f /artifact_top/DO_gem5/datasets/olesnik0_out.csr" --vcs-per-vnet 64 --buffers-per-data-vc 65536 --buffers-per-ctrl-vc 1024 > logs/log1167.txt &
-nohup /artifact_top/alloy-gem5/build/RISCV_MESI_TSO/gem5.opt --stats-file=stats1168.txt --debug-flags=DOMEM,DOACC --listener-mode=off /artifact_top/alloy-gem5/configs/brg/sc3.py --cpu-type TimingSimpleCPU --link-latency 20 --CG_link_latency 50 --garnet-deadlock-threshold 100000 --l2_size 16384kB --l2_assoc 8 --num-dirs 8 --brg-fast-forward --num-cpus 64 --network garnet2.0 --buffer-size 0 --mem-size 16GB --ruby --l1d_size 64kB --mem-type SimpleMemory --num-l1-cache-ports 8 --num-l2caches 8 --ports 16 --l1i_size 64kB --topology TwoMeshXY -c /artifact_top/alloy-apps/build-applrts_sc3/SSSP -o "-w 0 -r 1 -n 8 -c 8 -t 8 -l 1 -u 32 -b 32 -f /artifact_top/DO_gem5/datasets/olesnik0_out.csr" --vcs-per-vnet 64 --buffers-per-data-vc 65536 --buffers-per-ctrl-vc 1024 > logs/log1168.txt &
-nohup /artifact_top/alloy-gem5/build/RISCV_MP_TSO/gem5.opt --stats-file=stats1169.txt --debug-flags=DOMEM,DOACC --listener-mode=off /artifact_top/alloy-gem5/configs/brg/sc3.py --cpu-type TimingSimpleCPU --link-latency 20 --CG_link_latency 50 --garnet-deadlock-threshold 100000 --l2_size 16384kB --l2_assoc 8 --num-dirs 8 --brg-fast-forward --num-cpus 64 --network garnet2.0 --buffer-size 0 --mem-size 16GB --ruby --l1d_size 64kB --mem-type SimpleMemory --num-l1-cache-ports 8 --num-l2caches 8 --ports 16 --l1i_size 64kB --topology TwoMeshXY -c /artifact_top/alloy-apps/build-applrts_sc3/SSSP -o "-w 0 -r 1 -n 8 -c 8 -t 8 -l 1 -u 32 -b 32 -f /artifact_top/DO_gem5/datasets/olesnik0_out.csr" --vcs-per-vnet 64 --buffers-per-data-vc 65536 --buffers-per-ctrl-vc 1024 > logs/log1169.txt &
+nohup /artifact_top/alloy-gem5/build/RISCV_DO_MESI/gem5.opt --stats-file=stats1166.txt --debug-flags=DOMEM,DOACC --listener-mode=off /artifact_top/alloy-gem5/configs/brg/sc3.py --do-consistency-model TSO --cpu-type TimingSimpleCPU --link-latency 20 --CG_link_latency 50 --garnet-deadlock-threshold 100000 --l2_size 16384kB --l2_assoc 8 --num-dirs 8 --brg-fast-forward --num-cpus 64 --network garnet2.0 --buffer-size 0 --mem-size 16GB --ruby --l1d_size 64kB --mem-type SimpleMemory --num-l1-cache-ports 8 --num-l2caches 8 --ports 16 --l1i_size 64kB --topology TwoMeshXY -c /artifact_top/alloy-apps/build-applrts_sc3/SSSP -o "-w 0 -r 1 -n 8 -c 8 -t 8 -l 1 -u 32 -b 32 -f /artifact_top/DO_gem5/datasets/olesnik0_out.csr" --vcs-per-vnet 64 --buffers-per-data-vc 65536 --buffers-per-ctrl-vc 1024 > logs/log1166.txt &
+nohup /artifact_top/alloy-gem5/build/RISCV_WT_MESI_TSO/gem5.opt --stats-file=stats1167.txt --debug-flags=DOMEM,DOACC --listener-mode=off /artifact_top/alloy-gem5/configs/brg/sc3.py --do-consistency-model TSO --cpu-type TimingSimpleCPU --link-latency 20 --CG_link_latency 50 --garnet-deadlock-threshold 100000 --l2_size 16384kB --l2_assoc 8 --num-dirs 8 --brg-fast-forward --num-cpus 64 --network garnet2.0 --buffer-size 0 --mem-size 16GB --ruby --l1d_size 64kB --mem-type SimpleMemory --num-l1-cache-ports 8 --num-l2caches 8 --ports 16 --l1i_size 64kB --topology TwoMeshXY -c /artifact_top/alloy-apps/build-applrts_sc3/SSSP -o "-w 0 -r 1 -n 8 -c 8 -t 8 -l 1 -u 32 -b 32 -f /artifact_top/DO_gem5/datasets/olesnik0_out.csr" --vcs-per-vnet 64 --buffers-per-data-vc 65536 --buffers-per-ctrl-vc 1024 > logs/log1167.txt &
+nohup /artifact_top/alloy-gem5/build/RISCV_MESI/gem5.opt --stats-file=stats1168.txt --debug-flags=DOMEM,DOACC --listener-mode=off /artifact_top/alloy-gem5/configs/brg/sc3.py --do-consistency-model TSO_WB --cpu-type TimingSimpleCPU --link-latency 20 --CG_link_latency 50 --garnet-deadlock-threshold 100000 --l2_size 16384kB --l2_assoc 8 --num-dirs 8 --brg-fast-forward --num-cpus 64 --network garnet2.0 --buffer-size 0 --mem-size 16GB --ruby --l1d_size 64kB --mem-type SimpleMemory --num-l1-cache-ports 8 --num-l2caches 8 --ports 16 --l1i_size 64kB --topology TwoMeshXY -c /artifact_top/alloy-apps/build-applrts_sc3/SSSP -o "-w 0 -r 1 -n 8 -c 8 -t 8 -l 1 -u 32 -b 32 -f /artifact_top/DO_gem5/datasets/olesnik0_out.csr" --vcs-per-vnet 64 --buffers-per-data-vc 65536 --buffers-per-ctrl-vc 1024 > logs/log1168.txt &
+nohup /artifact_top/alloy-gem5/build/RISCV_MP/gem5.opt --stats-file=stats1169.txt --debug-flags=DOMEM,DOACC --listener-mode=off /artifact_top/alloy-gem5/configs/brg/sc3.py --do-consistency-model TSO --cpu-type TimingSimpleCPU --link-latency 20 --CG_link_latency 50 --garnet-deadlock-threshold 100000 --l2_size 16384kB --l2_assoc 8 --num-dirs 8 --brg-fast-forward --num-cpus 64 --network garnet2.0 --buffer-size 0 --mem-size 16GB --ruby --l1d_size 64kB --mem-type SimpleMemory --num-l1-cache-ports 8 --num-l2caches 8 --ports 16 --l1i_size 64kB --topology TwoMeshXY -c /artifact_top/alloy-apps/build-applrts_sc3/SSSP -o "-w 0 -r 1 -n 8 -c 8 -t 8 -l 1 -u 32 -b 32 -f /artifact_top/DO_gem5/datasets/olesnik0_out.csr" --vcs-per-vnet 64 --buffers-per-data-vc 65536 --buffers-per-ctrl-vc 1024 > logs/log1169.txt &
 
 # PR 170-173
-nohup /artifact_top/alloy-gem5/build/RISCV_DO_MESI_TSO/gem5.opt --stats-file=stats1170.txt --debug-flags=DOMEM,DOACC --listener-mode=off /artifact_top/alloy-gem5/configs/brg/sc3.py --cpu-type TimingSimpleCPU --link-latency 20 --CG_link_latency 50 --garnet-deadlock-threshold 100000 --l2_size 16384kB --l2_assoc 8 --num-dirs 8 --brg-fast-forward --num-cpus 64 --network garnet2.0 --buffer-size 0 --mem-size 16GB --ruby --l1d_size 64kB --mem-type SimpleMemory --num-l1-cache-ports 8 --num-l2caches 8 --ports 16 --l1i_size 64kB --topology TwoMeshXY -c /artifact_top/alloy-apps/build-applrts_sc3/PR -o "-w 0 -r 1 -n 8 -c 8 -t 8 -f /artifact_top/DO_gem5/datasets/wing_out.csr" --vcs-per-vnet 64 --buffers-per-data-vc 65536 --buffers-per-ctrl-vc 1024 > logs/log1170.txt &
-nohup /artifact_top/alloy-gem5/build/RISCV_WT_MESI_TSO/gem5.opt --stats-file=stats1171.txt --debug-flags=DOMEM,DOACC --listener-mode=off /artifact_top/alloy-gem5/configs/brg/sc3.py --cpu-type TimingSimpleCPU --link-latency 20 --CG_link_latency 50 --garnet-deadlock-threshold 100000 --l2_size 16384kB --l2_assoc 8 --num-dirs 8 --brg-fast-forward --num-cpus 64 --network garnet2.0 --buffer-size 0 --mem-size 16GB --ruby --l1d_size 64kB --mem-type SimpleMemory --num-l1-cache-ports 8 --num-l2caches 8 --ports 16 --l1i_size 64kB --topology TwoMeshXY -c /artifact_top/alloy-apps/build-applrts_sc3/PR -o "-w 0 -r 1 -n 8 -c 8 -t 8 -f /artifact_top/DO_gem5/datasets/wing_out.csr" --vcs-per-vnet 64 --buffers-per-data-vc 65536 --buffers-per-ctrl-vc 1024 > logs/log1171.txt &
-nohup /artifact_top/alloy-gem5/build/RISCV_MESI_TSO/gem5.opt --stats-file=stats1172.txt --debug-flags=DOMEM,DOACC --listener-mode=off /artifact_top/alloy-gem5/configs/brg/sc3.py --cpu-type TimingSimpleCPU --link-latency 20 --CG_link_latency 50 --garnet-deadlock-threshold 100000 --l2_size 16384kB --l2_assoc 8 --num-dirs 8 --brg-fast-forward --num-cpus 64 --network garnet2.0 --buffer-size 0 --mem-size 16GB --ruby --l1d_size 64kB --mem-type SimpleMemory --num-l1-cache-ports 8 --num-l2caches 8 --ports 16 --l1i_size 64kB --topology TwoMeshXY -c /artifact_top/alloy-apps/build-applrts_sc3/PR -o "-w 0 -r 1 -n 8 -c 8 -t 8 -f /artifact_top/DO_gem5/datasets/wing_out.csr" --vcs-per-vnet 64 --buffers-per-data-vc 65536 --buffers-per-ctrl-vc 1024 > logs/log1172.txt &
-nohup /artifact_top/alloy-gem5/build/RISCV_MP_TSO/gem5.opt --stats-file=stats1173.txt --debug-flags=DOMEM,DOACC --listener-mode=off /artifact_top/alloy-gem5/configs/brg/sc3.py --cpu-type TimingSimpleCPU --link-latency 20 --CG_link_latency 50 --garnet-deadlock-threshold 100000 --l2_size 16384kB --l2_assoc 8 --num-dirs 8 --brg-fast-forward --num-cpus 64 --network garnet2.0 --buffer-size 0 --mem-size 16GB --ruby --l1d_size 64kB --mem-type SimpleMemory --num-l1-cache-ports 8 --num-l2caches 8 --ports 16 --l1i_size 64kB --topology TwoMeshXY -c /artifact_top/alloy-apps/build-applrts_sc3/PR -o "-w 0 -r 1 -n 8 -c 8 -t 8 -f /artifact_top/DO_gem5/datasets/wing_out.csr" --vcs-per-vnet 64 --buffers-per-data-vc 65536 --buffers-per-ctrl-vc 1024 > logs/log1173.txt &
+nohup /artifact_top/alloy-gem5/build/RISCV_DO_MESI/gem5.opt --stats-file=stats1170.txt --debug-flags=DOMEM,DOACC --listener-mode=off /artifact_top/alloy-gem5/configs/brg/sc3.py --do-consistency-model TSO --cpu-type TimingSimpleCPU --link-latency 20 --CG_link_latency 50 --garnet-deadlock-threshold 100000 --l2_size 16384kB --l2_assoc 8 --num-dirs 8 --brg-fast-forward --num-cpus 64 --network garnet2.0 --buffer-size 0 --mem-size 16GB --ruby --l1d_size 64kB --mem-type SimpleMemory --num-l1-cache-ports 8 --num-l2caches 8 --ports 16 --l1i_size 64kB --topology TwoMeshXY -c /artifact_top/alloy-apps/build-applrts_sc3/PR -o "-w 0 -r 1 -n 8 -c 8 -t 8 -f /artifact_top/DO_gem5/datasets/wing_out.csr" --vcs-per-vnet 64 --buffers-per-data-vc 65536 --buffers-per-ctrl-vc 1024 > logs/log1170.txt &
+nohup /artifact_top/alloy-gem5/build/RISCV_WT_MESI_TSO/gem5.opt --stats-file=stats1171.txt --debug-flags=DOMEM,DOACC --listener-mode=off /artifact_top/alloy-gem5/configs/brg/sc3.py --do-consistency-model TSO --cpu-type TimingSimpleCPU --link-latency 20 --CG_link_latency 50 --garnet-deadlock-threshold 100000 --l2_size 16384kB --l2_assoc 8 --num-dirs 8 --brg-fast-forward --num-cpus 64 --network garnet2.0 --buffer-size 0 --mem-size 16GB --ruby --l1d_size 64kB --mem-type SimpleMemory --num-l1-cache-ports 8 --num-l2caches 8 --ports 16 --l1i_size 64kB --topology TwoMeshXY -c /artifact_top/alloy-apps/build-applrts_sc3/PR -o "-w 0 -r 1 -n 8 -c 8 -t 8 -f /artifact_top/DO_gem5/datasets/wing_out.csr" --vcs-per-vnet 64 --buffers-per-data-vc 65536 --buffers-per-ctrl-vc 1024 > logs/log1171.txt &
+nohup /artifact_top/alloy-gem5/build/RISCV_MESI/gem5.opt --stats-file=stats1172.txt --debug-flags=DOMEM,DOACC --listener-mode=off /artifact_top/alloy-gem5/configs/brg/sc3.py --do-consistency-model TSO_WB --cpu-type TimingSimpleCPU --link-latency 20 --CG_link_latency 50 --garnet-deadlock-threshold 100000 --l2_size 16384kB --l2_assoc 8 --num-dirs 8 --brg-fast-forward --num-cpus 64 --network garnet2.0 --buffer-size 0 --mem-size 16GB --ruby --l1d_size 64kB --mem-type SimpleMemory --num-l1-cache-ports 8 --num-l2caches 8 --ports 16 --l1i_size 64kB --topology TwoMeshXY -c /artifact_top/alloy-apps/build-applrts_sc3/PR -o "-w 0 -r 1 -n 8 -c 8 -t 8 -f /artifact_top/DO_gem5/datasets/wing_out.csr" --vcs-per-vnet 64 --buffers-per-data-vc 65536 --buffers-per-ctrl-vc 1024 > logs/log1172.txt &
+nohup /artifact_top/alloy-gem5/build/RISCV_MP/gem5.opt --stats-file=stats1173.txt --debug-flags=DOMEM,DOACC --listener-mode=off /artifact_top/alloy-gem5/configs/brg/sc3.py --do-consistency-model TSO --cpu-type TimingSimpleCPU --link-latency 20 --CG_link_latency 50 --garnet-deadlock-threshold 100000 --l2_size 16384kB --l2_assoc 8 --num-dirs 8 --brg-fast-forward --num-cpus 64 --network garnet2.0 --buffer-size 0 --mem-size 16GB --ruby --l1d_size 64kB --mem-type SimpleMemory --num-l1-cache-ports 8 --num-l2caches 8 --ports 16 --l1i_size 64kB --topology TwoMeshXY -c /artifact_top/alloy-apps/build-applrts_sc3/PR -o "-w 0 -r 1 -n 8 -c 8 -t 8 -f /artifact_top/DO_gem5/datasets/wing_out.csr" --vcs-per-vnet 64 --buffers-per-data-vc 65536 --buffers-per-ctrl-vc 1024 > logs/log1173.txt &
 # PR 174
-nohup /artifact_top/alloy-gem5/build/RISCV_MP_TSO/gem5.opt --stats-file=stats1174.txt --debug-flags=DOMEM,DOACC --listener-mode=off /artifact_top/alloy-gem5/configs/brg/sc3.py --cpu-type TimingSimpleCPU --link-latency 20 --CG_link_latency 50 --garnet-deadlock-threshold 100000 --l2_size 16384kB --l2_assoc 8 --num-dirs 8 --brg-fast-forward --num-cpus 64 --network garnet2.0 --buffer-size 0 --mem-size 16GB --ruby --l1d_size 64kB --mem-type SimpleMemory --num-l1-cache-ports 8 --num-l2caches 8 --ports 16 --l1i_size 64kB --topology TwoMeshXY -c /artifact_top/alloy-apps/build-applrts_sc3/PR -o "-w 0 -r 0 -n 8 -c 8 -t 8 -f /artifact_top/DO_gem5/datasets/wing_out.csr" --vcs-per-vnet 64 --buffers-per-data-vc 65536 --buffers-per-ctrl-vc 1024 > logs/log1174.txt &
+nohup /artifact_top/alloy-gem5/build/RISCV_MP/gem5.opt --stats-file=stats1174.txt --debug-flags=DOMEM,DOACC --listener-mode=off /artifact_top/alloy-gem5/configs/brg/sc3.py --do-consistency-model TSO --cpu-type TimingSimpleCPU --link-latency 20 --CG_link_latency 50 --garnet-deadlock-threshold 100000 --l2_size 16384kB --l2_assoc 8 --num-dirs 8 --brg-fast-forward --num-cpus 64 --network garnet2.0 --buffer-size 0 --mem-size 16GB --ruby --l1d_size 64kB --mem-type SimpleMemory --num-l1-cache-ports 8 --num-l2caches 8 --ports 16 --l1i_size 64kB --topology TwoMeshXY -c /artifact_top/alloy-apps/build-applrts_sc3/PR -o "-w 0 -r 0 -n 8 -c 8 -t 8 -f /artifact_top/DO_gem5/datasets/wing_out.csr" --vcs-per-vnet 64 --buffers-per-data-vc 65536 --buffers-per-ctrl-vc 1024 > logs/log1174.txt &
 
 # PAD 175-178
-nohup /artifact_top/alloy-gem5/build/RISCV_DO_MESI_64B_TSO/gem5.opt --stats-file=stats1175.txt --debug-flags=DOMEM,DOACC --listener-mode=off /artifact_top/alloy-gem5/configs/brg/sc3.py --cpu-type TimingSimpleCPU --link-latency 20 --CG_link_latency 40 --garnet-deadlock-threshold 100000 --l2_size 16384kB --l2_assoc 8 --num-dirs 8 --brg-fast-forward --num-cpus 64 --network garnet2.0 --buffer-size 0 --mem-size 16GB --ruby --l1d_size 64kB --mem-type SimpleMemory --num-l1-cache-ports 8 --num-l2caches 8 --ports 16 --l1i_size 64kB --topology TwoMeshXY -c /artifact_top/alloy-apps/build-applrts_sc3/PAD -o "-w 0 -r 1 -n 8 -c 8 -t 8 -p 1" --vcs-per-vnet 64 --buffers-per-data-vc 65536 --buffers-per-ctrl-vc 1024 > logs/log1175.txt &
-nohup /artifact_top/alloy-gem5/build/RISCV_WT_MESI_64B_TSO/gem5.opt --stats-file=stats1176.txt --debug-flags=DOMEM,DOACC --listener-mode=off /artifact_top/alloy-gem5/configs/brg/sc3.py --cpu-type TimingSimpleCPU --link-latency 20 --CG_link_latency 40 --garnet-deadlock-threshold 100000 --l2_size 16384kB --l2_assoc 8 --num-dirs 8 --brg-fast-forward --num-cpus 64 --network garnet2.0 --buffer-size 0 --mem-size 16GB --ruby --l1d_size 64kB --mem-type SimpleMemory --num-l1-cache-ports 8 --num-l2caches 8 --ports 16 --l1i_size 64kB --topology TwoMeshXY -c /artifact_top/alloy-apps/build-applrts_sc3/PAD -o "-w 0 -r 1 -n 8 -c 8 -t 8 -p 1" --vcs-per-vnet 64 --buffers-per-data-vc 65536 --buffers-per-ctrl-vc 1024 > logs/log1176.txt &
-nohup /artifact_top/alloy-gem5/build/RISCV_MESI_TSO/gem5.opt --stats-file=stats1177.txt --debug-flags=DOMEM,DOACC --listener-mode=off /artifact_top/alloy-gem5/configs/brg/sc3.py --cpu-type TimingSimpleCPU --link-latency 20 --CG_link_latency 40 --garnet-deadlock-threshold 100000 --l2_size 16384kB --l2_assoc 8 --num-dirs 8 --brg-fast-forward --num-cpus 64 --network garnet2.0 --buffer-size 0 --mem-size 16GB --ruby --l1d_size 64kB --mem-type SimpleMemory --num-l1-cache-ports 8 --num-l2caches 8 --ports 16 --l1i_size 64kB --topology TwoMeshXY -c /artifact_top/alloy-apps/build-applrts_sc3/PAD -o "-w 0 -r 1 -n 8 -c 8 -t 8 -p 1" --vcs-per-vnet 64 --buffers-per-data-vc 65536 --buffers-per-ctrl-vc 1024 > logs/log1177.txt &
-nohup /artifact_top/alloy-gem5/build/RISCV_MP_64B_TSO/gem5.opt --stats-file=stats1178.txt --debug-flags=DOMEM,DOACC --listener-mode=off /artifact_top/alloy-gem5/configs/brg/sc3.py --cpu-type TimingSimpleCPU --link-latency 20 --CG_link_latency 40 --garnet-deadlock-threshold 100000 --l2_size 16384kB --l2_assoc 8 --num-dirs 8 --brg-fast-forward --num-cpus 64 --network garnet2.0 --buffer-size 0 --mem-size 16GB --ruby --l1d_size 64kB --mem-type SimpleMemory --num-l1-cache-ports 8 --num-l2caches 8 --ports 16 --l1i_size 64kB --topology TwoMeshXY -c /artifact_top/alloy-apps/build-applrts_sc3/PAD -o "-w 0 -r 1 -n 8 -c 8 -t 8 -p 1" --vcs-per-vnet 64 --buffers-per-data-vc 65536 --buffers-per-ctrl-vc 1024 > logs/log1178.txt &
+nohup /artifact_top/alloy-gem5/build/RISCV_DO_MESI/gem5.opt --stats-file=stats1175.txt --debug-flags=DOMEM,DOACC --listener-mode=off /artifact_top/alloy-gem5/configs/brg/sc3.py --do-consistency-model TSO --msg-size PUT_NT:64 --msg-size PUT_REL:72 --cpu-type TimingSimpleCPU --link-latency 20 --CG_link_latency 40 --garnet-deadlock-threshold 100000 --l2_size 16384kB --l2_assoc 8 --num-dirs 8 --brg-fast-forward --num-cpus 64 --network garnet2.0 --buffer-size 0 --mem-size 16GB --ruby --l1d_size 64kB --mem-type SimpleMemory --num-l1-cache-ports 8 --num-l2caches 8 --ports 16 --l1i_size 64kB --topology TwoMeshXY -c /artifact_top/alloy-apps/build-applrts_sc3/PAD -o "-w 0 -r 1 -n 8 -c 8 -t 8 -p 1" --vcs-per-vnet 64 --buffers-per-data-vc 65536 --buffers-per-ctrl-vc 1024 > logs/log1175.txt &
+nohup /artifact_top/alloy-gem5/build/RISCV_WT_MESI_TSO/gem5.opt --stats-file=stats1176.txt --debug-flags=DOMEM,DOACC --listener-mode=off /artifact_top/alloy-gem5/configs/brg/sc3.py --do-consistency-model TSO --msg-size PUT_NT:64 --msg-size PUT_REL:72 --cpu-type TimingSimpleCPU --link-latency 20 --CG_link_latency 40 --garnet-deadlock-threshold 100000 --l2_size 16384kB --l2_assoc 8 --num-dirs 8 --brg-fast-forward --num-cpus 64 --network garnet2.0 --buffer-size 0 --mem-size 16GB --ruby --l1d_size 64kB --mem-type SimpleMemory --num-l1-cache-ports 8 --num-l2caches 8 --ports 16 --l1i_size 64kB --topology TwoMeshXY -c /artifact_top/alloy-apps/build-applrts_sc3/PAD -o "-w 0 -r 1 -n 8 -c 8 -t 8 -p 1" --vcs-per-vnet 64 --buffers-per-data-vc 65536 --buffers-per-ctrl-vc 1024 > logs/log1176.txt &
+nohup /artifact_top/alloy-gem5/build/RISCV_MESI/gem5.opt --stats-file=stats1177.txt --debug-flags=DOMEM,DOACC --listener-mode=off /artifact_top/alloy-gem5/configs/brg/sc3.py --do-consistency-model TSO_WB --cpu-type TimingSimpleCPU --link-latency 20 --CG_link_latency 40 --garnet-deadlock-threshold 100000 --l2_size 16384kB --l2_assoc 8 --num-dirs 8 --brg-fast-forward --num-cpus 64 --network garnet2.0 --buffer-size 0 --mem-size 16GB --ruby --l1d_size 64kB --mem-type SimpleMemory --num-l1-cache-ports 8 --num-l2caches 8 --ports 16 --l1i_size 64kB --topology TwoMeshXY -c /artifact_top/alloy-apps/build-applrts_sc3/PAD -o "-w 0 -r 1 -n 8 -c 8 -t 8 -p 1" --vcs-per-vnet 64 --buffers-per-data-vc 65536 --buffers-per-ctrl-vc 1024 > logs/log1177.txt &
+nohup /artifact_top/alloy-gem5/build/RISCV_MP/gem5.opt --stats-file=stats1178.txt --debug-flags=DOMEM,DOACC --listener-mode=off /artifact_top/alloy-gem5/configs/brg/sc3.py --do-consistency-model TSO --msg-size PUT_NT:64 --msg-size PUT_REL:72 --cpu-type TimingSimpleCPU --link-latency 20 --CG_link_latency 40 --garnet-deadlock-threshold 100000 --l2_size 16384kB --l2_assoc 8 --num-dirs 8 --brg-fast-forward --num-cpus 64 --network garnet2.0 --buffer-size 0 --mem-size 16GB --ruby --l1d_size 64kB --mem-type SimpleMemory --num-l1-cache-ports 8 --num-l2caches 8 --ports 16 --l1i_size 64kB --topology TwoMeshXY -c /artifact_top/alloy-apps/build-applrts_sc3/PAD -o "-w 0 -r 1 -n 8 -c 8 -t 8 -p 1" --vcs-per-vnet 64 --buffers-per-data-vc 65536 --buffers-per-ctrl-vc 1024 > logs/log1178.txt &
 
 # TQH 179-182 SO traffic is buggy, need special handling
-nohup /artifact_top/alloy-gem5/build/RISCV_DO_MESI_64B_TSO/gem5.opt --stats-file=stats1179.txt --debug-flags=DOMEM,DOACC --listener-mode=off /artifact_top/alloy-gem5/configs/brg/sc3.py --cpu-type TimingSimpleCPU --link-latency 20 --CG_link_latency 50 --garnet-deadlock-threshold 100000 --l2_size 16384kB --l2_assoc 8 --num-dirs 8 --brg-fast-forward --num-cpus 64 --network garnet2.0 --buffer-size 0 --mem-size 16GB --ruby --l1d_size 64kB --mem-type SimpleMemory --num-l1-cache-ports 8 --num-l2caches 8 --ports 16 --l1i_size 64kB --topology TwoMeshXY -c /artifact_top/alloy-apps/build-applrts_sc3/TQH -o "-w 0 -r 2 -n 8 -c 8 -t 8 -p 32 -f /artifact_top/DO_gem5/datasets/basket" --vcs-per-vnet 64 --buffers-per-data-vc 65536 --buffers-per-ctrl-vc 1024 > logs/log1179.txt &
-nohup /artifact_top/alloy-gem5/build/RISCV_WT_MESI_64B_TSO/gem5.opt --stats-file=stats1180.txt --debug-flags=DOMEM,DOACC --listener-mode=off /artifact_top/alloy-gem5/configs/brg/sc3.py --cpu-type TimingSimpleCPU --link-latency 20 --CG_link_latency 50 --garnet-deadlock-threshold 100000 --l2_size 16384kB --l2_assoc 8 --num-dirs 8 --brg-fast-forward --num-cpus 64 --network garnet2.0 --buffer-size 0 --mem-size 16GB --ruby --l1d_size 64kB --mem-type SimpleMemory --num-l1-cache-ports 8 --num-l2caches 8 --ports 16 --l1i_size 64kB --topology TwoMeshXY -c /artifact_top/alloy-apps/build-applrts_sc3/TQH -o "-w 0 -r 2 -n 8 -c 8 -t 8 -p 32 -f /artifact_top/DO_gem5/datasets/basket" --vcs-per-vnet 64 --buffers-per-data-vc 65536 --buffers-per-ctrl-vc 1024 > logs/log1180.txt &
-nohup /artifact_top/alloy-gem5/build/RISCV_MESI_TSO/gem5.opt --stats-file=stats1181.txt --debug-flags=DOMEM,DOACC --listener-mode=off /artifact_top/alloy-gem5/configs/brg/sc3.py --cpu-type TimingSimpleCPU --link-latency 20 --CG_link_latency 50 --garnet-deadlock-threshold 100000 --l2_size 16384kB --l2_assoc 8 --num-dirs 8 --brg-fast-forward --num-cpus 64 --network garnet2.0 --buffer-size 0 --mem-size 16GB --ruby --l1d_size 64kB --mem-type SimpleMemory --num-l1-cache-ports 8 --num-l2caches 8 --ports 16 --l1i_size 64kB --topology TwoMeshXY -c /artifact_top/alloy-apps/build-applrts_sc3/TQH -o "-w 0 -r 2 -n 8 -c 8 -t 8 -p 32 -f /artifact_top/DO_gem5/datasets/basket" --vcs-per-vnet 64 --buffers-per-data-vc 65536 --buffers-per-ctrl-vc 1024 > logs/log1181.txt &
-nohup /artifact_top/alloy-gem5/build/RISCV_MP_64B_TSO/gem5.opt --stats-file=stats1182.txt --debug-flags=DOMEM,DOACC --listener-mode=off /artifact_top/alloy-gem5/configs/brg/sc3.py --cpu-type TimingSimpleCPU --link-latency 20 --CG_link_latency 50 --garnet-deadlock-threshold 100000 --l2_size 16384kB --l2_assoc 8 --num-dirs 8 --brg-fast-forward --num-cpus 64 --network garnet2.0 --buffer-size 0 --mem-size 16GB --ruby --l1d_size 64kB --mem-type SimpleMemory --num-l1-cache-ports 8 --num-l2caches 8 --ports 16 --l1i_size 64kB --topology TwoMeshXY -c /artifact_top/alloy-apps/build-applrts_sc3/TQH -o "-w 0 -r 2 -n 8 -c 8 -t 8 -p 32 -f /artifact_top/DO_gem5/datasets/basket" --vcs-per-vnet 64 --buffers-per-data-vc 65536 --buffers-per-ctrl-vc 1024 > logs/log1182.txt &
+nohup /artifact_top/alloy-gem5/build/RISCV_DO_MESI/gem5.opt --stats-file=stats1179.txt --debug-flags=DOMEM,DOACC --listener-mode=off /artifact_top/alloy-gem5/configs/brg/sc3.py --do-consistency-model TSO --msg-size PUT_NT:64 --msg-size PUT_REL:72 --cpu-type TimingSimpleCPU --link-latency 20 --CG_link_latency 50 --garnet-deadlock-threshold 100000 --l2_size 16384kB --l2_assoc 8 --num-dirs 8 --brg-fast-forward --num-cpus 64 --network garnet2.0 --buffer-size 0 --mem-size 16GB --ruby --l1d_size 64kB --mem-type SimpleMemory --num-l1-cache-ports 8 --num-l2caches 8 --ports 16 --l1i_size 64kB --topology TwoMeshXY -c /artifact_top/alloy-apps/build-applrts_sc3/TQH -o "-w 0 -r 2 -n 8 -c 8 -t 8 -p 32 -f /artifact_top/DO_gem5/datasets/basket" --vcs-per-vnet 64 --buffers-per-data-vc 65536 --buffers-per-ctrl-vc 1024 > logs/log1179.txt &
+nohup /artifact_top/alloy-gem5/build/RISCV_WT_MESI_TSO/gem5.opt --stats-file=stats1180.txt --debug-flags=DOMEM,DOACC --listener-mode=off /artifact_top/alloy-gem5/configs/brg/sc3.py --do-consistency-model TSO --msg-size PUT_NT:64 --msg-size PUT_REL:72 --cpu-type TimingSimpleCPU --link-latency 20 --CG_link_latency 50 --garnet-deadlock-threshold 100000 --l2_size 16384kB --l2_assoc 8 --num-dirs 8 --brg-fast-forward --num-cpus 64 --network garnet2.0 --buffer-size 0 --mem-size 16GB --ruby --l1d_size 64kB --mem-type SimpleMemory --num-l1-cache-ports 8 --num-l2caches 8 --ports 16 --l1i_size 64kB --topology TwoMeshXY -c /artifact_top/alloy-apps/build-applrts_sc3/TQH -o "-w 0 -r 2 -n 8 -c 8 -t 8 -p 32 -f /artifact_top/DO_gem5/datasets/basket" --vcs-per-vnet 64 --buffers-per-data-vc 65536 --buffers-per-ctrl-vc 1024 > logs/log1180.txt &
+nohup /artifact_top/alloy-gem5/build/RISCV_MESI/gem5.opt --stats-file=stats1181.txt --debug-flags=DOMEM,DOACC --listener-mode=off /artifact_top/alloy-gem5/configs/brg/sc3.py --do-consistency-model TSO_WB --cpu-type TimingSimpleCPU --link-latency 20 --CG_link_latency 50 --garnet-deadlock-threshold 100000 --l2_size 16384kB --l2_assoc 8 --num-dirs 8 --brg-fast-forward --num-cpus 64 --network garnet2.0 --buffer-size 0 --mem-size 16GB --ruby --l1d_size 64kB --mem-type SimpleMemory --num-l1-cache-ports 8 --num-l2caches 8 --ports 16 --l1i_size 64kB --topology TwoMeshXY -c /artifact_top/alloy-apps/build-applrts_sc3/TQH -o "-w 0 -r 2 -n 8 -c 8 -t 8 -p 32 -f /artifact_top/DO_gem5/datasets/basket" --vcs-per-vnet 64 --buffers-per-data-vc 65536 --buffers-per-ctrl-vc 1024 > logs/log1181.txt &
+nohup /artifact_top/alloy-gem5/build/RISCV_MP/gem5.opt --stats-file=stats1182.txt --debug-flags=DOMEM,DOACC --listener-mode=off /artifact_top/alloy-gem5/configs/brg/sc3.py --do-consistency-model TSO --msg-size PUT_NT:64 --msg-size PUT_REL:72 --cpu-type TimingSimpleCPU --link-latency 20 --CG_link_latency 50 --garnet-deadlock-threshold 100000 --l2_size 16384kB --l2_assoc 8 --num-dirs 8 --brg-fast-forward --num-cpus 64 --network garnet2.0 --buffer-size 0 --mem-size 16GB --ruby --l1d_size 64kB --mem-type SimpleMemory --num-l1-cache-ports 8 --num-l2caches 8 --ports 16 --l1i_size 64kB --topology TwoMeshXY -c /artifact_top/alloy-apps/build-applrts_sc3/TQH -o "-w 0 -r 2 -n 8 -c 8 -t 8 -p 32 -f /artifact_top/DO_gem5/datasets/basket" --vcs-per-vnet 64 --buffers-per-data-vc 65536 --buffers-per-ctrl-vc 1024 > logs/log1182.txt &
 
 # alltoall_10KB 183-186
-nohup /artifact_top/alloy-gem5/build/RISCV_DO_MESI_64B_TSO/gem5.opt --stats-file=stats1183.txt --debug-flags=DOMEM,DOACC --listener-mode=off /artifact_top/alloy-gem5/configs/brg/sc3.py --cpu-type TimingSimpleCPU --link-latency 20 --CG_link_latency 50 --garnet-deadlock-threshold 100000 --l2_size 16384kB --l2_assoc 8 --num-dirs 8 --brg-fast-forward --num-cpus 64 --network garnet2.0 --buffer-size 0 --mem-size 16GB --ruby --l1d_size 64kB --mem-type SimpleMemory --num-l1-cache-ports 8 --num-l2caches 8 --ports 16 --l1i_size 64kB --topology TwoMeshXY -c /artifact_top/alloy-apps/build-applrts_sc3/run_alltoall -o "-w 0 -r 1 -n 8 -c 8 -t 8 -f 1280 -s 8 -v 0" --vcs-per-vnet 64 --buffers-per-data-vc 65536 --buffers-per-ctrl-vc 1024 > logs/log1183.txt &
-nohup /artifact_top/alloy-gem5/build/RISCV_WT_MESI_64B_TSO/gem5.opt --stats-file=stats1184.txt --debug-flags=DOMEM,DOACC --listener-mode=off /artifact_top/alloy-gem5/configs/brg/sc3.py --cpu-type TimingSimpleCPU --link-latency 20 --CG_link_latency 50 --garnet-deadlock-threshold 100000 --l2_size 16384kB --l2_assoc 8 --num-dirs 8 --brg-fast-forward --num-cpus 64 --network garnet2.0 --buffer-size 0 --mem-size 16GB --ruby --l1d_size 64kB --mem-type SimpleMemory --num-l1-cache-ports 8 --num-l2caches 8 --ports 16 --l1i_size 64kB --topology TwoMeshXY -c /artifact_top/alloy-apps/build-applrts_sc3/run_alltoall -o "-w 0 -r 1 -n 8 -c 8 -t 8 -f 1280 -s 8 -v 0" --vcs-per-vnet 64 --buffers-per-data-vc 65536 --buffers-per-ctrl-vc 1024 > logs/log1184.txt &
-nohup /artifact_top/alloy-gem5/build/RISCV_MESI_TSO/gem5.opt --stats-file=stats1185.txt --debug-flags=DOMEM,DOACC --listener-mode=off /artifact_top/alloy-gem5/configs/brg/sc3.py --cpu-type TimingSimpleCPU --link-latency 20 --CG_link_latency 50 --garnet-deadlock-threshold 100000 --l2_size 16384kB --l2_assoc 8 --num-dirs 8 --brg-fast-forward --num-cpus 64 --network garnet2.0 --buffer-size 0 --mem-size 16GB --ruby --l1d_size 64kB --mem-type SimpleMemory --num-l1-cache-ports 8 --num-l2caches 8 --ports 16 --l1i_size 64kB --topology TwoMeshXY -c /artifact_top/alloy-apps/build-applrts_sc3/run_alltoall -o "-w 0 -r 1 -n 8 -c 8 -t 8 -f 1280 -s 8 -v 0" --vcs-per-vnet 64 --buffers-per-data-vc 65536 --buffers-per-ctrl-vc 1024 > logs/log1185.txt &
-nohup /artifact_top/alloy-gem5/build/RISCV_MP_64B_TSO/gem5.opt --stats-file=stats1186.txt --debug-flags=DOMEM,DOACC --listener-mode=off /artifact_top/alloy-gem5/configs/brg/sc3.py --cpu-type TimingSimpleCPU --link-latency 20 --CG_link_latency 50 --garnet-deadlock-threshold 100000 --l2_size 16384kB --l2_assoc 8 --num-dirs 8 --brg-fast-forward --num-cpus 64 --network garnet2.0 --buffer-size 0 --mem-size 16GB --ruby --l1d_size 64kB --mem-type SimpleMemory --num-l1-cache-ports 8 --num-l2caches 8 --ports 16 --l1i_size 64kB --topology TwoMeshXY -c /artifact_top/alloy-apps/build-applrts_sc3/run_alltoall -o "-w 0 -r 1 -n 8 -c 8 -t 8 -f 1280 -s 8 -v 0" --vcs-per-vnet 64 --buffers-per-data-vc 65536 --buffers-per-ctrl-vc 1024 > logs/log1186.txt &
+nohup /artifact_top/alloy-gem5/build/RISCV_DO_MESI/gem5.opt --stats-file=stats1183.txt --debug-flags=DOMEM,DOACC --listener-mode=off /artifact_top/alloy-gem5/configs/brg/sc3.py --do-consistency-model TSO --msg-size PUT_NT:64 --msg-size PUT_REL:72 --cpu-type TimingSimpleCPU --link-latency 20 --CG_link_latency 50 --garnet-deadlock-threshold 100000 --l2_size 16384kB --l2_assoc 8 --num-dirs 8 --brg-fast-forward --num-cpus 64 --network garnet2.0 --buffer-size 0 --mem-size 16GB --ruby --l1d_size 64kB --mem-type SimpleMemory --num-l1-cache-ports 8 --num-l2caches 8 --ports 16 --l1i_size 64kB --topology TwoMeshXY -c /artifact_top/alloy-apps/build-applrts_sc3/run_alltoall -o "-w 0 -r 1 -n 8 -c 8 -t 8 -f 1280 -s 8 -v 0" --vcs-per-vnet 64 --buffers-per-data-vc 65536 --buffers-per-ctrl-vc 1024 > logs/log1183.txt &
+nohup /artifact_top/alloy-gem5/build/RISCV_WT_MESI_TSO/gem5.opt --stats-file=stats1184.txt --debug-flags=DOMEM,DOACC --listener-mode=off /artifact_top/alloy-gem5/configs/brg/sc3.py --do-consistency-model TSO --msg-size PUT_NT:64 --msg-size PUT_REL:72 --cpu-type TimingSimpleCPU --link-latency 20 --CG_link_latency 50 --garnet-deadlock-threshold 100000 --l2_size 16384kB --l2_assoc 8 --num-dirs 8 --brg-fast-forward --num-cpus 64 --network garnet2.0 --buffer-size 0 --mem-size 16GB --ruby --l1d_size 64kB --mem-type SimpleMemory --num-l1-cache-ports 8 --num-l2caches 8 --ports 16 --l1i_size 64kB --topology TwoMeshXY -c /artifact_top/alloy-apps/build-applrts_sc3/run_alltoall -o "-w 0 -r 1 -n 8 -c 8 -t 8 -f 1280 -s 8 -v 0" --vcs-per-vnet 64 --buffers-per-data-vc 65536 --buffers-per-ctrl-vc 1024 > logs/log1184.txt &
+nohup /artifact_top/alloy-gem5/build/RISCV_MESI/gem5.opt --stats-file=stats1185.txt --debug-flags=DOMEM,DOACC --listener-mode=off /artifact_top/alloy-gem5/configs/brg/sc3.py --do-consistency-model TSO_WB --cpu-type TimingSimpleCPU --link-latency 20 --CG_link_latency 50 --garnet-deadlock-threshold 100000 --l2_size 16384kB --l2_assoc 8 --num-dirs 8 --brg-fast-forward --num-cpus 64 --network garnet2.0 --buffer-size 0 --mem-size 16GB --ruby --l1d_size 64kB --mem-type SimpleMemory --num-l1-cache-ports 8 --num-l2caches 8 --ports 16 --l1i_size 64kB --topology TwoMeshXY -c /artifact_top/alloy-apps/build-applrts_sc3/run_alltoall -o "-w 0 -r 1 -n 8 -c 8 -t 8 -f 1280 -s 8 -v 0" --vcs-per-vnet 64 --buffers-per-data-vc 65536 --buffers-per-ctrl-vc 1024 > logs/log1185.txt &
+nohup /artifact_top/alloy-gem5/build/RISCV_MP/gem5.opt --stats-file=stats1186.txt --debug-flags=DOMEM,DOACC --listener-mode=off /artifact_top/alloy-gem5/configs/brg/sc3.py --do-consistency-model TSO --msg-size PUT_NT:64 --msg-size PUT_REL:72 --cpu-type TimingSimpleCPU --link-latency 20 --CG_link_latency 50 --garnet-deadlock-threshold 100000 --l2_size 16384kB --l2_assoc 8 --num-dirs 8 --brg-fast-forward --num-cpus 64 --network garnet2.0 --buffer-size 0 --mem-size 16GB --ruby --l1d_size 64kB --mem-type SimpleMemory --num-l1-cache-ports 8 --num-l2caches 8 --ports 16 --l1i_size 64kB --topology TwoMeshXY -c /artifact_top/alloy-apps/build-applrts_sc3/run_alltoall -o "-w 0 -r 1 -n 8 -c 8 -t 8 -f 1280 -s 8 -v 0" --vcs-per-vnet 64 --buffers-per-data-vc 65536 --buffers-per-ctrl-vc 1024 > logs/log1186.txt &
 
 # reduce_256B 187-190
-nohup /artifact_top/alloy-gem5/build/RISCV_DO_MESI_64B_TSO/gem5.opt --stats-file=stats1187.txt --debug-flags=DOMEM,DOACC --listener-mode=off /artifact_top/alloy-gem5/configs/brg/sc3.py --cpu-type TimingSimpleCPU --link-latency 20 --CG_link_latency 50 --garnet-deadlock-threshold 100000 --l2_size 16384kB --l2_assoc 8 --num-dirs 8 --brg-fast-forward --num-cpus 64 --network garnet2.0 --buffer-size 0 --mem-size 16GB --ruby --l1d_size 64kB --mem-type SimpleMemory --num-l1-cache-ports 8 --num-l2caches 8 --ports 16 --l1i_size 64kB --topology TwoMeshXY -c /artifact_top/alloy-apps/build-applrts_sc3/run_reduce -o "-w 0 -r 1 -n 8 -c 8 -t 4 -f 64 -s 8 -v 0" --vcs-per-vnet 64 --buffers-per-data-vc 65536 --buffers-per-ctrl-vc 1024 > logs/log1187.txt &
-nohup /artifact_top/alloy-gem5/build/RISCV_WT_MESI_64B_TSO/gem5.opt --stats-file=stats1188.txt --debug-flags=DOMEM,DOACC --listener-mode=off /artifact_top/alloy-gem5/configs/brg/sc3.py --cpu-type TimingSimpleCPU --link-latency 20 --CG_link_latency 50 --garnet-deadlock-threshold 100000 --l2_size 16384kB --l2_assoc 8 --num-dirs 8 --brg-fast-forward --num-cpus 64 --network garnet2.0 --buffer-size 0 --mem-size 16GB --ruby --l1d_size 64kB --mem-type SimpleMemory --num-l1-cache-ports 8 --num-l2caches 8 --ports 16 --l1i_size 64kB --topology TwoMeshXY -c /artifact_top/alloy-apps/build-applrts_sc3/run_reduce -o "-w 0 -r 1 -n 8 -c 8 -t 4 -f 64 -s 8 -v 0" --vcs-per-vnet 64 --buffers-per-data-vc 65536 --buffers-per-ctrl-vc 1024 > logs/log1188.txt &
-nohup /artifact_top/alloy-gem5/build/RISCV_MESI_TSO/gem5.opt --stats-file=stats1189.txt --debug-flags=DOMEM,DOACC --listener-mode=off /artifact_top/alloy-gem5/configs/brg/sc3.py --cpu-type TimingSimpleCPU --link-latency 20 --CG_link_latency 50 --garnet-deadlock-threshold 100000 --l2_size 16384kB --l2_assoc 8 --num-dirs 8 --brg-fast-forward --num-cpus 64 --network garnet2.0 --buffer-size 0 --mem-size 16GB --ruby --l1d_size 64kB --mem-type SimpleMemory --num-l1-cache-ports 8 --num-l2caches 8 --ports 16 --l1i_size 64kB --topology TwoMeshXY -c /artifact_top/alloy-apps/build-applrts_sc3/run_reduce -o "-w 0 -r 1 -n 8 -c 8 -t 4 -f 64 -s 8 -v 0" --vcs-per-vnet 64 --buffers-per-data-vc 65536 --buffers-per-ctrl-vc 1024 > logs/log1189.txt &
-nohup /artifact_top/alloy-gem5/build/RISCV_MP_64B_TSO/gem5.opt --stats-file=stats1190.txt --debug-flags=DOMEM,DOACC --listener-mode=off /artifact_top/alloy-gem5/configs/brg/sc3.py --cpu-type TimingSimpleCPU --link-latency 20 --CG_link_latency 50 --garnet-deadlock-threshold 100000 --l2_size 16384kB --l2_assoc 8 --num-dirs 8 --brg-fast-forward --num-cpus 64 --network garnet2.0 --buffer-size 0 --mem-size 16GB --ruby --l1d_size 64kB --mem-type SimpleMemory --num-l1-cache-ports 8 --num-l2caches 8 --ports 16 --l1i_size 64kB --topology TwoMeshXY -c /artifact_top/alloy-apps/build-applrts_sc3/run_reduce -o "-w 0 -r 1 -n 8 -c 8 -t 4 -f 64 -s 8 -v 0" --vcs-per-vnet 64 --buffers-per-data-vc 65536 --buffers-per-ctrl-vc 1024 > logs/log1190.txt &
+nohup /artifact_top/alloy-gem5/build/RISCV_DO_MESI/gem5.opt --stats-file=stats1187.txt --debug-flags=DOMEM,DOACC --listener-mode=off /artifact_top/alloy-gem5/configs/brg/sc3.py --do-consistency-model TSO --msg-size PUT_NT:64 --msg-size PUT_REL:72 --cpu-type TimingSimpleCPU --link-latency 20 --CG_link_latency 50 --garnet-deadlock-threshold 100000 --l2_size 16384kB --l2_assoc 8 --num-dirs 8 --brg-fast-forward --num-cpus 64 --network garnet2.0 --buffer-size 0 --mem-size 16GB --ruby --l1d_size 64kB --mem-type SimpleMemory --num-l1-cache-ports 8 --num-l2caches 8 --ports 16 --l1i_size 64kB --topology TwoMeshXY -c /artifact_top/alloy-apps/build-applrts_sc3/run_reduce -o "-w 0 -r 1 -n 8 -c 8 -t 4 -f 64 -s 8 -v 0" --vcs-per-vnet 64 --buffers-per-data-vc 65536 --buffers-per-ctrl-vc 1024 > logs/log1187.txt &
+nohup /artifact_top/alloy-gem5/build/RISCV_WT_MESI_TSO/gem5.opt --stats-file=stats1188.txt --debug-flags=DOMEM,DOACC --listener-mode=off /artifact_top/alloy-gem5/configs/brg/sc3.py --do-consistency-model TSO --msg-size PUT_NT:64 --msg-size PUT_REL:72 --cpu-type TimingSimpleCPU --link-latency 20 --CG_link_latency 50 --garnet-deadlock-threshold 100000 --l2_size 16384kB --l2_assoc 8 --num-dirs 8 --brg-fast-forward --num-cpus 64 --network garnet2.0 --buffer-size 0 --mem-size 16GB --ruby --l1d_size 64kB --mem-type SimpleMemory --num-l1-cache-ports 8 --num-l2caches 8 --ports 16 --l1i_size 64kB --topology TwoMeshXY -c /artifact_top/alloy-apps/build-applrts_sc3/run_reduce -o "-w 0 -r 1 -n 8 -c 8 -t 4 -f 64 -s 8 -v 0" --vcs-per-vnet 64 --buffers-per-data-vc 65536 --buffers-per-ctrl-vc 1024 > logs/log1188.txt &
+nohup /artifact_top/alloy-gem5/build/RISCV_MESI/gem5.opt --stats-file=stats1189.txt --debug-flags=DOMEM,DOACC --listener-mode=off /artifact_top/alloy-gem5/configs/brg/sc3.py --do-consistency-model TSO_WB --cpu-type TimingSimpleCPU --link-latency 20 --CG_link_latency 50 --garnet-deadlock-threshold 100000 --l2_size 16384kB --l2_assoc 8 --num-dirs 8 --brg-fast-forward --num-cpus 64 --network garnet2.0 --buffer-size 0 --mem-size 16GB --ruby --l1d_size 64kB --mem-type SimpleMemory --num-l1-cache-ports 8 --num-l2caches 8 --ports 16 --l1i_size 64kB --topology TwoMeshXY -c /artifact_top/alloy-apps/build-applrts_sc3/run_reduce -o "-w 0 -r 1 -n 8 -c 8 -t 4 -f 64 -s 8 -v 0" --vcs-per-vnet 64 --buffers-per-data-vc 65536 --buffers-per-ctrl-vc 1024 > logs/log1189.txt &
+nohup /artifact_top/alloy-gem5/build/RISCV_MP/gem5.opt --stats-file=stats1190.txt --debug-flags=DOMEM,DOACC --listener-mode=off /artifact_top/alloy-gem5/configs/brg/sc3.py --do-consistency-model TSO --msg-size PUT_NT:64 --msg-size PUT_REL:72 --cpu-type TimingSimpleCPU --link-latency 20 --CG_link_latency 50 --garnet-deadlock-threshold 100000 --l2_size 16384kB --l2_assoc 8 --num-dirs 8 --brg-fast-forward --num-cpus 64 --network garnet2.0 --buffer-size 0 --mem-size 16GB --ruby --l1d_size 64kB --mem-type SimpleMemory --num-l1-cache-ports 8 --num-l2caches 8 --ports 16 --l1i_size 64kB --topology TwoMeshXY -c /artifact_top/alloy-apps/build-applrts_sc3/run_reduce -o "-w 0 -r 1 -n 8 -c 8 -t 4 -f 64 -s 8 -v 0" --vcs-per-vnet 64 --buffers-per-data-vc 65536 --buffers-per-ctrl-vc 1024 > logs/log1190.txt &
 
 # reduce_14KB 191-194
-nohup /artifact_top/alloy-gem5/build/RISCV_DO_MESI_64B_TSO/gem5.opt --stats-file=stats1191.txt --debug-flags=DOMEM,DOACC --listener-mode=off /artifact_top/alloy-gem5/configs/brg/sc3.py --cpu-type TimingSimpleCPU --link-latency 20 --CG_link_latency 50 --garnet-deadlock-threshold 100000 --l2_size 16384kB --l2_assoc 8 --num-dirs 8 --brg-fast-forward --num-cpus 64 --network garnet2.0 --buffer-size 0 --mem-size 16GB --ruby --l1d_size 64kB --mem-type SimpleMemory --num-l1-cache-ports 8 --num-l2caches 8 --ports 16 --l1i_size 64kB --topology TwoMeshXY -c /artifact_top/alloy-apps/build-applrts_sc3/run_reduce -o "-w 0 -r 1 -n 8 -c 8 -t 8 -f 3584 -s 8 -v 0" --vcs-per-vnet 64 --buffers-per-data-vc 65536 --buffers-per-ctrl-vc 1024 > logs/log1191.txt &
-nohup /artifact_top/alloy-gem5/build/RISCV_WT_MESI_64B_TSO/gem5.opt --stats-file=stats1192.txt --debug-flags=DOMEM,DOACC --listener-mode=off /artifact_top/alloy-gem5/configs/brg/sc3.py --cpu-type TimingSimpleCPU --link-latency 20 --CG_link_latency 50 --garnet-deadlock-threshold 100000 --l2_size 16384kB --l2_assoc 8 --num-dirs 8 --brg-fast-forward --num-cpus 64 --network garnet2.0 --buffer-size 0 --mem-size 16GB --ruby --l1d_size 64kB --mem-type SimpleMemory --num-l1-cache-ports 8 --num-l2caches 8 --ports 16 --l1i_size 64kB --topology TwoMeshXY -c /artifact_top/alloy-apps/build-applrts_sc3/run_reduce -o "-w 0 -r 1 -n 8 -c 8 -t 8 -f 3584 -s 8 -v 0" --vcs-per-vnet 64 --buffers-per-data-vc 65536 --buffers-per-ctrl-vc 1024 > logs/log1192.txt &
-nohup /artifact_top/alloy-gem5/build/RISCV_MESI_TSO/gem5.opt --stats-file=stats1193.txt --debug-flags=DOMEM,DOACC --listener-mode=off /artifact_top/alloy-gem5/configs/brg/sc3.py --cpu-type TimingSimpleCPU --link-latency 20 --CG_link_latency 50 --garnet-deadlock-threshold 100000 --l2_size 16384kB --l2_assoc 8 --num-dirs 8 --brg-fast-forward --num-cpus 64 --network garnet2.0 --buffer-size 0 --mem-size 16GB --ruby --l1d_size 64kB --mem-type SimpleMemory --num-l1-cache-ports 8 --num-l2caches 8 --ports 16 --l1i_size 64kB --topology TwoMeshXY -c /artifact_top/alloy-apps/build-applrts_sc3/run_reduce -o "-w 0 -r 1 -n 8 -c 8 -t 8 -f 3584 -s 8 -v 0" --vcs-per-vnet 64 --buffers-per-data-vc 65536 --buffers-per-ctrl-vc 1024 > logs/log1193.txt &
-nohup /artifact_top/alloy-gem5/build/RISCV_MP_64B_TSO/gem5.opt --stats-file=stats1194.txt --debug-flags=DOMEM,DOACC --listener-mode=off /artifact_top/alloy-gem5/configs/brg/sc3.py --cpu-type TimingSimpleCPU --link-latency 20 --CG_link_latency 50 --garnet-deadlock-threshold 100000 --l2_size 16384kB --l2_assoc 8 --num-dirs 8 --brg-fast-forward --num-cpus 64 --network garnet2.0 --buffer-size 0 --mem-size 16GB --ruby --l1d_size 64kB --mem-type SimpleMemory --num-l1-cache-ports 8 --num-l2caches 8 --ports 16 --l1i_size 64kB --topology TwoMeshXY -c /artifact_top/alloy-apps/build-applrts_sc3/run_reduce -o "-w 0 -r 1 -n 8 -c 8 -t 8 -f 3584 -s 8 -v 0" --vcs-per-vnet 64 --buffers-per-data-vc 65536 --buffers-per-ctrl-vc 1024 > logs/log1194.txt &
+nohup /artifact_top/alloy-gem5/build/RISCV_DO_MESI/gem5.opt --stats-file=stats1191.txt --debug-flags=DOMEM,DOACC --listener-mode=off /artifact_top/alloy-gem5/configs/brg/sc3.py --do-consistency-model TSO --msg-size PUT_NT:64 --msg-size PUT_REL:72 --cpu-type TimingSimpleCPU --link-latency 20 --CG_link_latency 50 --garnet-deadlock-threshold 100000 --l2_size 16384kB --l2_assoc 8 --num-dirs 8 --brg-fast-forward --num-cpus 64 --network garnet2.0 --buffer-size 0 --mem-size 16GB --ruby --l1d_size 64kB --mem-type SimpleMemory --num-l1-cache-ports 8 --num-l2caches 8 --ports 16 --l1i_size 64kB --topology TwoMeshXY -c /artifact_top/alloy-apps/build-applrts_sc3/run_reduce -o "-w 0 -r 1 -n 8 -c 8 -t 8 -f 3584 -s 8 -v 0" --vcs-per-vnet 64 --buffers-per-data-vc 65536 --buffers-per-ctrl-vc 1024 > logs/log1191.txt &
+nohup /artifact_top/alloy-gem5/build/RISCV_WT_MESI_TSO/gem5.opt --stats-file=stats1192.txt --debug-flags=DOMEM,DOACC --listener-mode=off /artifact_top/alloy-gem5/configs/brg/sc3.py --do-consistency-model TSO --msg-size PUT_NT:64 --msg-size PUT_REL:72 --cpu-type TimingSimpleCPU --link-latency 20 --CG_link_latency 50 --garnet-deadlock-threshold 100000 --l2_size 16384kB --l2_assoc 8 --num-dirs 8 --brg-fast-forward --num-cpus 64 --network garnet2.0 --buffer-size 0 --mem-size 16GB --ruby --l1d_size 64kB --mem-type SimpleMemory --num-l1-cache-ports 8 --num-l2caches 8 --ports 16 --l1i_size 64kB --topology TwoMeshXY -c /artifact_top/alloy-apps/build-applrts_sc3/run_reduce -o "-w 0 -r 1 -n 8 -c 8 -t 8 -f 3584 -s 8 -v 0" --vcs-per-vnet 64 --buffers-per-data-vc 65536 --buffers-per-ctrl-vc 1024 > logs/log1192.txt &
+nohup /artifact_top/alloy-gem5/build/RISCV_MESI/gem5.opt --stats-file=stats1193.txt --debug-flags=DOMEM,DOACC --listener-mode=off /artifact_top/alloy-gem5/configs/brg/sc3.py --do-consistency-model TSO_WB --cpu-type TimingSimpleCPU --link-latency 20 --CG_link_latency 50 --garnet-deadlock-threshold 100000 --l2_size 16384kB --l2_assoc 8 --num-dirs 8 --brg-fast-forward --num-cpus 64 --network garnet2.0 --buffer-size 0 --mem-size 16GB --ruby --l1d_size 64kB --mem-type SimpleMemory --num-l1-cache-ports 8 --num-l2caches 8 --ports 16 --l1i_size 64kB --topology TwoMeshXY -c /artifact_top/alloy-apps/build-applrts_sc3/run_reduce -o "-w 0 -r 1 -n 8 -c 8 -t 8 -f 3584 -s 8 -v 0" --vcs-per-vnet 64 --buffers-per-data-vc 65536 --buffers-per-ctrl-vc 1024 > logs/log1193.txt &
+nohup /artifact_top/alloy-gem5/build/RISCV_MP/gem5.opt --stats-file=stats1194.txt --debug-flags=DOMEM,DOACC --listener-mode=off /artifact_top/alloy-gem5/configs/brg/sc3.py --do-consistency-model TSO --msg-size PUT_NT:64 --msg-size PUT_REL:72 --cpu-type TimingSimpleCPU --link-latency 20 --CG_link_latency 50 --garnet-deadlock-threshold 100000 --l2_size 16384kB --l2_assoc 8 --num-dirs 8 --brg-fast-forward --num-cpus 64 --network garnet2.0 --buffer-size 0 --mem-size 16GB --ruby --l1d_size 64kB --mem-type SimpleMemory --num-l1-cache-ports 8 --num-l2caches 8 --ports 16 --l1i_size 64kB --topology TwoMeshXY -c /artifact_top/alloy-apps/build-applrts_sc3/run_reduce -o "-w 0 -r 1 -n 8 -c 8 -t 8 -f 3584 -s 8 -v 0" --vcs-per-vnet 64 --buffers-per-data-vc 65536 --buffers-per-ctrl-vc 1024 > logs/log1194.txt &
 
 # allreduce_8B 195-198
-nohup /artifact_top/alloy-gem5/build/RISCV_DO_MESI_TSO/gem5.opt --stats-file=stats1195.txt --debug-flags=DOMEM,DOACC --listener-mode=off /artifact_top/alloy-gem5/configs/brg/sc3.py --cpu-type TimingSimpleCPU --link-latency 20 --CG_link_latency 50 --garnet-deadlock-threshold 100000 --l2_size 16384kB --l2_assoc 8 --num-dirs 8 --brg-fast-forward --num-cpus 64 --network garnet2.0 --buffer-size 0 --mem-size 16GB --ruby --l1d_size 64kB --mem-type SimpleMemory --num-l1-cache-ports 8 --num-l2caches 8 --ports 16 --l1i_size 64kB --topology TwoMeshXY -c /artifact_top/alloy-apps/build-applrts_sc3/run_allreduce -o "-w 0 -r 2 -n 8 -c 8 -t 1 -f 128 -s 1000 -v 0" --vcs-per-vnet 64 --buffers-per-data-vc 65536 --buffers-per-ctrl-vc 1024 > logs/log1195.txt &
-nohup /artifact_top/alloy-gem5/build/RISCV_WT_MESI_TSO/gem5.opt --stats-file=stats1196.txt --debug-flags=DOMEM,DOACC --listener-mode=off /artifact_top/alloy-gem5/configs/brg/sc3.py --cpu-type TimingSimpleCPU --link-latency 20 --CG_link_latency 50 --garnet-deadlock-threshold 100000 --l2_size 16384kB --l2_assoc 8 --num-dirs 8 --brg-fast-forward --num-cpus 64 --network garnet2.0 --buffer-size 0 --mem-size 16GB --ruby --l1d_size 64kB --mem-type SimpleMemory --num-l1-cache-ports 8 --num-l2caches 8 --ports 16 --l1i_size 64kB --topology TwoMeshXY -c /artifact_top/alloy-apps/build-applrts_sc3/run_allreduce -o "-w 0 -r 2 -n 8 -c 8 -t 1 -f 128 -s 1000 -v 0" --vcs-per-vnet 64 --buffers-per-data-vc 65536 --buffers-per-ctrl-vc 1024 > logs/log1196.txt &
-nohup /artifact_top/alloy-gem5/build/RISCV_MESI_TSO/gem5.opt --stats-file=stats1197.txt --debug-flags=DOMEM,DOACC --listener-mode=off /artifact_top/alloy-gem5/configs/brg/sc3.py --cpu-type TimingSimpleCPU --link-latency 20 --CG_link_latency 50 --garnet-deadlock-threshold 100000 --l2_size 16384kB --l2_assoc 8 --num-dirs 8 --brg-fast-forward --num-cpus 64 --network garnet2.0 --buffer-size 0 --mem-size 16GB --ruby --l1d_size 64kB --mem-type SimpleMemory --num-l1-cache-ports 8 --num-l2caches 8 --ports 16 --l1i_size 64kB --topology TwoMeshXY -c /artifact_top/alloy-apps/build-applrts_sc3/run_allreduce -o "-w 0 -r 2 -n 8 -c 8 -t 1 -f 128 -s 1000 -v 0" --vcs-per-vnet 64 --buffers-per-data-vc 65536 --buffers-per-ctrl-vc 1024 > logs/log1197.txt &
-nohup /artifact_top/alloy-gem5/build/RISCV_MP_TSO/gem5.opt --stats-file=stats1198.txt --debug-flags=DOMEM,DOACC --listener-mode=off /artifact_top/alloy-gem5/configs/brg/sc3.py --cpu-type TimingSimpleCPU --link-latency 20 --CG_link_latency 50 --garnet-deadlock-threshold 100000 --l2_size 16384kB --l2_assoc 8 --num-dirs 8 --brg-fast-forward --num-cpus 64 --network garnet2.0 --buffer-size 0 --mem-size 16GB --ruby --l1d_size 64kB --mem-type SimpleMemory --num-l1-cache-ports 8 --num-l2caches 8 --ports 16 --l1i_size 64kB --topology TwoMeshXY -c /artifact_top/alloy-apps/build-applrts_sc3/run_allreduce -o "-w 0 -r 2 -n 8 -c 8 -t 1 -f 128 -s 1000 -v 0" --vcs-per-vnet 64 --buffers-per-data-vc 65536 --buffers-per-ctrl-vc 1024 > logs/log1198.txt &
+nohup /artifact_top/alloy-gem5/build/RISCV_DO_MESI/gem5.opt --stats-file=stats1195.txt --debug-flags=DOMEM,DOACC --listener-mode=off /artifact_top/alloy-gem5/configs/brg/sc3.py --do-consistency-model TSO --cpu-type TimingSimpleCPU --link-latency 20 --CG_link_latency 50 --garnet-deadlock-threshold 100000 --l2_size 16384kB --l2_assoc 8 --num-dirs 8 --brg-fast-forward --num-cpus 64 --network garnet2.0 --buffer-size 0 --mem-size 16GB --ruby --l1d_size 64kB --mem-type SimpleMemory --num-l1-cache-ports 8 --num-l2caches 8 --ports 16 --l1i_size 64kB --topology TwoMeshXY -c /artifact_top/alloy-apps/build-applrts_sc3/run_allreduce -o "-w 0 -r 2 -n 8 -c 8 -t 1 -f 128 -s 1000 -v 0" --vcs-per-vnet 64 --buffers-per-data-vc 65536 --buffers-per-ctrl-vc 1024 > logs/log1195.txt &
+nohup /artifact_top/alloy-gem5/build/RISCV_WT_MESI_TSO/gem5.opt --stats-file=stats1196.txt --debug-flags=DOMEM,DOACC --listener-mode=off /artifact_top/alloy-gem5/configs/brg/sc3.py --do-consistency-model TSO --cpu-type TimingSimpleCPU --link-latency 20 --CG_link_latency 50 --garnet-deadlock-threshold 100000 --l2_size 16384kB --l2_assoc 8 --num-dirs 8 --brg-fast-forward --num-cpus 64 --network garnet2.0 --buffer-size 0 --mem-size 16GB --ruby --l1d_size 64kB --mem-type SimpleMemory --num-l1-cache-ports 8 --num-l2caches 8 --ports 16 --l1i_size 64kB --topology TwoMeshXY -c /artifact_top/alloy-apps/build-applrts_sc3/run_allreduce -o "-w 0 -r 2 -n 8 -c 8 -t 1 -f 128 -s 1000 -v 0" --vcs-per-vnet 64 --buffers-per-data-vc 65536 --buffers-per-ctrl-vc 1024 > logs/log1196.txt &
+nohup /artifact_top/alloy-gem5/build/RISCV_MESI/gem5.opt --stats-file=stats1197.txt --debug-flags=DOMEM,DOACC --listener-mode=off /artifact_top/alloy-gem5/configs/brg/sc3.py --do-consistency-model TSO_WB --cpu-type TimingSimpleCPU --link-latency 20 --CG_link_latency 50 --garnet-deadlock-threshold 100000 --l2_size 16384kB --l2_assoc 8 --num-dirs 8 --brg-fast-forward --num-cpus 64 --network garnet2.0 --buffer-size 0 --mem-size 16GB --ruby --l1d_size 64kB --mem-type SimpleMemory --num-l1-cache-ports 8 --num-l2caches 8 --ports 16 --l1i_size 64kB --topology TwoMeshXY -c /artifact_top/alloy-apps/build-applrts_sc3/run_allreduce -o "-w 0 -r 2 -n 8 -c 8 -t 1 -f 128 -s 1000 -v 0" --vcs-per-vnet 64 --buffers-per-data-vc 65536 --buffers-per-ctrl-vc 1024 > logs/log1197.txt &
+nohup /artifact_top/alloy-gem5/build/RISCV_MP/gem5.opt --stats-file=stats1198.txt --debug-flags=DOMEM,DOACC --listener-mode=off /artifact_top/alloy-gem5/configs/brg/sc3.py --do-consistency-model TSO --cpu-type TimingSimpleCPU --link-latency 20 --CG_link_latency 50 --garnet-deadlock-threshold 100000 --l2_size 16384kB --l2_assoc 8 --num-dirs 8 --brg-fast-forward --num-cpus 64 --network garnet2.0 --buffer-size 0 --mem-size 16GB --ruby --l1d_size 64kB --mem-type SimpleMemory --num-l1-cache-ports 8 --num-l2caches 8 --ports 16 --l1i_size 64kB --topology TwoMeshXY -c /artifact_top/alloy-apps/build-applrts_sc3/run_allreduce -o "-w 0 -r 2 -n 8 -c 8 -t 1 -f 128 -s 1000 -v 0" --vcs-per-vnet 64 --buffers-per-data-vc 65536 --buffers-per-ctrl-vc 1024 > logs/log1198.txt &
 
 # bcast_8B 199-202
-nohup /artifact_top/alloy-gem5/build/RISCV_DO_MESI_TSO/gem5.opt --stats-file=stats1199.txt --debug-flags=DOMEM,DOACC --listener-mode=off /artifact_top/alloy-gem5/configs/brg/sc3.py --cpu-type TimingSimpleCPU --link-latency 20 --CG_link_latency 50 --garnet-deadlock-threshold 100000 --l2_size 16384kB --l2_assoc 8 --num-dirs 8 --brg-fast-forward --num-cpus 64 --network garnet2.0 --buffer-size 0 --mem-size 16GB --ruby --l1d_size 64kB --mem-type SimpleMemory --num-l1-cache-ports 8 --num-l2caches 8 --ports 16 --l1i_size 64kB --topology TwoMeshXY -c /artifact_top/alloy-apps/build-applrts_sc3/run_scatter -o "-w 0 -r 2 -n 8 -c 8 -t 1 -f 16 -s 1000 -v 0" --vcs-per-vnet 64 --buffers-per-data-vc 65536 --buffers-per-ctrl-vc 1024 > logs/log1199.txt &
-nohup /artifact_top/alloy-gem5/build/RISCV_WT_MESI_TSO/gem5.opt --stats-file=stats1200.txt --debug-flags=DOMEM,DOACC --listener-mode=off /artifact_top/alloy-gem5/configs/brg/sc3.py --cpu-type TimingSimpleCPU --link-latency 20 --CG_link_latency 50 --garnet-deadlock-threshold 100000 --l2_size 16384kB --l2_assoc 8 --num-dirs 8 --brg-fast-forward --num-cpus 64 --network garnet2.0 --buffer-size 0 --mem-size 16GB --ruby --l1d_size 64kB --mem-type SimpleMemory --num-l1-cache-ports 8 --num-l2caches 8 --ports 16 --l1i_size 64kB --topology TwoMeshXY -c /artifact_top/alloy-apps/build-applrts_sc3/run_scatter -o "-w 0 -r 2 -n 8 -c 8 -t 1 -f 16 -s 1000 -v 0" --vcs-per-vnet 64 --buffers-per-data-vc 65536 --buffers-per-ctrl-vc 1024 > logs/log1200.txt &
-nohup /artifact_top/alloy-gem5/build/RISCV_MESI_TSO/gem5.opt --stats-file=stats1201.txt --debug-flags=DOMEM,DOACC --listener-mode=off /artifact_top/alloy-gem5/configs/brg/sc3.py --cpu-type TimingSimpleCPU --link-latency 20 --CG_link_latency 50 --garnet-deadlock-threshold 100000 --l2_size 16384kB --l2_assoc 8 --num-dirs 8 --brg-fast-forward --num-cpus 64 --network garnet2.0 --buffer-size 0 --mem-size 16GB --ruby --l1d_size 64kB --mem-type SimpleMemory --num-l1-cache-ports 8 --num-l2caches 8 --ports 16 --l1i_size 64kB --topology TwoMeshXY -c /artifact_top/alloy-apps/build-applrts_sc3/run_scatter -o "-w 0 -r 2 -n 8 -c 8 -t 1 -f 16 -s 1000 -v 0" --vcs-per-vnet 64 --buffers-per-data-vc 65536 --buffers-per-ctrl-vc 1024 > logs/log1201.txt &
-nohup /artifact_top/alloy-gem5/build/RISCV_MP_TSO/gem5.opt --stats-file=stats1202.txt --debug-flags=DOMEM,DOACC --listener-mode=off /artifact_top/alloy-gem5/configs/brg/sc3.py --cpu-type TimingSimpleCPU --link-latency 20 --CG_link_latency 50 --garnet-deadlock-threshold 100000 --l2_size 16384kB --l2_assoc 8 --num-dirs 8 --brg-fast-forward --num-cpus 64 --network garnet2.0 --buffer-size 0 --mem-size 16GB --ruby --l1d_size 64kB --mem-type SimpleMemory --num-l1-cache-ports 8 --num-l2caches 8 --ports 16 --l1i_size 64kB --topology TwoMeshXY -c /artifact_top/alloy-apps/build-applrts_sc3/run_scatter -o "-w 0 -r 2 -n 8 -c 8 -t 1 -f 16 -s 1000 -v 0" --vcs-per-vnet 64 --buffers-per-data-vc 65536 --buffers-per-ctrl-vc 1024 > logs/log1202.txt &
+nohup /artifact_top/alloy-gem5/build/RISCV_DO_MESI/gem5.opt --stats-file=stats1199.txt --debug-flags=DOMEM,DOACC --listener-mode=off /artifact_top/alloy-gem5/configs/brg/sc3.py --do-consistency-model TSO --cpu-type TimingSimpleCPU --link-latency 20 --CG_link_latency 50 --garnet-deadlock-threshold 100000 --l2_size 16384kB --l2_assoc 8 --num-dirs 8 --brg-fast-forward --num-cpus 64 --network garnet2.0 --buffer-size 0 --mem-size 16GB --ruby --l1d_size 64kB --mem-type SimpleMemory --num-l1-cache-ports 8 --num-l2caches 8 --ports 16 --l1i_size 64kB --topology TwoMeshXY -c /artifact_top/alloy-apps/build-applrts_sc3/run_scatter -o "-w 0 -r 2 -n 8 -c 8 -t 1 -f 16 -s 1000 -v 0" --vcs-per-vnet 64 --buffers-per-data-vc 65536 --buffers-per-ctrl-vc 1024 > logs/log1199.txt &
+nohup /artifact_top/alloy-gem5/build/RISCV_WT_MESI_TSO/gem5.opt --stats-file=stats1200.txt --debug-flags=DOMEM,DOACC --listener-mode=off /artifact_top/alloy-gem5/configs/brg/sc3.py --do-consistency-model TSO --cpu-type TimingSimpleCPU --link-latency 20 --CG_link_latency 50 --garnet-deadlock-threshold 100000 --l2_size 16384kB --l2_assoc 8 --num-dirs 8 --brg-fast-forward --num-cpus 64 --network garnet2.0 --buffer-size 0 --mem-size 16GB --ruby --l1d_size 64kB --mem-type SimpleMemory --num-l1-cache-ports 8 --num-l2caches 8 --ports 16 --l1i_size 64kB --topology TwoMeshXY -c /artifact_top/alloy-apps/build-applrts_sc3/run_scatter -o "-w 0 -r 2 -n 8 -c 8 -t 1 -f 16 -s 1000 -v 0" --vcs-per-vnet 64 --buffers-per-data-vc 65536 --buffers-per-ctrl-vc 1024 > logs/log1200.txt &
+nohup /artifact_top/alloy-gem5/build/RISCV_MESI/gem5.opt --stats-file=stats1201.txt --debug-flags=DOMEM,DOACC --listener-mode=off /artifact_top/alloy-gem5/configs/brg/sc3.py --do-consistency-model TSO_WB --cpu-type TimingSimpleCPU --link-latency 20 --CG_link_latency 50 --garnet-deadlock-threshold 100000 --l2_size 16384kB --l2_assoc 8 --num-dirs 8 --brg-fast-forward --num-cpus 64 --network garnet2.0 --buffer-size 0 --mem-size 16GB --ruby --l1d_size 64kB --mem-type SimpleMemory --num-l1-cache-ports 8 --num-l2caches 8 --ports 16 --l1i_size 64kB --topology TwoMeshXY -c /artifact_top/alloy-apps/build-applrts_sc3/run_scatter -o "-w 0 -r 2 -n 8 -c 8 -t 1 -f 16 -s 1000 -v 0" --vcs-per-vnet 64 --buffers-per-data-vc 65536 --buffers-per-ctrl-vc 1024 > logs/log1201.txt &
+nohup /artifact_top/alloy-gem5/build/RISCV_MP/gem5.opt --stats-file=stats1202.txt --debug-flags=DOMEM,DOACC --listener-mode=off /artifact_top/alloy-gem5/configs/brg/sc3.py --do-consistency-model TSO --cpu-type TimingSimpleCPU --link-latency 20 --CG_link_latency 50 --garnet-deadlock-threshold 100000 --l2_size 16384kB --l2_assoc 8 --num-dirs 8 --brg-fast-forward --num-cpus 64 --network garnet2.0 --buffer-size 0 --mem-size 16GB --ruby --l1d_size 64kB --mem-type SimpleMemory --num-l1-cache-ports 8 --num-l2caches 8 --ports 16 --l1i_size 64kB --topology TwoMeshXY -c /artifact_top/alloy-apps/build-applrts_sc3/run_scatter -o "-w 0 -r 2 -n 8 -c 8 -t 1 -f 16 -s 1000 -v 0" --vcs-per-vnet 64 --buffers-per-data-vc 65536 --buffers-per-ctrl-vc 1024 > logs/log1202.txt &
 
 # sendrecv_8B 203-206
-nohup /artifact_top/alloy-gem5/build/RISCV_DO_MESI_TSO/gem5.opt --stats-file=stats1203.txt --debug-flags=DOMEM,DOACC --listener-mode=off /artifact_top/alloy-gem5/configs/brg/sc3.py --cpu-type TimingSimpleCPU --link-latency 20 --CG_link_latency 50 --garnet-deadlock-threshold 100000 --l2_size 16384kB --l2_assoc 8 --num-dirs 8 --brg-fast-forward --num-cpus 64 --network garnet2.0 --buffer-size 0 --mem-size 16GB --ruby --l1d_size 64kB --mem-type SimpleMemory --num-l1-cache-ports 8 --num-l2caches 8 --ports 16 --l1i_size 64kB --topology TwoMeshXY -c /artifact_top/alloy-apps/build-applrts_sc3/run_sendrecv -o "-w 0 -r 2 -c 8 -f 16 -s 1000" --vcs-per-vnet 64 --buffers-per-data-vc 65536 --buffers-per-ctrl-vc 1024 > logs/log1203.txt &
-nohup /artifact_top/alloy-gem5/build/RISCV_WT_MESI_TSO/gem5.opt --stats-file=stats1204.txt --debug-flags=DOMEM,DOACC --listener-mode=off /artifact_top/alloy-gem5/configs/brg/sc3.py --cpu-type TimingSimpleCPU --link-latency 20 --CG_link_latency 50 --garnet-deadlock-threshold 100000 --l2_size 16384kB --l2_assoc 8 --num-dirs 8 --brg-fast-forward --num-cpus 64 --network garnet2.0 --buffer-size 0 --mem-size 16GB --ruby --l1d_size 64kB --mem-type SimpleMemory --num-l1-cache-ports 8 --num-l2caches 8 --ports 16 --l1i_size 64kB --topology TwoMeshXY -c /artifact_top/alloy-apps/build-applrts_sc3/run_sendrecv -o "-w 0 -r 2 -c 8 -f 16 -s 1000" --vcs-per-vnet 64 --buffers-per-data-vc 65536 --buffers-per-ctrl-vc 1024 > logs/log1204.txt &
-nohup /artifact_top/alloy-gem5/build/RISCV_MESI_TSO/gem5.opt --stats-file=stats1205.txt --debug-flags=DOMEM,DOACC --listener-mode=off /artifact_top/alloy-gem5/configs/brg/sc3.py --cpu-type TimingSimpleCPU --link-latency 20 --CG_link_latency 50 --garnet-deadlock-threshold 100000 --l2_size 16384kB --l2_assoc 8 --num-dirs 8 --brg-fast-forward --num-cpus 64 --network garnet2.0 --buffer-size 0 --mem-size 16GB --ruby --l1d_size 64kB --mem-type SimpleMemory --num-l1-cache-ports 8 --num-l2caches 8 --ports 16 --l1i_size 64kB --topology TwoMeshXY -c /artifact_top/alloy-apps/build-applrts_sc3/run_sendrecv -o "-w 0 -r 2 -c 8 -f 16 -s 1000" --vcs-per-vnet 64 --buffers-per-data-vc 65536 --buffers-per-ctrl-vc 1024 > logs/log1205.txt &
-nohup /artifact_top/alloy-gem5/build/RISCV_MP_TSO/gem5.opt --stats-file=stats1206.txt --debug-flags=DOMEM,DOACC --listener-mode=off /artifact_top/alloy-gem5/configs/brg/sc3.py --cpu-type TimingSimpleCPU --link-latency 20 --CG_link_latency 50 --garnet-deadlock-threshold 100000 --l2_size 16384kB --l2_assoc 8 --num-dirs 8 --brg-fast-forward --num-cpus 64 --network garnet2.0 --buffer-size 0 --mem-size 16GB --ruby --l1d_size 64kB --mem-type SimpleMemory --num-l1-cache-ports 8 --num-l2caches 8 --ports 16 --l1i_size 64kB --topology TwoMeshXY -c /artifact_top/alloy-apps/build-applrts_sc3/run_sendrecv -o "-w 0 -r 2 -c 8 -f 16 -s 1000" --vcs-per-vnet 64 --buffers-per-data-vc 65536 --buffers-per-ctrl-vc 1024 > logs/log1206.txt &
+nohup /artifact_top/alloy-gem5/build/RISCV_DO_MESI/gem5.opt --stats-file=stats1203.txt --debug-flags=DOMEM,DOACC --listener-mode=off /artifact_top/alloy-gem5/configs/brg/sc3.py --do-consistency-model TSO --cpu-type TimingSimpleCPU --link-latency 20 --CG_link_latency 50 --garnet-deadlock-threshold 100000 --l2_size 16384kB --l2_assoc 8 --num-dirs 8 --brg-fast-forward --num-cpus 64 --network garnet2.0 --buffer-size 0 --mem-size 16GB --ruby --l1d_size 64kB --mem-type SimpleMemory --num-l1-cache-ports 8 --num-l2caches 8 --ports 16 --l1i_size 64kB --topology TwoMeshXY -c /artifact_top/alloy-apps/build-applrts_sc3/run_sendrecv -o "-w 0 -r 2 -c 8 -f 16 -s 1000" --vcs-per-vnet 64 --buffers-per-data-vc 65536 --buffers-per-ctrl-vc 1024 > logs/log1203.txt &
+nohup /artifact_top/alloy-gem5/build/RISCV_WT_MESI_TSO/gem5.opt --stats-file=stats1204.txt --debug-flags=DOMEM,DOACC --listener-mode=off /artifact_top/alloy-gem5/configs/brg/sc3.py --do-consistency-model TSO --cpu-type TimingSimpleCPU --link-latency 20 --CG_link_latency 50 --garnet-deadlock-threshold 100000 --l2_size 16384kB --l2_assoc 8 --num-dirs 8 --brg-fast-forward --num-cpus 64 --network garnet2.0 --buffer-size 0 --mem-size 16GB --ruby --l1d_size 64kB --mem-type SimpleMemory --num-l1-cache-ports 8 --num-l2caches 8 --ports 16 --l1i_size 64kB --topology TwoMeshXY -c /artifact_top/alloy-apps/build-applrts_sc3/run_sendrecv -o "-w 0 -r 2 -c 8 -f 16 -s 1000" --vcs-per-vnet 64 --buffers-per-data-vc 65536 --buffers-per-ctrl-vc 1024 > logs/log1204.txt &
+nohup /artifact_top/alloy-gem5/build/RISCV_MESI/gem5.opt --stats-file=stats1205.txt --debug-flags=DOMEM,DOACC --listener-mode=off /artifact_top/alloy-gem5/configs/brg/sc3.py --do-consistency-model TSO_WB --cpu-type TimingSimpleCPU --link-latency 20 --CG_link_latency 50 --garnet-deadlock-threshold 100000 --l2_size 16384kB --l2_assoc 8 --num-dirs 8 --brg-fast-forward --num-cpus 64 --network garnet2.0 --buffer-size 0 --mem-size 16GB --ruby --l1d_size 64kB --mem-type SimpleMemory --num-l1-cache-ports 8 --num-l2caches 8 --ports 16 --l1i_size 64kB --topology TwoMeshXY -c /artifact_top/alloy-apps/build-applrts_sc3/run_sendrecv -o "-w 0 -r 2 -c 8 -f 16 -s 1000" --vcs-per-vnet 64 --buffers-per-data-vc 65536 --buffers-per-ctrl-vc 1024 > logs/log1205.txt &
+nohup /artifact_top/alloy-gem5/build/RISCV_MP/gem5.opt --stats-file=stats1206.txt --debug-flags=DOMEM,DOACC --listener-mode=off /artifact_top/alloy-gem5/configs/brg/sc3.py --do-consistency-model TSO --cpu-type TimingSimpleCPU --link-latency 20 --CG_link_latency 50 --garnet-deadlock-threshold 100000 --l2_size 16384kB --l2_assoc 8 --num-dirs 8 --brg-fast-forward --num-cpus 64 --network garnet2.0 --buffer-size 0 --mem-size 16GB --ruby --l1d_size 64kB --mem-type SimpleMemory --num-l1-cache-ports 8 --num-l2caches 8 --ports 16 --l1i_size 64kB --topology TwoMeshXY -c /artifact_top/alloy-apps/build-applrts_sc3/run_sendrecv -o "-w 0 -r 2 -c 8 -f 16 -s 1000" --vcs-per-vnet 64 --buffers-per-data-vc 65536 --buffers-per-ctrl-vc 1024 > logs/log1206.txt &
 
 # sendrecv_512B 207-210
-nohup /artifact_top/alloy-gem5/build/RISCV_DO_MESI_64B_TSO/gem5.opt --stats-file=stats1207.txt --debug-flags=DOMEM,DOACC --listener-mode=off /artifact_top/alloy-gem5/configs/brg/sc3.py --cpu-type TimingSimpleCPU --link-latency 20 --CG_link_latency 50 --garnet-deadlock-threshold 100000 --l2_size 16384kB --l2_assoc 8 --num-dirs 8 --brg-fast-forward --num-cpus 64 --network garnet2.0 --buffer-size 0 --mem-size 16GB --ruby --l1d_size 64kB --mem-type SimpleMemory --num-l1-cache-ports 8 --num-l2caches 8 --ports 16 --l1i_size 64kB --topology TwoMeshXY -c /artifact_top/alloy-apps/build-applrts_sc3/run_sendrecv -o "-w 0 -r 2 -c 8 -f 128 -s 8" --vcs-per-vnet 64 --buffers-per-data-vc 65536 --buffers-per-ctrl-vc 1024 > logs/log1207.txt &
-nohup /artifact_top/alloy-gem5/build/RISCV_WT_MESI_64B_TSO/gem5.opt --stats-file=stats1208.txt --debug-flags=DOMEM,DOACC --listener-mode=off /artifact_top/alloy-gem5/configs/brg/sc3.py --cpu-type TimingSimpleCPU --link-latency 20 --CG_link_latency 50 --garnet-deadlock-threshold 100000 --l2_size 16384kB --l2_assoc 8 --num-dirs 8 --brg-fast-forward --num-cpus 64 --network garnet2.0 --buffer-size 0 --mem-size 16GB --ruby --l1d_size 64kB --mem-type SimpleMemory --num-l1-cache-ports 8 --num-l2caches 8 --ports 16 --l1i_size 64kB --topology TwoMeshXY -c /artifact_top/alloy-apps/build-applrts_sc3/run_sendrecv -o "-w 0 -r 2 -c 8 -f 128 -s 8" --vcs-per-vnet 64 --buffers-per-data-vc 65536 --buffers-per-ctrl-vc 1024 > logs/log1208.txt &
-nohup /artifact_top/alloy-gem5/build/RISCV_MESI_TSO/gem5.opt --stats-file=stats1209.txt --debug-flags=DOMEM,DOACC --listener-mode=off /artifact_top/alloy-gem5/configs/brg/sc3.py --cpu-type TimingSimpleCPU --link-latency 20 --CG_link_latency 50 --garnet-deadlock-threshold 100000 --l2_size 16384kB --l2_assoc 8 --num-dirs 8 --brg-fast-forward --num-cpus 64 --network garnet2.0 --buffer-size 0 --mem-size 16GB --ruby --l1d_size 64kB --mem-type SimpleMemory --num-l1-cache-ports 8 --num-l2caches 8 --ports 16 --l1i_size 64kB --topology TwoMeshXY -c /artifact_top/alloy-apps/build-applrts_sc3/run_sendrecv -o "-w 0 -r 2 -c 8 -f 128 -s 8" --vcs-per-vnet 64 --buffers-per-data-vc 65536 --buffers-per-ctrl-vc 1024 > logs/log1209.txt &
-nohup /artifact_top/alloy-gem5/build/RISCV_MP_64B_TSO/gem5.opt --stats-file=stats1210.txt --debug-flags=DOMEM,DOACC --listener-mode=off /artifact_top/alloy-gem5/configs/brg/sc3.py --cpu-type TimingSimpleCPU --link-latency 20 --CG_link_latency 50 --garnet-deadlock-threshold 100000 --l2_size 16384kB --l2_assoc 8 --num-dirs 8 --brg-fast-forward --num-cpus 64 --network garnet2.0 --buffer-size 0 --mem-size 16GB --ruby --l1d_size 64kB --mem-type SimpleMemory --num-l1-cache-ports 8 --num-l2caches 8 --ports 16 --l1i_size 64kB --topology TwoMeshXY -c /artifact_top/alloy-apps/build-applrts_sc3/run_sendrecv -o "-w 0 -r 2 -c 8 -f 128 -s 8" --vcs-per-vnet 64 --buffers-per-data-vc 65536 --buffers-per-ctrl-vc 1024 > logs/log1210.txt &
+nohup /artifact_top/alloy-gem5/build/RISCV_DO_MESI/gem5.opt --stats-file=stats1207.txt --debug-flags=DOMEM,DOACC --listener-mode=off /artifact_top/alloy-gem5/configs/brg/sc3.py --do-consistency-model TSO --msg-size PUT_NT:64 --msg-size PUT_REL:72 --cpu-type TimingSimpleCPU --link-latency 20 --CG_link_latency 50 --garnet-deadlock-threshold 100000 --l2_size 16384kB --l2_assoc 8 --num-dirs 8 --brg-fast-forward --num-cpus 64 --network garnet2.0 --buffer-size 0 --mem-size 16GB --ruby --l1d_size 64kB --mem-type SimpleMemory --num-l1-cache-ports 8 --num-l2caches 8 --ports 16 --l1i_size 64kB --topology TwoMeshXY -c /artifact_top/alloy-apps/build-applrts_sc3/run_sendrecv -o "-w 0 -r 2 -c 8 -f 128 -s 8" --vcs-per-vnet 64 --buffers-per-data-vc 65536 --buffers-per-ctrl-vc 1024 > logs/log1207.txt &
+nohup /artifact_top/alloy-gem5/build/RISCV_WT_MESI_TSO/gem5.opt --stats-file=stats1208.txt --debug-flags=DOMEM,DOACC --listener-mode=off /artifact_top/alloy-gem5/configs/brg/sc3.py --do-consistency-model TSO --msg-size PUT_NT:64 --msg-size PUT_REL:72 --cpu-type TimingSimpleCPU --link-latency 20 --CG_link_latency 50 --garnet-deadlock-threshold 100000 --l2_size 16384kB --l2_assoc 8 --num-dirs 8 --brg-fast-forward --num-cpus 64 --network garnet2.0 --buffer-size 0 --mem-size 16GB --ruby --l1d_size 64kB --mem-type SimpleMemory --num-l1-cache-ports 8 --num-l2caches 8 --ports 16 --l1i_size 64kB --topology TwoMeshXY -c /artifact_top/alloy-apps/build-applrts_sc3/run_sendrecv -o "-w 0 -r 2 -c 8 -f 128 -s 8" --vcs-per-vnet 64 --buffers-per-data-vc 65536 --buffers-per-ctrl-vc 1024 > logs/log1208.txt &
+nohup /artifact_top/alloy-gem5/build/RISCV_MESI/gem5.opt --stats-file=stats1209.txt --debug-flags=DOMEM,DOACC --listener-mode=off /artifact_top/alloy-gem5/configs/brg/sc3.py --do-consistency-model TSO_WB --cpu-type TimingSimpleCPU --link-latency 20 --CG_link_latency 50 --garnet-deadlock-threshold 100000 --l2_size 16384kB --l2_assoc 8 --num-dirs 8 --brg-fast-forward --num-cpus 64 --network garnet2.0 --buffer-size 0 --mem-size 16GB --ruby --l1d_size 64kB --mem-type SimpleMemory --num-l1-cache-ports 8 --num-l2caches 8 --ports 16 --l1i_size 64kB --topology TwoMeshXY -c /artifact_top/alloy-apps/build-applrts_sc3/run_sendrecv -o "-w 0 -r 2 -c 8 -f 128 -s 8" --vcs-per-vnet 64 --buffers-per-data-vc 65536 --buffers-per-ctrl-vc 1024 > logs/log1209.txt &
+nohup /artifact_top/alloy-gem5/build/RISCV_MP/gem5.opt --stats-file=stats1210.txt --debug-flags=DOMEM,DOACC --listener-mode=off /artifact_top/alloy-gem5/configs/brg/sc3.py --do-consistency-model TSO --msg-size PUT_NT:64 --msg-size PUT_REL:72 --cpu-type TimingSimpleCPU --link-latency 20 --CG_link_latency 50 --garnet-deadlock-threshold 100000 --l2_size 16384kB --l2_assoc 8 --num-dirs 8 --brg-fast-forward --num-cpus 64 --network garnet2.0 --buffer-size 0 --mem-size 16GB --ruby --l1d_size 64kB --mem-type SimpleMemory --num-l1-cache-ports 8 --num-l2caches 8 --ports 16 --l1i_size 64kB --topology TwoMeshXY -c /artifact_top/alloy-apps/build-applrts_sc3/run_sendrecv -o "-w 0 -r 2 -c 8 -f 128 -s 8" --vcs-per-vnet 64 --buffers-per-data-vc 65536 --buffers-per-ctrl-vc 1024 > logs/log1210.txt &
 
 # barrier 211-214
-nohup /artifact_top/alloy-gem5/build/RISCV_DO_MESI_TSO/gem5.opt --stats-file=stats1211.txt --debug-flags=DOMEM,DOACC --listener-mode=off /artifact_top/alloy-gem5/configs/brg/sc3.py --cpu-type TimingSimpleCPU --link-latency 20 --CG_link_latency 50 --garnet-deadlock-threshold 100000 --l2_size 16384kB --l2_assoc 8 --num-dirs 8 --brg-fast-forward --num-cpus 64 --network garnet2.0 --buffer-size 0 --mem-size 16GB --ruby --l1d_size 64kB --mem-type SimpleMemory --num-l1-cache-ports 8 --num-l2caches 8 --ports 16 --l1i_size 64kB --topology TwoMeshXY -c /artifact_top/alloy-apps/build-applrts_sc3/run_barrier -o "-w 0 -r 2 -n 8 -c 8 -t 8" --vcs-per-vnet 64 --buffers-per-data-vc 65536 --buffers-per-ctrl-vc 1024 > logs/log1211.txt &
-nohup /artifact_top/alloy-gem5/build/RISCV_WT_MESI_TSO/gem5.opt --stats-file=stats1212.txt --debug-flags=DOMEM,DOACC --listener-mode=off /artifact_top/alloy-gem5/configs/brg/sc3.py --cpu-type TimingSimpleCPU --link-latency 20 --CG_link_latency 50 --garnet-deadlock-threshold 100000 --l2_size 16384kB --l2_assoc 8 --num-dirs 8 --brg-fast-forward --num-cpus 64 --network garnet2.0 --buffer-size 0 --mem-size 16GB --ruby --l1d_size 64kB --mem-type SimpleMemory --num-l1-cache-ports 8 --num-l2caches 8 --ports 16 --l1i_size 64kB --topology TwoMeshXY -c /artifact_top/alloy-apps/build-applrts_sc3/run_barrier -o "-w 0 -r 2 -n 8 -c 8 -t 8" --vcs-per-vnet 64 --buffers-per-data-vc 65536 --buffers-per-ctrl-vc 1024 > logs/log1212.txt &
-nohup /artifact_top/alloy-gem5/build/RISCV_MESI_TSO/gem5.opt --stats-file=stats1213.txt --debug-flags=DOMEM,DOACC --listener-mode=off /artifact_top/alloy-gem5/configs/brg/sc3.py --cpu-type TimingSimpleCPU --link-latency 20 --CG_link_latency 50 --garnet-deadlock-threshold 100000 --l2_size 16384kB --l2_assoc 8 --num-dirs 8 --brg-fast-forward --num-cpus 64 --network garnet2.0 --buffer-size 0 --mem-size 16GB --ruby --l1d_size 64kB --mem-type SimpleMemory --num-l1-cache-ports 8 --num-l2caches 8 --ports 16 --l1i_size 64kB --topology TwoMeshXY -c /artifact_top/alloy-apps/build-applrts_sc3/run_barrier -o "-w 0 -r 2 -n 8 -c 8 -t 8" --vcs-per-vnet 64 --buffers-per-data-vc 65536 --buffers-per-ctrl-vc 1024 > logs/log1213.txt &
-nohup /artifact_top/alloy-gem5/build/RISCV_MP_TSO/gem5.opt --stats-file=stats1214.txt --debug-flags=DOMEM,DOACC --listener-mode=off /artifact_top/alloy-gem5/configs/brg/sc3.py --cpu-type TimingSimpleCPU --link-latency 20 --CG_link_latency 50 --garnet-deadlock-threshold 100000 --l2_size 16384kB --l2_assoc 8 --num-dirs 8 --brg-fast-forward --num-cpus 64 --network garnet2.0 --buffer-size 0 --mem-size 16GB --ruby --l1d_size 64kB --mem-type SimpleMemory --num-l1-cache-ports 8 --num-l2caches 8 --ports 16 --l1i_size 64kB --topology TwoMeshXY -c /artifact_top/alloy-apps/build-applrts_sc3/run_barrier -o "-w 0 -r 2 -n 8 -c 8 -t 8" --vcs-per-vnet 64 --buffers-per-data-vc 65536 --buffers-per-ctrl-vc 1024 > logs/log1214.txt &
+nohup /artifact_top/alloy-gem5/build/RISCV_DO_MESI/gem5.opt --stats-file=stats1211.txt --debug-flags=DOMEM,DOACC --listener-mode=off /artifact_top/alloy-gem5/configs/brg/sc3.py --do-consistency-model TSO --cpu-type TimingSimpleCPU --link-latency 20 --CG_link_latency 50 --garnet-deadlock-threshold 100000 --l2_size 16384kB --l2_assoc 8 --num-dirs 8 --brg-fast-forward --num-cpus 64 --network garnet2.0 --buffer-size 0 --mem-size 16GB --ruby --l1d_size 64kB --mem-type SimpleMemory --num-l1-cache-ports 8 --num-l2caches 8 --ports 16 --l1i_size 64kB --topology TwoMeshXY -c /artifact_top/alloy-apps/build-applrts_sc3/run_barrier -o "-w 0 -r 2 -n 8 -c 8 -t 8" --vcs-per-vnet 64 --buffers-per-data-vc 65536 --buffers-per-ctrl-vc 1024 > logs/log1211.txt &
+nohup /artifact_top/alloy-gem5/build/RISCV_WT_MESI_TSO/gem5.opt --stats-file=stats1212.txt --debug-flags=DOMEM,DOACC --listener-mode=off /artifact_top/alloy-gem5/configs/brg/sc3.py --do-consistency-model TSO --cpu-type TimingSimpleCPU --link-latency 20 --CG_link_latency 50 --garnet-deadlock-threshold 100000 --l2_size 16384kB --l2_assoc 8 --num-dirs 8 --brg-fast-forward --num-cpus 64 --network garnet2.0 --buffer-size 0 --mem-size 16GB --ruby --l1d_size 64kB --mem-type SimpleMemory --num-l1-cache-ports 8 --num-l2caches 8 --ports 16 --l1i_size 64kB --topology TwoMeshXY -c /artifact_top/alloy-apps/build-applrts_sc3/run_barrier -o "-w 0 -r 2 -n 8 -c 8 -t 8" --vcs-per-vnet 64 --buffers-per-data-vc 65536 --buffers-per-ctrl-vc 1024 > logs/log1212.txt &
+nohup /artifact_top/alloy-gem5/build/RISCV_MESI/gem5.opt --stats-file=stats1213.txt --debug-flags=DOMEM,DOACC --listener-mode=off /artifact_top/alloy-gem5/configs/brg/sc3.py --do-consistency-model TSO_WB --cpu-type TimingSimpleCPU --link-latency 20 --CG_link_latency 50 --garnet-deadlock-threshold 100000 --l2_size 16384kB --l2_assoc 8 --num-dirs 8 --brg-fast-forward --num-cpus 64 --network garnet2.0 --buffer-size 0 --mem-size 16GB --ruby --l1d_size 64kB --mem-type SimpleMemory --num-l1-cache-ports 8 --num-l2caches 8 --ports 16 --l1i_size 64kB --topology TwoMeshXY -c /artifact_top/alloy-apps/build-applrts_sc3/run_barrier -o "-w 0 -r 2 -n 8 -c 8 -t 8" --vcs-per-vnet 64 --buffers-per-data-vc 65536 --buffers-per-ctrl-vc 1024 > logs/log1213.txt &
+nohup /artifact_top/alloy-gem5/build/RISCV_MP/gem5.opt --stats-file=stats1214.txt --debug-flags=DOMEM,DOACC --listener-mode=off /artifact_top/alloy-gem5/configs/brg/sc3.py --do-consistency-model TSO --cpu-type TimingSimpleCPU --link-latency 20 --CG_link_latency 50 --garnet-deadlock-threshold 100000 --l2_size 16384kB --l2_assoc 8 --num-dirs 8 --brg-fast-forward --num-cpus 64 --network garnet2.0 --buffer-size 0 --mem-size 16GB --ruby --l1d_size 64kB --mem-type SimpleMemory --num-l1-cache-ports 8 --num-l2caches 8 --ports 16 --l1i_size 64kB --topology TwoMeshXY -c /artifact_top/alloy-apps/build-applrts_sc3/run_barrier -o "-w 0 -r 2 -n 8 -c 8 -t 8" --vcs-per-vnet 64 --buffers-per-data-vc 65536 --buffers-per-ctrl-vc 1024 > logs/log1214.txt &
 
 # HSTI 215-218 SO traffic is buggy, need special handling
-nohup /artifact_top/alloy-gem5/build/RISCV_DO_MESI_64B_TSO/gem5.opt --stats-file=stats1215.txt --debug-flags=DOMEM,DOACC --listener-mode=off /artifact_top/alloy-gem5/configs/brg/sc3.py --cpu-type TimingSimpleCPU --link-latency 20 --CG_link_latency 150 --garnet-deadlock-threshold 100000 --l2_size 16384kB --l2_assoc 8 --num-dirs 8 --brg-fast-forward --num-cpus 64 --network garnet2.0 --buffer-size 0 --mem-size 16GB --ruby --l1d_size 64kB --mem-type SimpleMemory --num-l1-cache-ports 8 --num-l2caches 8 --ports 16 --l1i_size 64kB --topology TwoMeshXY -c /artifact_top/alloy-apps/build-applrts_sc3/TQH -o "-w 0 -r 1 -n 8 -c 8 -t 8 -p 32 -f /artifact_top/DO_gem5/datasets/basket" --vcs-per-vnet 64 --buffers-per-data-vc 65536 --buffers-per-ctrl-vc 1024 > logs/log1215.txt &
-nohup /artifact_top/alloy-gem5/build/RISCV_WT_MESI_64B_TSO/gem5.opt --stats-file=stats1216.txt --debug-flags=DOMEM,DOACC --listener-mode=off /artifact_top/alloy-gem5/configs/brg/sc3.py --cpu-type TimingSimpleCPU --link-latency 20 --CG_link_latency 150 --garnet-deadlock-threshold 100000 --l2_size 16384kB --l2_assoc 8 --num-dirs 8 --brg-fast-forward --num-cpus 64 --network garnet2.0 --buffer-size 0 --mem-size 16GB --ruby --l1d_size 64kB --mem-type SimpleMemory --num-l1-cache-ports 8 --num-l2caches 8 --ports 16 --l1i_size 64kB --topology TwoMeshXY -c /artifact_top/alloy-apps/build-applrts_sc3/TQH -o "-w 0 -r 1 -n 8 -c 8 -t 8 -p 32 -f /artifact_top/DO_gem5/datasets/basket" --vcs-per-vnet 64 --buffers-per-data-vc 65536 --buffers-per-ctrl-vc 1024 > logs/log1216.txt &
-nohup /artifact_top/alloy-gem5/build/RISCV_MESI_TSO/gem5.opt --stats-file=stats1217.txt --debug-flags=DOMEM,DOACC --listener-mode=off /artifact_top/alloy-gem5/configs/brg/sc3.py --cpu-type TimingSimpleCPU --link-latency 20 --CG_link_latency 150 --garnet-deadlock-threshold 100000 --l2_size 16384kB --l2_assoc 8 --num-dirs 8 --brg-fast-forward --num-cpus 64 --network garnet2.0 --buffer-size 0 --mem-size 16GB --ruby --l1d_size 64kB --mem-type SimpleMemory --num-l1-cache-ports 8 --num-l2caches 8 --ports 16 --l1i_size 64kB --topology TwoMeshXY -c /artifact_top/alloy-apps/build-applrts_sc3/TQH -o "-w 0 -r 1 -n 8 -c 8 -t 8 -p 32 -f /artifact_top/DO_gem5/datasets/basket" --vcs-per-vnet 64 --buffers-per-data-vc 65536 --buffers-per-ctrl-vc 1024 > logs/log1217.txt &
-nohup /artifact_top/alloy-gem5/build/RISCV_MP_64B_TSO/gem5.opt --stats-file=stats1218.txt --debug-flags=DOMEM,DOACC --listener-mode=off /artifact_top/alloy-gem5/configs/brg/sc3.py --cpu-type TimingSimpleCPU --link-latency 20 --CG_link_latency 150 --garnet-deadlock-threshold 100000 --l2_size 16384kB --l2_assoc 8 --num-dirs 8 --brg-fast-forward --num-cpus 64 --network garnet2.0 --buffer-size 0 --mem-size 16GB --ruby --l1d_size 64kB --mem-type SimpleMemory --num-l1-cache-ports 8 --num-l2caches 8 --ports 16 --l1i_size 64kB --topology TwoMeshXY -c /artifact_top/alloy-apps/build-applrts_sc3/TQH -o "-w 0 -r 1 -n 8 -c 8 -t 8 -p 32 -f /artifact_top/DO_gem5/datasets/basket" --vcs-per-vnet 64 --buffers-per-data-vc 65536 --buffers-per-ctrl-vc 1024 > logs/log1218.txt &
+nohup /artifact_top/alloy-gem5/build/RISCV_DO_MESI/gem5.opt --stats-file=stats1215.txt --debug-flags=DOMEM,DOACC --listener-mode=off /artifact_top/alloy-gem5/configs/brg/sc3.py --do-consistency-model TSO --msg-size PUT_NT:64 --msg-size PUT_REL:72 --cpu-type TimingSimpleCPU --link-latency 20 --CG_link_latency 150 --garnet-deadlock-threshold 100000 --l2_size 16384kB --l2_assoc 8 --num-dirs 8 --brg-fast-forward --num-cpus 64 --network garnet2.0 --buffer-size 0 --mem-size 16GB --ruby --l1d_size 64kB --mem-type SimpleMemory --num-l1-cache-ports 8 --num-l2caches 8 --ports 16 --l1i_size 64kB --topology TwoMeshXY -c /artifact_top/alloy-apps/build-applrts_sc3/TQH -o "-w 0 -r 1 -n 8 -c 8 -t 8 -p 32 -f /artifact_top/DO_gem5/datasets/basket" --vcs-per-vnet 64 --buffers-per-data-vc 65536 --buffers-per-ctrl-vc 1024 > logs/log1215.txt &
+nohup /artifact_top/alloy-gem5/build/RISCV_WT_MESI_TSO/gem5.opt --stats-file=stats1216.txt --debug-flags=DOMEM,DOACC --listener-mode=off /artifact_top/alloy-gem5/configs/brg/sc3.py --do-consistency-model TSO --msg-size PUT_NT:64 --msg-size PUT_REL:72 --cpu-type TimingSimpleCPU --link-latency 20 --CG_link_latency 150 --garnet-deadlock-threshold 100000 --l2_size 16384kB --l2_assoc 8 --num-dirs 8 --brg-fast-forward --num-cpus 64 --network garnet2.0 --buffer-size 0 --mem-size 16GB --ruby --l1d_size 64kB --mem-type SimpleMemory --num-l1-cache-ports 8 --num-l2caches 8 --ports 16 --l1i_size 64kB --topology TwoMeshXY -c /artifact_top/alloy-apps/build-applrts_sc3/TQH -o "-w 0 -r 1 -n 8 -c 8 -t 8 -p 32 -f /artifact_top/DO_gem5/datasets/basket" --vcs-per-vnet 64 --buffers-per-data-vc 65536 --buffers-per-ctrl-vc 1024 > logs/log1216.txt &
+nohup /artifact_top/alloy-gem5/build/RISCV_MESI/gem5.opt --stats-file=stats1217.txt --debug-flags=DOMEM,DOACC --listener-mode=off /artifact_top/alloy-gem5/configs/brg/sc3.py --do-consistency-model TSO_WB --cpu-type TimingSimpleCPU --link-latency 20 --CG_link_latency 150 --garnet-deadlock-threshold 100000 --l2_size 16384kB --l2_assoc 8 --num-dirs 8 --brg-fast-forward --num-cpus 64 --network garnet2.0 --buffer-size 0 --mem-size 16GB --ruby --l1d_size 64kB --mem-type SimpleMemory --num-l1-cache-ports 8 --num-l2caches 8 --ports 16 --l1i_size 64kB --topology TwoMeshXY -c /artifact_top/alloy-apps/build-applrts_sc3/TQH -o "-w 0 -r 1 -n 8 -c 8 -t 8 -p 32 -f /artifact_top/DO_gem5/datasets/basket" --vcs-per-vnet 64 --buffers-per-data-vc 65536 --buffers-per-ctrl-vc 1024 > logs/log1217.txt &
+nohup /artifact_top/alloy-gem5/build/RISCV_MP/gem5.opt --stats-file=stats1218.txt --debug-flags=DOMEM,DOACC --listener-mode=off /artifact_top/alloy-gem5/configs/brg/sc3.py --do-consistency-model TSO --msg-size PUT_NT:64 --msg-size PUT_REL:72 --cpu-type TimingSimpleCPU --link-latency 20 --CG_link_latency 150 --garnet-deadlock-threshold 100000 --l2_size 16384kB --l2_assoc 8 --num-dirs 8 --brg-fast-forward --num-cpus 64 --network garnet2.0 --buffer-size 0 --mem-size 16GB --ruby --l1d_size 64kB --mem-type SimpleMemory --num-l1-cache-ports 8 --num-l2caches 8 --ports 16 --l1i_size 64kB --topology TwoMeshXY -c /artifact_top/alloy-apps/build-applrts_sc3/TQH -o "-w 0 -r 1 -n 8 -c 8 -t 8 -p 32 -f /artifact_top/DO_gem5/datasets/basket" --vcs-per-vnet 64 --buffers-per-data-vc 65536 --buffers-per-ctrl-vc 1024 > logs/log1218.txt &
 
 # HSTI 219-222 SO traffic is buggy, need special handling
-nohup /artifact_top/alloy-gem5/build/RISCV_DO_MESI_64B_TSO/gem5.opt --stats-file=stats1219.txt --debug-flags=DOMEM,DOACC --listener-mode=off /artifact_top/alloy-gem5/configs/brg/sc3.py --cpu-type TimingSimpleCPU --link-latency 20 --CG_link_latency 50 --garnet-deadlock-threshold 100000 --l2_size 16384kB --l2_assoc 8 --num-dirs 8 --brg-fast-forward --num-cpus 64 --network garnet2.0 --buffer-size 0 --mem-size 16GB --ruby --l1d_size 64kB --mem-type SimpleMemory --num-l1-cache-ports 8 --num-l2caches 8 --ports 16 --l1i_size 64kB --topology TwoMeshXY -c /artifact_top/alloy-apps/build-applrts_sc3/TQH -o "-w 0 -r 1 -n 8 -c 8 -t 8 -p 32 -f /artifact_top/DO_gem5/datasets/basket" --vcs-per-vnet 64 --buffers-per-data-vc 65536 --buffers-per-ctrl-vc 1024 > logs/log1219.txt &
-nohup /artifact_top/alloy-gem5/build/RISCV_WT_MESI_64B_TSO/gem5.opt --stats-file=stats1220.txt --debug-flags=DOMEM,DOACC --listener-mode=off /artifact_top/alloy-gem5/configs/brg/sc3.py --cpu-type TimingSimpleCPU --link-latency 20 --CG_link_latency 50 --garnet-deadlock-threshold 100000 --l2_size 16384kB --l2_assoc 8 --num-dirs 8 --brg-fast-forward --num-cpus 64 --network garnet2.0 --buffer-size 0 --mem-size 16GB --ruby --l1d_size 64kB --mem-type SimpleMemory --num-l1-cache-ports 8 --num-l2caches 8 --ports 16 --l1i_size 64kB --topology TwoMeshXY -c /artifact_top/alloy-apps/build-applrts_sc3/TQH -o "-w 0 -r 1 -n 8 -c 8 -t 8 -p 32 -f /artifact_top/DO_gem5/datasets/basket" --vcs-per-vnet 64 --buffers-per-data-vc 65536 --buffers-per-ctrl-vc 1024 > logs/log1220.txt &
-nohup /artifact_top/alloy-gem5/build/RISCV_MESI_TSO/gem5.opt --stats-file=stats1221.txt --debug-flags=DOMEM,DOACC --listener-mode=off /artifact_top/alloy-gem5/configs/brg/sc3.py --cpu-type TimingSimpleCPU --link-latency 20 --CG_link_latency 50 --garnet-deadlock-threshold 100000 --l2_size 16384kB --l2_assoc 8 --num-dirs 8 --brg-fast-forward --num-cpus 64 --network garnet2.0 --buffer-size 0 --mem-size 16GB --ruby --l1d_size 64kB --mem-type SimpleMemory --num-l1-cache-ports 8 --num-l2caches 8 --ports 16 --l1i_size 64kB --topology TwoMeshXY -c /artifact_top/alloy-apps/build-applrts_sc3/TQH -o "-w 0 -r 1 -n 8 -c 8 -t 8 -p 32 -f /artifact_top/DO_gem5/datasets/basket" --vcs-per-vnet 64 --buffers-per-data-vc 65536 --buffers-per-ctrl-vc 1024 > logs/log1221.txt &
-nohup /artifact_top/alloy-gem5/build/RISCV_MP_64B_TSO/gem5.opt --stats-file=stats1222.txt --debug-flags=DOMEM,DOACC --listener-mode=off /artifact_top/alloy-gem5/configs/brg/sc3.py --cpu-type TimingSimpleCPU --link-latency 20 --CG_link_latency 50 --garnet-deadlock-threshold 100000 --l2_size 16384kB --l2_assoc 8 --num-dirs 8 --brg-fast-forward --num-cpus 64 --network garnet2.0 --buffer-size 0 --mem-size 16GB --ruby --l1d_size 64kB --mem-type SimpleMemory --num-l1-cache-ports 8 --num-l2caches 8 --ports 16 --l1i_size 64kB --topology TwoMeshXY -c /artifact_top/alloy-apps/build-applrts_sc3/TQH -o "-w 0 -r 1 -n 8 -c 8 -t 8 -p 32 -f /artifact_top/DO_gem5/datasets/basket" --vcs-per-vnet 64 --buffers-per-data-vc 65536 --buffers-per-ctrl-vc 1024 > logs/log1222.txt &
+nohup /artifact_top/alloy-gem5/build/RISCV_DO_MESI/gem5.opt --stats-file=stats1219.txt --debug-flags=DOMEM,DOACC --listener-mode=off /artifact_top/alloy-gem5/configs/brg/sc3.py --do-consistency-model TSO --msg-size PUT_NT:64 --msg-size PUT_REL:72 --cpu-type TimingSimpleCPU --link-latency 20 --CG_link_latency 50 --garnet-deadlock-threshold 100000 --l2_size 16384kB --l2_assoc 8 --num-dirs 8 --brg-fast-forward --num-cpus 64 --network garnet2.0 --buffer-size 0 --mem-size 16GB --ruby --l1d_size 64kB --mem-type SimpleMemory --num-l1-cache-ports 8 --num-l2caches 8 --ports 16 --l1i_size 64kB --topology TwoMeshXY -c /artifact_top/alloy-apps/build-applrts_sc3/TQH -o "-w 0 -r 1 -n 8 -c 8 -t 8 -p 32 -f /artifact_top/DO_gem5/datasets/basket" --vcs-per-vnet 64 --buffers-per-data-vc 65536 --buffers-per-ctrl-vc 1024 > logs/log1219.txt &
+nohup /artifact_top/alloy-gem5/build/RISCV_WT_MESI_TSO/gem5.opt --stats-file=stats1220.txt --debug-flags=DOMEM,DOACC --listener-mode=off /artifact_top/alloy-gem5/configs/brg/sc3.py --do-consistency-model TSO --msg-size PUT_NT:64 --msg-size PUT_REL:72 --cpu-type TimingSimpleCPU --link-latency 20 --CG_link_latency 50 --garnet-deadlock-threshold 100000 --l2_size 16384kB --l2_assoc 8 --num-dirs 8 --brg-fast-forward --num-cpus 64 --network garnet2.0 --buffer-size 0 --mem-size 16GB --ruby --l1d_size 64kB --mem-type SimpleMemory --num-l1-cache-ports 8 --num-l2caches 8 --ports 16 --l1i_size 64kB --topology TwoMeshXY -c /artifact_top/alloy-apps/build-applrts_sc3/TQH -o "-w 0 -r 1 -n 8 -c 8 -t 8 -p 32 -f /artifact_top/DO_gem5/datasets/basket" --vcs-per-vnet 64 --buffers-per-data-vc 65536 --buffers-per-ctrl-vc 1024 > logs/log1220.txt &
+nohup /artifact_top/alloy-gem5/build/RISCV_MESI/gem5.opt --stats-file=stats1221.txt --debug-flags=DOMEM,DOACC --listener-mode=off /artifact_top/alloy-gem5/configs/brg/sc3.py --do-consistency-model TSO_WB --cpu-type TimingSimpleCPU --link-latency 20 --CG_link_latency 50 --garnet-deadlock-threshold 100000 --l2_size 16384kB --l2_assoc 8 --num-dirs 8 --brg-fast-forward --num-cpus 64 --network garnet2.0 --buffer-size 0 --mem-size 16GB --ruby --l1d_size 64kB --mem-type SimpleMemory --num-l1-cache-ports 8 --num-l2caches 8 --ports 16 --l1i_size 64kB --topology TwoMeshXY -c /artifact_top/alloy-apps/build-applrts_sc3/TQH -o "-w 0 -r 1 -n 8 -c 8 -t 8 -p 32 -f /artifact_top/DO_gem5/datasets/basket" --vcs-per-vnet 64 --buffers-per-data-vc 65536 --buffers-per-ctrl-vc 1024 > logs/log1221.txt &
+nohup /artifact_top/alloy-gem5/build/RISCV_MP/gem5.opt --stats-file=stats1222.txt --debug-flags=DOMEM,DOACC --listener-mode=off /artifact_top/alloy-gem5/configs/brg/sc3.py --do-consistency-model TSO --msg-size PUT_NT:64 --msg-size PUT_REL:72 --cpu-type TimingSimpleCPU --link-latency 20 --CG_link_latency 50 --garnet-deadlock-threshold 100000 --l2_size 16384kB --l2_assoc 8 --num-dirs 8 --brg-fast-forward --num-cpus 64 --network garnet2.0 --buffer-size 0 --mem-size 16GB --ruby --l1d_size 64kB --mem-type SimpleMemory --num-l1-cache-ports 8 --num-l2caches 8 --ports 16 --l1i_size 64kB --topology TwoMeshXY -c /artifact_top/alloy-apps/build-applrts_sc3/TQH -o "-w 0 -r 1 -n 8 -c 8 -t 8 -p 32 -f /artifact_top/DO_gem5/datasets/basket" --vcs-per-vnet 64 --buffers-per-data-vc 65536 --buffers-per-ctrl-vc 1024 > logs/log1222.txt &
 
 # # PR 223-226
-# nohup /artifact_top/alloy-gem5/build/RISCV_DO_MESI_TSO/gem5.opt --stats-file=stats1223.txt --debug-flags=DOMEM,DOACC --listener-mode=off /artifact_top/alloy-gem5/configs/brg/sc3.py --cpu-type TimingSimpleCPU --link-latency 20 --CG_link_latency 150 --garnet-deadlock-threshold 100000 --l2_size 16384kB --l2_assoc 8 --num-dirs 8 --brg-fast-forward --num-cpus 64 --network garnet2.0 --buffer-size 0 --mem-size 16GB --ruby --l1d_size 64kB --mem-type SimpleMemory --num-l1-cache-ports 8 --num-l2caches 8 --ports 16 --l1i_size 64kB --topology TwoMeshXY -c /artifact_top/alloy-apps/build-applrts_sc3/BC -o "-w 0 -r 1 -n 8 -c 8 -t 8 -f /artifact_top/DO_gem5/datasets/mark3jac020_out.csr" --vcs-per-vnet 64 --buffers-per-data-vc 65536 --buffers-per-ctrl-vc 1024 > logs/log1223.txt &
-# nohup /artifact_top/alloy-gem5/build/RISCV_WT_MESI_TSO/gem5.opt --stats-file=stats1224.txt --debug-flags=DOMEM,DOACC --listener-mode=off /artifact_top/alloy-gem5/configs/brg/sc3.py --cpu-type TimingSimpleCPU --link-latency 20 --CG_link_latency 150 --garnet-deadlock-threshold 100000 --l2_size 16384kB --l2_assoc 8 --num-dirs 8 --brg-fast-forward --num-cpus 64 --network garnet2.0 --buffer-size 0 --mem-size 16GB --ruby --l1d_size 64kB --mem-type SimpleMemory --num-l1-cache-ports 8 --num-l2caches 8 --ports 16 --l1i_size 64kB --topology TwoMeshXY -c /artifact_top/alloy-apps/build-applrts_sc3/BC -o "-w 0 -r 1 -n 8 -c 8 -t 8 -f /artifact_top/DO_gem5/datasets/mark3jac020_out.csr" --vcs-per-vnet 64 --buffers-per-data-vc 65536 --buffers-per-ctrl-vc 1024 > logs/log1224.txt &
-# nohup /artifact_top/alloy-gem5/build/RISCV_MESI_TSO/gem5.opt --stats-file=stats1225.txt --debug-flags=DOMEM,DOACC --listener-mode=off /artifact_top/alloy-gem5/configs/brg/sc3.py --cpu-type TimingSimpleCPU --link-latency 20 --CG_link_latency 150 --garnet-deadlock-threshold 100000 --l2_size 16384kB --l2_assoc 8 --num-dirs 8 --brg-fast-forward --num-cpus 64 --network garnet2.0 --buffer-size 0 --mem-size 16GB --ruby --l1d_size 64kB --mem-type SimpleMemory --num-l1-cache-ports 8 --num-l2caches 8 --ports 16 --l1i_size 64kB --topology TwoMeshXY -c /artifact_top/alloy-apps/build-applrts_sc3/BC -o "-w 0 -r 1 -n 8 -c 8 -t 8 -f /artifact_top/DO_gem5/datasets/mark3jac020_out.csr" --vcs-per-vnet 64 --buffers-per-data-vc 65536 --buffers-per-ctrl-vc 1024 > logs/log1225.txt &
-# nohup /artifact_top/alloy-gem5/build/RISCV_MP_TSO/gem5.opt --stats-file=stats1226.txt --debug-flags=DOMEM,DOACC --listener-mode=off /artifact_top/alloy-gem5/configs/brg/sc3.py --cpu-type TimingSimpleCPU --link-latency 20 --CG_link_latency 150 --garnet-deadlock-threshold 100000 --l2_size 16384kB --l2_assoc 8 --num-dirs 8 --brg-fast-forward --num-cpus 64 --network garnet2.0 --buffer-size 0 --mem-size 16GB --ruby --l1d_size 64kB --mem-type SimpleMemory --num-l1-cache-ports 8 --num-l2caches 8 --ports 16 --l1i_size 64kB --topology TwoMeshXY -c /artifact_top/alloy-apps/build-applrts_sc3/BC -o "-w 0 -r 1 -n 8 -c 8 -t 8 -f /artifact_top/DO_gem5/datasets/mark3jac020_out.csr" --vcs-per-vnet 64 --buffers-per-data-vc 65536 --buffers-per-ctrl-vc 1024 > logs/log1226.txt &
+# nohup /artifact_top/alloy-gem5/build/RISCV_DO_MESI/gem5.opt --stats-file=stats1223.txt --debug-flags=DOMEM,DOACC --listener-mode=off /artifact_top/alloy-gem5/configs/brg/sc3.py --do-consistency-model TSO --cpu-type TimingSimpleCPU --link-latency 20 --CG_link_latency 150 --garnet-deadlock-threshold 100000 --l2_size 16384kB --l2_assoc 8 --num-dirs 8 --brg-fast-forward --num-cpus 64 --network garnet2.0 --buffer-size 0 --mem-size 16GB --ruby --l1d_size 64kB --mem-type SimpleMemory --num-l1-cache-ports 8 --num-l2caches 8 --ports 16 --l1i_size 64kB --topology TwoMeshXY -c /artifact_top/alloy-apps/build-applrts_sc3/BC -o "-w 0 -r 1 -n 8 -c 8 -t 8 -f /artifact_top/DO_gem5/datasets/mark3jac020_out.csr" --vcs-per-vnet 64 --buffers-per-data-vc 65536 --buffers-per-ctrl-vc 1024 > logs/log1223.txt &
+# nohup /artifact_top/alloy-gem5/build/RISCV_WT_MESI_TSO/gem5.opt --stats-file=stats1224.txt --debug-flags=DOMEM,DOACC --listener-mode=off /artifact_top/alloy-gem5/configs/brg/sc3.py --do-consistency-model TSO --cpu-type TimingSimpleCPU --link-latency 20 --CG_link_latency 150 --garnet-deadlock-threshold 100000 --l2_size 16384kB --l2_assoc 8 --num-dirs 8 --brg-fast-forward --num-cpus 64 --network garnet2.0 --buffer-size 0 --mem-size 16GB --ruby --l1d_size 64kB --mem-type SimpleMemory --num-l1-cache-ports 8 --num-l2caches 8 --ports 16 --l1i_size 64kB --topology TwoMeshXY -c /artifact_top/alloy-apps/build-applrts_sc3/BC -o "-w 0 -r 1 -n 8 -c 8 -t 8 -f /artifact_top/DO_gem5/datasets/mark3jac020_out.csr" --vcs-per-vnet 64 --buffers-per-data-vc 65536 --buffers-per-ctrl-vc 1024 > logs/log1224.txt &
+# nohup /artifact_top/alloy-gem5/build/RISCV_MESI/gem5.opt --stats-file=stats1225.txt --debug-flags=DOMEM,DOACC --listener-mode=off /artifact_top/alloy-gem5/configs/brg/sc3.py --do-consistency-model TSO_WB --cpu-type TimingSimpleCPU --link-latency 20 --CG_link_latency 150 --garnet-deadlock-threshold 100000 --l2_size 16384kB --l2_assoc 8 --num-dirs 8 --brg-fast-forward --num-cpus 64 --network garnet2.0 --buffer-size 0 --mem-size 16GB --ruby --l1d_size 64kB --mem-type SimpleMemory --num-l1-cache-ports 8 --num-l2caches 8 --ports 16 --l1i_size 64kB --topology TwoMeshXY -c /artifact_top/alloy-apps/build-applrts_sc3/BC -o "-w 0 -r 1 -n 8 -c 8 -t 8 -f /artifact_top/DO_gem5/datasets/mark3jac020_out.csr" --vcs-per-vnet 64 --buffers-per-data-vc 65536 --buffers-per-ctrl-vc 1024 > logs/log1225.txt &
+# nohup /artifact_top/alloy-gem5/build/RISCV_MP/gem5.opt --stats-file=stats1226.txt --debug-flags=DOMEM,DOACC --listener-mode=off /artifact_top/alloy-gem5/configs/brg/sc3.py --do-consistency-model TSO --cpu-type TimingSimpleCPU --link-latency 20 --CG_link_latency 150 --garnet-deadlock-threshold 100000 --l2_size 16384kB --l2_assoc 8 --num-dirs 8 --brg-fast-forward --num-cpus 64 --network garnet2.0 --buffer-size 0 --mem-size 16GB --ruby --l1d_size 64kB --mem-type SimpleMemory --num-l1-cache-ports 8 --num-l2caches 8 --ports 16 --l1i_size 64kB --topology TwoMeshXY -c /artifact_top/alloy-apps/build-applrts_sc3/BC -o "-w 0 -r 1 -n 8 -c 8 -t 8 -f /artifact_top/DO_gem5/datasets/mark3jac020_out.csr" --vcs-per-vnet 64 --buffers-per-data-vc 65536 --buffers-per-ctrl-vc 1024 > logs/log1226.txt &
 
 # # PR 227-230
-# nohup /artifact_top/alloy-gem5/build/RISCV_DO_MESI_TSO/gem5.opt --stats-file=stats1227.txt --debug-flags=DOMEM,DOACC --listener-mode=off /artifact_top/alloy-gem5/configs/brg/sc3.py --cpu-type TimingSimpleCPU --link-latency 20 --CG_link_latency 50 --garnet-deadlock-threshold 100000 --l2_size 16384kB --l2_assoc 8 --num-dirs 8 --brg-fast-forward --num-cpus 64 --network garnet2.0 --buffer-size 0 --mem-size 16GB --ruby --l1d_size 64kB --mem-type SimpleMemory --num-l1-cache-ports 8 --num-l2caches 8 --ports 16 --l1i_size 64kB --topology TwoMeshXY -c /artifact_top/alloy-apps/build-applrts_sc3/BC -o "-w 0 -r 1 -n 8 -c 8 -t 8 -f /artifact_top/DO_gem5/datasets/mark3jac020_out.csr" --vcs-per-vnet 64 --buffers-per-data-vc 65536 --buffers-per-ctrl-vc 1024 > logs/log1227.txt &
-# nohup /artifact_top/alloy-gem5/build/RISCV_WT_MESI_TSO/gem5.opt --stats-file=stats1228.txt --debug-flags=DOMEM,DOACC --listener-mode=off /artifact_top/alloy-gem5/configs/brg/sc3.py --cpu-type TimingSimpleCPU --link-latency 20 --CG_link_latency 50 --garnet-deadlock-threshold 100000 --l2_size 16384kB --l2_assoc 8 --num-dirs 8 --brg-fast-forward --num-cpus 64 --network garnet2.0 --buffer-size 0 --mem-size 16GB --ruby --l1d_size 64kB --mem-type SimpleMemory --num-l1-cache-ports 8 --num-l2caches 8 --ports 16 --l1i_size 64kB --topology TwoMeshXY -c /artifact_top/alloy-apps/build-applrts_sc3/BC -o "-w 0 -r 1 -n 8 -c 8 -t 8 -f /artifact_top/DO_gem5/datasets/mark3jac020_out.csr" --vcs-per-vnet 64 --buffers-per-data-vc 65536 --buffers-per-ctrl-vc 1024 > logs/log1228.txt &
-# nohup /artifact_top/alloy-gem5/build/RISCV_MESI_TSO/gem5.opt --stats-file=stats1229.txt --debug-flags=DOMEM,DOACC --listener-mode=off /artifact_top/alloy-gem5/configs/brg/sc3.py --cpu-type TimingSimpleCPU --link-latency 20 --CG_link_latency 50 --garnet-deadlock-threshold 100000 --l2_size 16384kB --l2_assoc 8 --num-dirs 8 --brg-fast-forward --num-cpus 64 --network garnet2.0 --buffer-size 0 --mem-size 16GB --ruby --l1d_size 64kB --mem-type SimpleMemory --num-l1-cache-ports 8 --num-l2caches 8 --ports 16 --l1i_size 64kB --topology TwoMeshXY -c /artifact_top/alloy-apps/build-applrts_sc3/BC -o "-w 0 -r 1 -n 8 -c 8 -t 8 -f /artifact_top/DO_gem5/datasets/mark3jac020_out.csr" --vcs-per-vnet 64 --buffers-per-data-vc 65536 --buffers-per-ctrl-vc 1024 > logs/log1229.txt &
-# nohup /artifact_top/alloy-gem5/build/RISCV_MP_TSO/gem5.opt --stats-file=stats1230.txt --debug-flags=DOMEM,DOACC --listener-mode=off /artifact_top/alloy-gem5/configs/brg/sc3.py --cpu-type TimingSimpleCPU --link-latency 20 --CG_link_latency 50 --garnet-deadlock-threshold 100000 --l2_size 16384kB --l2_assoc 8 --num-dirs 8 --brg-fast-forward --num-cpus 64 --network garnet2.0 --buffer-size 0 --mem-size 16GB --ruby --l1d_size 64kB --mem-type SimpleMemory --num-l1-cache-ports 8 --num-l2caches 8 --ports 16 --l1i_size 64kB --topology TwoMeshXY -c /artifact_top/alloy-apps/build-applrts_sc3/BC -o "-w 0 -r 1 -n 8 -c 8 -t 8 -f /artifact_top/DO_gem5/datasets/mark3jac020_out.csr" --vcs-per-vnet 64 --buffers-per-data-vc 65536 --buffers-per-ctrl-vc 1024 > logs/log1230.txt &
+# nohup /artifact_top/alloy-gem5/build/RISCV_DO_MESI/gem5.opt --stats-file=stats1227.txt --debug-flags=DOMEM,DOACC --listener-mode=off /artifact_top/alloy-gem5/configs/brg/sc3.py --do-consistency-model TSO --cpu-type TimingSimpleCPU --link-latency 20 --CG_link_latency 50 --garnet-deadlock-threshold 100000 --l2_size 16384kB --l2_assoc 8 --num-dirs 8 --brg-fast-forward --num-cpus 64 --network garnet2.0 --buffer-size 0 --mem-size 16GB --ruby --l1d_size 64kB --mem-type SimpleMemory --num-l1-cache-ports 8 --num-l2caches 8 --ports 16 --l1i_size 64kB --topology TwoMeshXY -c /artifact_top/alloy-apps/build-applrts_sc3/BC -o "-w 0 -r 1 -n 8 -c 8 -t 8 -f /artifact_top/DO_gem5/datasets/mark3jac020_out.csr" --vcs-per-vnet 64 --buffers-per-data-vc 65536 --buffers-per-ctrl-vc 1024 > logs/log1227.txt &
+# nohup /artifact_top/alloy-gem5/build/RISCV_WT_MESI_TSO/gem5.opt --stats-file=stats1228.txt --debug-flags=DOMEM,DOACC --listener-mode=off /artifact_top/alloy-gem5/configs/brg/sc3.py --do-consistency-model TSO --cpu-type TimingSimpleCPU --link-latency 20 --CG_link_latency 50 --garnet-deadlock-threshold 100000 --l2_size 16384kB --l2_assoc 8 --num-dirs 8 --brg-fast-forward --num-cpus 64 --network garnet2.0 --buffer-size 0 --mem-size 16GB --ruby --l1d_size 64kB --mem-type SimpleMemory --num-l1-cache-ports 8 --num-l2caches 8 --ports 16 --l1i_size 64kB --topology TwoMeshXY -c /artifact_top/alloy-apps/build-applrts_sc3/BC -o "-w 0 -r 1 -n 8 -c 8 -t 8 -f /artifact_top/DO_gem5/datasets/mark3jac020_out.csr" --vcs-per-vnet 64 --buffers-per-data-vc 65536 --buffers-per-ctrl-vc 1024 > logs/log1228.txt &
+# nohup /artifact_top/alloy-gem5/build/RISCV_MESI/gem5.opt --stats-file=stats1229.txt --debug-flags=DOMEM,DOACC --listener-mode=off /artifact_top/alloy-gem5/configs/brg/sc3.py --do-consistency-model TSO_WB --cpu-type TimingSimpleCPU --link-latency 20 --CG_link_latency 50 --garnet-deadlock-threshold 100000 --l2_size 16384kB --l2_assoc 8 --num-dirs 8 --brg-fast-forward --num-cpus 64 --network garnet2.0 --buffer-size 0 --mem-size 16GB --ruby --l1d_size 64kB --mem-type SimpleMemory --num-l1-cache-ports 8 --num-l2caches 8 --ports 16 --l1i_size 64kB --topology TwoMeshXY -c /artifact_top/alloy-apps/build-applrts_sc3/BC -o "-w 0 -r 1 -n 8 -c 8 -t 8 -f /artifact_top/DO_gem5/datasets/mark3jac020_out.csr" --vcs-per-vnet 64 --buffers-per-data-vc 65536 --buffers-per-ctrl-vc 1024 > logs/log1229.txt &
+# nohup /artifact_top/alloy-gem5/build/RISCV_MP/gem5.opt --stats-file=stats1230.txt --debug-flags=DOMEM,DOACC --listener-mode=off /artifact_top/alloy-gem5/configs/brg/sc3.py --do-consistency-model TSO --cpu-type TimingSimpleCPU --link-latency 20 --CG_link_latency 50 --garnet-deadlock-threshold 100000 --l2_size 16384kB --l2_assoc 8 --num-dirs 8 --brg-fast-forward --num-cpus 64 --network garnet2.0 --buffer-size 0 --mem-size 16GB --ruby --l1d_size 64kB --mem-type SimpleMemory --num-l1-cache-ports 8 --num-l2caches 8 --ports 16 --l1i_size 64kB --topology TwoMeshXY -c /artifact_top/alloy-apps/build-applrts_sc3/BC -o "-w 0 -r 1 -n 8 -c 8 -t 8 -f /artifact_top/DO_gem5/datasets/mark3jac020_out.csr" --vcs-per-vnet 64 --buffers-per-data-vc 65536 --buffers-per-ctrl-vc 1024 > logs/log1230.txt &
 
 # TRNS 231-234
-nohup /artifact_top/alloy-gem5/build/RISCV_DO_MESI_64B_TSO/gem5.opt --stats-file=stats1231.txt --debug-flags=DOMEM,DOACC --listener-mode=off /artifact_top/alloy-gem5/configs/brg/sc3.py --cpu-type TimingSimpleCPU --link-latency 20 --CG_link_latency 150 --garnet-deadlock-threshold 100000 --l2_size 16384kB --l2_assoc 8 --num-dirs 8 --brg-fast-forward --num-cpus 64 --network garnet2.0 --buffer-size 0 --mem-size 16GB --ruby --l1d_size 64kB --mem-type SimpleMemory --num-l1-cache-ports 8 --num-l2caches 8 --ports 16 --l1i_size 64kB --topology TwoMeshXY -c /artifact_top/alloy-apps/build-applrts_sc3/TRNS -o "-n 8 -c 8 -t 8 -r 1 -w 0 -m 8" --vcs-per-vnet 64 --buffers-per-data-vc 65536 --buffers-per-ctrl-vc 1024 > logs/log1231.txt &
-nohup /artifact_top/alloy-gem5/build/RISCV_WT_MESI_64B_TSO/gem5.opt --stats-file=stats1232.txt --debug-flags=DOMEM,DOACC --listener-mode=off /artifact_top/alloy-gem5/configs/brg/sc3.py --cpu-type TimingSimpleCPU --link-latency 20 --CG_link_latency 150 --garnet-deadlock-threshold 100000 --l2_size 16384kB --l2_assoc 8 --num-dirs 8 --brg-fast-forward --num-cpus 64 --network garnet2.0 --buffer-size 0 --mem-size 16GB --ruby --l1d_size 64kB --mem-type SimpleMemory --num-l1-cache-ports 8 --num-l2caches 8 --ports 16 --l1i_size 64kB --topology TwoMeshXY -c /artifact_top/alloy-apps/build-applrts_sc3/TRNS -o "-n 8 -c 8 -t 8 -r 1 -w 0 -m 8" --vcs-per-vnet 64 --buffers-per-data-vc 65536 --buffers-per-ctrl-vc 1024 > logs/log1232.txt &
-nohup /artifact_top/alloy-gem5/build/RISCV_MESI_TSO/gem5.opt --stats-file=stats1233.txt --debug-flags=DOMEM,DOACC --listener-mode=off /artifact_top/alloy-gem5/configs/brg/sc3.py --cpu-type TimingSimpleCPU --link-latency 20 --CG_link_latency 150 --garnet-deadlock-threshold 100000 --l2_size 16384kB --l2_assoc 8 --num-dirs 8 --brg-fast-forward --num-cpus 64 --network garnet2.0 --buffer-size 0 --mem-size 16GB --ruby --l1d_size 64kB --mem-type SimpleMemory --num-l1-cache-ports 8 --num-l2caches 8 --ports 16 --l1i_size 64kB --topology TwoMeshXY -c /artifact_top/alloy-apps/build-applrts_sc3/TRNS -o "-n 8 -c 8 -t 8 -r 1 -w 0 -m 8" --vcs-per-vnet 64 --buffers-per-data-vc 65536 --buffers-per-ctrl-vc 1024 > logs/log1233.txt &
-nohup /artifact_top/alloy-gem5/build/RISCV_MP_64B_TSO/gem5.opt --stats-file=stats1234.txt --debug-flags=DOMEM,DOACC --listener-mode=off /artifact_top/alloy-gem5/configs/brg/sc3.py --cpu-type TimingSimpleCPU --link-latency 20 --CG_link_latency 150 --garnet-deadlock-threshold 100000 --l2_size 16384kB --l2_assoc 8 --num-dirs 8 --brg-fast-forward --num-cpus 64 --network garnet2.0 --buffer-size 0 --mem-size 16GB --ruby --l1d_size 64kB --mem-type SimpleMemory --num-l1-cache-ports 8 --num-l2caches 8 --ports 16 --l1i_size 64kB --topology TwoMeshXY -c /artifact_top/alloy-apps/build-applrts_sc3/TRNS -o "-n 8 -c 8 -t 8 -r 1 -w 0 -m 8" --vcs-per-vnet 64 --buffers-per-data-vc 65536 --buffers-per-ctrl-vc 1024 > logs/log1234.txt &
+nohup /artifact_top/alloy-gem5/build/RISCV_DO_MESI/gem5.opt --stats-file=stats1231.txt --debug-flags=DOMEM,DOACC --listener-mode=off /artifact_top/alloy-gem5/configs/brg/sc3.py --do-consistency-model TSO --msg-size PUT_NT:64 --msg-size PUT_REL:72 --cpu-type TimingSimpleCPU --link-latency 20 --CG_link_latency 150 --garnet-deadlock-threshold 100000 --l2_size 16384kB --l2_assoc 8 --num-dirs 8 --brg-fast-forward --num-cpus 64 --network garnet2.0 --buffer-size 0 --mem-size 16GB --ruby --l1d_size 64kB --mem-type SimpleMemory --num-l1-cache-ports 8 --num-l2caches 8 --ports 16 --l1i_size 64kB --topology TwoMeshXY -c /artifact_top/alloy-apps/build-applrts_sc3/TRNS -o "-n 8 -c 8 -t 8 -r 1 -w 0 -m 8" --vcs-per-vnet 64 --buffers-per-data-vc 65536 --buffers-per-ctrl-vc 1024 > logs/log1231.txt &
+nohup /artifact_top/alloy-gem5/build/RISCV_WT_MESI_TSO/gem5.opt --stats-file=stats1232.txt --debug-flags=DOMEM,DOACC --listener-mode=off /artifact_top/alloy-gem5/configs/brg/sc3.py --do-consistency-model TSO --msg-size PUT_NT:64 --msg-size PUT_REL:72 --cpu-type TimingSimpleCPU --link-latency 20 --CG_link_latency 150 --garnet-deadlock-threshold 100000 --l2_size 16384kB --l2_assoc 8 --num-dirs 8 --brg-fast-forward --num-cpus 64 --network garnet2.0 --buffer-size 0 --mem-size 16GB --ruby --l1d_size 64kB --mem-type SimpleMemory --num-l1-cache-ports 8 --num-l2caches 8 --ports 16 --l1i_size 64kB --topology TwoMeshXY -c /artifact_top/alloy-apps/build-applrts_sc3/TRNS -o "-n 8 -c 8 -t 8 -r 1 -w 0 -m 8" --vcs-per-vnet 64 --buffers-per-data-vc 65536 --buffers-per-ctrl-vc 1024 > logs/log1232.txt &
+nohup /artifact_top/alloy-gem5/build/RISCV_MESI/gem5.opt --stats-file=stats1233.txt --debug-flags=DOMEM,DOACC --listener-mode=off /artifact_top/alloy-gem5/configs/brg/sc3.py --do-consistency-model TSO_WB --cpu-type TimingSimpleCPU --link-latency 20 --CG_link_latency 150 --garnet-deadlock-threshold 100000 --l2_size 16384kB --l2_assoc 8 --num-dirs 8 --brg-fast-forward --num-cpus 64 --network garnet2.0 --buffer-size 0 --mem-size 16GB --ruby --l1d_size 64kB --mem-type SimpleMemory --num-l1-cache-ports 8 --num-l2caches 8 --ports 16 --l1i_size 64kB --topology TwoMeshXY -c /artifact_top/alloy-apps/build-applrts_sc3/TRNS -o "-n 8 -c 8 -t 8 -r 1 -w 0 -m 8" --vcs-per-vnet 64 --buffers-per-data-vc 65536 --buffers-per-ctrl-vc 1024 > logs/log1233.txt &
+nohup /artifact_top/alloy-gem5/build/RISCV_MP/gem5.opt --stats-file=stats1234.txt --debug-flags=DOMEM,DOACC --listener-mode=off /artifact_top/alloy-gem5/configs/brg/sc3.py --do-consistency-model TSO --msg-size PUT_NT:64 --msg-size PUT_REL:72 --cpu-type TimingSimpleCPU --link-latency 20 --CG_link_latency 150 --garnet-deadlock-threshold 100000 --l2_size 16384kB --l2_assoc 8 --num-dirs 8 --brg-fast-forward --num-cpus 64 --network garnet2.0 --buffer-size 0 --mem-size 16GB --ruby --l1d_size 64kB --mem-type SimpleMemory --num-l1-cache-ports 8 --num-l2caches 8 --ports 16 --l1i_size 64kB --topology TwoMeshXY -c /artifact_top/alloy-apps/build-applrts_sc3/TRNS -o "-n 8 -c 8 -t 8 -r 1 -w 0 -m 8" --vcs-per-vnet 64 --buffers-per-data-vc 65536 --buffers-per-ctrl-vc 1024 > logs/log1234.txt &
 
 # TRNS 235-238
-nohup /artifact_top/alloy-gem5/build/RISCV_DO_MESI_64B_TSO/gem5.opt --stats-file=stats1235.txt --debug-flags=DOMEM,DOACC --listener-mode=off /artifact_top/alloy-gem5/configs/brg/sc3.py --cpu-type TimingSimpleCPU --link-latency 20 --CG_link_latency 50 --garnet-deadlock-threshold 100000 --l2_size 16384kB --l2_assoc 8 --num-dirs 8 --brg-fast-forward --num-cpus 64 --network garnet2.0 --buffer-size 0 --mem-size 16GB --ruby --l1d_size 64kB --mem-type SimpleMemory --num-l1-cache-ports 8 --num-l2caches 8 --ports 16 --l1i_size 64kB --topology TwoMeshXY -c /artifact_top/alloy-apps/build-applrts_sc3/TRNS -o "-n 8 -c 8 -t 8 -r 1 -w 0 -m 8" --vcs-per-vnet 64 --buffers-per-data-vc 65536 --buffers-per-ctrl-vc 1024 > logs/log1235.txt &
-nohup /artifact_top/alloy-gem5/build/RISCV_WT_MESI_64B_TSO/gem5.opt --stats-file=stats1236.txt --debug-flags=DOMEM,DOACC --listener-mode=off /artifact_top/alloy-gem5/configs/brg/sc3.py --cpu-type TimingSimpleCPU --link-latency 20 --CG_link_latency 50 --garnet-deadlock-threshold 100000 --l2_size 16384kB --l2_assoc 8 --num-dirs 8 --brg-fast-forward --num-cpus 64 --network garnet2.0 --buffer-size 0 --mem-size 16GB --ruby --l1d_size 64kB --mem-type SimpleMemory --num-l1-cache-ports 8 --num-l2caches 8 --ports 16 --l1i_size 64kB --topology TwoMeshXY -c /artifact_top/alloy-apps/build-applrts_sc3/TRNS -o "-n 8 -c 8 -t 8 -r 1 -w 0 -m 8" --vcs-per-vnet 64 --buffers-per-data-vc 65536 --buffers-per-ctrl-vc 1024 > logs/log1236.txt &
-nohup /artifact_top/alloy-gem5/build/RISCV_MESI_TSO/gem5.opt --stats-file=stats1237.txt --debug-flags=DOMEM,DOACC --listener-mode=off /artifact_top/alloy-gem5/configs/brg/sc3.py --cpu-type TimingSimpleCPU --link-latency 20 --CG_link_latency 50 --garnet-deadlock-threshold 100000 --l2_size 16384kB --l2_assoc 8 --num-dirs 8 --brg-fast-forward --num-cpus 64 --network garnet2.0 --buffer-size 0 --mem-size 16GB --ruby --l1d_size 64kB --mem-type SimpleMemory --num-l1-cache-ports 8 --num-l2caches 8 --ports 16 --l1i_size 64kB --topology TwoMeshXY -c /artifact_top/alloy-apps/build-applrts_sc3/TRNS -o "-n 8 -c 8 -t 8 -r 1 -w 0 -m 8" --vcs-per-vnet 64 --buffers-per-data-vc 65536 --buffers-per-ctrl-vc 1024 > logs/log1237.txt &
-nohup /artifact_top/alloy-gem5/build/RISCV_MP_64B_TSO/gem5.opt --stats-file=stats1238.txt --debug-flags=DOMEM,DOACC --listener-mode=off /artifact_top/alloy-gem5/configs/brg/sc3.py --cpu-type TimingSimpleCPU --link-latency 20 --CG_link_latency 50 --garnet-deadlock-threshold 100000 --l2_size 16384kB --l2_assoc 8 --num-dirs 8 --brg-fast-forward --num-cpus 64 --network garnet2.0 --buffer-size 0 --mem-size 16GB --ruby --l1d_size 64kB --mem-type SimpleMemory --num-l1-cache-ports 8 --num-l2caches 8 --ports 16 --l1i_size 64kB --topology TwoMeshXY -c /artifact_top/alloy-apps/build-applrts_sc3/TRNS -o "-n 8 -c 8 -t 8 -r 1 -w 0 -m 8" --vcs-per-vnet 64 --buffers-per-data-vc 65536 --buffers-per-ctrl-vc 1024 > logs/log1238.txt &
+nohup /artifact_top/alloy-gem5/build/RISCV_DO_MESI/gem5.opt --stats-file=stats1235.txt --debug-flags=DOMEM,DOACC --listener-mode=off /artifact_top/alloy-gem5/configs/brg/sc3.py --do-consistency-model TSO --msg-size PUT_NT:64 --msg-size PUT_REL:72 --cpu-type TimingSimpleCPU --link-latency 20 --CG_link_latency 50 --garnet-deadlock-threshold 100000 --l2_size 16384kB --l2_assoc 8 --num-dirs 8 --brg-fast-forward --num-cpus 64 --network garnet2.0 --buffer-size 0 --mem-size 16GB --ruby --l1d_size 64kB --mem-type SimpleMemory --num-l1-cache-ports 8 --num-l2caches 8 --ports 16 --l1i_size 64kB --topology TwoMeshXY -c /artifact_top/alloy-apps/build-applrts_sc3/TRNS -o "-n 8 -c 8 -t 8 -r 1 -w 0 -m 8" --vcs-per-vnet 64 --buffers-per-data-vc 65536 --buffers-per-ctrl-vc 1024 > logs/log1235.txt &
+nohup /artifact_top/alloy-gem5/build/RISCV_WT_MESI_TSO/gem5.opt --stats-file=stats1236.txt --debug-flags=DOMEM,DOACC --listener-mode=off /artifact_top/alloy-gem5/configs/brg/sc3.py --do-consistency-model TSO --msg-size PUT_NT:64 --msg-size PUT_REL:72 --cpu-type TimingSimpleCPU --link-latency 20 --CG_link_latency 50 --garnet-deadlock-threshold 100000 --l2_size 16384kB --l2_assoc 8 --num-dirs 8 --brg-fast-forward --num-cpus 64 --network garnet2.0 --buffer-size 0 --mem-size 16GB --ruby --l1d_size 64kB --mem-type SimpleMemory --num-l1-cache-ports 8 --num-l2caches 8 --ports 16 --l1i_size 64kB --topology TwoMeshXY -c /artifact_top/alloy-apps/build-applrts_sc3/TRNS -o "-n 8 -c 8 -t 8 -r 1 -w 0 -m 8" --vcs-per-vnet 64 --buffers-per-data-vc 65536 --buffers-per-ctrl-vc 1024 > logs/log1236.txt &
+nohup /artifact_top/alloy-gem5/build/RISCV_MESI/gem5.opt --stats-file=stats1237.txt --debug-flags=DOMEM,DOACC --listener-mode=off /artifact_top/alloy-gem5/configs/brg/sc3.py --do-consistency-model TSO_WB --cpu-type TimingSimpleCPU --link-latency 20 --CG_link_latency 50 --garnet-deadlock-threshold 100000 --l2_size 16384kB --l2_assoc 8 --num-dirs 8 --brg-fast-forward --num-cpus 64 --network garnet2.0 --buffer-size 0 --mem-size 16GB --ruby --l1d_size 64kB --mem-type SimpleMemory --num-l1-cache-ports 8 --num-l2caches 8 --ports 16 --l1i_size 64kB --topology TwoMeshXY -c /artifact_top/alloy-apps/build-applrts_sc3/TRNS -o "-n 8 -c 8 -t 8 -r 1 -w 0 -m 8" --vcs-per-vnet 64 --buffers-per-data-vc 65536 --buffers-per-ctrl-vc 1024 > logs/log1237.txt &
+nohup /artifact_top/alloy-gem5/build/RISCV_MP/gem5.opt --stats-file=stats1238.txt --debug-flags=DOMEM,DOACC --listener-mode=off /artifact_top/alloy-gem5/configs/brg/sc3.py --do-consistency-model TSO --msg-size PUT_NT:64 --msg-size PUT_REL:72 --cpu-type TimingSimpleCPU --link-latency 20 --CG_link_latency 50 --garnet-deadlock-threshold 100000 --l2_size 16384kB --l2_assoc 8 --num-dirs 8 --brg-fast-forward --num-cpus 64 --network garnet2.0 --buffer-size 0 --mem-size 16GB --ruby --l1d_size 64kB --mem-type SimpleMemory --num-l1-cache-ports 8 --num-l2caches 8 --ports 16 --l1i_size 64kB --topology TwoMeshXY -c /artifact_top/alloy-apps/build-applrts_sc3/TRNS -o "-n 8 -c 8 -t 8 -r 1 -w 0 -m 8" --vcs-per-vnet 64 --buffers-per-data-vc 65536 --buffers-per-ctrl-vc 1024 > logs/log1238.txt &
 
 wait
\ No newline at end of file
@@ -0,0 +1,40 @@
+#!/bin/bash
+
+ # SPDX-FileCopyrightText: Copyright (c) 2024 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ # SPDX-License-Identifier: LicenseRef-NvidiaProprietary
+ #
+ # NVIDIA CORPORATION, its affiliates and licensors retain all intellectual
+ # property and proprietary rights in and to this material, related
+ # documentation and any modifications thereto. Any use, reproduction,
+ # disclosure or distribution of this material and related documentation
+ # without an express license agreement from NVIDIA CORPORATION or
+ # its affiliates is strictly prohibited.
+
+# Takes a ROI checkpoint of run_allreduce and restores it. The checkpoint
+# is taken at appl::start_stats(), right after gem5_barrier_wait(0); the
+# restored run then has to pass gem5_barrier_wait(1) before the result
+# check, so it hangs if the barrier state was not restored.
+
+GEM5=/artifact_top/alloy-gem5/build/RISCV_DO_MESI/gem5.opt
+CONFIG=/artifact_top/alloy-gem5/configs/brg/sc3.py
+CKPT=ckpt_roi_allreduce
+
+COMMON="--cpu-type TimingSimpleCPU --link-latency 20 --CG_link_latency 150 --garnet-deadlock-threshold 100000 --l2_size 16384kB --l2_assoc 8 --num-dirs 8 --brg-fast-forward --num-cpus 64 --network garnet2.0 --buffer-size 0 --mem-size 16GB --ruby --l1d_size 64kB --mem-type SimpleMemory --num-l1-cache-ports 8 --num-l2caches 8 --ports 16 --l1i_size 64kB --topology TwoMeshXY --vcs-per-vnet 64 --buffers-per-data-vc 65536 --buffers-per-ctrl-vc 1024"
+APP="-c /artifact_top/alloy-apps/build-applrts_sc3/run_allreduce -o \"-w 0 -r 1 -n 8 -c 8 -t 1 -f 128 -v 1\""
+
+mkdir -p logs
+rm -rf $CKPT
+
+eval $GEM5 --stats-file=stats_ckpt.txt --listener-mode=off $CONFIG $COMMON --roi-checkpoint $CKPT $APP > logs/log_ckpt.txt 2>&1
+if [ $? -ne 0 ] || [ ! -d $CKPT ]; then
+    echo "FAIL: no ROI checkpoint taken, see logs/log_ckpt.txt"
+    exit 1
+fi
+
+eval timeout 4h $GEM5 --stats-file=stats_restore.txt --listener-mode=off $CONFIG $COMMON --restore-roi-checkpoint $CKPT $APP > logs/log_restore.txt 2>&1
+if [ $? -ne 0 ] || ! grep -q "allreduce test passed" logs/log_restore.txt; then
+    echo "FAIL: restored run did not finish, see logs/log_restore.txt"
+    exit 1
+fi
+
+echo "PASS"
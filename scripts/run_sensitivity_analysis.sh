@@ -12,69 +12,69 @@
 
 # synchronization granularity, store granularity=64B, -n 2
 # sendrecv size = 64B
-nohup /artifact_top/alloy-gem5/build/RISCV_DO_MESI_64B/gem5.opt --stats-file=stats1.txt --debug-flags=DOMEM,DOACC --listener-mode=off /artifact_top/alloy-gem5/configs/brg/sc3.py --cpu-type TimingSimpleCPU --link-latency 20 --CG_link_latency 150 --garnet-deadlock-threshold 100000 --l2_size 16384kB --l2_assoc 8 --num-dirs 8 --brg-fast-forward --num-cpus 64 --network garnet2.0 --buffer-size 0 --mem-size 4GB --ruby --l1d_size 64kB --mem-type SimpleMemory --num-l1-cache-ports 8 --num-l2caches 8 --ports 16 --l1i_size 64kB --topology TwoMeshXY -c /artifact_top/alloy-apps/build-applrts_sc3/run_sendrecv_pad -o "-w 0 -r 1 -n 2 -c 8 -f 16 -s 8 -p 21" --vcs-per-vnet 64 --buffers-per-data-vc 65536 --buffers-per-ctrl-vc 1024 > logs/log1.txt &
-nohup /artifact_top/alloy-gem5/build/RISCV_DO_MESI_64B/gem5.opt --stats-file=stats2.txt --debug-flags=DOMEM,DOACC --listener-mode=off /artifact_top/alloy-gem5/configs/brg/sc3.py --cpu-type TimingSimpleCPU --link-latency 20 --CG_link_latency 50 --garnet-deadlock-threshold 100000 --l2_size 16384kB --l2_assoc 8 --num-dirs 8 --brg-fast-forward --num-cpus 64 --network garnet2.0 --buffer-size 0 --mem-size 4GB --ruby --l1d_size 64kB --mem-type SimpleMemory --num-l1-cache-ports 8 --num-l2caches 8 --ports 16 --l1i_size 64kB --topology TwoMeshXY -c /artifact_top/alloy-apps/build-applrts_sc3/run_sendrecv_pad -o "-w 0 -r 1 -n 2 -c 8 -f 16 -s 8 -p 21" --vcs-per-vnet 64 --buffers-per-data-vc 65536 --buffers-per-ctrl-vc 1024 > logs/log2.txt &
-nohup /artifact_top/alloy-gem5/build/RISCV_WT_MESI_64B/gem5.opt --stats-file=stats3.txt --debug-flags=DOMEM,DOACC --listener-mode=off /artifact_top/alloy-gem5/configs/brg/sc3.py --cpu-type TimingSimpleCPU --link-latency 20 --CG_link_latency 150 --garnet-deadlock-threshold 100000 --l2_size 16384kB --l2_assoc 8 --num-dirs 8 --brg-fast-forward --num-cpus 64 --network garnet2.0 --buffer-size 0 --mem-size 4GB --ruby --l1d_size 64kB --mem-type SimpleMemory --num-l1-cache-ports 8 --num-l2caches 8 --ports 16 --l1i_size 64kB --topology TwoMeshXY -c /artifact_top/alloy-apps/build-applrts_sc3/run_sendrecv_pad -o "-w 0 -r 1 -n 2 -c 8 -f 16 -s 8 -p 21" --vcs-per-vnet 64 --buffers-per-data-vc 65536 --buffers-per-ctrl-vc 1024 > logs/log3.txt &
-nohup /artifact_top/alloy-gem5/build/RISCV_WT_MESI_64B/gem5.opt --stats-file=stats4.txt --debug-flags=DOMEM,DOACC --listener-mode=off /artifact_top/alloy-gem5/configs/brg/sc3.py --cpu-type TimingSimpleCPU --link-latency 20 --CG_link_latency 50 --garnet-deadlock-threshold 100000 --l2_size 16384kB --l2_assoc 8 --num-dirs 8 --brg-fast-forward --num-cpus 64 --network garnet2.0 --buffer-size 0 --mem-size 4GB --ruby --l1d_size 64kB --mem-type SimpleMemory --num-l1-cache-ports 8 --num-l2caches 8 --ports 16 --l1i_size 64kB --topology TwoMeshXY -c /artifact_top/alloy-apps/build-applrts_sc3/run_sendrecv_pad -o "-w 0 -r 1 -n 2 -c 8 -f 16 -s 8 -p 21" --vcs-per-vnet 64 --buffers-per-data-vc 65536 --buffers-per-ctrl-vc 1024 > logs/log4.txt &
-nohup /artifact_top/alloy-gem5/build/RISCV_MP_64B/gem5.opt --stats-file=stats5.txt --debug-flags=DOMEM,DOACC --listener-mode=off /artifact_top/alloy-gem5/configs/brg/sc3.py --cpu-type TimingSimpleCPU --link-latency 20 --CG_link_latency 150 --garnet-deadlock-threshold 100000 --l2_size 16384kB --l2_assoc 8 --num-dirs 8 --brg-fast-forward --num-cpus 64 --network garnet2.0 --buffer-size 0 --mem-size 4GB --ruby --l1d_size 64kB --mem-type SimpleMemory --num-l1-cache-ports 8 --num-l2caches 8 --ports 16 --l1i_size 64kB --topology TwoMeshXY -c /artifact_top/alloy-apps/build-applrts_sc3/run_sendrecv_pad -o "-w 0 -r 1 -n 2 -c 8 -f 16 -s 8 -p 21" --vcs-per-vnet 64 --buffers-per-data-vc 65536 --buffers-per-ctrl-vc 1024 > logs/log5.txt &
-nohup /artifact_top/alloy-gem5/build/RISCV_MP_64B/gem5.opt --stats-file=stats6.txt --debug-flags=DOMEM,DOACC --listener-mode=off /artifact_top/alloy-gem5/configs/brg/sc3.py --cpu-type TimingSimpleCPU --link-latency 20 --CG_link_latency 50 --garnet-deadlock-threshold 100000 --l2_size 16384kB --l2_assoc 8 --num-dirs 8 --brg-fast-forward --num-cpus 64 --network garnet2.0 --buffer-size 0 --mem-size 4GB --ruby --l1d_size 64kB --mem-type SimpleMemory --num-l1-cache-ports 8 --num-l2caches 8 --ports 16 --l1i_size 64kB --topology TwoMeshXY -c /artifact_top/alloy-apps/build-applrts_sc3/run_sendrecv_pad -o "-w 0 -r 1 -n 2 -c 8 -f 16 -s 8 -p 21" --vcs-per-vnet 64 --buffers-per-data-vc 65536 --buffers-per-ctrl-vc 1024 > logs/log6.txt &
+nohup /artifact_top/alloy-gem5/build/RISCV_DO_MESI/gem5.opt --stats-file=stats1.txt --debug-flags=DOMEM,DOACC --listener-mode=off /artifact_top/alloy-gem5/configs/brg/sc3.py --msg-size PUT_NT:64 --cpu-type TimingSimpleCPU --link-latency 20 --CG_link_latency 150 --garnet-deadlock-threshold 100000 --l2_size 16384kB --l2_assoc 8 --num-dirs 8 --brg-fast-forward --num-cpus 64 --network garnet2.0 --buffer-size 0 --mem-size 4GB --ruby --l1d_size 64kB --mem-type SimpleMemory --num-l1-cache-ports 8 --num-l2caches 8 --ports 16 --l1i_size 64kB --topology TwoMeshXY -c /artifact_top/alloy-apps/build-applrts_sc3/run_sendrecv_pad -o "-w 0 -r 1 -n 2 -c 8 -f 16 -s 8 -p 21" --vcs-per-vnet 64 --buffers-per-data-vc 65536 --buffers-per-ctrl-vc 1024 > logs/log1.txt &
+nohup /artifact_top/alloy-gem5/build/RISCV_DO_MESI/gem5.opt --stats-file=stats2.txt --debug-flags=DOMEM,DOACC --listener-mode=off /artifact_top/alloy-gem5/configs/brg/sc3.py --msg-size PUT_NT:64 --cpu-type TimingSimpleCPU --link-latency 20 --CG_link_latency 50 --garnet-deadlock-threshold 100000 --l2_size 16384kB --l2_assoc 8 --num-dirs 8 --brg-fast-forward --num-cpus 64 --network garnet2.0 --buffer-size 0 --mem-size 4GB --ruby --l1d_size 64kB --mem-type SimpleMemory --num-l1-cache-ports 8 --num-l2caches 8 --ports 16 --l1i_size 64kB --topology TwoMeshXY -c /artifact_top/alloy-apps/build-applrts_sc3/run_sendrecv_pad -o "-w 0 -r 1 -n 2 -c 8 -f 16 -s 8 -p 21" --vcs-per-vnet 64 --buffers-per-data-vc 65536 --buffers-per-ctrl-vc 1024 > logs/log2.txt &
+nohup /artifact_top/alloy-gem5/build/RISCV_WT_MESI/gem5.opt --stats-file=stats3.txt --debug-flags=DOMEM,DOACC --listener-mode=off /artifact_top/alloy-gem5/configs/brg/sc3.py --msg-size PUT_NT:64 --cpu-type TimingSimpleCPU --link-latency 20 --CG_link_latency 150 --garnet-deadlock-threshold 100000 --l2_size 16384kB --l2_assoc 8 --num-dirs 8 --brg-fast-forward --num-cpus 64 --network garnet2.0 --buffer-size 0 --mem-size 4GB --ruby --l1d_size 64kB --mem-type SimpleMemory --num-l1-cache-ports 8 --num-l2caches 8 --ports 16 --l1i_size 64kB --topology TwoMeshXY -c /artifact_top/alloy-apps/build-applrts_sc3/run_sendrecv_pad -o "-w 0 -r 1 -n 2 -c 8 -f 16 -s 8 -p 21" --vcs-per-vnet 64 --buffers-per-data-vc 65536 --buffers-per-ctrl-vc 1024 > logs/log3.txt &
+nohup /artifact_top/alloy-gem5/build/RISCV_WT_MESI/gem5.opt --stats-file=stats4.txt --debug-flags=DOMEM,DOACC --listener-mode=off /artifact_top/alloy-gem5/configs/brg/sc3.py --msg-size PUT_NT:64 --cpu-type TimingSimpleCPU --link-latency 20 --CG_link_latency 50 --garnet-deadlock-threshold 100000 --l2_size 16384kB --l2_assoc 8 --num-dirs 8 --brg-fast-forward --num-cpus 64 --network garnet2.0 --buffer-size 0 --mem-size 4GB --ruby --l1d_size 64kB --mem-type SimpleMemory --num-l1-cache-ports 8 --num-l2caches 8 --ports 16 --l1i_size 64kB --topology TwoMeshXY -c /artifact_top/alloy-apps/build-applrts_sc3/run_sendrecv_pad -o "-w 0 -r 1 -n 2 -c 8 -f 16 -s 8 -p 21" --vcs-per-vnet 64 --buffers-per-data-vc 65536 --buffers-per-ctrl-vc 1024 > logs/log4.txt &
+nohup /artifact_top/alloy-gem5/build/RISCV_MP/gem5.opt --stats-file=stats5.txt --debug-flags=DOMEM,DOACC --listener-mode=off /artifact_top/alloy-gem5/configs/brg/sc3.py --msg-size PUT_NT:64 --cpu-type TimingSimpleCPU --link-latency 20 --CG_link_latency 150 --garnet-deadlock-threshold 100000 --l2_size 16384kB --l2_assoc 8 --num-dirs 8 --brg-fast-forward --num-cpus 64 --network garnet2.0 --buffer-size 0 --mem-size 4GB --ruby --l1d_size 64kB --mem-type SimpleMemory --num-l1-cache-ports 8 --num-l2caches 8 --ports 16 --l1i_size 64kB --topology TwoMeshXY -c /artifact_top/alloy-apps/build-applrts_sc3/run_sendrecv_pad -o "-w 0 -r 1 -n 2 -c 8 -f 16 -s 8 -p 21" --vcs-per-vnet 64 --buffers-per-data-vc 65536 --buffers-per-ctrl-vc 1024 > logs/log5.txt &
+nohup /artifact_top/alloy-gem5/build/RISCV_MP/gem5.opt --stats-file=stats6.txt --debug-flags=DOMEM,DOACC --listener-mode=off /artifact_top/alloy-gem5/configs/brg/sc3.py --msg-size PUT_NT:64 --cpu-type TimingSimpleCPU --link-latency 20 --CG_link_latency 50 --garnet-deadlock-threshold 100000 --l2_size 16384kB --l2_assoc 8 --num-dirs 8 --brg-fast-forward --num-cpus 64 --network garnet2.0 --buffer-size 0 --mem-size 4GB --ruby --l1d_size 64kB --mem-type SimpleMemory --num-l1-cache-ports 8 --num-l2caches 8 --ports 16 --l1i_size 64kB --topology TwoMeshXY -c /artifact_top/alloy-apps/build-applrts_sc3/run_sendrecv_pad -o "-w 0 -r 1 -n 2 -c 8 -f 16 -s 8 -p 21" --vcs-per-vnet 64 --buffers-per-data-vc 65536 --buffers-per-ctrl-vc 1024 > logs/log6.txt &
 # sendrecv size = 512B
-nohup /artifact_top/alloy-gem5/build/RISCV_DO_MESI_64B/gem5.opt --stats-file=stats7.txt --debug-flags=DOMEM,DOACC --listener-mode=off /artifact_top/alloy-gem5/configs/brg/sc3.py --cpu-type TimingSimpleCPU --link-latency 20 --CG_link_latency 150 --garnet-deadlock-threshold 100000 --l2_size 16384kB --l2_assoc 8 --num-dirs 8 --brg-fast-forward --num-cpus 64 --network garnet2.0 --buffer-size 0 --mem-size 4GB --ruby --l1d_size 64kB --mem-type SimpleMemory --num-l1-cache-ports 8 --num-l2caches 8 --ports 16 --l1i_size 64kB --topology TwoMeshXY -c /artifact_top/alloy-apps/build-applrts_sc3/run_sendrecv_pad -o "-w 0 -r 1 -n 2 -c 8 -f 128 -s 8 -p 21" --vcs-per-vnet 64 --buffers-per-data-vc 65536 --buffers-per-ctrl-vc 1024 > logs/log7.txt &
-nohup /artifact_top/alloy-gem5/build/RISCV_DO_MESI_64B/gem5.opt --stats-file=stats8.txt --debug-flags=DOMEM,DOACC --listener-mode=off /artifact_top/alloy-gem5/configs/brg/sc3.py --cpu-type TimingSimpleCPU --link-latency 20 --CG_link_latency 50 --garnet-deadlock-threshold 100000 --l2_size 16384kB --l2_assoc 8 --num-dirs 8 --brg-fast-forward --num-cpus 64 --network garnet2.0 --buffer-size 0 --mem-size 4GB --ruby --l1d_size 64kB --mem-type SimpleMemory --num-l1-cache-ports 8 --num-l2caches 8 --ports 16 --l1i_size 64kB --topology TwoMeshXY -c /artifact_top/alloy-apps/build-applrts_sc3/run_sendrecv_pad -o "-w 0 -r 1 -n 2 -c 8 -f 128 -s 8 -p 21" --vcs-per-vnet 64 --buffers-per-data-vc 65536 --buffers-per-ctrl-vc 1024 > logs/log8.txt &
-nohup /artifact_top/alloy-gem5/build/RISCV_WT_MESI_64B/gem5.opt --stats-file=stats9.txt --debug-flags=DOMEM,DOACC --listener-mode=off /artifact_top/alloy-gem5/configs/brg/sc3.py --cpu-type TimingSimpleCPU --link-latency 20 --CG_link_latency 150 --garnet-deadlock-threshold 100000 --l2_size 16384kB --l2_assoc 8 --num-dirs 8 --brg-fast-forward --num-cpus 64 --network garnet2.0 --buffer-size 0 --mem-size 4GB --ruby --l1d_size 64kB --mem-type SimpleMemory --num-l1-cache-ports 8 --num-l2caches 8 --ports 16 --l1i_size 64kB --topology TwoMeshXY -c /artifact_top/alloy-apps/build-applrts_sc3/run_sendrecv_pad -o "-w 0 -r 1 -n 2 -c 8 -f 128 -s 8 -p 21" --vcs-per-vnet 64 --buffers-per-data-vc 65536 --buffers-per-ctrl-vc 1024 > logs/log9.txt &
-nohup /artifact_top/alloy-gem5/build/RISCV_WT_MESI_64B/gem5.opt --stats-file=stats10.txt --debug-flags=DOMEM,DOACC --listener-mode=off /artifact_top/alloy-gem5/configs/brg/sc3.py --cpu-type TimingSimpleCPU --link-latency 20 --CG_link_latency 50 --garnet-deadlock-threshold 100000 --l2_size 16384kB --l2_assoc 8 --num-dirs 8 --brg-fast-forward --num-cpus 64 --network garnet2.0 --buffer-size 0 --mem-size 4GB --ruby --l1d_size 64kB --mem-type SimpleMemory --num-l1-cache-ports 8 --num-l2caches 8 --ports 16 --l1i_size 64kB --topology TwoMeshXY -c /artifact_top/alloy-apps/build-applrts_sc3/run_sendrecv_pad -o "-w 0 -r 1 -n 2 -c 8 -f 128 -s 8 -p 21" --vcs-per-vnet 64 --buffers-per-data-vc 65536 --buffers-per-ctrl-vc 1024 > logs/log10.txt &
-nohup /artifact_top/alloy-gem5/build/RISCV_MP_64B/gem5.opt --stats-file=stats11.txt --debug-flags=DOMEM,DOACC --listener-mode=off /artifact_top/alloy-gem5/configs/brg/sc3.py --cpu-type TimingSimpleCPU --link-latency 20 --CG_link_latency 150 --garnet-deadlock-threshold 100000 --l2_size 16384kB --l2_assoc 8 --num-dirs 8 --brg-fast-forward --num-cpus 64 --network garnet2.0 --buffer-size 0 --mem-size 4GB --ruby --l1d_size 64kB --mem-type SimpleMemory --num-l1-cache-ports 8 --num-l2caches 8 --ports 16 --l1i_size 64kB --topology TwoMeshXY -c /artifact_top/alloy-apps/build-applrts_sc3/run_sendrecv_pad -o "-w 0 -r 1 -n 2 -c 8 -f 128 -s 8 -p 21" --vcs-per-vnet 64 --buffers-per-data-vc 65536 --buffers-per-ctrl-vc 1024 > logs/log11.txt &
-nohup /artifact_top/alloy-gem5/build/RISCV_MP_64B/gem5.opt --stats-file=stats12.txt --debug-flags=DOMEM,DOACC --listener-mode=off /artifact_top/alloy-gem5/configs/brg/sc3.py --cpu-type TimingSimpleCPU --link-latency 20 --CG_link_latency 50 --garnet-deadlock-threshold 100000 --l2_size 16384kB --l2_assoc 8 --num-dirs 8 --brg-fast-forward --num-cpus 64 --network garnet2.0 --buffer-size 0 --mem-size 4GB --ruby --l1d_size 64kB --mem-type SimpleMemory --num-l1-cache-ports 8 --num-l2caches 8 --ports 16 --l1i_size 64kB --topology TwoMeshXY -c /artifact_top/alloy-apps/build-applrts_sc3/run_sendrecv_pad -o "-w 0 -r 1 -n 2 -c 8 -f 128 -s 8 -p 21" --vcs-per-vnet 64 --buffers-per-data-vc 65536 --buffers-per-ctrl-vc 1024 > logs/log12.txt &
+nohup /artifact_top/alloy-gem5/build/RISCV_DO_MESI/gem5.opt --stats-file=stats7.txt --debug-flags=DOMEM,DOACC --listener-mode=off /artifact_top/alloy-gem5/configs/brg/sc3.py --msg-size PUT_NT:64 --cpu-type TimingSimpleCPU --link-latency 20 --CG_link_latency 150 --garnet-deadlock-threshold 100000 --l2_size 16384kB --l2_assoc 8 --num-dirs 8 --brg-fast-forward --num-cpus 64 --network garnet2.0 --buffer-size 0 --mem-size 4GB --ruby --l1d_size 64kB --mem-type SimpleMemory --num-l1-cache-ports 8 --num-l2caches 8 --ports 16 --l1i_size 64kB --topology TwoMeshXY -c /artifact_top/alloy-apps/build-applrts_sc3/run_sendrecv_pad -o "-w 0 -r 1 -n 2 -c 8 -f 128 -s 8 -p 21" --vcs-per-vnet 64 --buffers-per-data-vc 65536 --buffers-per-ctrl-vc 1024 > logs/log7.txt &
+nohup /artifact_top/alloy-gem5/build/RISCV_DO_MESI/gem5.opt --stats-file=stats8.txt --debug-flags=DOMEM,DOACC --listener-mode=off /artifact_top/alloy-gem5/configs/brg/sc3.py --msg-size PUT_NT:64 --cpu-type TimingSimpleCPU --link-latency 20 --CG_link_latency 50 --garnet-deadlock-threshold 100000 --l2_size 16384kB --l2_assoc 8 --num-dirs 8 --brg-fast-forward --num-cpus 64 --network garnet2.0 --buffer-size 0 --mem-size 4GB --ruby --l1d_size 64kB --mem-type SimpleMemory --num-l1-cache-ports 8 --num-l2caches 8 --ports 16 --l1i_size 64kB --topology TwoMeshXY -c /artifact_top/alloy-apps/build-applrts_sc3/run_sendrecv_pad -o "-w 0 -r 1 -n 2 -c 8 -f 128 -s 8 -p 21" --vcs-per-vnet 64 --buffers-per-data-vc 65536 --buffers-per-ctrl-vc 1024 > logs/log8.txt &
+nohup /artifact_top/alloy-gem5/build/RISCV_WT_MESI/gem5.opt --stats-file=stats9.txt --debug-flags=DOMEM,DOACC --listener-mode=off /artifact_top/alloy-gem5/configs/brg/sc3.py --msg-size PUT_NT:64 --cpu-type TimingSimpleCPU --link-latency 20 --CG_link_latency 150 --garnet-deadlock-threshold 100000 --l2_size 16384kB --l2_assoc 8 --num-dirs 8 --brg-fast-forward --num-cpus 64 --network garnet2.0 --buffer-size 0 --mem-size 4GB --ruby --l1d_size 64kB --mem-type SimpleMemory --num-l1-cache-ports 8 --num-l2caches 8 --ports 16 --l1i_size 64kB --topology TwoMeshXY -c /artifact_top/alloy-apps/build-applrts_sc3/run_sendrecv_pad -o "-w 0 -r 1 -n 2 -c 8 -f 128 -s 8 -p 21" --vcs-per-vnet 64 --buffers-per-data-vc 65536 --buffers-per-ctrl-vc 1024 > logs/log9.txt &
+nohup /artifact_top/alloy-gem5/build/RISCV_WT_MESI/gem5.opt --stats-file=stats10.txt --debug-flags=DOMEM,DOACC --listener-mode=off /artifact_top/alloy-gem5/configs/brg/sc3.py --msg-size PUT_NT:64 --cpu-type TimingSimpleCPU --link-latency 20 --CG_link_latency 50 --garnet-deadlock-threshold 100000 --l2_size 16384kB --l2_assoc 8 --num-dirs 8 --brg-fast-forward --num-cpus 64 --network garnet2.0 --buffer-size 0 --mem-size 4GB --ruby --l1d_size 64kB --mem-type SimpleMemory --num-l1-cache-ports 8 --num-l2caches 8 --ports 16 --l1i_size 64kB --topology TwoMeshXY -c /artifact_top/alloy-apps/build-applrts_sc3/run_sendrecv_pad -o "-w 0 -r 1 -n 2 -c 8 -f 128 -s 8 -p 21" --vcs-per-vnet 64 --buffers-per-data-vc 65536 --buffers-per-ctrl-vc 1024 > logs/log10.txt &
+nohup /artifact_top/alloy-gem5/build/RISCV_MP/gem5.opt --stats-file=stats11.txt --debug-flags=DOMEM,DOACC --listener-mode=off /artifact_top/alloy-gem5/configs/brg/sc3.py --msg-size PUT_NT:64 --cpu-type TimingSimpleCPU --link-latency 20 --CG_link_latency 150 --garnet-deadlock-threshold 100000 --l2_size 16384kB --l2_assoc 8 --num-dirs 8 --brg-fast-forward --num-cpus 64 --network garnet2.0 --buffer-size 0 --mem-size 4GB --ruby --l1d_size 64kB --mem-type SimpleMemory --num-l1-cache-ports 8 --num-l2caches 8 --ports 16 --l1i_size 64kB --topology TwoMeshXY -c /artifact_top/alloy-apps/build-applrts_sc3/run_sendrecv_pad -o "-w 0 -r 1 -n 2 -c 8 -f 128 -s 8 -p 21" --vcs-per-vnet 64 --buffers-per-data-vc 65536 --buffers-per-ctrl-vc 1024 > logs/log11.txt &
+nohup /artifact_top/alloy-gem5/build/RISCV_MP/gem5.opt --stats-file=stats12.txt --debug-flags=DOMEM,DOACC --listener-mode=off /artifact_top/alloy-gem5/configs/brg/sc3.py --msg-size PUT_NT:64 --cpu-type TimingSimpleCPU --link-latency 20 --CG_link_latency 50 --garnet-deadlock-threshold 100000 --l2_size 16384kB --l2_assoc 8 --num-dirs 8 --brg-fast-forward --num-cpus 64 --network garnet2.0 --buffer-size 0 --mem-size 4GB --ruby --l1d_size 64kB --mem-type SimpleMemory --num-l1-cache-ports 8 --num-l2caches 8 --ports 16 --l1i_size 64kB --topology TwoMeshXY -c /artifact_top/alloy-apps/build-applrts_sc3/run_sendrecv_pad -o "-w 0 -r 1 -n 2 -c 8 -f 128 -s 8 -p 21" --vcs-per-vnet 64 --buffers-per-data-vc 65536 --buffers-per-ctrl-vc 1024 > logs/log12.txt &
 # sendrecv size = 4KB
-nohup /artifact_top/alloy-gem5/build/RISCV_DO_MESI_64B/gem5.opt --stats-file=stats13.txt --debug-flags=DOMEM,DOACC --listener-mode=off /artifact_top/alloy-gem5/configs/brg/sc3.py --cpu-type TimingSimpleCPU --link-latency 20 --CG_link_latency 150 --garnet-deadlock-threshold 100000 --l2_size 16384kB --l2_assoc 8 --num-dirs 8 --brg-fast-forward --num-cpus 64 --network garnet2.0 --buffer-size 0 --mem-size 4GB --ruby --l1d_size 64kB --mem-type SimpleMemory --num-l1-cache-ports 8 --num-l2caches 8 --ports 16 --l1i_size 64kB --topology TwoMeshXY -c /artifact_top/alloy-apps/build-applrts_sc3/run_sendrecv_pad -o "-w 0 -r 1 -n 2 -c 8 -f 1024 -s 8 -p 21" --vcs-per-vnet 64 --buffers-per-data-vc 65536 --buffers-per-ctrl-vc 1024 > logs/log13.txt &
-nohup /artifact_top/alloy-gem5/build/RISCV_DO_MESI_64B/gem5.opt --stats-file=stats14.txt --debug-flags=DOMEM,DOACC --listener-mode=off /artifact_top/alloy-gem5/configs/brg/sc3.py --cpu-type TimingSimpleCPU --link-latency 20 --CG_link_latency 50 --garnet-deadlock-threshold 100000 --l2_size 16384kB --l2_assoc 8 --num-dirs 8 --brg-fast-forward --num-cpus 64 --network garnet2.0 --buffer-size 0 --mem-size 4GB --ruby --l1d_size 64kB --mem-type SimpleMemory --num-l1-cache-ports 8 --num-l2caches 8 --ports 16 --l1i_size 64kB --topology TwoMeshXY -c /artifact_top/alloy-apps/build-applrts_sc3/run_sendrecv_pad -o "-w 0 -r 1 -n 2 -c 8 -f 1024 -s 8 -p 21" --vcs-per-vnet 64 --buffers-per-data-vc 65536 --buffers-per-ctrl-vc 1024 > logs/log14.txt &
-nohup /artifact_top/alloy-gem5/build/RISCV_WT_MESI_64B/gem5.opt --stats-file=stats15.txt --debug-flags=DOMEM,DOACC --listener-mode=off /artifact_top/alloy-gem5/configs/brg/sc3.py --cpu-type TimingSimpleCPU --link-latency 20 --CG_link_latency 150 --garnet-deadlock-threshold 100000 --l2_size 16384kB --l2_assoc 8 --num-dirs 8 --brg-fast-forward --num-cpus 64 --network garnet2.0 --buffer-size 0 --mem-size 4GB --ruby --l1d_size 64kB --mem-type SimpleMemory --num-l1-cache-ports 8 --num-l2caches 8 --ports 16 --l1i_size 64kB --topology TwoMeshXY -c /artifact_top/alloy-apps/build-applrts_sc3/run_sendrecv_pad -o "-w 0 -r 1 -n 2 -c 8 -f 1024 -s 8 -p 21" --vcs-per-vnet 64 --buffers-per-data-vc 65536 --buffers-per-ctrl-vc 1024 > logs/log15.txt &
-nohup /artifact_top/alloy-gem5/build/RISCV_WT_MESI_64B/gem5.opt --stats-file=stats16.txt --debug-flags=DOMEM,DOACC --listener-mode=off /artifact_top/alloy-gem5/configs/brg/sc3.py --cpu-type TimingSimpleCPU --link-latency 20 --CG_link_latency 50 --garnet-deadlock-threshold 100000 --l2_size 16384kB --l2_assoc 8 --num-dirs 8 --brg-fast-forward --num-cpus 64 --network garnet2.0 --buffer-size 0 --mem-size 4GB --ruby --l1d_size 64kB --mem-type SimpleMemory --num-l1-cache-ports 8 --num-l2caches 8 --ports 16 --l1i_size 64kB --topology TwoMeshXY -c /artifact_top/alloy-apps/build-applrts_sc3/run_sendrecv_pad -o "-w 0 -r 1 -n 2 -c 8 -f 1024 -s 8 -p 21" --vcs-per-vnet 64 --buffers-per-data-vc 65536 --buffers-per-ctrl-vc 1024 > logs/log16.txt &
-nohup /artifact_top/alloy-gem5/build/RISCV_MP_64B/gem5.opt --stats-file=stats17.txt --debug-flags=DOMEM,DOACC --listener-mode=off /artifact_top/alloy-gem5/configs/brg/sc3.py --cpu-type TimingSimpleCPU --link-latency 20 --CG_link_latency 150 --garnet-deadlock-threshold 100000 --l2_size 16384kB --l2_assoc 8 --num-dirs 8 --brg-fast-forward --num-cpus 64 --network garnet2.0 --buffer-size 0 --mem-size 4GB --ruby --l1d_size 64kB --mem-type SimpleMemory --num-l1-cache-ports 8 --num-l2caches 8 --ports 16 --l1i_size 64kB --topology TwoMeshXY -c /artifact_top/alloy-apps/build-applrts_sc3/run_sendrecv_pad -o "-w 0 -r 1 -n 2 -c 8 -f 1024 -s 8 -p 21" --vcs-per-vnet 64 --buffers-per-data-vc 65536 --buffers-per-ctrl-vc 1024 > logs/log17.txt &
-nohup /artifact_top/alloy-gem5/build/RISCV_MP_64B/gem5.opt --stats-file=stats18.txt --debug-flags=DOMEM,DOACC --listener-mode=off /artifact_top/alloy-gem5/configs/brg/sc3.py --cpu-type TimingSimpleCPU --link-latency 20 --CG_link_latency 50 --garnet-deadlock-threshold 100000 --l2_size 16384kB --l2_assoc 8 --num-dirs 8 --brg-fast-forward --num-cpus 64 --network garnet2.0 --buffer-size 0 --mem-size 4GB --ruby --l1d_size 64kB --mem-type SimpleMemory --num-l1-cache-ports 8 --num-l2caches 8 --ports 16 --l1i_size 64kB --topology TwoMeshXY -c /artifact_top/alloy-apps/build-applrts_sc3/run_sendrecv_pad -o "-w 0 -r 1 -n 2 -c 8 -f 1024 -s 8 -p 21" --vcs-per-vnet 64 --buffers-per-data-vc 65536 --buffers-per-ctrl-vc 1024 > logs/log18.txt &
+nohup /artifact_top/alloy-gem5/build/RISCV_DO_MESI/gem5.opt --stats-file=stats13.txt --debug-flags=DOMEM,DOACC --listener-mode=off /artifact_top/alloy-gem5/configs/brg/sc3.py --msg-size PUT_NT:64 --cpu-type TimingSimpleCPU --link-latency 20 --CG_link_latency 150 --garnet-deadlock-threshold 100000 --l2_size 16384kB --l2_assoc 8 --num-dirs 8 --brg-fast-forward --num-cpus 64 --network garnet2.0 --buffer-size 0 --mem-size 4GB --ruby --l1d_size 64kB --mem-type SimpleMemory --num-l1-cache-ports 8 --num-l2caches 8 --ports 16 --l1i_size 64kB --topology TwoMeshXY -c /artifact_top/alloy-apps/build-applrts_sc3/run_sendrecv_pad -o "-w 0 -r 1 -n 2 -c 8 -f 1024 -s 8 -p 21" --vcs-per-vnet 64 --buffers-per-data-vc 65536 --buffers-per-ctrl-vc 1024 > logs/log13.txt &
+nohup /artifact_top/alloy-gem5/build/RISCV_DO_MESI/gem5.opt --stats-file=stats14.txt --debug-flags=DOMEM,DOACC --listener-mode=off /artifact_top/alloy-gem5/configs/brg/sc3.py --msg-size PUT_NT:64 --cpu-type TimingSimpleCPU --link-latency 20 --CG_link_latency 50 --garnet-deadlock-threshold 100000 --l2_size 16384kB --l2_assoc 8 --num-dirs 8 --brg-fast-forward --num-cpus 64 --network garnet2.0 --buffer-size 0 --mem-size 4GB --ruby --l1d_size 64kB --mem-type SimpleMemory --num-l1-cache-ports 8 --num-l2caches 8 --ports 16 --l1i_size 64kB --topology TwoMeshXY -c /artifact_top/alloy-apps/build-applrts_sc3/run_sendrecv_pad -o "-w 0 -r 1 -n 2 -c 8 -f 1024 -s 8 -p 21" --vcs-per-vnet 64 --buffers-per-data-vc 65536 --buffers-per-ctrl-vc 1024 > logs/log14.txt &
+nohup /artifact_top/alloy-gem5/build/RISCV_WT_MESI/gem5.opt --stats-file=stats15.txt --debug-flags=DOMEM,DOACC --listener-mode=off /artifact_top/alloy-gem5/configs/brg/sc3.py --msg-size PUT_NT:64 --cpu-type TimingSimpleCPU --link-latency 20 --CG_link_latency 150 --garnet-deadlock-threshold 100000 --l2_size 16384kB --l2_assoc 8 --num-dirs 8 --brg-fast-forward --num-cpus 64 --network garnet2.0 --buffer-size 0 --mem-size 4GB --ruby --l1d_size 64kB --mem-type SimpleMemory --num-l1-cache-ports 8 --num-l2caches 8 --ports 16 --l1i_size 64kB --topology TwoMeshXY -c /artifact_top/alloy-apps/build-applrts_sc3/run_sendrecv_pad -o "-w 0 -r 1 -n 2 -c 8 -f 1024 -s 8 -p 21" --vcs-per-vnet 64 --buffers-per-data-vc 65536 --buffers-per-ctrl-vc 1024 > logs/log15.txt &
+nohup /artifact_top/alloy-gem5/build/RISCV_WT_MESI/gem5.opt --stats-file=stats16.txt --debug-flags=DOMEM,DOACC --listener-mode=off /artifact_top/alloy-gem5/configs/brg/sc3.py --msg-size PUT_NT:64 --cpu-type TimingSimpleCPU --link-latency 20 --CG_link_latency 50 --garnet-deadlock-threshold 100000 --l2_size 16384kB --l2_assoc 8 --num-dirs 8 --brg-fast-forward --num-cpus 64 --network garnet2.0 --buffer-size 0 --mem-size 4GB --ruby --l1d_size 64kB --mem-type SimpleMemory --num-l1-cache-ports 8 --num-l2caches 8 --ports 16 --l1i_size 64kB --topology TwoMeshXY -c /artifact_top/alloy-apps/build-applrts_sc3/run_sendrecv_pad -o "-w 0 -r 1 -n 2 -c 8 -f 1024 -s 8 -p 21" --vcs-per-vnet 64 --buffers-per-data-vc 65536 --buffers-per-ctrl-vc 1024 > logs/log16.txt &
+nohup /artifact_top/alloy-gem5/build/RISCV_MP/gem5.opt --stats-file=stats17.txt --debug-flags=DOMEM,DOACC --listener-mode=off /artifact_top/alloy-gem5/configs/brg/sc3.py --msg-size PUT_NT:64 --cpu-type TimingSimpleCPU --link-latency 20 --CG_link_latency 150 --garnet-deadlock-threshold 100000 --l2_size 16384kB --l2_assoc 8 --num-dirs 8 --brg-fast-forward --num-cpus 64 --network garnet2.0 --buffer-size 0 --mem-size 4GB --ruby --l1d_size 64kB --mem-type SimpleMemory --num-l1-cache-ports 8 --num-l2caches 8 --ports 16 --l1i_size 64kB --topology TwoMeshXY -c /artifact_top/alloy-apps/build-applrts_sc3/run_sendrecv_pad -o "-w 0 -r 1 -n 2 -c 8 -f 1024 -s 8 -p 21" --vcs-per-vnet 64 --buffers-per-data-vc 65536 --buffers-per-ctrl-vc 1024 > logs/log17.txt &
+nohup /artifact_top/alloy-gem5/build/RISCV_MP/gem5.opt --stats-file=stats18.txt --debug-flags=DOMEM,DOACC --listener-mode=off /artifact_top/alloy-gem5/configs/brg/sc3.py --msg-size PUT_NT:64 --cpu-type TimingSimpleCPU --link-latency 20 --CG_link_latency 50 --garnet-deadlock-threshold 100000 --l2_size 16384kB --l2_assoc 8 --num-dirs 8 --brg-fast-forward --num-cpus 64 --network garnet2.0 --buffer-size 0 --mem-size 4GB --ruby --l1d_size 64kB --mem-type SimpleMemory --num-l1-cache-ports 8 --num-l2caches 8 --ports 16 --l1i_size 64kB --topology TwoMeshXY -c /artifact_top/alloy-apps/build-applrts_sc3/run_sendrecv_pad -o "-w 0 -r 1 -n 2 -c 8 -f 1024 -s 8 -p 21" --vcs-per-vnet 64 --buffers-per-data-vc 65536 --buffers-per-ctrl-vc 1024 > logs/log18.txt &
 # sendrecv size = 32KB
-nohup /artifact_top/alloy-gem5/build/RISCV_DO_MESI_64B/gem5.opt --stats-file=stats19.txt --debug-flags=DOMEM,DOACC --listener-mode=off /artifact_top/alloy-gem5/configs/brg/sc3.py --cpu-type TimingSimpleCPU --link-latency 20 --CG_link_latency 150 --garnet-deadlock-threshold 100000 --l2_size 16384kB --l2_assoc 8 --num-dirs 8 --brg-fast-forward --num-cpus 64 --network garnet2.0 --buffer-size 0 --mem-size 4GB --ruby --l1d_size 64kB --mem-type SimpleMemory --num-l1-cache-ports 8 --num-l2caches 8 --ports 16 --l1i_size 64kB --topology TwoMeshXY -c /artifact_top/alloy-apps/build-applrts_sc3/run_sendrecv_pad -o "-w 0 -r 1 -n 2 -c 8 -f 8192 -s 8 -p 21" --vcs-per-vnet 64 --buffers-per-data-vc 65536 --buffers-per-ctrl-vc 1024 > logs/log19.txt &
-nohup /artifact_top/alloy-gem5/build/RISCV_DO_MESI_64B/gem5.opt --stats-file=stats20.txt --debug-flags=DOMEM,DOACC --listener-mode=off /artifact_top/alloy-gem5/configs/brg/sc3.py --cpu-type TimingSimpleCPU --link-latency 20 --CG_link_latency 50 --garnet-deadlock-threshold 100000 --l2_size 16384kB --l2_assoc 8 --num-dirs 8 --brg-fast-forward --num-cpus 64 --network garnet2.0 --buffer-size 0 --mem-size 4GB --ruby --l1d_size 64kB --mem-type SimpleMemory --num-l1-cache-ports 8 --num-l2caches 8 --ports 16 --l1i_size 64kB --topology TwoMeshXY -c /artifact_top/alloy-apps/build-applrts_sc3/run_sendrecv_pad -o "-w 0 -r 1 -n 2 -c 8 -f 8192 -s 8 -p 21" --vcs-per-vnet 64 --buffers-per-data-vc 65536 --buffers-per-ctrl-vc 1024 > logs/log20.txt &
-nohup /artifact_top/alloy-gem5/build/RISCV_WT_MESI_64B/gem5.opt --stats-file=stats21.txt --debug-flags=DOMEM,DOACC --listener-mode=off /artifact_top/alloy-gem5/configs/brg/sc3.py --cpu-type TimingSimpleCPU --link-latency 20 --CG_link_latency 150 --garnet-deadlock-threshold 100000 --l2_size 16384kB --l2_assoc 8 --num-dirs 8 --brg-fast-forward --num-cpus 64 --network garnet2.0 --buffer-size 0 --mem-size 4GB --ruby --l1d_size 64kB --mem-type SimpleMemory --num-l1-cache-ports 8 --num-l2caches 8 --ports 16 --l1i_size 64kB --topology TwoMeshXY -c /artifact_top/alloy-apps/build-applrts_sc3/run_sendrecv_pad -o "-w 0 -r 1 -n 2 -c 8 -f 8192 -s 8 -p 21" --vcs-per-vnet 64 --buffers-per-data-vc 65536 --buffers-per-ctrl-vc 1024 > logs/log21.txt &
-nohup /artifact_top/alloy-gem5/build/RISCV_WT_MESI_64B/gem5.opt --stats-file=stats22.txt --debug-flags=DOMEM,DOACC --listener-mode=off /artifact_top/alloy-gem5/configs/brg/sc3.py --cpu-type TimingSimpleCPU --link-latency 20 --CG_link_latency 50 --garnet-deadlock-threshold 100000 --l2_size 16384kB --l2_assoc 8 --num-dirs 8 --brg-fast-forward --num-cpus 64 --network garnet2.0 --buffer-size 0 --mem-size 4GB --ruby --l1d_size 64kB --mem-type SimpleMemory --num-l1-cache-ports 8 --num-l2caches 8 --ports 16 --l1i_size 64kB --topology TwoMeshXY -c /artifact_top/alloy-apps/build-applrts_sc3/run_sendrecv_pad -o "-w 0 -r 1 -n 2 -c 8 -f 8192 -s 8 -p 21" --vcs-per-vnet 64 --buffers-per-data-vc 65536 --buffers-per-ctrl-vc 1024 > logs/log22.txt &
-nohup /artifact_top/alloy-gem5/build/RISCV_MP_64B/gem5.opt --stats-file=stats23.txt --debug-flags=DOMEM,DOACC --listener-mode=off /artifact_top/alloy-gem5/configs/brg/sc3.py --cpu-type TimingSimpleCPU --link-latency 20 --CG_link_latency 150 --garnet-deadlock-threshold 100000 --l2_size 16384kB --l2_assoc 8 --num-dirs 8 --brg-fast-forward --num-cpus 64 --network garnet2.0 --buffer-size 0 --mem-size 4GB --ruby --l1d_size 64kB --mem-type SimpleMemory --num-l1-cache-ports 8 --num-l2caches 8 --ports 16 --l1i_size 64kB --topology TwoMeshXY -c /artifact_top/alloy-apps/build-applrts_sc3/run_sendrecv_pad -o "-w 0 -r 1 -n 2 -c 8 -f 8192 -s 8 -p 21" --vcs-per-vnet 64 --buffers-per-data-vc 65536 --buffers-per-ctrl-vc 1024 > logs/log23.txt &
-nohup /artifact_top/alloy-gem5/build/RISCV_MP_64B/gem5.opt --stats-file=stats24.txt --debug-flags=DOMEM,DOACC --listener-mode=off /artifact_top/alloy-gem5/configs/brg/sc3.py --cpu-type TimingSimpleCPU --link-latency 20 --CG_link_latency 50 --garnet-deadlock-threshold 100000 --l2_size 16384kB --l2_assoc 8 --num-dirs 8 --brg-fast-forward --num-cpus 64 --network garnet2.0 --buffer-size 0 --mem-size 4GB --ruby --l1d_size 64kB --mem-type SimpleMemory --num-l1-cache-ports 8 --num-l2caches 8 --ports 16 --l1i_size 64kB --topology TwoMeshXY -c /artifact_top/alloy-apps/build-applrts_sc3/run_sendrecv_pad -o "-w 0 -r 1 -n 2 -c 8 -f 8192 -s 8 -p 21" --vcs-per-vnet 64 --buffers-per-data-vc 65536 --buffers-per-ctrl-vc 1024 > logs/log24.txt &
+nohup /artifact_top/alloy-gem5/build/RISCV_DO_MESI/gem5.opt --stats-file=stats19.txt --debug-flags=DOMEM,DOACC --listener-mode=off /artifact_top/alloy-gem5/configs/brg/sc3.py --msg-size PUT_NT:64 --cpu-type TimingSimpleCPU --link-latency 20 --CG_link_latency 150 --garnet-deadlock-threshold 100000 --l2_size 16384kB --l2_assoc 8 --num-dirs 8 --brg-fast-forward --num-cpus 64 --network garnet2.0 --buffer-size 0 --mem-size 4GB --ruby --l1d_size 64kB --mem-type SimpleMemory --num-l1-cache-ports 8 --num-l2caches 8 --ports 16 --l1i_size 64kB --topology TwoMeshXY -c /artifact_top/alloy-apps/build-applrts_sc3/run_sendrecv_pad -o "-w 0 -r 1 -n 2 -c 8 -f 8192 -s 8 -p 21" --vcs-per-vnet 64 --buffers-per-data-vc 65536 --buffers-per-ctrl-vc 1024 > logs/log19.txt &
+nohup /artifact_top/alloy-gem5/build/RISCV_DO_MESI/gem5.opt --stats-file=stats20.txt --debug-flags=DOMEM,DOACC --listener-mode=off /artifact_top/alloy-gem5/configs/brg/sc3.py --msg-size PUT_NT:64 --cpu-type TimingSimpleCPU --link-latency 20 --CG_link_latency 50 --garnet-deadlock-threshold 100000 --l2_size 16384kB --l2_assoc 8 --num-dirs 8 --brg-fast-forward --num-cpus 64 --network garnet2.0 --buffer-size 0 --mem-size 4GB --ruby --l1d_size 64kB --mem-type SimpleMemory --num-l1-cache-ports 8 --num-l2caches 8 --ports 16 --l1i_size 64kB --topology TwoMeshXY -c /artifact_top/alloy-apps/build-applrts_sc3/run_sendrecv_pad -o "-w 0 -r 1 -n 2 -c 8 -f 8192 -s 8 -p 21" --vcs-per-vnet 64 --buffers-per-data-vc 65536 --buffers-per-ctrl-vc 1024 > logs/log20.txt &
+nohup /artifact_top/alloy-gem5/build/RISCV_WT_MESI/gem5.opt --stats-file=stats21.txt --debug-flags=DOMEM,DOACC --listener-mode=off /artifact_top/alloy-gem5/configs/brg/sc3.py --msg-size PUT_NT:64 --cpu-type TimingSimpleCPU --link-latency 20 --CG_link_latency 150 --garnet-deadlock-threshold 100000 --l2_size 16384kB --l2_assoc 8 --num-dirs 8 --brg-fast-forward --num-cpus 64 --network garnet2.0 --buffer-size 0 --mem-size 4GB --ruby --l1d_size 64kB --mem-type SimpleMemory --num-l1-cache-ports 8 --num-l2caches 8 --ports 16 --l1i_size 64kB --topology TwoMeshXY -c /artifact_top/alloy-apps/build-applrts_sc3/run_sendrecv_pad -o "-w 0 -r 1 -n 2 -c 8 -f 8192 -s 8 -p 21" --vcs-per-vnet 64 --buffers-per-data-vc 65536 --buffers-per-ctrl-vc 1024 > logs/log21.txt &
+nohup /artifact_top/alloy-gem5/build/RISCV_WT_MESI/gem5.opt --stats-file=stats22.txt --debug-flags=DOMEM,DOACC --listener-mode=off /artifact_top/alloy-gem5/configs/brg/sc3.py --msg-size PUT_NT:64 --cpu-type TimingSimpleCPU --link-latency 20 --CG_link_latency 50 --garnet-deadlock-threshold 100000 --l2_size 16384kB --l2_assoc 8 --num-dirs 8 --brg-fast-forward --num-cpus 64 --network garnet2.0 --buffer-size 0 --mem-size 4GB --ruby --l1d_size 64kB --mem-type SimpleMemory --num-l1-cache-ports 8 --num-l2caches 8 --ports 16 --l1i_size 64kB --topology TwoMeshXY -c /artifact_top/alloy-apps/build-applrts_sc3/run_sendrecv_pad -o "-w 0 -r 1 -n 2 -c 8 -f 8192 -s 8 -p 21" --vcs-per-vnet 64 --buffers-per-data-vc 65536 --buffers-per-ctrl-vc 1024 > logs/log22.txt &
+nohup /artifact_top/alloy-gem5/build/RISCV_MP/gem5.opt --stats-file=stats23.txt --debug-flags=DOMEM,DOACC --listener-mode=off /artifact_top/alloy-gem5/configs/brg/sc3.py --msg-size PUT_NT:64 --cpu-type TimingSimpleCPU --link-latency 20 --CG_link_latency 150 --garnet-deadlock-threshold 100000 --l2_size 16384kB --l2_assoc 8 --num-dirs 8 --brg-fast-forward --num-cpus 64 --network garnet2.0 --buffer-size 0 --mem-size 4GB --ruby --l1d_size 64kB --mem-type SimpleMemory --num-l1-cache-ports 8 --num-l2caches 8 --ports 16 --l1i_size 64kB --topology TwoMeshXY -c /artifact_top/alloy-apps/build-applrts_sc3/run_sendrecv_pad -o "-w 0 -r 1 -n 2 -c 8 -f 8192 -s 8 -p 21" --vcs-per-vnet 64 --buffers-per-data-vc 65536 --buffers-per-ctrl-vc 1024 > logs/log23.txt &
+nohup /artifact_top/alloy-gem5/build/RISCV_MP/gem5.opt --stats-file=stats24.txt --debug-flags=DOMEM,DOACC --listener-mode=off /artifact_top/alloy-gem5/configs/brg/sc3.py --msg-size PUT_NT:64 --cpu-type TimingSimpleCPU --link-latency 20 --CG_link_latency 50 --garnet-deadlock-threshold 100000 --l2_size 16384kB --l2_assoc 8 --num-dirs 8 --brg-fast-forward --num-cpus 64 --network garnet2.0 --buffer-size 0 --mem-size 4GB --ruby --l1d_size 64kB --mem-type SimpleMemory --num-l1-cache-ports 8 --num-l2caches 8 --ports 16 --l1i_size 64kB --topology TwoMeshXY -c /artifact_top/alloy-apps/build-applrts_sc3/run_sendrecv_pad -o "-w 0 -r 1 -n 2 -c 8 -f 8192 -s 8 -p 21" --vcs-per-vnet 64 --buffers-per-data-vc 65536 --buffers-per-ctrl-vc 1024 > logs/log24.txt &
 # sendrecv size = 256KB
-nohup /artifact_top/alloy-gem5/build/RISCV_DO_MESI_64B/gem5.opt --stats-file=stats25.txt --debug-flags=DOMEM,DOACC --listener-mode=off /artifact_top/alloy-gem5/configs/brg/sc3.py --cpu-type TimingSimpleCPU --link-latency 20 --CG_link_latency 150 --garnet-deadlock-threshold 100000 --l2_size 16384kB --l2_assoc 8 --num-dirs 8 --brg-fast-forward --num-cpus 64 --network garnet2.0 --buffer-size 0 --mem-size 4GB --ruby --l1d_size 64kB --mem-type SimpleMemory --num-l1-cache-ports 8 --num-l2caches 8 --ports 16 --l1i_size 64kB --topology TwoMeshXY -c /artifact_top/alloy-apps/build-applrts_sc3/run_sendrecv_pad -o "-w 0 -r 1 -n 2 -c 8 -f 65536 -s 8 -p 21" --vcs-per-vnet 64 --buffers-per-data-vc 65536 --buffers-per-ctrl-vc 1024 > logs/log25.txt &
-nohup /artifact_top/alloy-gem5/build/RISCV_DO_MESI_64B/gem5.opt --stats-file=stats26.txt --debug-flags=DOMEM,DOACC --listener-mode=off /artifact_top/alloy-gem5/configs/brg/sc3.py --cpu-type TimingSimpleCPU --link-latency 20 --CG_link_latency 50 --garnet-deadlock-threshold 100000 --l2_size 16384kB --l2_assoc 8 --num-dirs 8 --brg-fast-forward --num-cpus 64 --network garnet2.0 --buffer-size 0 --mem-size 4GB --ruby --l1d_size 64kB --mem-type SimpleMemory --num-l1-cache-ports 8 --num-l2caches 8 --ports 16 --l1i_size 64kB --topology TwoMeshXY -c /artifact_top/alloy-apps/build-applrts_sc3/run_sendrecv_pad -o "-w 0 -r 1 -n 2 -c 8 -f 65536 -s 8 -p 21" --vcs-per-vnet 64 --buffers-per-data-vc 65536 --buffers-per-ctrl-vc 1024 > logs/log26.txt & 
-nohup /artifact_top/alloy-gem5/build/RISCV_WT_MESI_64B/gem5.opt --stats-file=stats27.txt --debug-flags=DOMEM,DOACC --listener-mode=off /artifact_top/alloy-gem5/configs/brg/sc3.py --cpu-type TimingSimpleCPU --link-latency 20 --CG_link_latency 150 --garnet-deadlock-threshold 100000 --l2_size 16384kB --l2_assoc 8 --num-dirs 8 --brg-fast-forward --num-cpus 64 --network garnet2.0 --buffer-size 0 --mem-size 4GB --ruby --l1d_size 64kB --mem-type SimpleMemory --num-l1-cache-ports 8 --num-l2caches 8 --ports 16 --l1i_size 64kB --topology TwoMeshXY -c /artifact_top/alloy-apps/build-applrts_sc3/run_sendrecv_pad -o "-w 0 -r 1 -n 2 -c 8 -f 65536 -s 8 -p 21" --vcs-per-vnet 64 --buffers-per-data-vc 65536 --buffers-per-ctrl-vc 1024 > logs/log27.txt & 
-nohup /artifact_top/alloy-gem5/build/RISCV_WT_MESI_64B/gem5.opt --stats-file=stats28.txt --debug-flags=DOMEM,DOACC --listener-mode=off /artifact_top/alloy-gem5/configs/brg/sc3.py --cpu-type TimingSimpleCPU --link-latency 20 --CG_link_latency 50 --garnet-deadlock-threshold 100000 --l2_size 16384kB --l2_assoc 8 --num-dirs 8 --brg-fast-forward --num-cpus 64 --network garnet2.0 --buffer-size 0 --mem-size 4GB --ruby --l1d_size 64kB --mem-type SimpleMemory --num-l1-cache-ports 8 --num-l2caches 8 --ports 16 --l1i_size 64kB --topology TwoMeshXY -c /artifact_top/alloy-apps/build-applrts_sc3/run_sendrecv_pad -o "-w 0 -r 1 -n 2 -c 8 -f 65536 -s 8 -p 21" --vcs-per-vnet 64 --buffers-per-data-vc 65536 --buffers-per-ctrl-vc 1024 > logs/log28.txt &
-nohup /artifact_top/alloy-gem5/build/RISCV_MP_64B/gem5.opt --stats-file=stats29.txt --debug-flags=DOMEM,DOACC --listener-mode=off /artifact_top/alloy-gem5/configs/brg/sc3.py --cpu-type TimingSimpleCPU --link-latency 20 --CG_link_latency 150 --garnet-deadlock-threshold 100000 --l2_size 16384kB --l2_assoc 8 --num-dirs 8 --brg-fast-forward --num-cpus 64 --network garnet2.0 --buffer-size 0 --mem-size 4GB --ruby --l1d_size 64kB --mem-type SimpleMemory --num-l1-cache-ports 8 --num-l2caches 8 --ports 16 --l1i_size 64kB --topology TwoMeshXY -c /artifact_top/alloy-apps/build-applrts_sc3/run_sendrecv_pad -o "-w 0 -r 1 -n 2 -c 8 -f 65536 -s 8 -p 21" --vcs-per-vnet 64 --buffers-per-data-vc 65536 --buffers-per-ctrl-vc 1024 > logs/log29.txt & 
-nohup /artifact_top/alloy-gem5/build/RISCV_MP_64B/gem5.opt --stats-file=stats30.txt --debug-flags=DOMEM,DOACC --listener-mode=off /artifact_top/alloy-gem5/configs/brg/sc3.py --cpu-type TimingSimpleCPU --link-latency 20 --CG_link_latency 50 --garnet-deadlock-threshold 100000 --l2_size 16384kB --l2_assoc 8 --num-dirs 8 --brg-fast-forward --num-cpus 64 --network garnet2.0 --buffer-size 0 --mem-size 4GB --ruby --l1d_size 64kB --mem-type SimpleMemory --num-l1-cache-ports 8 --num-l2caches 8 --ports 16 --l1i_size 64kB --topology TwoMeshXY -c /artifact_top/alloy-apps/build-applrts_sc3/run_sendrecv_pad -o "-w 0 -r 1 -n 2 -c 8 -f 65536 -s 8 -p 21" --vcs-per-vnet 64 --buffers-per-data-vc 65536 --buffers-per-ctrl-vc 1024 > logs/log30.txt &
+nohup /artifact_top/alloy-gem5/build/RISCV_DO_MESI/gem5.opt --stats-file=stats25.txt --debug-flags=DOMEM,DOACC --listener-mode=off /artifact_top/alloy-gem5/configs/brg/sc3.py --msg-size PUT_NT:64 --cpu-type TimingSimpleCPU --link-latency 20 --CG_link_latency 150 --garnet-deadlock-threshold 100000 --l2_size 16384kB --l2_assoc 8 --num-dirs 8 --brg-fast-forward --num-cpus 64 --network garnet2.0 --buffer-size 0 --mem-size 4GB --ruby --l1d_size 64kB --mem-type SimpleMemory --num-l1-cache-ports 8 --num-l2caches 8 --ports 16 --l1i_size 64kB --topology TwoMeshXY -c /artifact_top/alloy-apps/build-applrts_sc3/run_sendrecv_pad -o "-w 0 -r 1 -n 2 -c 8 -f 65536 -s 8 -p 21" --vcs-per-vnet 64 --buffers-per-data-vc 65536 --buffers-per-ctrl-vc 1024 > logs/log25.txt &
+nohup /artifact_top/alloy-gem5/build/RISCV_DO_MESI/gem5.opt --stats-file=stats26.txt --debug-flags=DOMEM,DOACC --listener-mode=off /artifact_top/alloy-gem5/configs/brg/sc3.py --msg-size PUT_NT:64 --cpu-type TimingSimpleCPU --link-latency 20 --CG_link_latency 50 --garnet-deadlock-threshold 100000 --l2_size 16384kB --l2_assoc 8 --num-dirs 8 --brg-fast-forward --num-cpus 64 --network garnet2.0 --buffer-size 0 --mem-size 4GB --ruby --l1d_size 64kB --mem-type SimpleMemory --num-l1-cache-ports 8 --num-l2caches 8 --ports 16 --l1i_size 64kB --topology TwoMeshXY -c /artifact_top/alloy-apps/build-applrts_sc3/run_sendrecv_pad -o "-w 0 -r 1 -n 2 -c 8 -f 65536 -s 8 -p 21" --vcs-per-vnet 64 --buffers-per-data-vc 65536 --buffers-per-ctrl-vc 1024 > logs/log26.txt & 
+nohup /artifact_top/alloy-gem5/build/RISCV_WT_MESI/gem5.opt --stats-file=stats27.txt --debug-flags=DOMEM,DOACC --listener-mode=off /artifact_top/alloy-gem5/configs/brg/sc3.py --msg-size PUT_NT:64 --cpu-type TimingSimpleCPU --link-latency 20 --CG_link_latency 150 --garnet-deadlock-threshold 100000 --l2_size 16384kB --l2_assoc 8 --num-dirs 8 --brg-fast-forward --num-cpus 64 --network garnet2.0 --buffer-size 0 --mem-size 4GB --ruby --l1d_size 64kB --mem-type SimpleMemory --num-l1-cache-ports 8 --num-l2caches 8 --ports 16 --l1i_size 64kB --topology TwoMeshXY -c /artifact_top/alloy-apps/build-applrts_sc3/run_sendrecv_pad -o "-w 0 -r 1 -n 2 -c 8 -f 65536 -s 8 -p 21" --vcs-per-vnet 64 --buffers-per-data-vc 65536 --buffers-per-ctrl-vc 1024 > logs/log27.txt & 
+nohup /artifact_top/alloy-gem5/build/RISCV_WT_MESI/gem5.opt --stats-file=stats28.txt --debug-flags=DOMEM,DOACC --listener-mode=off /artifact_top/alloy-gem5/configs/brg/sc3.py --msg-size PUT_NT:64 --cpu-type TimingSimpleCPU --link-latency 20 --CG_link_latency 50 --garnet-deadlock-threshold 100000 --l2_size 16384kB --l2_assoc 8 --num-dirs 8 --brg-fast-forward --num-cpus 64 --network garnet2.0 --buffer-size 0 --mem-size 4GB --ruby --l1d_size 64kB --mem-type SimpleMemory --num-l1-cache-ports 8 --num-l2caches 8 --ports 16 --l1i_size 64kB --topology TwoMeshXY -c /artifact_top/alloy-apps/build-applrts_sc3/run_sendrecv_pad -o "-w 0 -r 1 -n 2 -c 8 -f 65536 -s 8 -p 21" --vcs-per-vnet 64 --buffers-per-data-vc 65536 --buffers-per-ctrl-vc 1024 > logs/log28.txt &
+nohup /artifact_top/alloy-gem5/build/RISCV_MP/gem5.opt --stats-file=stats29.txt --debug-flags=DOMEM,DOACC --listener-mode=off /artifact_top/alloy-gem5/configs/brg/sc3.py --msg-size PUT_NT:64 --cpu-type TimingSimpleCPU --link-latency 20 --CG_link_latency 150 --garnet-deadlock-threshold 100000 --l2_size 16384kB --l2_assoc 8 --num-dirs 8 --brg-fast-forward --num-cpus 64 --network garnet2.0 --buffer-size 0 --mem-size 4GB --ruby --l1d_size 64kB --mem-type SimpleMemory --num-l1-cache-ports 8 --num-l2caches 8 --ports 16 --l1i_size 64kB --topology TwoMeshXY -c /artifact_top/alloy-apps/build-applrts_sc3/run_sendrecv_pad -o "-w 0 -r 1 -n 2 -c 8 -f 65536 -s 8 -p 21" --vcs-per-vnet 64 --buffers-per-data-vc 65536 --buffers-per-ctrl-vc 1024 > logs/log29.txt & 
+nohup /artifact_top/alloy-gem5/build/RISCV_MP/gem5.opt --stats-file=stats30.txt --debug-flags=DOMEM,DOACC --listener-mode=off /artifact_top/alloy-gem5/configs/brg/sc3.py --msg-size PUT_NT:64 --cpu-type TimingSimpleCPU --link-latency 20 --CG_link_latency 50 --garnet-deadlock-threshold 100000 --l2_size 16384kB --l2_assoc 8 --num-dirs 8 --brg-fast-forward --num-cpus 64 --network garnet2.0 --buffer-size 0 --mem-size 4GB --ruby --l1d_size 64kB --mem-type SimpleMemory --num-l1-cache-ports 8 --num-l2caches 8 --ports 16 --l1i_size 64kB --topology TwoMeshXY -c /artifact_top/alloy-apps/build-applrts_sc3/run_sendrecv_pad -o "-w 0 -r 1 -n 2 -c 8 -f 65536 -s 8 -p 21" --vcs-per-vnet 64 --buffers-per-data-vc 65536 --buffers-per-ctrl-vc 1024 > logs/log30.txt &
 # sendrecv size = 2MB
-nohup /artifact_top/alloy-gem5/build/RISCV_DO_MESI_64B/gem5.opt --stats-file=stats31.txt --debug-flags=DOMEM,DOACC --listener-mode=off /artifact_top/alloy-gem5/configs/brg/sc3.py --cpu-type TimingSimpleCPU --link-latency 20 --CG_link_latency 150 --garnet-deadlock-threshold 100000 --l2_size 16384kB --l2_assoc 8 --num-dirs 8 --brg-fast-forward --num-cpus 64 --network garnet2.0 --buffer-size 0 --mem-size 4GB --ruby --l1d_size 64kB --mem-type SimpleMemory --num-l1-cache-ports 8 --num-l2caches 8 --ports 16 --l1i_size 64kB --topology TwoMeshXY -c /artifact_top/alloy-apps/build-applrts_sc3/run_sendrecv_pad -o "-w 0 -r 1 -n 2 -c 8 -f 524288 -s 8 -p 7" --vcs-per-vnet 64 --buffers-per-data-vc 65536 --buffers-per-ctrl-vc 1024 > logs/log31.txt &
-nohup /artifact_top/alloy-gem5/build/RISCV_DO_MESI_64B/gem5.opt --stats-file=stats32.txt --debug-flags=DOMEM,DOACC --listener-mode=off /artifact_top/alloy-gem5/configs/brg/sc3.py --cpu-type TimingSimpleCPU --link-latency 20 --CG_link_latency 50 --garnet-deadlock-threshold 100000 --l2_size 16384kB --l2_assoc 8 --num-dirs 8 --brg-fast-forward --num-cpus 64 --network garnet2.0 --buffer-size 0 --mem-size 4GB --ruby --l1d_size 64kB --mem-type SimpleMemory --num-l1-cache-ports 8 --num-l2caches 8 --ports 16 --l1i_size 64kB --topology TwoMeshXY -c /artifact_top/alloy-apps/build-applrts_sc3/run_sendrecv_pad -o "-w 0 -r 1 -n 2 -c 8 -f 524288 -s 8 -p 7" --vcs-per-vnet 64 --buffers-per-data-vc 65536 --buffers-per-ctrl-vc 1024 > logs/log32.txt &
-nohup /artifact_top/alloy-gem5/build/RISCV_WT_MESI_64B/gem5.opt --stats-file=stats33.txt --debug-flags=DOMEM,DOACC --listener-mode=off /artifact_top/alloy-gem5/configs/brg/sc3.py --cpu-type TimingSimpleCPU --link-latency 20 --CG_link_latency 150 --garnet-deadlock-threshold 100000 --l2_size 16384kB --l2_assoc 8 --num-dirs 8 --brg-fast-forward --num-cpus 64 --network garnet2.0 --buffer-size 0 --mem-size 4GB --ruby --l1d_size 64kB --mem-type SimpleMemory --num-l1-cache-ports 8 --num-l2caches 8 --ports 16 --l1i_size 64kB --topology TwoMeshXY -c /artifact_top/alloy-apps/build-applrts_sc3/run_sendrecv_pad -o "-w 0 -r 1 -n 2 -c 8 -f 524288 -s 8 -p 7" --vcs-per-vnet 64 --buffers-per-data-vc 65536 --buffers-per-ctrl-vc 1024 > logs/log33.txt &
-nohup /artifact_top/alloy-gem5/build/RISCV_WT_MESI_64B/gem5.opt --stats-file=stats34.txt --debug-flags=DOMEM,DOACC --listener-mode=off /artifact_top/alloy-gem5/configs/brg/sc3.py --cpu-type TimingSimpleCPU --link-latency 20 --CG_link_latency 50 --garnet-deadlock-threshold 100000 --l2_size 16384kB --l2_assoc 8 --num-dirs 8 --brg-fast-forward --num-cpus 64 --network garnet2.0 --buffer-size 0 --mem-size 4GB --ruby --l1d_size 64kB --mem-type SimpleMemory --num-l1-cache-ports 8 --num-l2caches 8 --ports 16 --l1i_size 64kB --topology TwoMeshXY -c /artifact_top/alloy-apps/build-applrts_sc3/run_sendrecv_pad -o "-w 0 -r 1 -n 2 -c 8 -f 524288 -s 8 -p 7" --vcs-per-vnet 64 --buffers-per-data-vc 65536 --buffers-per-ctrl-vc 1024 > logs/log34.txt &
-nohup /artifact_top/alloy-gem5/build/RISCV_MP_64B/gem5.opt --stats-file=stats35.txt --debug-flags=DOMEM,DOACC --listener-mode=off /artifact_top/alloy-gem5/configs/brg/sc3.py --cpu-type TimingSimpleCPU --link-latency 20 --CG_link_latency 150 --garnet-deadlock-threshold 100000 --l2_size 16384kB --l2_assoc 8 --num-dirs 8 --brg-fast-forward --num-cpus 64 --network garnet2.0 --buffer-size 0 --mem-size 4GB --ruby --l1d_size 64kB --mem-type SimpleMemory --num-l1-cache-ports 8 --num-l2caches 8 --ports 16 --l1i_size 64kB --topology TwoMeshXY -c /artifact_top/alloy-apps/build-applrts_sc3/run_sendrecv_pad -o "-w 0 -r 1 -n 2 -c 8 -f 524288 -s 8 -p 7" --vcs-per-vnet 64 --buffers-per-data-vc 65536 --buffers-per-ctrl-vc 1024 > logs/log35.txt &
-nohup /artifact_top/alloy-gem5/build/RISCV_MP_64B/gem5.opt --stats-file=stats36.txt --debug-flags=DOMEM,DOACC --listener-mode=off /artifact_top/alloy-gem5/configs/brg/sc3.py --cpu-type TimingSimpleCPU --link-latency 20 --CG_link_latency 50 --garnet-deadlock-threshold 100000 --l2_size 16384kB --l2_assoc 8 --num-dirs 8 --brg-fast-forward --num-cpus 64 --network garnet2.0 --buffer-size 0 --mem-size 4GB --ruby --l1d_size 64kB --mem-type SimpleMemory --num-l1-cache-ports 8 --num-l2caches 8 --ports 16 --l1i_size 64kB --topology TwoMeshXY -c /artifact_top/alloy-apps/build-applrts_sc3/run_sendrecv_pad -o "-w 0 -r 1 -n 2 -c 8 -f 524288 -s 8 -p 7" --vcs-per-vnet 64 --buffers-per-data-vc 65536 --buffers-per-ctrl-vc 1024 > logs/log36.txt &
+nohup /artifact_top/alloy-gem5/build/RISCV_DO_MESI/gem5.opt --stats-file=stats31.txt --debug-flags=DOMEM,DOACC --listener-mode=off /artifact_top/alloy-gem5/configs/brg/sc3.py --msg-size PUT_NT:64 --cpu-type TimingSimpleCPU --link-latency 20 --CG_link_latency 150 --garnet-deadlock-threshold 100000 --l2_size 16384kB --l2_assoc 8 --num-dirs 8 --brg-fast-forward --num-cpus 64 --network garnet2.0 --buffer-size 0 --mem-size 4GB --ruby --l1d_size 64kB --mem-type SimpleMemory --num-l1-cache-ports 8 --num-l2caches 8 --ports 16 --l1i_size 64kB --topology TwoMeshXY -c /artifact_top/alloy-apps/build-applrts_sc3/run_sendrecv_pad -o "-w 0 -r 1 -n 2 -c 8 -f 524288 -s 8 -p 7" --vcs-per-vnet 64 --buffers-per-data-vc 65536 --buffers-per-ctrl-vc 1024 > logs/log31.txt &
+nohup /artifact_top/alloy-gem5/build/RISCV_DO_MESI/gem5.opt --stats-file=stats32.txt --debug-flags=DOMEM,DOACC --listener-mode=off /artifact_top/alloy-gem5/configs/brg/sc3.py --msg-size PUT_NT:64 --cpu-type TimingSimpleCPU --link-latency 20 --CG_link_latency 50 --garnet-deadlock-threshold 100000 --l2_size 16384kB --l2_assoc 8 --num-dirs 8 --brg-fast-forward --num-cpus 64 --network garnet2.0 --buffer-size 0 --mem-size 4GB --ruby --l1d_size 64kB --mem-type SimpleMemory --num-l1-cache-ports 8 --num-l2caches 8 --ports 16 --l1i_size 64kB --topology TwoMeshXY -c /artifact_top/alloy-apps/build-applrts_sc3/run_sendrecv_pad -o "-w 0 -r 1 -n 2 -c 8 -f 524288 -s 8 -p 7" --vcs-per-vnet 64 --buffers-per-data-vc 65536 --buffers-per-ctrl-vc 1024 > logs/log32.txt &
+nohup /artifact_top/alloy-gem5/build/RISCV_WT_MESI/gem5.opt --stats-file=stats33.txt --debug-flags=DOMEM,DOACC --listener-mode=off /artifact_top/alloy-gem5/configs/brg/sc3.py --msg-size PUT_NT:64 --cpu-type TimingSimpleCPU --link-latency 20 --CG_link_latency 150 --garnet-deadlock-threshold 100000 --l2_size 16384kB --l2_assoc 8 --num-dirs 8 --brg-fast-forward --num-cpus 64 --network garnet2.0 --buffer-size 0 --mem-size 4GB --ruby --l1d_size 64kB --mem-type SimpleMemory --num-l1-cache-ports 8 --num-l2caches 8 --ports 16 --l1i_size 64kB --topology TwoMeshXY -c /artifact_top/alloy-apps/build-applrts_sc3/run_sendrecv_pad -o "-w 0 -r 1 -n 2 -c 8 -f 524288 -s 8 -p 7" --vcs-per-vnet 64 --buffers-per-data-vc 65536 --buffers-per-ctrl-vc 1024 > logs/log33.txt &
+nohup /artifact_top/alloy-gem5/build/RISCV_WT_MESI/gem5.opt --stats-file=stats34.txt --debug-flags=DOMEM,DOACC --listener-mode=off /artifact_top/alloy-gem5/configs/brg/sc3.py --msg-size PUT_NT:64 --cpu-type TimingSimpleCPU --link-latency 20 --CG_link_latency 50 --garnet-deadlock-threshold 100000 --l2_size 16384kB --l2_assoc 8 --num-dirs 8 --brg-fast-forward --num-cpus 64 --network garnet2.0 --buffer-size 0 --mem-size 4GB --ruby --l1d_size 64kB --mem-type SimpleMemory --num-l1-cache-ports 8 --num-l2caches 8 --ports 16 --l1i_size 64kB --topology TwoMeshXY -c /artifact_top/alloy-apps/build-applrts_sc3/run_sendrecv_pad -o "-w 0 -r 1 -n 2 -c 8 -f 524288 -s 8 -p 7" --vcs-per-vnet 64 --buffers-per-data-vc 65536 --buffers-per-ctrl-vc 1024 > logs/log34.txt &
+nohup /artifact_top/alloy-gem5/build/RISCV_MP/gem5.opt --stats-file=stats35.txt --debug-flags=DOMEM,DOACC --listener-mode=off /artifact_top/alloy-gem5/configs/brg/sc3.py --msg-size PUT_NT:64 --cpu-type TimingSimpleCPU --link-latency 20 --CG_link_latency 150 --garnet-deadlock-threshold 100000 --l2_size 16384kB --l2_assoc 8 --num-dirs 8 --brg-fast-forward --num-cpus 64 --network garnet2.0 --buffer-size 0 --mem-size 4GB --ruby --l1d_size 64kB --mem-type SimpleMemory --num-l1-cache-ports 8 --num-l2caches 8 --ports 16 --l1i_size 64kB --topology TwoMeshXY -c /artifact_top/alloy-apps/build-applrts_sc3/run_sendrecv_pad -o "-w 0 -r 1 -n 2 -c 8 -f 524288 -s 8 -p 7" --vcs-per-vnet 64 --buffers-per-data-vc 65536 --buffers-per-ctrl-vc 1024 > logs/log35.txt &
+nohup /artifact_top/alloy-gem5/build/RISCV_MP/gem5.opt --stats-file=stats36.txt --debug-flags=DOMEM,DOACC --listener-mode=off /artifact_top/alloy-gem5/configs/brg/sc3.py --msg-size PUT_NT:64 --cpu-type TimingSimpleCPU --link-latency 20 --CG_link_latency 50 --garnet-deadlock-threshold 100000 --l2_size 16384kB --l2_assoc 8 --num-dirs 8 --brg-fast-forward --num-cpus 64 --network garnet2.0 --buffer-size 0 --mem-size 4GB --ruby --l1d_size 64kB --mem-type SimpleMemory --num-l1-cache-ports 8 --num-l2caches 8 --ports 16 --l1i_size 64kB --topology TwoMeshXY -c /artifact_top/alloy-apps/build-applrts_sc3/run_sendrecv_pad -o "-w 0 -r 1 -n 2 -c 8 -f 524288 -s 8 -p 7" --vcs-per-vnet 64 --buffers-per-data-vc 65536 --buffers-per-ctrl-vc 1024 > logs/log36.txt &
 #comm fannout, store granularity=64B, synchronization granularity=4KB
 # sendrecv -n 2
-nohup /artifact_top/alloy-gem5/build/RISCV_DO_MESI_64B/gem5.opt --stats-file=stats37.txt --debug-flags=DOMEM,DOACC --listener-mode=off /artifact_top/alloy-gem5/configs/brg/sc3.py --cpu-type TimingSimpleCPU --link-latency 20 --CG_link_latency 150 --garnet-deadlock-threshold 100000 --l2_size 16384kB --l2_assoc 8 --num-dirs 8 --brg-fast-forward --num-cpus 64 --network garnet2.0 --buffer-size 0 --mem-size 4GB --ruby --l1d_size 64kB --mem-type SimpleMemory --num-l1-cache-ports 8 --num-l2caches 8 --ports 16 --l1i_size 64kB --topology TwoMeshXY -c /artifact_top/alloy-apps/build-applrts_sc3/run_sendrecv_pad -o "-w 0 -r 1 -n 2 -c 8 -f 1024 -s 8 -p 21" --vcs-per-vnet 64 --buffers-per-data-vc 65536 --buffers-per-ctrl-vc 1024 > logs/log37.txt &
-nohup /artifact_top/alloy-gem5/build/RISCV_DO_MESI_64B/gem5.opt --stats-file=stats38.txt --debug-flags=DOMEM,DOACC --listener-mode=off /artifact_top/alloy-gem5/configs/brg/sc3.py --cpu-type TimingSimpleCPU --link-latency 20 --CG_link_latency 50 --garnet-deadlock-threshold 100000 --l2_size 16384kB --l2_assoc 8 --num-dirs 8 --brg-fast-forward --num-cpus 64 --network garnet2.0 --buffer-size 0 --mem-size 4GB --ruby --l1d_size 64kB --mem-type SimpleMemory --num-l1-cache-ports 8 --num-l2caches 8 --ports 16 --l1i_size 64kB --topology TwoMeshXY -c /artifact_top/alloy-apps/build-applrts_sc3/run_sendrecv_pad -o "-w 0 -r 1 -n 2 -c 8 -f 1024 -s 8 -p 21" --vcs-per-vnet 64 --buffers-per-data-vc 65536 --buffers-per-ctrl-vc 1024 > logs/log38.txt &
-nohup /artifact_top/alloy-gem5/build/RISCV_WT_MESI_64B/gem5.opt --stats-file=stats39.txt --debug-flags=DOMEM,DOACC --listener-mode=off /artifact_top/alloy-gem5/configs/brg/sc3.py --cpu-type TimingSimpleCPU --link-latency 20 --CG_link_latency 150 --garnet-deadlock-threshold 100000 --l2_size 16384kB --l2_assoc 8 --num-dirs 8 --brg-fast-forward --num-cpus 64 --network garnet2.0 --buffer-size 0 --mem-size 4GB --ruby --l1d_size 64kB --mem-type SimpleMemory --num-l1-cache-ports 8 --num-l2caches 8 --ports 16 --l1i_size 64kB --topology TwoMeshXY -c /artifact_top/alloy-apps/build-applrts_sc3/run_sendrecv_pad -o "-w 0 -r 1 -n 2 -c 8 -f 1024 -s 8 -p 21" --vcs-per-vnet 64 --buffers-per-data-vc 65536 --buffers-per-ctrl-vc 1024 > logs/log39.txt &
-nohup /artifact_top/alloy-gem5/build/RISCV_WT_MESI_64B/gem5.opt --stats-file=stats40.txt --debug-flags=DOMEM,DOACC --listener-mode=off /artifact_top/alloy-gem5/configs/brg/sc3.py --cpu-type TimingSimpleCPU --link-latency 20 --CG_link_latency 50 --garnet-deadlock-threshold 100000 --l2_size 16384kB --l2_assoc 8 --num-dirs 8 --brg-fast-forward --num-cpus 64 --network garnet2.0 --buffer-size 0 --mem-size 4GB --ruby --l1d_size 64kB --mem-type SimpleMemory --num-l1-cache-ports 8 --num-l2caches 8 --ports 16 --l1i_size 64kB --topology TwoMeshXY -c /artifact_top/alloy-apps/build-applrts_sc3/run_sendrecv_pad -o "-w 0 -r 1 -n 2 -c 8 -f 1024 -s 8 -p 21" --vcs-per-vnet 64 --buffers-per-data-vc 65536 --buffers-per-ctrl-vc 1024 > logs/log40.txt &
-nohup /artifact_top/alloy-gem5/build/RISCV_MP_64B/gem5.opt --stats-file=stats41.txt --debug-flags=DOMEM,DOACC --listener-mode=off /artifact_top/alloy-gem5/configs/brg/sc3.py --cpu-type TimingSimpleCPU --link-latency 20 --CG_link_latency 150 --garnet-deadlock-threshold 100000 --l2_size 16384kB --l2_assoc 8 --num-dirs 8 --brg-fast-forward --num-cpus 64 --network garnet2.0 --buffer-size 0 --mem-size 4GB --ruby --l1d_size 64kB --mem-type SimpleMemory --num-l1-cache-ports 8 --num-l2caches 8 --ports 16 --l1i_size 64kB --topology TwoMeshXY -c /artifact_top/alloy-apps/build-applrts_sc3/run_sendrecv_pad -o "-w 0 -r 1 -n 2 -c 8 -f 1024 -s 8 -p 21" --vcs-per-vnet 64 --buffers-per-data-vc 65536 --buffers-per-ctrl-vc 1024 > logs/log41.txt &
-nohup /artifact_top/alloy-gem5/build/RISCV_MP_64B/gem5.opt --stats-file=stats42.txt --debug-flags=DOMEM,DOACC --listener-mode=off /artifact_top/alloy-gem5/configs/brg/sc3.py --cpu-type TimingSimpleCPU --link-latency 20 --CG_link_latency 50 --garnet-deadlock-threshold 100000 --l2_size 16384kB --l2_assoc 8 --num-dirs 8 --brg-fast-forward --num-cpus 64 --network garnet2.0 --buffer-size 0 --mem-size 4GB --ruby --l1d_size 64kB --mem-type SimpleMemory --num-l1-cache-ports 8 --num-l2caches 8 --ports 16 --l1i_size 64kB --topology TwoMeshXY -c /artifact_top/alloy-apps/build-applrts_sc3/run_sendrecv_pad -o "-w 0 -r 1 -n 2 -c 8 -f 1024 -s 8 -p 21" --vcs-per-vnet 64 --buffers-per-data-vc 65536 --buffers-per-ctrl-vc 1024 > logs/log42.txt &
+nohup /artifact_top/alloy-gem5/build/RISCV_DO_MESI/gem5.opt --stats-file=stats37.txt --debug-flags=DOMEM,DOACC --listener-mode=off /artifact_top/alloy-gem5/configs/brg/sc3.py --msg-size PUT_NT:64 --cpu-type TimingSimpleCPU --link-latency 20 --CG_link_latency 150 --garnet-deadlock-threshold 100000 --l2_size 16384kB --l2_assoc 8 --num-dirs 8 --brg-fast-forward --num-cpus 64 --network garnet2.0 --buffer-size 0 --mem-size 4GB --ruby --l1d_size 64kB --mem-type SimpleMemory --num-l1-cache-ports 8 --num-l2caches 8 --ports 16 --l1i_size 64kB --topology TwoMeshXY -c /artifact_top/alloy-apps/build-applrts_sc3/run_sendrecv_pad -o "-w 0 -r 1 -n 2 -c 8 -f 1024 -s 8 -p 21" --vcs-per-vnet 64 --buffers-per-data-vc 65536 --buffers-per-ctrl-vc 1024 > logs/log37.txt &
+nohup /artifact_top/alloy-gem5/build/RISCV_DO_MESI/gem5.opt --stats-file=stats38.txt --debug-flags=DOMEM,DOACC --listener-mode=off /artifact_top/alloy-gem5/configs/brg/sc3.py --msg-size PUT_NT:64 --cpu-type TimingSimpleCPU --link-latency 20 --CG_link_latency 50 --garnet-deadlock-threshold 100000 --l2_size 16384kB --l2_assoc 8 --num-dirs 8 --brg-fast-forward --num-cpus 64 --network garnet2.0 --buffer-size 0 --mem-size 4GB --ruby --l1d_size 64kB --mem-type SimpleMemory --num-l1-cache-ports 8 --num-l2caches 8 --ports 16 --l1i_size 64kB --topology TwoMeshXY -c /artifact_top/alloy-apps/build-applrts_sc3/run_sendrecv_pad -o "-w 0 -r 1 -n 2 -c 8 -f 1024 -s 8 -p 21" --vcs-per-vnet 64 --buffers-per-data-vc 65536 --buffers-per-ctrl-vc 1024 > logs/log38.txt &
+nohup /artifact_top/alloy-gem5/build/RISCV_WT_MESI/gem5.opt --stats-file=stats39.txt --debug-flags=DOMEM,DOACC --listener-mode=off /artifact_top/alloy-gem5/configs/brg/sc3.py --msg-size PUT_NT:64 --cpu-type TimingSimpleCPU --link-latency 20 --CG_link_latency 150 --garnet-deadlock-threshold 100000 --l2_size 16384kB --l2_assoc 8 --num-dirs 8 --brg-fast-forward --num-cpus 64 --network garnet2.0 --buffer-size 0 --mem-size 4GB --ruby --l1d_size 64kB --mem-type SimpleMemory --num-l1-cache-ports 8 --num-l2caches 8 --ports 16 --l1i_size 64kB --topology TwoMeshXY -c /artifact_top/alloy-apps/build-applrts_sc3/run_sendrecv_pad -o "-w 0 -r 1 -n 2 -c 8 -f 1024 -s 8 -p 21" --vcs-per-vnet 64 --buffers-per-data-vc 65536 --buffers-per-ctrl-vc 1024 > logs/log39.txt &
+nohup /artifact_top/alloy-gem5/build/RISCV_WT_MESI/gem5.opt --stats-file=stats40.txt --debug-flags=DOMEM,DOACC --listener-mode=off /artifact_top/alloy-gem5/configs/brg/sc3.py --msg-size PUT_NT:64 --cpu-type TimingSimpleCPU --link-latency 20 --CG_link_latency 50 --garnet-deadlock-threshold 100000 --l2_size 16384kB --l2_assoc 8 --num-dirs 8 --brg-fast-forward --num-cpus 64 --network garnet2.0 --buffer-size 0 --mem-size 4GB --ruby --l1d_size 64kB --mem-type SimpleMemory --num-l1-cache-ports 8 --num-l2caches 8 --ports 16 --l1i_size 64kB --topology TwoMeshXY -c /artifact_top/alloy-apps/build-applrts_sc3/run_sendrecv_pad -o "-w 0 -r 1 -n 2 -c 8 -f 1024 -s 8 -p 21" --vcs-per-vnet 64 --buffers-per-data-vc 65536 --buffers-per-ctrl-vc 1024 > logs/log40.txt &
+nohup /artifact_top/alloy-gem5/build/RISCV_MP/gem5.opt --stats-file=stats41.txt --debug-flags=DOMEM,DOACC --listener-mode=off /artifact_top/alloy-gem5/configs/brg/sc3.py --msg-size PUT_NT:64 --cpu-type TimingSimpleCPU --link-latency 20 --CG_link_latency 150 --garnet-deadlock-threshold 100000 --l2_size 16384kB --l2_assoc 8 --num-dirs 8 --brg-fast-forward --num-cpus 64 --network garnet2.0 --buffer-size 0 --mem-size 4GB --ruby --l1d_size 64kB --mem-type SimpleMemory --num-l1-cache-ports 8 --num-l2caches 8 --ports 16 --l1i_size 64kB --topology TwoMeshXY -c /artifact_top/alloy-apps/build-applrts_sc3/run_sendrecv_pad -o "-w 0 -r 1 -n 2 -c 8 -f 1024 -s 8 -p 21" --vcs-per-vnet 64 --buffers-per-data-vc 65536 --buffers-per-ctrl-vc 1024 > logs/log41.txt &
+nohup /artifact_top/alloy-gem5/build/RISCV_MP/gem5.opt --stats-file=stats42.txt --debug-flags=DOMEM,DOACC --listener-mode=off /artifact_top/alloy-gem5/configs/brg/sc3.py --msg-size PUT_NT:64 --cpu-type TimingSimpleCPU --link-latency 20 --CG_link_latency 50 --garnet-deadlock-threshold 100000 --l2_size 16384kB --l2_assoc 8 --num-dirs 8 --brg-fast-forward --num-cpus 64 --network garnet2.0 --buffer-size 0 --mem-size 4GB --ruby --l1d_size 64kB --mem-type SimpleMemory --num-l1-cache-ports 8 --num-l2caches 8 --ports 16 --l1i_size 64kB --topology TwoMeshXY -c /artifact_top/alloy-apps/build-applrts_sc3/run_sendrecv_pad -o "-w 0 -r 1 -n 2 -c 8 -f 1024 -s 8 -p 21" --vcs-per-vnet 64 --buffers-per-data-vc 65536 --buffers-per-ctrl-vc 1024 > logs/log42.txt &
 # sendrecv -n 4
-nohup /artifact_top/alloy-gem5/build/RISCV_DO_MESI_64B/gem5.opt --stats-file=stats43.txt --debug-flags=DOMEM,DOACC --listener-mode=off /artifact_top/alloy-gem5/configs/brg/sc3.py --cpu-type TimingSimpleCPU --link-latency 20 --CG_link_latency 150 --garnet-deadlock-threshold 100000 --l2_size 16384kB --l2_assoc 8 --num-dirs 8 --brg-fast-forward --num-cpus 64 --network garnet2.0 --buffer-size 0 --mem-size 4GB --ruby --l1d_size 64kB --mem-type SimpleMemory --num-l1-cache-ports 8 --num-l2caches 8 --ports 16 --l1i_size 64kB --topology TwoMeshXY -c /artifact_top/alloy-apps/build-applrts_sc3/run_sendrecv_pad -o "-w 0 -r 1 -n 4 -c 8 -f 1024 -s 8 -p 21" --vcs-per-vnet 64 --buffers-per-data-vc 65536 --buffers-per-ctrl-vc 1024 > logs/log43.txt &
-nohup /artifact_top/alloy-gem5/build/RISCV_DO_MESI_64B/gem5.opt --stats-file=stats44.txt --debug-flags=DOMEM,DOACC --listener-mode=off /artifact_top/alloy-gem5/configs/brg/sc3.py --cpu-type TimingSimpleCPU --link-latency 20 --CG_link_latency 50 --garnet-deadlock-threshold 100000 --l2_size 16384kB --l2_assoc 8 --num-dirs 8 --brg-fast-forward --num-cpus 64 --network garnet2.0 --buffer-size 0 --mem-size 4GB --ruby --l1d_size 64kB --mem-type SimpleMemory --num-l1-cache-ports 8 --num-l2caches 8 --ports 16 --l1i_size 64kB --topology TwoMeshXY -c /artifact_top/alloy-apps/build-applrts_sc3/run_sendrecv_pad -o "-w 0 -r 1 -n 4 -c 8 -f 1024 -s 8 -p 21" --vcs-per-vnet 64 --buffers-per-data-vc 65536 --buffers-per-ctrl-vc 1024 > logs/log44.txt &
-nohup /artifact_top/alloy-gem5/build/RISCV_WT_MESI_64B/gem5.opt --stats-file=stats45.txt --debug-flags=DOMEM,DOACC --listener-mode=off /artifact_top/alloy-gem5/configs/brg/sc3.py --cpu-type TimingSimpleCPU --link-latency 20 --CG_link_latency 150 --garnet-deadlock-threshold 100000 --l2_size 16384kB --l2_assoc 8 --num-dirs 8 --brg-fast-forward --num-cpus 64 --network garnet2.0 --buffer-size 0 --mem-size 4GB --ruby --l1d_size 64kB --mem-type SimpleMemory --num-l1-cache-ports 8 --num-l2caches 8 --ports 16 --l1i_size 64kB --topology TwoMeshXY -c /artifact_top/alloy-apps/build-applrts_sc3/run_sendrecv_pad -o "-w 0 -r 1 -n 4 -c 8 -f 1024 -s 8 -p 21" --vcs-per-vnet 64 --buffers-per-data-vc 65536 --buffers-per-ctrl-vc 1024 > logs/log45.txt &
-nohup /artifact_top/alloy-gem5/build/RISCV_WT_MESI_64B/gem5.opt --stats-file=stats46.txt --debug-flags=DOMEM,DOACC --listener-mode=off /artifact_top/alloy-gem5/configs/brg/sc3.py --cpu-type TimingSimpleCPU --link-latency 20 --CG_link_latency 50 --garnet-deadlock-threshold 100000 --l2_size 16384kB --l2_assoc 8 --num-dirs 8 --brg-fast-forward --num-cpus 64 --network garnet2.0 --buffer-size 0 --mem-size 4GB --ruby --l1d_size 64kB --mem-type SimpleMemory --num-l1-cache-ports 8 --num-l2caches 8 --ports 16 --l1i_size 64kB --topology TwoMeshXY -c /artifact_top/alloy-apps/build-applrts_sc3/run_sendrecv_pad -o "-w 0 -r 1 -n 4 -c 8 -f 1024 -s 8 -p 21" --vcs-per-vnet 64 --buffers-per-data-vc 65536 --buffers-per-ctrl-vc 1024 > logs/log46.txt &
-nohup /artifact_top/alloy-gem5/build/RISCV_MP_64B/gem5.opt --stats-file=stats47.txt --debug-flags=DOMEM,DOACC --listener-mode=off /artifact_top/alloy-gem5/configs/brg/sc3.py --cpu-type TimingSimpleCPU --link-latency 20 --CG_link_latency 150 --garnet-deadlock-threshold 100000 --l2_size 16384kB --l2_assoc 8 --num-dirs 8 --brg-fast-forward --num-cpus 64 --network garnet2.0 --buffer-size 0 --mem-size 4GB --ruby --l1d_size 64kB --mem-type SimpleMemory --num-l1-cache-ports 8 --num-l2caches 8 --ports 16 --l1i_size 64kB --topology TwoMeshXY -c /artifact_top/alloy-apps/build-applrts_sc3/run_sendrecv_pad -o "-w 0 -r 1 -n 4 -c 8 -f 1024 -s 8 -p 21" --vcs-per-vnet 64 --buffers-per-data-vc 65536 --buffers-per-ctrl-vc 1024 > logs/log47.txt &
-nohup /artifact_top/alloy-gem5/build/RISCV_MP_64B/gem5.opt --stats-file=stats48.txt --debug-flags=DOMEM,DOACC --listener-mode=off /artifact_top/alloy-gem5/configs/brg/sc3.py --cpu-type TimingSimpleCPU --link-latency 20 --CG_link_latency 50 --garnet-deadlock-threshold 100000 --l2_size 16384kB --l2_assoc 8 --num-dirs 8 --brg-fast-forward --num-cpus 64 --network garnet2.0 --buffer-size 0 --mem-size 4GB --ruby --l1d_size 64kB --mem-type SimpleMemory --num-l1-cache-ports 8 --num-l2caches 8 --ports 16 --l1i_size 64kB --topology TwoMeshXY -c /artifact_top/alloy-apps/build-applrts_sc3/run_sendrecv_pad -o "-w 0 -r 1 -n 4 -c 8 -f 1024 -s 8 -p 21" --vcs-per-vnet 64 --buffers-per-data-vc 65536 --buffers-per-ctrl-vc 1024 > logs/log48.txt &
+nohup /artifact_top/alloy-gem5/build/RISCV_DO_MESI/gem5.opt --stats-file=stats43.txt --debug-flags=DOMEM,DOACC --listener-mode=off /artifact_top/alloy-gem5/configs/brg/sc3.py --msg-size PUT_NT:64 --cpu-type TimingSimpleCPU --link-latency 20 --CG_link_latency 150 --garnet-deadlock-threshold 100000 --l2_size 16384kB --l2_assoc 8 --num-dirs 8 --brg-fast-forward --num-cpus 64 --network garnet2.0 --buffer-size 0 --mem-size 4GB --ruby --l1d_size 64kB --mem-type SimpleMemory --num-l1-cache-ports 8 --num-l2caches 8 --ports 16 --l1i_size 64kB --topology TwoMeshXY -c /artifact_top/alloy-apps/build-applrts_sc3/run_sendrecv_pad -o "-w 0 -r 1 -n 4 -c 8 -f 1024 -s 8 -p 21" --vcs-per-vnet 64 --buffers-per-data-vc 65536 --buffers-per-ctrl-vc 1024 > logs/log43.txt &
+nohup /artifact_top/alloy-gem5/build/RISCV_DO_MESI/gem5.opt --stats-file=stats44.txt --debug-flags=DOMEM,DOACC --listener-mode=off /artifact_top/alloy-gem5/configs/brg/sc3.py --msg-size PUT_NT:64 --cpu-type TimingSimpleCPU --link-latency 20 --CG_link_latency 50 --garnet-deadlock-threshold 100000 --l2_size 16384kB --l2_assoc 8 --num-dirs 8 --brg-fast-forward --num-cpus 64 --network garnet2.0 --buffer-size 0 --mem-size 4GB --ruby --l1d_size 64kB --mem-type SimpleMemory --num-l1-cache-ports 8 --num-l2caches 8 --ports 16 --l1i_size 64kB --topology TwoMeshXY -c /artifact_top/alloy-apps/build-applrts_sc3/run_sendrecv_pad -o "-w 0 -r 1 -n 4 -c 8 -f 1024 -s 8 -p 21" --vcs-per-vnet 64 --buffers-per-data-vc 65536 --buffers-per-ctrl-vc 1024 > logs/log44.txt &
+nohup /artifact_top/alloy-gem5/build/RISCV_WT_MESI/gem5.opt --stats-file=stats45.txt --debug-flags=DOMEM,DOACC --listener-mode=off /artifact_top/alloy-gem5/configs/brg/sc3.py --msg-size PUT_NT:64 --cpu-type TimingSimpleCPU --link-latency 20 --CG_link_latency 150 --garnet-deadlock-threshold 100000 --l2_size 16384kB --l2_assoc 8 --num-dirs 8 --brg-fast-forward --num-cpus 64 --network garnet2.0 --buffer-size 0 --mem-size 4GB --ruby --l1d_size 64kB --mem-type SimpleMemory --num-l1-cache-ports 8 --num-l2caches 8 --ports 16 --l1i_size 64kB --topology TwoMeshXY -c /artifact_top/alloy-apps/build-applrts_sc3/run_sendrecv_pad -o "-w 0 -r 1 -n 4 -c 8 -f 1024 -s 8 -p 21" --vcs-per-vnet 64 --buffers-per-data-vc 65536 --buffers-per-ctrl-vc 1024 > logs/log45.txt &
+nohup /artifact_top/alloy-gem5/build/RISCV_WT_MESI/gem5.opt --stats-file=stats46.txt --debug-flags=DOMEM,DOACC --listener-mode=off /artifact_top/alloy-gem5/configs/brg/sc3.py --msg-size PUT_NT:64 --cpu-type TimingSimpleCPU --link-latency 20 --CG_link_latency 50 --garnet-deadlock-threshold 100000 --l2_size 16384kB --l2_assoc 8 --num-dirs 8 --brg-fast-forward --num-cpus 64 --network garnet2.0 --buffer-size 0 --mem-size 4GB --ruby --l1d_size 64kB --mem-type SimpleMemory --num-l1-cache-ports 8 --num-l2caches 8 --ports 16 --l1i_size 64kB --topology TwoMeshXY -c /artifact_top/alloy-apps/build-applrts_sc3/run_sendrecv_pad -o "-w 0 -r 1 -n 4 -c 8 -f 1024 -s 8 -p 21" --vcs-per-vnet 64 --buffers-per-data-vc 65536 --buffers-per-ctrl-vc 1024 > logs/log46.txt &
+nohup /artifact_top/alloy-gem5/build/RISCV_MP/gem5.opt --stats-file=stats47.txt --debug-flags=DOMEM,DOACC --listener-mode=off /artifact_top/alloy-gem5/configs/brg/sc3.py --msg-size PUT_NT:64 --cpu-type TimingSimpleCPU --link-latency 20 --CG_link_latency 150 --garnet-deadlock-threshold 100000 --l2_size 16384kB --l2_assoc 8 --num-dirs 8 --brg-fast-forward --num-cpus 64 --network garnet2.0 --buffer-size 0 --mem-size 4GB --ruby --l1d_size 64kB --mem-type SimpleMemory --num-l1-cache-ports 8 --num-l2caches 8 --ports 16 --l1i_size 64kB --topology TwoMeshXY -c /artifact_top/alloy-apps/build-applrts_sc3/run_sendrecv_pad -o "-w 0 -r 1 -n 4 -c 8 -f 1024 -s 8 -p 21" --vcs-per-vnet 64 --buffers-per-data-vc 65536 --buffers-per-ctrl-vc 1024 > logs/log47.txt &
+nohup /artifact_top/alloy-gem5/build/RISCV_MP/gem5.opt --stats-file=stats48.txt --debug-flags=DOMEM,DOACC --listener-mode=off /artifact_top/alloy-gem5/configs/brg/sc3.py --msg-size PUT_NT:64 --cpu-type TimingSimpleCPU --link-latency 20 --CG_link_latency 50 --garnet-deadlock-threshold 100000 --l2_size 16384kB --l2_assoc 8 --num-dirs 8 --brg-fast-forward --num-cpus 64 --network garnet2.0 --buffer-size 0 --mem-size 4GB --ruby --l1d_size 64kB --mem-type SimpleMemory --num-l1-cache-ports 8 --num-l2caches 8 --ports 16 --l1i_size 64kB --topology TwoMeshXY -c /artifact_top/alloy-apps/build-applrts_sc3/run_sendrecv_pad -o "-w 0 -r 1 -n 4 -c 8 -f 1024 -s 8 -p 21" --vcs-per-vnet 64 --buffers-per-data-vc 65536 --buffers-per-ctrl-vc 1024 > logs/log48.txt &
 # sendrecv -n 8
-nohup /artifact_top/alloy-gem5/build/RISCV_DO_MESI_64B/gem5.opt --stats-file=stats49.txt --debug-flags=DOMEM,DOACC --listener-mode=off /artifact_top/alloy-gem5/configs/brg/sc3.py --cpu-type TimingSimpleCPU --link-latency 20 --CG_link_latency 150 --garnet-deadlock-threshold 100000 --l2_size 16384kB --l2_assoc 8 --num-dirs 8 --brg-fast-forward --num-cpus 64 --network garnet2.0 --buffer-size 0 --mem-size 4GB --ruby --l1d_size 64kB --mem-type SimpleMemory --num-l1-cache-ports 8 --num-l2caches 8 --ports 16 --l1i_size 64kB --topology TwoMeshXY -c /artifact_top/alloy-apps/build-applrts_sc3/run_sendrecv_pad -o "-w 0 -r 1 -n 8 -c 8 -f 1024 -s 8 -p 21" --vcs-per-vnet 64 --buffers-per-data-vc 65536 --buffers-per-ctrl-vc 1024 > logs/log49.txt &
-nohup /artifact_top/alloy-gem5/build/RISCV_DO_MESI_64B/gem5.opt --stats-file=stats50.txt --debug-flags=DOMEM,DOACC --listener-mode=off /artifact_top/alloy-gem5/configs/brg/sc3.py --cpu-type TimingSimpleCPU --link-latency 20 --CG_link_latency 50 --garnet-deadlock-threshold 100000 --l2_size 16384kB --l2_assoc 8 --num-dirs 8 --brg-fast-forward --num-cpus 64 --network garnet2.0 --buffer-size 0 --mem-size 4GB --ruby --l1d_size 64kB --mem-type SimpleMemory --num-l1-cache-ports 8 --num-l2caches 8 --ports 16 --l1i_size 64kB --topology TwoMeshXY -c /artifact_top/alloy-apps/build-applrts_sc3/run_sendrecv_pad -o "-w 0 -r 1 -n 8 -c 8 -f 1024 -s 8 -p 21" --vcs-per-vnet 64 --buffers-per-data-vc 65536 --buffers-per-ctrl-vc 1024 > logs/log50.txt &
-nohup /artifact_top/alloy-gem5/build/RISCV_WT_MESI_64B/gem5.opt --stats-file=stats51.txt --debug-flags=DOMEM,DOACC --listener-mode=off /artifact_top/alloy-gem5/configs/brg/sc3.py --cpu-type TimingSimpleCPU --link-latency 20 --CG_link_latency 150 --garnet-deadlock-threshold 100000 --l2_size 16384kB --l2_assoc 8 --num-dirs 8 --brg-fast-forward --num-cpus 64 --network garnet2.0 --buffer-size 0 --mem-size 4GB --ruby --l1d_size 64kB --mem-type SimpleMemory --num-l1-cache-ports 8 --num-l2caches 8 --ports 16 --l1i_size 64kB --topology TwoMeshXY -c /artifact_top/alloy-apps/build-applrts_sc3/run_sendrecv_pad -o "-w 0 -r 1 -n 8 -c 8 -f 1024 -s 8 -p 21" --vcs-per-vnet 64 --buffers-per-data-vc 65536 --buffers-per-ctrl-vc 1024 > logs/log51.txt &
-nohup /artifact_top/alloy-gem5/build/RISCV_WT_MESI_64B/gem5.opt --stats-file=stats52.txt --debug-flags=DOMEM,DOACC --listener-mode=off /artifact_top/alloy-gem5/configs/brg/sc3.py --cpu-type TimingSimpleCPU --link-latency 20 --CG_link_latency 50 --garnet-deadlock-threshold 100000 --l2_size 16384kB --l2_assoc 8 --num-dirs 8 --brg-fast-forward --num-cpus 64 --network garnet2.0 --buffer-size 0 --mem-size 4GB --ruby --l1d_size 64kB --mem-type SimpleMemory --num-l1-cache-ports 8 --num-l2caches 8 --ports 16 --l1i_size 64kB --topology TwoMeshXY -c /artifact_top/alloy-apps/build-applrts_sc3/run_sendrecv_pad -o "-w 0 -r 1 -n 8 -c 8 -f 1024 -s 8 -p 21" --vcs-per-vnet 64 --buffers-per-data-vc 65536 --buffers-per-ctrl-vc 1024 > logs/log52.txt &
-nohup /artifact_top/alloy-gem5/build/RISCV_MP_64B/gem5.opt --stats-file=stats53.txt --debug-flags=DOMEM,DOACC --listener-mode=off /artifact_top/alloy-gem5/configs/brg/sc3.py --cpu-type TimingSimpleCPU --link-latency 20 --CG_link_latency 150 --garnet-deadlock-threshold 100000 --l2_size 16384kB --l2_assoc 8 --num-dirs 8 --brg-fast-forward --num-cpus 64 --network garnet2.0 --buffer-size 0 --mem-size 4GB --ruby --l1d_size 64kB --mem-type SimpleMemory --num-l1-cache-ports 8 --num-l2caches 8 --ports 16 --l1i_size 64kB --topology TwoMeshXY -c /artifact_top/alloy-apps/build-applrts_sc3/run_sendrecv_pad -o "-w 0 -r 1 -n 8 -c 8 -f 1024 -s 8 -p 21" --vcs-per-vnet 64 --buffers-per-data-vc 65536 --buffers-per-ctrl-vc 1024 > logs/log53.txt &
-nohup /artifact_top/alloy-gem5/build/RISCV_MP_64B/gem5.opt --stats-file=stats54.txt --debug-flags=DOMEM,DOACC --listener-mode=off /artifact_top/alloy-gem5/configs/brg/sc3.py --cpu-type TimingSimpleCPU --link-latency 20 --CG_link_latency 50 --garnet-deadlock-threshold 100000 --l2_size 16384kB --l2_assoc 8 --num-dirs 8 --brg-fast-forward --num-cpus 64 --network garnet2.0 --buffer-size 0 --mem-size 4GB --ruby --l1d_size 64kB --mem-type SimpleMemory --num-l1-cache-ports 8 --num-l2caches 8 --ports 16 --l1i_size 64kB --topology TwoMeshXY -c /artifact_top/alloy-apps/build-applrts_sc3/run_sendrecv_pad -o "-w 0 -r 1 -n 8 -c 8 -f 1024 -s 8 -p 21" --vcs-per-vnet 64 --buffers-per-data-vc 65536 --buffers-per-ctrl-vc 1024 > logs/log54.txt &
+nohup /artifact_top/alloy-gem5/build/RISCV_DO_MESI/gem5.opt --stats-file=stats49.txt --debug-flags=DOMEM,DOACC --listener-mode=off /artifact_top/alloy-gem5/configs/brg/sc3.py --msg-size PUT_NT:64 --cpu-type TimingSimpleCPU --link-latency 20 --CG_link_latency 150 --garnet-deadlock-threshold 100000 --l2_size 16384kB --l2_assoc 8 --num-dirs 8 --brg-fast-forward --num-cpus 64 --network garnet2.0 --buffer-size 0 --mem-size 4GB --ruby --l1d_size 64kB --mem-type SimpleMemory --num-l1-cache-ports 8 --num-l2caches 8 --ports 16 --l1i_size 64kB --topology TwoMeshXY -c /artifact_top/alloy-apps/build-applrts_sc3/run_sendrecv_pad -o "-w 0 -r 1 -n 8 -c 8 -f 1024 -s 8 -p 21" --vcs-per-vnet 64 --buffers-per-data-vc 65536 --buffers-per-ctrl-vc 1024 > logs/log49.txt &
+nohup /artifact_top/alloy-gem5/build/RISCV_DO_MESI/gem5.opt --stats-file=stats50.txt --debug-flags=DOMEM,DOACC --listener-mode=off /artifact_top/alloy-gem5/configs/brg/sc3.py --msg-size PUT_NT:64 --cpu-type TimingSimpleCPU --link-latency 20 --CG_link_latency 50 --garnet-deadlock-threshold 100000 --l2_size 16384kB --l2_assoc 8 --num-dirs 8 --brg-fast-forward --num-cpus 64 --network garnet2.0 --buffer-size 0 --mem-size 4GB --ruby --l1d_size 64kB --mem-type SimpleMemory --num-l1-cache-ports 8 --num-l2caches 8 --ports 16 --l1i_size 64kB --topology TwoMeshXY -c /artifact_top/alloy-apps/build-applrts_sc3/run_sendrecv_pad -o "-w 0 -r 1 -n 8 -c 8 -f 1024 -s 8 -p 21" --vcs-per-vnet 64 --buffers-per-data-vc 65536 --buffers-per-ctrl-vc 1024 > logs/log50.txt &
+nohup /artifact_top/alloy-gem5/build/RISCV_WT_MESI/gem5.opt --stats-file=stats51.txt --debug-flags=DOMEM,DOACC --listener-mode=off /artifact_top/alloy-gem5/configs/brg/sc3.py --msg-size PUT_NT:64 --cpu-type TimingSimpleCPU --link-latency 20 --CG_link_latency 150 --garnet-deadlock-threshold 100000 --l2_size 16384kB --l2_assoc 8 --num-dirs 8 --brg-fast-forward --num-cpus 64 --network garnet2.0 --buffer-size 0 --mem-size 4GB --ruby --l1d_size 64kB --mem-type SimpleMemory --num-l1-cache-ports 8 --num-l2caches 8 --ports 16 --l1i_size 64kB --topology TwoMeshXY -c /artifact_top/alloy-apps/build-applrts_sc3/run_sendrecv_pad -o "-w 0 -r 1 -n 8 -c 8 -f 1024 -s 8 -p 21" --vcs-per-vnet 64 --buffers-per-data-vc 65536 --buffers-per-ctrl-vc 1024 > logs/log51.txt &
+nohup /artifact_top/alloy-gem5/build/RISCV_WT_MESI/gem5.opt --stats-file=stats52.txt --debug-flags=DOMEM,DOACC --listener-mode=off /artifact_top/alloy-gem5/configs/brg/sc3.py --msg-size PUT_NT:64 --cpu-type TimingSimpleCPU --link-latency 20 --CG_link_latency 50 --garnet-deadlock-threshold 100000 --l2_size 16384kB --l2_assoc 8 --num-dirs 8 --brg-fast-forward --num-cpus 64 --network garnet2.0 --buffer-size 0 --mem-size 4GB --ruby --l1d_size 64kB --mem-type SimpleMemory --num-l1-cache-ports 8 --num-l2caches 8 --ports 16 --l1i_size 64kB --topology TwoMeshXY -c /artifact_top/alloy-apps/build-applrts_sc3/run_sendrecv_pad -o "-w 0 -r 1 -n 8 -c 8 -f 1024 -s 8 -p 21" --vcs-per-vnet 64 --buffers-per-data-vc 65536 --buffers-per-ctrl-vc 1024 > logs/log52.txt &
+nohup /artifact_top/alloy-gem5/build/RISCV_MP/gem5.opt --stats-file=stats53.txt --debug-flags=DOMEM,DOACC --listener-mode=off /artifact_top/alloy-gem5/configs/brg/sc3.py --msg-size PUT_NT:64 --cpu-type TimingSimpleCPU --link-latency 20 --CG_link_latency 150 --garnet-deadlock-threshold 100000 --l2_size 16384kB --l2_assoc 8 --num-dirs 8 --brg-fast-forward --num-cpus 64 --network garnet2.0 --buffer-size 0 --mem-size 4GB --ruby --l1d_size 64kB --mem-type SimpleMemory --num-l1-cache-ports 8 --num-l2caches 8 --ports 16 --l1i_size 64kB --topology TwoMeshXY -c /artifact_top/alloy-apps/build-applrts_sc3/run_sendrecv_pad -o "-w 0 -r 1 -n 8 -c 8 -f 1024 -s 8 -p 21" --vcs-per-vnet 64 --buffers-per-data-vc 65536 --buffers-per-ctrl-vc 1024 > logs/log53.txt &
+nohup /artifact_top/alloy-gem5/build/RISCV_MP/gem5.opt --stats-file=stats54.txt --debug-flags=DOMEM,DOACC --listener-mode=off /artifact_top/alloy-gem5/configs/brg/sc3.py --msg-size PUT_NT:64 --cpu-type TimingSimpleCPU --link-latency 20 --CG_link_latency 50 --garnet-deadlock-threshold 100000 --l2_size 16384kB --l2_assoc 8 --num-dirs 8 --brg-fast-forward --num-cpus 64 --network garnet2.0 --buffer-size 0 --mem-size 4GB --ruby --l1d_size 64kB --mem-type SimpleMemory --num-l1-cache-ports 8 --num-l2caches 8 --ports 16 --l1i_size 64kB --topology TwoMeshXY -c /artifact_top/alloy-apps/build-applrts_sc3/run_sendrecv_pad -o "-w 0 -r 1 -n 8 -c 8 -f 1024 -s 8 -p 21" --vcs-per-vnet 64 --buffers-per-data-vc 65536 --buffers-per-ctrl-vc 1024 > logs/log54.txt &
 # store granularity, synchronization granularity=4KB, -n 2
 # recompile PUT_NT = 8B
 nohup /artifact_top/alloy-gem5/build/RISCV_DO_MESI/gem5.opt --stats-file=stats55.txt --debug-flags=DOMEM,DOACC --listener-mode=off /artifact_top/alloy-gem5/configs/brg/sc3.py --cpu-type TimingSimpleCPU --link-latency 20 --CG_link_latency 150 --garnet-deadlock-threshold 100000 --l2_size 16384kB --l2_assoc 8 --num-dirs 8 --brg-fast-forward --num-cpus 64 --network garnet2.0 --buffer-size 0 --mem-size 4GB --ruby --l1d_size 64kB --mem-type SimpleMemory --num-l1-cache-ports 8 --num-l2caches 8 --ports 16 --l1i_size 64kB --topology TwoMeshXY -c /artifact_top/alloy-apps/build-applrts_sc3/run_sendrecv_pad -o "-w 0 -r 1 -n 2 -c 8 -f 1024 -s 1 -p 21" --vcs-per-vnet 64 --buffers-per-data-vc 65536 --buffers-per-ctrl-vc 1024 > logs/log55.txt &
@@ -84,32 +84,32 @@ nohup /artifact_top/alloy-gem5/build/RISCV_WT_MESI/gem5.opt --stats-file=stats58
 nohup /artifact_top/alloy-gem5/build/RISCV_MP/gem5.opt --stats-file=stats59.txt --debug-flags=DOMEM,DOACC --listener-mode=off /artifact_top/alloy-gem5/configs/brg/sc3.py --cpu-type TimingSimpleCPU --link-latency 20 --CG_link_latency 150 --garnet-deadlock-threshold 100000 --l2_size 16384kB --l2_assoc 8 --num-dirs 8 --brg-fast-forward --num-cpus 64 --network garnet2.0 --buffer-size 0 --mem-size 4GB --ruby --l1d_size 64kB --mem-type SimpleMemory --num-l1-cache-ports 8 --num-l2caches 8 --ports 16 --l1i_size 64kB --topology TwoMeshXY -c /artifact_top/alloy-apps/build-applrts_sc3/run_sendrecv_pad -o "-w 0 -r 1 -n 2 -c 8 -f 1024 -s 1 -p 21" --vcs-per-vnet 64 --buffers-per-data-vc 65536 --buffers-per-ctrl-vc 1024 > logs/log59.txt &
 nohup /artifact_top/alloy-gem5/build/RISCV_MP/gem5.opt --stats-file=stats60.txt --debug-flags=DOMEM,DOACC --listener-mode=off /artifact_top/alloy-gem5/configs/brg/sc3.py --cpu-type TimingSimpleCPU --link-latency 20 --CG_link_latency 50 --garnet-deadlock-threshold 100000 --l2_size 16384kB --l2_assoc 8 --num-dirs 8 --brg-fast-forward --num-cpus 64 --network garnet2.0 --buffer-size 0 --mem-size 4GB --ruby --l1d_size 64kB --mem-type SimpleMemory --num-l1-cache-ports 8 --num-l2caches 8 --ports 16 --l1i_size 64kB --topology TwoMeshXY -c /artifact_top/alloy-apps/build-applrts_sc3/run_sendrecv_pad -o "-w 0 -r 1 -n 2 -c 8 -f 1024 -s 1 -p 21" --vcs-per-vnet 64 --buffers-per-data-vc 65536 --buffers-per-ctrl-vc 1024 > logs/log60.txt &
 # recompile PUT_NT = 64B
-nohup /artifact_top/alloy-gem5/build/RISCV_DO_MESI_64B/gem5.opt --stats-file=stats61.txt --debug-flags=DOMEM,DOACC --listener-mode=off /artifact_top/alloy-gem5/configs/brg/sc3.py --cpu-type TimingSimpleCPU --link-latency 20 --CG_link_latency 150 --garnet-deadlock-threshold 100000 --l2_size 16384kB --l2_assoc 8 --num-dirs 8 --brg-fast-forward --num-cpus 64 --network garnet2.0 --buffer-size 0 --mem-size 4GB --ruby --l1d_size 64kB --mem-type SimpleMemory --num-l1-cache-ports 8 --num-l2caches 8 --ports 16 --l1i_size 64kB --topology TwoMeshXY -c /artifact_top/alloy-apps/build-applrts_sc3/run_sendrecv_pad -o "-w 0 -r 1 -n 2 -c 8 -f 1024 -s 8 -p 21" --vcs-per-vnet 64 --buffers-per-data-vc 65536 --buffers-per-ctrl-vc 1024 > logs/log61.txt &
-nohup /artifact_top/alloy-gem5/build/RISCV_DO_MESI_64B/gem5.opt --stats-file=stats62.txt --debug-flags=DOMEM,DOACC --listener-mode=off /artifact_top/alloy-gem5/configs/brg/sc3.py --cpu-type TimingSimpleCPU --link-latency 20 --CG_link_latency 50 --garnet-deadlock-threshold 100000 --l2_size 16384kB --l2_assoc 8 --num-dirs 8 --brg-fast-forward --num-cpus 64 --network garnet2.0 --buffer-size 0 --mem-size 4GB --ruby --l1d_size 64kB --mem-type SimpleMemory --num-l1-cache-ports 8 --num-l2caches 8 --ports 16 --l1i_size 64kB --topology TwoMeshXY -c /artifact_top/alloy-apps/build-applrts_sc3/run_sendrecv_pad -o "-w 0 -r 1 -n 2 -c 8 -f 1024 -s 8 -p 21" --vcs-per-vnet 64 --buffers-per-data-vc 65536 --buffers-per-ctrl-vc 1024 > logs/log62.txt &
-nohup /artifact_top/alloy-gem5/build/RISCV_WT_MESI_64B/gem5.opt --stats-file=stats63.txt --debug-flags=DOMEM,DOACC --listener-mode=off /artifact_top/alloy-gem5/configs/brg/sc3.py --cpu-type TimingSimpleCPU --link-latency 20 --CG_link_latency 150 --garnet-deadlock-threshold 100000 --l2_size 16384kB --l2_assoc 8 --num-dirs 8 --brg-fast-forward --num-cpus 64 --network garnet2.0 --buffer-size 0 --mem-size 4GB --ruby --l1d_size 64kB --mem-type SimpleMemory --num-l1-cache-ports 8 --num-l2caches 8 --ports 16 --l1i_size 64kB --topology TwoMeshXY -c /artifact_top/alloy-apps/build-applrts_sc3/run_sendrecv_pad -o "-w 0 -r 1 -n 2 -c 8 -f 1024 -s 8 -p 21" --vcs-per-vnet 64 --buffers-per-data-vc 65536 --buffers-per-ctrl-vc 1024 > logs/log63.txt &
-nohup /artifact_top/alloy-gem5/build/RISCV_WT_MESI_64B/gem5.opt --stats-file=stats64.txt --debug-flags=DOMEM,DOACC --listener-mode=off /artifact_top/alloy-gem5/configs/brg/sc3.py --cpu-type TimingSimpleCPU --link-latency 20 --CG_link_latency 50 --garnet-deadlock-threshold 100000 --l2_size 16384kB --l2_assoc 8 --num-dirs 8 --brg-fast-forward --num-cpus 64 --network garnet2.0 --buffer-size 0 --mem-size 4GB --ruby --l1d_size 64kB --mem-type SimpleMemory --num-l1-cache-ports 8 --num-l2caches 8 --ports 16 --l1i_size 64kB --topology TwoMeshXY -c /artifact_top/alloy-apps/build-applrts_sc3/run_sendrecv_pad -o "-w 0 -r 1 -n 2 -c 8 -f 1024 -s 8 -p 21" --vcs-per-vnet 64 --buffers-per-data-vc 65536 --buffers-per-ctrl-vc 1024 > logs/log64.txt &
-nohup /artifact_top/alloy-gem5/build/RISCV_MP_64B/gem5.opt --stats-file=stats65.txt --debug-flags=DOMEM,DOACC --listener-mode=off /artifact_top/alloy-gem5/configs/brg/sc3.py --cpu-type TimingSimpleCPU --link-latency 20 --CG_link_latency 150 --garnet-deadlock-threshold 100000 --l2_size 16384kB --l2_assoc 8 --num-dirs 8 --brg-fast-forward --num-cpus 64 --network garnet2.0 --buffer-size 0 --mem-size 4GB --ruby --l1d_size 64kB --mem-type SimpleMemory --num-l1-cache-ports 8 --num-l2caches 8 --ports 16 --l1i_size 64kB --topology TwoMeshXY -c /artifact_top/alloy-apps/build-applrts_sc3/run_sendrecv_pad -o "-w 0 -r 1 -n 2 -c 8 -f 1024 -s 8 -p 21" --vcs-per-vnet 64 --buffers-per-data-vc 65536 --buffers-per-ctrl-vc 1024 > logs/log65.txt &
-nohup /artifact_top/alloy-gem5/build/RISCV_MP_64B/gem5.opt --stats-file=stats66.txt --debug-flags=DOMEM,DOACC --listener-mode=off /artifact_top/alloy-gem5/configs/brg/sc3.py --cpu-type TimingSimpleCPU --link-latency 20 --CG_link_latency 50 --garnet-deadlock-threshold 100000 --l2_size 16384kB --l2_assoc 8 --num-dirs 8 --brg-fast-forward --num-cpus 64 --network garnet2.0 --buffer-size 0 --mem-size 4GB --ruby --l1d_size 64kB --mem-type SimpleMemory --num-l1-cache-ports 8 --num-l2caches 8 --ports 16 --l1i_size 64kB --topology TwoMeshXY -c /artifact_top/alloy-apps/build-applrts_sc3/run_sendrecv_pad -o "-w 0 -r 1 -n 2 -c 8 -f 1024 -s 8 -p 21" --vcs-per-vnet 64 --buffers-per-data-vc 65536 --buffers-per-ctrl-vc 1024 > logs/log66.txt &
+nohup /artifact_top/alloy-gem5/build/RISCV_DO_MESI/gem5.opt --stats-file=stats61.txt --debug-flags=DOMEM,DOACC --listener-mode=off /artifact_top/alloy-gem5/configs/brg/sc3.py --msg-size PUT_NT:64 --cpu-type TimingSimpleCPU --link-latency 20 --CG_link_latency 150 --garnet-deadlock-threshold 100000 --l2_size 16384kB --l2_assoc 8 --num-dirs 8 --brg-fast-forward --num-cpus 64 --network garnet2.0 --buffer-size 0 --mem-size 4GB --ruby --l1d_size 64kB --mem-type SimpleMemory --num-l1-cache-ports 8 --num-l2caches 8 --ports 16 --l1i_size 64kB --topology TwoMeshXY -c /artifact_top/alloy-apps/build-applrts_sc3/run_sendrecv_pad -o "-w 0 -r 1 -n 2 -c 8 -f 1024 -s 8 -p 21" --vcs-per-vnet 64 --buffers-per-data-vc 65536 --buffers-per-ctrl-vc 1024 > logs/log61.txt &
+nohup /artifact_top/alloy-gem5/build/RISCV_DO_MESI/gem5.opt --stats-file=stats62.txt --debug-flags=DOMEM,DOACC --listener-mode=off /artifact_top/alloy-gem5/configs/brg/sc3.py --msg-size PUT_NT:64 --cpu-type TimingSimpleCPU --link-latency 20 --CG_link_latency 50 --garnet-deadlock-threshold 100000 --l2_size 16384kB --l2_assoc 8 --num-dirs 8 --brg-fast-forward --num-cpus 64 --network garnet2.0 --buffer-size 0 --mem-size 4GB --ruby --l1d_size 64kB --mem-type SimpleMemory --num-l1-cache-ports 8 --num-l2caches 8 --ports 16 --l1i_size 64kB --topology TwoMeshXY -c /artifact_top/alloy-apps/build-applrts_sc3/run_sendrecv_pad -o "-w 0 -r 1 -n 2 -c 8 -f 1024 -s 8 -p 21" --vcs-per-vnet 64 --buffers-per-data-vc 65536 --buffers-per-ctrl-vc 1024 > logs/log62.txt &
+nohup /artifact_top/alloy-gem5/build/RISCV_WT_MESI/gem5.opt --stats-file=stats63.txt --debug-flags=DOMEM,DOACC --listener-mode=off /artifact_top/alloy-gem5/configs/brg/sc3.py --msg-size PUT_NT:64 --cpu-type TimingSimpleCPU --link-latency 20 --CG_link_latency 150 --garnet-deadlock-threshold 100000 --l2_size 16384kB --l2_assoc 8 --num-dirs 8 --brg-fast-forward --num-cpus 64 --network garnet2.0 --buffer-size 0 --mem-size 4GB --ruby --l1d_size 64kB --mem-type SimpleMemory --num-l1-cache-ports 8 --num-l2caches 8 --ports 16 --l1i_size 64kB --topology TwoMeshXY -c /artifact_top/alloy-apps/build-applrts_sc3/run_sendrecv_pad -o "-w 0 -r 1 -n 2 -c 8 -f 1024 -s 8 -p 21" --vcs-per-vnet 64 --buffers-per-data-vc 65536 --buffers-per-ctrl-vc 1024 > logs/log63.txt &
+nohup /artifact_top/alloy-gem5/build/RISCV_WT_MESI/gem5.opt --stats-file=stats64.txt --debug-flags=DOMEM,DOACC --listener-mode=off /artifact_top/alloy-gem5/configs/brg/sc3.py --msg-size PUT_NT:64 --cpu-type TimingSimpleCPU --link-latency 20 --CG_link_latency 50 --garnet-deadlock-threshold 100000 --l2_size 16384kB --l2_assoc 8 --num-dirs 8 --brg-fast-forward --num-cpus 64 --network garnet2.0 --buffer-size 0 --mem-size 4GB --ruby --l1d_size 64kB --mem-type SimpleMemory --num-l1-cache-ports 8 --num-l2caches 8 --ports 16 --l1i_size 64kB --topology TwoMeshXY -c /artifact_top/alloy-apps/build-applrts_sc3/run_sendrecv_pad -o "-w 0 -r 1 -n 2 -c 8 -f 1024 -s 8 -p 21" --vcs-per-vnet 64 --buffers-per-data-vc 65536 --buffers-per-ctrl-vc 1024 > logs/log64.txt &
+nohup /artifact_top/alloy-gem5/build/RISCV_MP/gem5.opt --stats-file=stats65.txt --debug-flags=DOMEM,DOACC --listener-mode=off /artifact_top/alloy-gem5/configs/brg/sc3.py --msg-size PUT_NT:64 --cpu-type TimingSimpleCPU --link-latency 20 --CG_link_latency 150 --garnet-deadlock-threshold 100000 --l2_size 16384kB --l2_assoc 8 --num-dirs 8 --brg-fast-forward --num-cpus 64 --network garnet2.0 --buffer-size 0 --mem-size 4GB --ruby --l1d_size 64kB --mem-type SimpleMemory --num-l1-cache-ports 8 --num-l2caches 8 --ports 16 --l1i_size 64kB --topology TwoMeshXY -c /artifact_top/alloy-apps/build-applrts_sc3/run_sendrecv_pad -o "-w 0 -r 1 -n 2 -c 8 -f 1024 -s 8 -p 21" --vcs-per-vnet 64 --buffers-per-data-vc 65536 --buffers-per-ctrl-vc 1024 > logs/log65.txt &
+nohup /artifact_top/alloy-gem5/build/RISCV_MP/gem5.opt --stats-file=stats66.txt --debug-flags=DOMEM,DOACC --listener-mode=off /artifact_top/alloy-gem5/configs/brg/sc3.py --msg-size PUT_NT:64 --cpu-type TimingSimpleCPU --link-latency 20 --CG_link_latency 50 --garnet-deadlock-threshold 100000 --l2_size 16384kB --l2_assoc 8 --num-dirs 8 --brg-fast-forward --num-cpus 64 --network garnet2.0 --buffer-size 0 --mem-size 4GB --ruby --l1d_size 64kB --mem-type SimpleMemory --num-l1-cache-ports 8 --num-l2caches 8 --ports 16 --l1i_size 64kB --topology TwoMeshXY -c /artifact_top/alloy-apps/build-applrts_sc3/run_sendrecv_pad -o "-w 0 -r 1 -n 2 -c 8 -f 1024 -s 8 -p 21" --vcs-per-vnet 64 --buffers-per-data-vc 65536 --buffers-per-ctrl-vc 1024 > logs/log66.txt &
 # recompile PUT_NT = 256B
-nohup /artifact_top/alloy-gem5/build/RISCV_DO_MESI_256B/gem5.opt --stats-file=stats67.txt --debug-flags=DOMEM,DOACC --listener-mode=off /artifact_top/alloy-gem5/configs/brg/sc3.py --cpu-type TimingSimpleCPU --link-latency 20 --CG_link_latency 150 --garnet-deadlock-threshold 100000 --l2_size 16384kB --l2_assoc 8 --num-dirs 8 --brg-fast-forward --num-cpus 64 --network garnet2.0 --buffer-size 0 --mem-size 4GB --ruby --l1d_size 64kB --mem-type SimpleMemory --num-l1-cache-ports 8 --num-l2caches 8 --ports 16 --l1i_size 64kB --topology TwoMeshXY -c /artifact_top/alloy-apps/build-applrts_sc3/run_sendrecv_pad -o "-w 0 -r 1 -n 2 -c 8 -f 1024 -s 32 -p 21" --vcs-per-vnet 64 --buffers-per-data-vc 65536 --buffers-per-ctrl-vc 1024 > logs/log67.txt &
-nohup /artifact_top/alloy-gem5/build/RISCV_DO_MESI_256B/gem5.opt --stats-file=stats68.txt --debug-flags=DOMEM,DOACC --listener-mode=off /artifact_top/alloy-gem5/configs/brg/sc3.py --cpu-type TimingSimpleCPU --link-latency 20 --CG_link_latency 50 --garnet-deadlock-threshold 100000 --l2_size 16384kB --l2_assoc 8 --num-dirs 8 --brg-fast-forward --num-cpus 64 --network garnet2.0 --buffer-size 0 --mem-size 4GB --ruby --l1d_size 64kB --mem-type SimpleMemory --num-l1-cache-ports 8 --num-l2caches 8 --ports 16 --l1i_size 64kB --topology TwoMeshXY -c /artifact_top/alloy-apps/build-applrts_sc3/run_sendrecv_pad -o "-w 0 -r 1 -n 2 -c 8 -f 1024 -s 32 -p 21" --vcs-per-vnet 64 --buffers-per-data-vc 65536 --buffers-per-ctrl-vc 1024 > logs/log68.txt &
-nohup /artifact_top/alloy-gem5/build/RISCV_WT_MESI_256B/gem5.opt --stats-file=stats69.txt --debug-flags=DOMEM,DOACC --listener-mode=off /artifact_top/alloy-gem5/configs/brg/sc3.py --cpu-type TimingSimpleCPU --link-latency 20 --CG_link_latency 150 --garnet-deadlock-threshold 100000 --l2_size 16384kB --l2_assoc 8 --num-dirs 8 --brg-fast-forward --num-cpus 64 --network garnet2.0 --buffer-size 0 --mem-size 4GB --ruby --l1d_size 64kB --mem-type SimpleMemory --num-l1-cache-ports 8 --num-l2caches 8 --ports 16 --l1i_size 64kB --topology TwoMeshXY -c /artifact_top/alloy-apps/build-applrts_sc3/run_sendrecv_pad -o "-w 0 -r 1 -n 2 -c 8 -f 1024 -s 32 -p 21" --vcs-per-vnet 64 --buffers-per-data-vc 65536 --buffers-per-ctrl-vc 1024 > logs/log69.txt &
-nohup /artifact_top/alloy-gem5/build/RISCV_WT_MESI_256B/gem5.opt --stats-file=stats70.txt --debug-flags=DOMEM,DOACC --listener-mode=off /artifact_top/alloy-gem5/configs/brg/sc3.py --cpu-type TimingSimpleCPU --link-latency 20 --CG_link_latency 50 --garnet-deadlock-threshold 100000 --l2_size 16384kB --l2_assoc 8 --num-dirs 8 --brg-fast-forward --num-cpus 64 --network garnet2.0 --buffer-size 0 --mem-size 4GB --ruby --l1d_size 64kB --mem-type SimpleMemory --num-l1-cache-ports 8 --num-l2caches 8 --ports 16 --l1i_size 64kB --topology TwoMeshXY -c /artifact_top/alloy-apps/build-applrts_sc3/run_sendrecv_pad -o "-w 0 -r 1 -n 2 -c 8 -f 1024 -s 32 -p 21" --vcs-per-vnet 64 --buffers-per-data-vc 65536 --buffers-per-ctrl-vc 1024 > logs/log70.txt &
-nohup /artifact_top/alloy-gem5/build/RISCV_MP_256B/gem5.opt --stats-file=stats71.txt --debug-flags=DOMEM,DOACC --listener-mode=off /artifact_top/alloy-gem5/configs/brg/sc3.py --cpu-type TimingSimpleCPU --link-latency 20 --CG_link_latency 150 --garnet-deadlock-threshold 100000 --l2_size 16384kB --l2_assoc 8 --num-dirs 8 --brg-fast-forward --num-cpus 64 --network garnet2.0 --buffer-size 0 --mem-size 4GB --ruby --l1d_size 64kB --mem-type SimpleMemory --num-l1-cache-ports 8 --num-l2caches 8 --ports 16 --l1i_size 64kB --topology TwoMeshXY -c /artifact_top/alloy-apps/build-applrts_sc3/run_sendrecv_pad -o "-w 0 -r 1 -n 2 -c 8 -f 1024 -s 32 -p 21" --vcs-per-vnet 64 --buffers-per-data-vc 65536 --buffers-per-ctrl-vc 1024 > logs/log71.txt &
-nohup /artifact_top/alloy-gem5/build/RISCV_MP_256B/gem5.opt --stats-file=stats72.txt --debug-flags=DOMEM,DOACC --listener-mode=off /artifact_top/alloy-gem5/configs/brg/sc3.py --cpu-type TimingSimpleCPU --link-latency 20 --CG_link_latency 50 --garnet-deadlock-threshold 100000 --l2_size 16384kB --l2_assoc 8 --num-dirs 8 --brg-fast-forward --num-cpus 64 --network garnet2.0 --buffer-size 0 --mem-size 4GB --ruby --l1d_size 64kB --mem-type SimpleMemory --num-l1-cache-ports 8 --num-l2caches 8 --ports 16 --l1i_size 64kB --topology TwoMeshXY -c /artifact_top/alloy-apps/build-applrts_sc3/run_sendrecv_pad -o "-w 0 -r 1 -n 2 -c 8 -f 1024 -s 32 -p 21" --vcs-per-vnet 64 --buffers-per-data-vc 65536 --buffers-per-ctrl-vc 1024 > logs/log72.txt &
+nohup /artifact_top/alloy-gem5/build/RISCV_DO_MESI/gem5.opt --stats-file=stats67.txt --debug-flags=DOMEM,DOACC --listener-mode=off /artifact_top/alloy-gem5/configs/brg/sc3.py --msg-size PUT_NT:256 --cpu-type TimingSimpleCPU --link-latency 20 --CG_link_latency 150 --garnet-deadlock-threshold 100000 --l2_size 16384kB --l2_assoc 8 --num-dirs 8 --brg-fast-forward --num-cpus 64 --network garnet2.0 --buffer-size 0 --mem-size 4GB --ruby --l1d_size 64kB --mem-type SimpleMemory --num-l1-cache-ports 8 --num-l2caches 8 --ports 16 --l1i_size 64kB --topology TwoMeshXY -c /artifact_top/alloy-apps/build-applrts_sc3/run_sendrecv_pad -o "-w 0 -r 1 -n 2 -c 8 -f 1024 -s 32 -p 21" --vcs-per-vnet 64 --buffers-per-data-vc 65536 --buffers-per-ctrl-vc 1024 > logs/log67.txt &
+nohup /artifact_top/alloy-gem5/build/RISCV_DO_MESI/gem5.opt --stats-file=stats68.txt --debug-flags=DOMEM,DOACC --listener-mode=off /artifact_top/alloy-gem5/configs/brg/sc3.py --msg-size PUT_NT:256 --cpu-type TimingSimpleCPU --link-latency 20 --CG_link_latency 50 --garnet-deadlock-threshold 100000 --l2_size 16384kB --l2_assoc 8 --num-dirs 8 --brg-fast-forward --num-cpus 64 --network garnet2.0 --buffer-size 0 --mem-size 4GB --ruby --l1d_size 64kB --mem-type SimpleMemory --num-l1-cache-ports 8 --num-l2caches 8 --ports 16 --l1i_size 64kB --topology TwoMeshXY -c /artifact_top/alloy-apps/build-applrts_sc3/run_sendrecv_pad -o "-w 0 -r 1 -n 2 -c 8 -f 1024 -s 32 -p 21" --vcs-per-vnet 64 --buffers-per-data-vc 65536 --buffers-per-ctrl-vc 1024 > logs/log68.txt &
+nohup /artifact_top/alloy-gem5/build/RISCV_WT_MESI/gem5.opt --stats-file=stats69.txt --debug-flags=DOMEM,DOACC --listener-mode=off /artifact_top/alloy-gem5/configs/brg/sc3.py --msg-size PUT_NT:256 --cpu-type TimingSimpleCPU --link-latency 20 --CG_link_latency 150 --garnet-deadlock-threshold 100000 --l2_size 16384kB --l2_assoc 8 --num-dirs 8 --brg-fast-forward --num-cpus 64 --network garnet2.0 --buffer-size 0 --mem-size 4GB --ruby --l1d_size 64kB --mem-type SimpleMemory --num-l1-cache-ports 8 --num-l2caches 8 --ports 16 --l1i_size 64kB --topology TwoMeshXY -c /artifact_top/alloy-apps/build-applrts_sc3/run_sendrecv_pad -o "-w 0 -r 1 -n 2 -c 8 -f 1024 -s 32 -p 21" --vcs-per-vnet 64 --buffers-per-data-vc 65536 --buffers-per-ctrl-vc 1024 > logs/log69.txt &
+nohup /artifact_top/alloy-gem5/build/RISCV_WT_MESI/gem5.opt --stats-file=stats70.txt --debug-flags=DOMEM,DOACC --listener-mode=off /artifact_top/alloy-gem5/configs/brg/sc3.py --msg-size PUT_NT:256 --cpu-type TimingSimpleCPU --link-latency 20 --CG_link_latency 50 --garnet-deadlock-threshold 100000 --l2_size 16384kB --l2_assoc 8 --num-dirs 8 --brg-fast-forward --num-cpus 64 --network garnet2.0 --buffer-size 0 --mem-size 4GB --ruby --l1d_size 64kB --mem-type SimpleMemory --num-l1-cache-ports 8 --num-l2caches 8 --ports 16 --l1i_size 64kB --topology TwoMeshXY -c /artifact_top/alloy-apps/build-applrts_sc3/run_sendrecv_pad -o "-w 0 -r 1 -n 2 -c 8 -f 1024 -s 32 -p 21" --vcs-per-vnet 64 --buffers-per-data-vc 65536 --buffers-per-ctrl-vc 1024 > logs/log70.txt &
+nohup /artifact_top/alloy-gem5/build/RISCV_MP/gem5.opt --stats-file=stats71.txt --debug-flags=DOMEM,DOACC --listener-mode=off /artifact_top/alloy-gem5/configs/brg/sc3.py --msg-size PUT_NT:256 --cpu-type TimingSimpleCPU --link-latency 20 --CG_link_latency 150 --garnet-deadlock-threshold 100000 --l2_size 16384kB --l2_assoc 8 --num-dirs 8 --brg-fast-forward --num-cpus 64 --network garnet2.0 --buffer-size 0 --mem-size 4GB --ruby --l1d_size 64kB --mem-type SimpleMemory --num-l1-cache-ports 8 --num-l2caches 8 --ports 16 --l1i_size 64kB --topology TwoMeshXY -c /artifact_top/alloy-apps/build-applrts_sc3/run_sendrecv_pad -o "-w 0 -r 1 -n 2 -c 8 -f 1024 -s 32 -p 21" --vcs-per-vnet 64 --buffers-per-data-vc 65536 --buffers-per-ctrl-vc 1024 > logs/log71.txt &
+nohup /artifact_top/alloy-gem5/build/RISCV_MP/gem5.opt --stats-file=stats72.txt --debug-flags=DOMEM,DOACC --listener-mode=off /artifact_top/alloy-gem5/configs/brg/sc3.py --msg-size PUT_NT:256 --cpu-type TimingSimpleCPU --link-latency 20 --CG_link_latency 50 --garnet-deadlock-threshold 100000 --l2_size 16384kB --l2_assoc 8 --num-dirs 8 --brg-fast-forward --num-cpus 64 --network garnet2.0 --buffer-size 0 --mem-size 4GB --ruby --l1d_size 64kB --mem-type SimpleMemory --num-l1-cache-ports 8 --num-l2caches 8 --ports 16 --l1i_size 64kB --topology TwoMeshXY -c /artifact_top/alloy-apps/build-applrts_sc3/run_sendrecv_pad -o "-w 0 -r 1 -n 2 -c 8 -f 1024 -s 32 -p 21" --vcs-per-vnet 64 --buffers-per-data-vc 65536 --buffers-per-ctrl-vc 1024 > logs/log72.txt &
 # recompile PUT_NT = 1KB
-nohup /artifact_top/alloy-gem5/build/RISCV_DO_MESI_1KB/gem5.opt --stats-file=stats73.txt --debug-flags=DOMEM,DOACC --listener-mode=off /artifact_top/alloy-gem5/configs/brg/sc3.py --cpu-type TimingSimpleCPU --link-latency 20 --CG_link_latency 150 --garnet-deadlock-threshold 100000 --l2_size 16384kB --l2_assoc 8 --num-dirs 8 --brg-fast-forward --num-cpus 64 --network garnet2.0 --buffer-size 0 --mem-size 4GB --ruby --l1d_size 64kB --mem-type SimpleMemory --num-l1-cache-ports 8 --num-l2caches 8 --ports 16 --l1i_size 64kB --topology TwoMeshXY -c /artifact_top/alloy-apps/build-applrts_sc3/run_sendrecv_pad -o "-w 0 -r 1 -n 2 -c 8 -f 1024 -s 128 -p 21" --vcs-per-vnet 64 --buffers-per-data-vc 65536 --buffers-per-ctrl-vc 1024 > logs/log73.txt &
-nohup /artifact_top/alloy-gem5/build/RISCV_DO_MESI_1KB/gem5.opt --stats-file=stats74.txt --debug-flags=DOMEM,DOACC --listener-mode=off /artifact_top/alloy-gem5/configs/brg/sc3.py --cpu-type TimingSimpleCPU --link-latency 20 --CG_link_latency 50 --garnet-deadlock-threshold 100000 --l2_size 16384kB --l2_assoc 8 --num-dirs 8 --brg-fast-forward --num-cpus 64 --network garnet2.0 --buffer-size 0 --mem-size 4GB --ruby --l1d_size 64kB --mem-type SimpleMemory --num-l1-cache-ports 8 --num-l2caches 8 --ports 16 --l1i_size 64kB --topology TwoMeshXY -c /artifact_top/alloy-apps/build-applrts_sc3/run_sendrecv_pad -o "-w 0 -r 1 -n 2 -c 8 -f 1024 -s 128 -p 21" --vcs-per-vnet 64 --buffers-per-data-vc 65536 --buffers-per-ctrl-vc 1024 > logs/log74.txt &
-nohup /artifact_top/alloy-gem5/build/RISCV_WT_MESI_1KB/gem5.opt --stats-file=stats75.txt --debug-flags=DOMEM,DOACC --listener-mode=off /artifact_top/alloy-gem5/configs/brg/sc3.py --cpu-type TimingSimpleCPU --link-latency 20 --CG_link_latency 150 --garnet-deadlock-threshold 100000 --l2_size 16384kB --l2_assoc 8 --num-dirs 8 --brg-fast-forward --num-cpus 64 --network garnet2.0 --buffer-size 0 --mem-size 4GB --ruby --l1d_size 64kB --mem-type SimpleMemory --num-l1-cache-ports 8 --num-l2caches 8 --ports 16 --l1i_size 64kB --topology TwoMeshXY -c /artifact_top/alloy-apps/build-applrts_sc3/run_sendrecv_pad -o "-w 0 -r 1 -n 2 -c 8 -f 1024 -s 128 -p 21" --vcs-per-vnet 64 --buffers-per-data-vc 65536 --buffers-per-ctrl-vc 1024 > logs/log75.txt &
-nohup /artifact_top/alloy-gem5/build/RISCV_WT_MESI_1KB/gem5.opt --stats-file=stats76.txt --debug-flags=DOMEM,DOACC --listener-mode=off /artifact_top/alloy-gem5/configs/brg/sc3.py --cpu-type TimingSimpleCPU --link-latency 20 --CG_link_latency 50 --garnet-deadlock-threshold 100000 --l2_size 16384kB --l2_assoc 8 --num-dirs 8 --brg-fast-forward --num-cpus 64 --network garnet2.0 --buffer-size 0 --mem-size 4GB --ruby --l1d_size 64kB --mem-type SimpleMemory --num-l1-cache-ports 8 --num-l2caches 8 --ports 16 --l1i_size 64kB --topology TwoMeshXY -c /artifact_top/alloy-apps/build-applrts_sc3/run_sendrecv_pad -o "-w 0 -r 1 -n 2 -c 8 -f 1024 -s 128 -p 21" --vcs-per-vnet 64 --buffers-per-data-vc 65536 --buffers-per-ctrl-vc 1024 > logs/log76.txt &
-nohup /artifact_top/alloy-gem5/build/RISCV_MP_1KB/gem5.opt --stats-file=stats77.txt --debug-flags=DOMEM,DOACC --listener-mode=off /artifact_top/alloy-gem5/configs/brg/sc3.py --cpu-type TimingSimpleCPU --link-latency 20 --CG_link_latency 150 --garnet-deadlock-threshold 100000 --l2_size 16384kB --l2_assoc 8 --num-dirs 8 --brg-fast-forward --num-cpus 64 --network garnet2.0 --buffer-size 0 --mem-size 4GB --ruby --l1d_size 64kB --mem-type SimpleMemory --num-l1-cache-ports 8 --num-l2caches 8 --ports 16 --l1i_size 64kB --topology TwoMeshXY -c /artifact_top/alloy-apps/build-applrts_sc3/run_sendrecv_pad -o "-w 0 -r 1 -n 2 -c 8 -f 1024 -s 128 -p 21" --vcs-per-vnet 64 --buffers-per-data-vc 65536 --buffers-per-ctrl-vc 1024 > logs/log77.txt &
-nohup /artifact_top/alloy-gem5/build/RISCV_MP_1KB/gem5.opt --stats-file=stats78.txt --debug-flags=DOMEM,DOACC --listener-mode=off /artifact_top/alloy-gem5/configs/brg/sc3.py --cpu-type TimingSimpleCPU --link-latency 20 --CG_link_latency 50 --garnet-deadlock-threshold 100000 --l2_size 16384kB --l2_assoc 8 --num-dirs 8 --brg-fast-forward --num-cpus 64 --network garnet2.0 --buffer-size 0 --mem-size 4GB --ruby --l1d_size 64kB --mem-type SimpleMemory --num-l1-cache-ports 8 --num-l2caches 8 --ports 16 --l1i_size 64kB --topology TwoMeshXY -c /artifact_top/alloy-apps/build-applrts_sc3/run_sendrecv_pad -o "-w 0 -r 1 -n 2 -c 8 -f 1024 -s 128 -p 21" --vcs-per-vnet 64 --buffers-per-data-vc 65536 --buffers-per-ctrl-vc 1024 > logs/log78.txt &
+nohup /artifact_top/alloy-gem5/build/RISCV_DO_MESI/gem5.opt --stats-file=stats73.txt --debug-flags=DOMEM,DOACC --listener-mode=off /artifact_top/alloy-gem5/configs/brg/sc3.py --msg-size PUT_NT:1024 --cpu-type TimingSimpleCPU --link-latency 20 --CG_link_latency 150 --garnet-deadlock-threshold 100000 --l2_size 16384kB --l2_assoc 8 --num-dirs 8 --brg-fast-forward --num-cpus 64 --network garnet2.0 --buffer-size 0 --mem-size 4GB --ruby --l1d_size 64kB --mem-type SimpleMemory --num-l1-cache-ports 8 --num-l2caches 8 --ports 16 --l1i_size 64kB --topology TwoMeshXY -c /artifact_top/alloy-apps/build-applrts_sc3/run_sendrecv_pad -o "-w 0 -r 1 -n 2 -c 8 -f 1024 -s 128 -p 21" --vcs-per-vnet 64 --buffers-per-data-vc 65536 --buffers-per-ctrl-vc 1024 > logs/log73.txt &
+nohup /artifact_top/alloy-gem5/build/RISCV_DO_MESI/gem5.opt --stats-file=stats74.txt --debug-flags=DOMEM,DOACC --listener-mode=off /artifact_top/alloy-gem5/configs/brg/sc3.py --msg-size PUT_NT:1024 --cpu-type TimingSimpleCPU --link-latency 20 --CG_link_latency 50 --garnet-deadlock-threshold 100000 --l2_size 16384kB --l2_assoc 8 --num-dirs 8 --brg-fast-forward --num-cpus 64 --network garnet2.0 --buffer-size 0 --mem-size 4GB --ruby --l1d_size 64kB --mem-type SimpleMemory --num-l1-cache-ports 8 --num-l2caches 8 --ports 16 --l1i_size 64kB --topology TwoMeshXY -c /artifact_top/alloy-apps/build-applrts_sc3/run_sendrecv_pad -o "-w 0 -r 1 -n 2 -c 8 -f 1024 -s 128 -p 21" --vcs-per-vnet 64 --buffers-per-data-vc 65536 --buffers-per-ctrl-vc 1024 > logs/log74.txt &
+nohup /artifact_top/alloy-gem5/build/RISCV_WT_MESI/gem5.opt --stats-file=stats75.txt --debug-flags=DOMEM,DOACC --listener-mode=off /artifact_top/alloy-gem5/configs/brg/sc3.py --msg-size PUT_NT:1024 --cpu-type TimingSimpleCPU --link-latency 20 --CG_link_latency 150 --garnet-deadlock-threshold 100000 --l2_size 16384kB --l2_assoc 8 --num-dirs 8 --brg-fast-forward --num-cpus 64 --network garnet2.0 --buffer-size 0 --mem-size 4GB --ruby --l1d_size 64kB --mem-type SimpleMemory --num-l1-cache-ports 8 --num-l2caches 8 --ports 16 --l1i_size 64kB --topology TwoMeshXY -c /artifact_top/alloy-apps/build-applrts_sc3/run_sendrecv_pad -o "-w 0 -r 1 -n 2 -c 8 -f 1024 -s 128 -p 21" --vcs-per-vnet 64 --buffers-per-data-vc 65536 --buffers-per-ctrl-vc 1024 > logs/log75.txt &
+nohup /artifact_top/alloy-gem5/build/RISCV_WT_MESI/gem5.opt --stats-file=stats76.txt --debug-flags=DOMEM,DOACC --listener-mode=off /artifact_top/alloy-gem5/configs/brg/sc3.py --msg-size PUT_NT:1024 --cpu-type TimingSimpleCPU --link-latency 20 --CG_link_latency 50 --garnet-deadlock-threshold 100000 --l2_size 16384kB --l2_assoc 8 --num-dirs 8 --brg-fast-forward --num-cpus 64 --network garnet2.0 --buffer-size 0 --mem-size 4GB --ruby --l1d_size 64kB --mem-type SimpleMemory --num-l1-cache-ports 8 --num-l2caches 8 --ports 16 --l1i_size 64kB --topology TwoMeshXY -c /artifact_top/alloy-apps/build-applrts_sc3/run_sendrecv_pad -o "-w 0 -r 1 -n 2 -c 8 -f 1024 -s 128 -p 21" --vcs-per-vnet 64 --buffers-per-data-vc 65536 --buffers-per-ctrl-vc 1024 > logs/log76.txt &
+nohup /artifact_top/alloy-gem5/build/RISCV_MP/gem5.opt --stats-file=stats77.txt --debug-flags=DOMEM,DOACC --listener-mode=off /artifact_top/alloy-gem5/configs/brg/sc3.py --msg-size PUT_NT:1024 --cpu-type TimingSimpleCPU --link-latency 20 --CG_link_latency 150 --garnet-deadlock-threshold 100000 --l2_size 16384kB --l2_assoc 8 --num-dirs 8 --brg-fast-forward --num-cpus 64 --network garnet2.0 --buffer-size 0 --mem-size 4GB --ruby --l1d_size 64kB --mem-type SimpleMemory --num-l1-cache-ports 8 --num-l2caches 8 --ports 16 --l1i_size 64kB --topology TwoMeshXY -c /artifact_top/alloy-apps/build-applrts_sc3/run_sendrecv_pad -o "-w 0 -r 1 -n 2 -c 8 -f 1024 -s 128 -p 21" --vcs-per-vnet 64 --buffers-per-data-vc 65536 --buffers-per-ctrl-vc 1024 > logs/log77.txt &
+nohup /artifact_top/alloy-gem5/build/RISCV_MP/gem5.opt --stats-file=stats78.txt --debug-flags=DOMEM,DOACC --listener-mode=off /artifact_top/alloy-gem5/configs/brg/sc3.py --msg-size PUT_NT:1024 --cpu-type TimingSimpleCPU --link-latency 20 --CG_link_latency 50 --garnet-deadlock-threshold 100000 --l2_size 16384kB --l2_assoc 8 --num-dirs 8 --brg-fast-forward --num-cpus 64 --network garnet2.0 --buffer-size 0 --mem-size 4GB --ruby --l1d_size 64kB --mem-type SimpleMemory --num-l1-cache-ports 8 --num-l2caches 8 --ports 16 --l1i_size 64kB --topology TwoMeshXY -c /artifact_top/alloy-apps/build-applrts_sc3/run_sendrecv_pad -o "-w 0 -r 1 -n 2 -c 8 -f 1024 -s 128 -p 21" --vcs-per-vnet 64 --buffers-per-data-vc 65536 --buffers-per-ctrl-vc 1024 > logs/log78.txt &
 # recompile PUT_NT = 4KB
-nohup /artifact_top/alloy-gem5/build/RISCV_DO_MESI_4KB/gem5.opt --stats-file=stats79.txt --debug-flags=DOMEM,DOACC --listener-mode=off /artifact_top/alloy-gem5/configs/brg/sc3.py --cpu-type TimingSimpleCPU --link-latency 20 --CG_link_latency 150 --garnet-deadlock-threshold 100000 --l2_size 16384kB --l2_assoc 8 --num-dirs 8 --brg-fast-forward --num-cpus 64 --network garnet2.0 --buffer-size 0 --mem-size 4GB --ruby --l1d_size 64kB --mem-type SimpleMemory --num-l1-cache-ports 8 --num-l2caches 8 --ports 16 --l1i_size 64kB --topology TwoMeshXY -c /artifact_top/alloy-apps/build-applrts_sc3/run_sendrecv_pad -o "-w 0 -r 1 -n 2 -c 8 -f 1024 -s 512 -p 21" --vcs-per-vnet 64 --buffers-per-data-vc 65536 --buffers-per-ctrl-vc 1024 > logs/log79.txt &
-nohup /artifact_top/alloy-gem5/build/RISCV_DO_MESI_4KB/gem5.opt --stats-file=stats80.txt --debug-flags=DOMEM,DOACC --listener-mode=off /artifact_top/alloy-gem5/configs/brg/sc3.py --cpu-type TimingSimpleCPU --link-latency 20 --CG_link_latency 50 --garnet-deadlock-threshold 100000 --l2_size 16384kB --l2_assoc 8 --num-dirs 8 --brg-fast-forward --num-cpus 64 --network garnet2.0 --buffer-size 0 --mem-size 4GB --ruby --l1d_size 64kB --mem-type SimpleMemory --num-l1-cache-ports 8 --num-l2caches 8 --ports 16 --l1i_size 64kB --topology TwoMeshXY -c /artifact_top/alloy-apps/build-applrts_sc3/run_sendrecv_pad -o "-w 0 -r 1 -n 2 -c 8 -f 1024 -s 512 -p 21" --vcs-per-vnet 64 --buffers-per-data-vc 65536 --buffers-per-ctrl-vc 1024 > logs/log80.txt &
-nohup /artifact_top/alloy-gem5/build/RISCV_WT_MESI_4KB/gem5.opt --stats-file=stats81.txt --debug-flags=DOMEM,DOACC --listener-mode=off /artifact_top/alloy-gem5/configs/brg/sc3.py --cpu-type TimingSimpleCPU --link-latency 20 --CG_link_latency 150 --garnet-deadlock-threshold 100000 --l2_size 16384kB --l2_assoc 8 --num-dirs 8 --brg-fast-forward --num-cpus 64 --network garnet2.0 --buffer-size 0 --mem-size 4GB --ruby --l1d_size 64kB --mem-type SimpleMemory --num-l1-cache-ports 8 --num-l2caches 8 --ports 16 --l1i_size 64kB --topology TwoMeshXY -c /artifact_top/alloy-apps/build-applrts_sc3/run_sendrecv_pad -o "-w 0 -r 1 -n 2 -c 8 -f 1024 -s 512 -p 21" --vcs-per-vnet 64 --buffers-per-data-vc 65536 --buffers-per-ctrl-vc 1024 > logs/log81.txt &
-nohup /artifact_top/alloy-gem5/build/RISCV_WT_MESI_4KB/gem5.opt --stats-file=stats82.txt --debug-flags=DOMEM,DOACC --listener-mode=off /artifact_top/alloy-gem5/configs/brg/sc3.py --cpu-type TimingSimpleCPU --link-latency 20 --CG_link_latency 50 --garnet-deadlock-threshold 100000 --l2_size 16384kB --l2_assoc 8 --num-dirs 8 --brg-fast-forward --num-cpus 64 --network garnet2.0 --buffer-size 0 --mem-size 4GB --ruby --l1d_size 64kB --mem-type SimpleMemory --num-l1-cache-ports 8 --num-l2caches 8 --ports 16 --l1i_size 64kB --topology TwoMeshXY -c /artifact_top/alloy-apps/build-applrts_sc3/run_sendrecv_pad -o "-w 0 -r 1 -n 2 -c 8 -f 1024 -s 512 -p 21" --vcs-per-vnet 64 --buffers-per-data-vc 65536 --buffers-per-ctrl-vc 1024 > logs/log82.txt &
-nohup /artifact_top/alloy-gem5/build/RISCV_MP_4KB/gem5.opt --stats-file=stats83.txt --debug-flags=DOMEM,DOACC --listener-mode=off /artifact_top/alloy-gem5/configs/brg/sc3.py --cpu-type TimingSimpleCPU --link-latency 20 --CG_link_latency 150 --garnet-deadlock-threshold 100000 --l2_size 16384kB --l2_assoc 8 --num-dirs 8 --brg-fast-forward --num-cpus 64 --network garnet2.0 --buffer-size 0 --mem-size 4GB --ruby --l1d_size 64kB --mem-type SimpleMemory --num-l1-cache-ports 8 --num-l2caches 8 --ports 16 --l1i_size 64kB --topology TwoMeshXY -c /artifact_top/alloy-apps/build-applrts_sc3/run_sendrecv_pad -o "-w 0 -r 1 -n 2 -c 8 -f 1024 -s 512 -p 21" --vcs-per-vnet 64 --buffers-per-data-vc 65536 --buffers-per-ctrl-vc 1024 > logs/log83.txt &
-nohup /artifact_top/alloy-gem5/build/RISCV_MP_4KB/gem5.opt --stats-file=stats84.txt --debug-flags=DOMEM,DOACC --listener-mode=off /artifact_top/alloy-gem5/configs/brg/sc3.py --cpu-type TimingSimpleCPU --link-latency 20 --CG_link_latency 50 --garnet-deadlock-threshold 100000 --l2_size 16384kB --l2_assoc 8 --num-dirs 8 --brg-fast-forward --num-cpus 64 --network garnet2.0 --buffer-size 0 --mem-size 4GB --ruby --l1d_size 64kB --mem-type SimpleMemory --num-l1-cache-ports 8 --num-l2caches 8 --ports 16 --l1i_size 64kB --topology TwoMeshXY -c /artifact_top/alloy-apps/build-applrts_sc3/run_sendrecv_pad -o "-w 0 -r 1 -n 2 -c 8 -f 1024 -s 512 -p 21" --vcs-per-vnet 64 --buffers-per-data-vc 65536 --buffers-per-ctrl-vc 1024 > logs/log84.txt &
+nohup /artifact_top/alloy-gem5/build/RISCV_DO_MESI/gem5.opt --stats-file=stats79.txt --debug-flags=DOMEM,DOACC --listener-mode=off /artifact_top/alloy-gem5/configs/brg/sc3.py --msg-size PUT_NT:4096 --cpu-type TimingSimpleCPU --link-latency 20 --CG_link_latency 150 --garnet-deadlock-threshold 100000 --l2_size 16384kB --l2_assoc 8 --num-dirs 8 --brg-fast-forward --num-cpus 64 --network garnet2.0 --buffer-size 0 --mem-size 4GB --ruby --l1d_size 64kB --mem-type SimpleMemory --num-l1-cache-ports 8 --num-l2caches 8 --ports 16 --l1i_size 64kB --topology TwoMeshXY -c /artifact_top/alloy-apps/build-applrts_sc3/run_sendrecv_pad -o "-w 0 -r 1 -n 2 -c 8 -f 1024 -s 512 -p 21" --vcs-per-vnet 64 --buffers-per-data-vc 65536 --buffers-per-ctrl-vc 1024 > logs/log79.txt &
+nohup /artifact_top/alloy-gem5/build/RISCV_DO_MESI/gem5.opt --stats-file=stats80.txt --debug-flags=DOMEM,DOACC --listener-mode=off /artifact_top/alloy-gem5/configs/brg/sc3.py --msg-size PUT_NT:4096 --cpu-type TimingSimpleCPU --link-latency 20 --CG_link_latency 50 --garnet-deadlock-threshold 100000 --l2_size 16384kB --l2_assoc 8 --num-dirs 8 --brg-fast-forward --num-cpus 64 --network garnet2.0 --buffer-size 0 --mem-size 4GB --ruby --l1d_size 64kB --mem-type SimpleMemory --num-l1-cache-ports 8 --num-l2caches 8 --ports 16 --l1i_size 64kB --topology TwoMeshXY -c /artifact_top/alloy-apps/build-applrts_sc3/run_sendrecv_pad -o "-w 0 -r 1 -n 2 -c 8 -f 1024 -s 512 -p 21" --vcs-per-vnet 64 --buffers-per-data-vc 65536 --buffers-per-ctrl-vc 1024 > logs/log80.txt &
+nohup /artifact_top/alloy-gem5/build/RISCV_WT_MESI/gem5.opt --stats-file=stats81.txt --debug-flags=DOMEM,DOACC --listener-mode=off /artifact_top/alloy-gem5/configs/brg/sc3.py --msg-size PUT_NT:4096 --cpu-type TimingSimpleCPU --link-latency 20 --CG_link_latency 150 --garnet-deadlock-threshold 100000 --l2_size 16384kB --l2_assoc 8 --num-dirs 8 --brg-fast-forward --num-cpus 64 --network garnet2.0 --buffer-size 0 --mem-size 4GB --ruby --l1d_size 64kB --mem-type SimpleMemory --num-l1-cache-ports 8 --num-l2caches 8 --ports 16 --l1i_size 64kB --topology TwoMeshXY -c /artifact_top/alloy-apps/build-applrts_sc3/run_sendrecv_pad -o "-w 0 -r 1 -n 2 -c 8 -f 1024 -s 512 -p 21" --vcs-per-vnet 64 --buffers-per-data-vc 65536 --buffers-per-ctrl-vc 1024 > logs/log81.txt &
+nohup /artifact_top/alloy-gem5/build/RISCV_WT_MESI/gem5.opt --stats-file=stats82.txt --debug-flags=DOMEM,DOACC --listener-mode=off /artifact_top/alloy-gem5/configs/brg/sc3.py --msg-size PUT_NT:4096 --cpu-type TimingSimpleCPU --link-latency 20 --CG_link_latency 50 --garnet-deadlock-threshold 100000 --l2_size 16384kB --l2_assoc 8 --num-dirs 8 --brg-fast-forward --num-cpus 64 --network garnet2.0 --buffer-size 0 --mem-size 4GB --ruby --l1d_size 64kB --mem-type SimpleMemory --num-l1-cache-ports 8 --num-l2caches 8 --ports 16 --l1i_size 64kB --topology TwoMeshXY -c /artifact_top/alloy-apps/build-applrts_sc3/run_sendrecv_pad -o "-w 0 -r 1 -n 2 -c 8 -f 1024 -s 512 -p 21" --vcs-per-vnet 64 --buffers-per-data-vc 65536 --buffers-per-ctrl-vc 1024 > logs/log82.txt &
+nohup /artifact_top/alloy-gem5/build/RISCV_MP/gem5.opt --stats-file=stats83.txt --debug-flags=DOMEM,DOACC --listener-mode=off /artifact_top/alloy-gem5/configs/brg/sc3.py --msg-size PUT_NT:4096 --cpu-type TimingSimpleCPU --link-latency 20 --CG_link_latency 150 --garnet-deadlock-threshold 100000 --l2_size 16384kB --l2_assoc 8 --num-dirs 8 --brg-fast-forward --num-cpus 64 --network garnet2.0 --buffer-size 0 --mem-size 4GB --ruby --l1d_size 64kB --mem-type SimpleMemory --num-l1-cache-ports 8 --num-l2caches 8 --ports 16 --l1i_size 64kB --topology TwoMeshXY -c /artifact_top/alloy-apps/build-applrts_sc3/run_sendrecv_pad -o "-w 0 -r 1 -n 2 -c 8 -f 1024 -s 512 -p 21" --vcs-per-vnet 64 --buffers-per-data-vc 65536 --buffers-per-ctrl-vc 1024 > logs/log83.txt &
+nohup /artifact_top/alloy-gem5/build/RISCV_MP/gem5.opt --stats-file=stats84.txt --debug-flags=DOMEM,DOACC --listener-mode=off /artifact_top/alloy-gem5/configs/brg/sc3.py --msg-size PUT_NT:4096 --cpu-type TimingSimpleCPU --link-latency 20 --CG_link_latency 50 --garnet-deadlock-threshold 100000 --l2_size 16384kB --l2_assoc 8 --num-dirs 8 --brg-fast-forward --num-cpus 64 --network garnet2.0 --buffer-size 0 --mem-size 4GB --ruby --l1d_size 64kB --mem-type SimpleMemory --num-l1-cache-ports 8 --num-l2caches 8 --ports 16 --l1i_size 64kB --topology TwoMeshXY -c /artifact_top/alloy-apps/build-applrts_sc3/run_sendrecv_pad -o "-w 0 -r 1 -n 2 -c 8 -f 1024 -s 512 -p 21" --vcs-per-vnet 64 --buffers-per-data-vc 65536 --buffers-per-ctrl-vc 1024 > logs/log84.txt &
 
 wait
\ No newline at end of file
@@ -39,90 +39,23 @@ make TRNS
 MAX_CORES=$(nproc)
 cd /artifact_top/alloy-gem5/
 
-# set RC sequencer
-cp src/mem/ruby/system/DOSequencerRC.py src/mem/ruby/system/DOSequencer.py
-cp src/mem/ruby/system/DOSequencerRC.hh src/mem/ruby/system/DOSequencer.hh
-cp src/mem/ruby/system/DOSequencerRC.cc src/mem/ruby/system/DOSequencer.cc
-
 # set RC WT
 cp src/mem/protocol/WT_MESI-L1cache_RC.sm src/mem/protocol/WT_MESI-L1cache.sm
 
-# 8B PUT_NT
+# PUT_NT/PUT_REL sizes are run-time options (--msg-size TYPE:bytes)
 mkdir -p build/RISCV_DO_MESI
 mkdir -p build/RISCV_WT_MESI
 mkdir -p build/RISCV_MESI
 mkdir -p build/RISCV_MP
-cp src/mem/ruby/network/Network_8B.cc src/mem/ruby/network/Network.cc
 scons build/RISCV_MP/gem5.opt --default=RISCV PROTOCOL=MP -j$MAX_CORES
 scons build/RISCV_DO_MESI/gem5.opt --default=RISCV PROTOCOL=DO_MESI -j$MAX_CORES
 scons build/RISCV_WT_MESI/gem5.opt --default=RISCV PROTOCOL=WT_MESI -j$MAX_CORES
 scons build/RISCV_MESI/gem5.opt --default=RISCV PROTOCOL=MESI -j$MAX_CORES
 
-# 64B PUT_NT
-mkdir -p build/RISCV_DO_MESI_64B
-mkdir -p build/RISCV_WT_MESI_64B
-mkdir -p build/RISCV_MP_64B
-cp src/mem/ruby/network/Network_64B.cc src/mem/ruby/network/Network.cc
-scons build/RISCV_MP_64B/gem5.opt --default=RISCV PROTOCOL=MP -j$MAX_CORES
-scons build/RISCV_DO_MESI_64B/gem5.opt --default=RISCV PROTOCOL=DO_MESI -j$MAX_CORES
-scons build/RISCV_WT_MESI_64B/gem5.opt --default=RISCV PROTOCOL=WT_MESI -j$MAX_CORES
-
-# 256B PUT_NT
-mkdir -p build/RISCV_DO_MESI_256B
-mkdir -p build/RISCV_WT_MESI_256B
-mkdir -p build/RISCV_MP_256B
-cp src/mem/ruby/network/Network_256B.cc src/mem/ruby/network/Network.cc
-scons build/RISCV_MP_256B/gem5.opt --default=RISCV PROTOCOL=MP -j$MAX_CORES
-scons build/RISCV_DO_MESI_256B/gem5.opt --default=RISCV PROTOCOL=DO_MESI -j$MAX_CORES
-scons build/RISCV_WT_MESI_256B/gem5.opt --default=RISCV PROTOCOL=WT_MESI -j$MAX_CORES
-
-# 1KB PUT_NT
-mkdir -p build/RISCV_DO_MESI_1KB
-mkdir -p build/RISCV_WT_MESI_1KB
-mkdir -p build/RISCV_MP_1KB
-cp src/mem/ruby/network/Network_1KB.cc src/mem/ruby/network/Network.cc
-scons build/RISCV_MP_1KB/gem5.opt --default=RISCV PROTOCOL=MP -j$MAX_CORES
-scons build/RISCV_DO_MESI_1KB/gem5.opt --default=RISCV PROTOCOL=DO_MESI -j$MAX_CORES
-scons build/RISCV_WT_MESI_1KB/gem5.opt --default=RISCV PROTOCOL=WT_MESI -j$MAX_CORES
-
-# 4KB PUT_NT
-mkdir -p build/RISCV_DO_MESI_4KB
-mkdir -p build/RISCV_WT_MESI_4KB
-mkdir -p build/RISCV_MP_4KB
-cp src/mem/ruby/network/Network_4KB.cc src/mem/ruby/network/Network.cc
-scons build/RISCV_MP_4KB/gem5.opt --default=RISCV PROTOCOL=MP -j$MAX_CORES
-scons build/RISCV_DO_MESI_4KB/gem5.opt --default=RISCV PROTOCOL=DO_MESI -j$MAX_CORES
-scons build/RISCV_WT_MESI_4KB/gem5.opt --default=RISCV PROTOCOL=WT_MESI -j$MAX_CORES
-
 
-# set TSO sequencer
-cp src/mem/ruby/system/DOSequencerTSO.py src/mem/ruby/system/DOSequencer.py
-cp src/mem/ruby/system/DOSequencerTSO.hh src/mem/ruby/system/DOSequencer.hh
-cp src/mem/ruby/system/DOSequencerTSO.cc src/mem/ruby/system/DOSequencer.cc
-
-# set TSO WT
+# RC/TSO/TSO_WB is a run-time option (--do-consistency-model); only
+# WT_MESI still needs a TSO build for its L1 controller
 cp src/mem/protocol/WT_MESI-L1cache_TSO.sm src/mem/protocol/WT_MESI-L1cache.sm
 
-# 8B PUT_REL
-mkdir -p build/RISCV_DO_MESI_TSO
 mkdir -p build/RISCV_WT_MESI_TSO
-mkdir -p build/RISCV_MESI_TSO
-mkdir -p build/RISCV_MP_TSO
-cp src/mem/ruby/network/Network_8B_TSO.cc src/mem/ruby/network/Network.cc
-scons build/RISCV_MP_TSO/gem5.opt --default=RISCV PROTOCOL=MP -j$MAX_CORES
-scons build/RISCV_DO_MESI_TSO/gem5.opt --default=RISCV PROTOCOL=DO_MESI -j$MAX_CORES
 scons build/RISCV_WT_MESI_TSO/gem5.opt --default=RISCV PROTOCOL=WT_MESI -j$MAX_CORES
-
-cp src/mem/ruby/system/DOSequencerTSOWB.cc src/mem/ruby/system/DOSequencer.cc
-scons build/RISCV_MESI_TSO/gem5.opt --default=RISCV PROTOCOL=MESI -j$MAX_CORES
-
-cp src/mem/ruby/system/DOSequencerTSO.cc src/mem/ruby/system/DOSequencer.cc
-
-# 64B PUT_REL
-mkdir -p build/RISCV_DO_MESI_64B_TSO
-mkdir -p build/RISCV_WT_MESI_64B_TSO
-mkdir -p build/RISCV_MP_64B_TSO
-cp src/mem/ruby/network/Network_64B_TSO.cc src/mem/ruby/network/Network.cc
-scons build/RISCV_MP_64B_TSO/gem5.opt --default=RISCV PROTOCOL=MP -j$MAX_CORES
-scons build/RISCV_DO_MESI_64B_TSO/gem5.opt --default=RISCV PROTOCOL=DO_MESI -j$MAX_CORES
-scons build/RISCV_WT_MESI_64B_TSO/gem5.opt --default=RISCV PROTOCOL=WT_MESI -j$MAX_CORES
\ No newline at end of file